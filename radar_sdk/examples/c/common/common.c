@@ -464,15 +464,13 @@ int app_start(int argc, char** argv, app_t* application, void* app_context)
     }
     else if (is_directory(data_file_path))
     {
-        fprintf(stderr, "Opening recordings is not supported in legacy API\n");
-        goto cleanup;
-        //        device_handle = ifx_avian_playback_create(data_file_path, false);
-        //        is_daq_recording = true;
-        //        if (!device_handle)
-        //        {
-        //            fprintf(stderr, "Could not open %s\n", data_file_path);
-        //            goto cleanup;
-        //        }
+        device_handle = ifx_fmcw_create_playback(data_file_path);
+        is_daq_recording = true;
+        if (!device_handle)
+        {
+            fprintf(stderr, "Could not open %s\n", data_file_path);
+            goto cleanup;
+        }
     }
     else
     {
@@ -39,9 +39,11 @@
 #include "ifxAvian_Types.hpp"
 #include <array>
 #include <bitset>
+#include <condition_variable>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -49,6 +51,9 @@
 namespace Infineon {
 namespace Avian {
 
+template <typename DATA_TYPE>
+class DataConverter;
+
 // ---------------------------------------------------------------------------- Continuous_Wave_Controller
 /*!
  * This class allows to use an Avian device in continuous wave mode. All relevant
@@ -354,6 +359,38 @@ public:
      */
     std::map<unsigned, std::vector<float>> capture_rx_signals();
 
+    /*!
+     * This method captures the signals received through the Avian device's RX
+     * antennas like \ref capture_rx_signals, but writes them directly into a
+     * buffer provided by the caller.
+     *
+     * The data reader, the receive buffers and the SPI trigger sequence are
+     * kept between calls, so that repeated captures don't allocate any
+     * memory. They are only set up again after the configuration has
+     * changed or a sensor measurement has been done.
+     *
+     * If more than one capture is requested, the captures are done back to
+     * back. The next acquisition is already triggered while the data of the
+     * previous one is being converted.
+     *
+     * This method throws an exception in the same cases as
+     * \ref capture_rx_signals, and if row_stride is less than the number of
+     * samples.
+     *
+     * \param[out] signals       The signal of the n-th enabled RX antenna
+     *                           of the c-th capture is written to
+     *                           signals + (c * N + n) * row_stride, where N is
+     *                           the number of enabled RX antennas. Each signal
+     *                           has the number of samples set through
+     *                           \ref set_number_of_samples, normalized to the
+     *                           range -1...1.
+     * \param[in]  row_stride    The distance between two signals in the
+     *                           buffer (in number of values).
+     * \param[in]  num_captures  The number of consecutive captures.
+     */
+    void capture_rx_signals(float* signals, size_t row_stride,
+                            unsigned num_captures = 1);
+
     /*!
      * This method sets the gain of the Avian device's baseband high pass
      * filter.
@@ -532,6 +569,33 @@ private:
      */
     bool go_to_active_state();
 
+    /*!
+     * This method sets up the data reader, the receive buffers and the SPI
+     * sequence to trigger an acquisition, unless this has already been done
+     * since the last configuration change.
+     */
+    void prepare_capture();
+
+    /*!
+     * This method stops the data reader. The next capture will set up
+     * everything again through \ref prepare_capture.
+     */
+    void stop_capture();
+
+    /*!
+     * This method triggers an acquisition, the received data will be stored
+     * in the given buffer.
+     */
+    void start_capture(uint16_t* raw_data);
+
+    /*!
+     * This method waits until the data of the acquisition triggered by
+     * \ref start_capture has been received and brings the Avian state
+     * machine back to the state before the acquisition. In case of an error
+     * an exception is thrown.
+     */
+    void finish_capture();
+
     HW::IControlPort& m_port;
     std::unique_ptr<Driver> m_driver;
     double m_continuous_wave_frequency;
@@ -543,6 +607,16 @@ private:
     std::bitset<4> m_rx_mask;
     uint16_t m_num_samples;
     std::array<HW::Spi_Command_t, 2> m_toggle_commands;
+
+    // Capture session, kept until the configuration changes.
+    std::unique_ptr<DataConverter<uint16_t>> m_converter;
+    std::vector<uint16_t> m_raw_data;  // two blocks, so acquisition and conversion can overlap
+    std::vector<HW::Spi_Command_t> m_capture_commands;
+    bool m_capture_prepared;
+
+    std::mutex m_capture_guard;
+    std::condition_variable m_capture_notifier;
+    bool m_data_received;
 };
 
 /* ------------------------------------------------------------------------ */
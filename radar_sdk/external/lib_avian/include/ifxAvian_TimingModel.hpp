@@ -35,6 +35,7 @@
 
 // ---------------------------------------------------------------------------- includes
 #include <cstdint>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -83,6 +84,68 @@ public:
     StateSequence(const HW::RegisterSet& registers, Device_Type device_type,
                   double ref_frequency = 80.0e6);
 
+    /**
+     * @brief This function returns the timing model of a register
+     *        configuration.
+     *
+     * The result is the same as constructing a StateSequence, but the created
+     * models are kept in a process wide cache. The cache is keyed on device
+     * type, reference frequency and those registers the timing model depends
+     * on, so a configuration that only differs in other registers (e.g. gain
+     * settings) gets the model that has already been simulated.
+     *
+     * This function is thread safe.
+     *
+     * @param[in] registers      The register configuration of the device.
+     * @param[in] device_type    The type of the Avian device.
+     * @param[in] ref_frequency  The reference clock frequency in Hz.
+     *
+     * @return The timing model of the configuration.
+     */
+    static std::shared_ptr<const StateSequence>
+    create(const HW::RegisterSet& registers, Device_Type device_type,
+           double ref_frequency = 80.0e6);
+
+    /**
+     * @brief This function returns the timing model of the current
+     *        configuration of a driver instance.
+     *
+     * See \ref create for details about caching.
+     *
+     * @param[in] driver  The driver instance holding the configuration.
+     *
+     * @return The timing model of the configuration.
+     */
+    static std::shared_ptr<const StateSequence> create(const Driver& driver);
+
+    /**
+     * @brief This function returns the timing models of many register
+     *        configurations at once.
+     *
+     * This is meant for searching a configuration space. Configurations that
+     * share the same timing relevant registers are simulated only once, and
+     * configurations that are not yet cached are simulated in parallel.
+     * See also \ref create.
+     *
+     * If the simulation of any configuration fails, the first error is
+     * thrown after all other configurations have been processed.
+     *
+     * @param[in] candidates     The register configurations to evaluate.
+     * @param[in] device_type    The type of the Avian device.
+     * @param[in] ref_frequency  The reference clock frequency in Hz.
+     *
+     * @return The timing models in the same order as the configurations.
+     */
+    static std::vector<std::shared_ptr<const StateSequence>>
+    createBatch(const std::vector<HW::RegisterSet>& candidates,
+                Device_Type device_type, double ref_frequency = 80.0e6);
+
+    /**
+     * @brief This function removes all timing models from the cache used by
+     *        \ref create and \ref createBatch.
+     */
+    static void clearCache();
+
     /**
      * @brief This function returns the total number of step in the sequence.
      *
@@ -0,0 +1,156 @@
+/**
+ * \file ifxAvian_ShadowControlPort.hpp
+ */
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+#ifndef IFX_AVIAN_SHADOW_CONTROL_PORT_H
+#define IFX_AVIAN_SHADOW_CONTROL_PORT_H
+
+// ---------------------------------------------------------------------------- includes
+#include "ifxAvian_IPort.hpp"
+#include "ifxAvian_RegisterSet.hpp"
+#include <memory>
+#include <vector>
+
+// ---------------------------------------------------------------------------- namespaces
+namespace Infineon {
+namespace Avian {
+
+// ---------------------------------------------------------------------------- ShadowControlPort
+/**
+ * This class wraps another control port and keeps a shadow copy of all
+ * register values that have been written to the Avian device through it.
+ *
+ * All calls are forwarded to the wrapped port. Each SPI write command that
+ * passes the port is recorded in the shadow register set, so the shadow
+ * always reflects the register content of the device. This allows to program
+ * a new register configuration with only those registers that actually
+ * differ from the current device state (see \ref program).
+ *
+ * The shadow is cleared when the device is reset, either by the reset
+ * sequence of the port or by a soft reset through the MAIN register. It is
+ * also cleared if sending commands to the device fails, because in that case
+ * it is unknown which commands have reached the device. The self clearing
+ * bits of the MAIN register (FRAME_START, SW_RESET, FSM_RESET, FIFO_RESET) are
+ * never stored in the shadow.
+ *
+ * \note All register writes must go through this port. If the device is
+ *       programmed in a different way, \ref invalidate must be called.
+ */
+class ShadowControlPort : public HW::IControlPort
+{
+public:
+    explicit ShadowControlPort(std::unique_ptr<HW::IControlPort> port);
+    ~ShadowControlPort() = default;
+
+    void send_commands(const HW::Spi_Command_t* commands, size_t num_words,
+                       HW::Spi_Response_t* response = nullptr) override;
+
+    void generate_reset_sequence() override;
+
+    bool read_irq_level() override;
+
+    const Properties& get_properties() const override;
+
+    /**
+     * This method returns the register values that are known to be
+     * programmed into the Avian device.
+     *
+     * \return The shadow register set.
+     */
+    const HW::RegisterSet& get_device_registers() const;
+
+    /**
+     * This method clears the shadow register set, so the next call of
+     * \ref program sends the complete register set to the device.
+     */
+    void invalidate();
+
+    /**
+     * This method checks if the register write command is known to be
+     * programmed into the Avian device already, so sending it again would not
+     * change the device state.
+     *
+     * \param[in] command_word  The SPI register write command to check.
+     *
+     * \return True if the register already holds the value of the command.
+     */
+    bool is_programmed(HW::Spi_Command_t command_word) const;
+
+    /**
+     * This method generates the SPI command sequence to bring the Avian
+     * device from its current state to the provided register configuration.
+     * Only registers that are not yet programmed or hold a different value
+     * are part of the sequence.
+     *
+     * If set_trigger_bit is true and the register set contains the MAIN
+     * register, the MAIN register is always part of the sequence, because
+     * writing the FRAME_START bit is what triggers the device. See also
+     * \ref HW::RegisterSet::get_configuration_sequence.
+     *
+     * \param[in] registers        The register configuration to be programmed.
+     * \param[in] set_trigger_bit  If this is true, the FRAME_START bit is
+     *                             also set.
+     *
+     * \return The SPI command sequence to update the Avian device.
+     */
+    std::vector<HW::Spi_Command_t>
+    get_update_sequence(const HW::RegisterSet& registers,
+                        bool set_trigger_bit) const;
+
+    /**
+     * This method programs a register configuration into the Avian device.
+     * Unlike \ref HW::RegisterSet::send_to_device only the sequence returned
+     * by \ref get_update_sequence is sent, and it is sent in a single call of
+     * \ref send_commands, so switching between two configurations costs only
+     * as many SPI words as registers differ between them.
+     *
+     * \param[in] registers        The register configuration to be programmed.
+     * \param[in] set_trigger_bit  If this is true, the FRAME_START bit is
+     *                             also set.
+     *
+     * \return The number of SPI command words that have been sent.
+     */
+    size_t program(const HW::RegisterSet& registers, bool set_trigger_bit);
+
+private:
+    void record(const HW::Spi_Command_t* commands, size_t num_words);
+
+    std::unique_ptr<HW::IControlPort> m_port;
+    HW::RegisterSet m_device_registers;
+};
+
+/* ------------------------------------------------------------------------ */
+}  // namespace Avian
+}  // namespace Infineon
+
+#endif /* IFX_AVIAN_SHADOW_CONTROL_PORT_H */
+
+/* --- End of File -------------------------------------------------------- */
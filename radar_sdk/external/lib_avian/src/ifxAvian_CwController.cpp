@@ -88,7 +88,9 @@ Continuous_Wave_Controller::Continuous_Wave_Controller(HW::IControlPort& port,
     m_tx_mask(1),
     m_rx_mask(1),
     m_num_samples(64),
-    m_toggle_commands {0}
+    m_toggle_commands {0},
+    m_capture_prepared(false),
+    m_data_received(false)
 {
     /*
      * A frame with just one chirp per frame is defined.That frame type is used
@@ -137,6 +139,9 @@ Device_Type Continuous_Wave_Controller::get_device_type() const
 // ---------------------------------------------------------------------------- enable_continuous_wave
 void Continuous_Wave_Controller::enable_continuous_wave(bool enable)
 {
+    // The capture session depends on the configuration, so it's set up again.
+    stop_capture();
+
     m_continuous_wave_enabled = enable;
     if (enable)
     {
@@ -584,47 +589,116 @@ float Continuous_Wave_Controller::get_sampling_rate() const
 // ---------------------------------------------------------------------------- capture_rx_signals
 std::map<unsigned, std::vector<float>> Continuous_Wave_Controller::capture_rx_signals()
 {
-    auto& device_traits = Device_Traits::get(m_driver->get_device_type());
+    // The signals of all enabled RX antennas are captured into one block.
+    std::vector<float> signals(m_rx_mask.count() * m_num_samples);
+    capture_rx_signals(signals.data(), m_num_samples);
+
+    // Afterwards each signal is moved into its own vector.
+    std::map<unsigned, std::vector<float>> rx_signals;
+    auto signal_begin = signals.begin();
+    for (unsigned i = 0; i < get_number_of_rx_antennas(); ++i)
+    {
+        if (!is_rx_antenna_enabled(i))
+            continue;
+
+        rx_signals.emplace(i, std::vector<float>(signal_begin,
+                                                 signal_begin + m_num_samples));
+        signal_begin += m_num_samples;
+    }
 
+    return rx_signals;
+}
+
+// ---------------------------------------------------------------------------- capture_rx_signals
+void Continuous_Wave_Controller::capture_rx_signals(float* signals,
+                                                    size_t row_stride,
+                                                    unsigned num_captures)
+{
     // First it's checked if data can be acquired.
     if (!m_continuous_wave_enabled)
         throw std::runtime_error("continuous wave is not active.");
     if (m_rx_mask == 0)
         throw std::runtime_error("No RX antenna selected.");
+    if (row_stride < m_num_samples)
+        throw std::runtime_error("Row stride is less than number of samples.");
 
-    auto read_port = dynamic_cast<HW::IReadPort<HW::Packed_Raw_Data_t>*>(&m_port);
-    if (read_port == nullptr)
-        throw std::runtime_error("The provided port does not support data acquisition.");
+    if (num_captures == 0)
+        return;
+
+    prepare_capture();
 
-    // Now a memory block is allocated to store received raw data.
-    auto num_rx_antennas = m_rx_mask.count();
-    size_t raw_block_size = m_num_samples * num_rx_antennas;
-    std::vector<uint16_t> raw_data(raw_block_size);
+    const size_t num_rx_antennas = m_rx_mask.count();
+    const size_t raw_block_size = m_num_samples * num_rx_antennas;
 
     /*
-     * Usually, the data receive callbacks is invoked in a separate thread.
-     * Therefore some synchronization objects are initialized.
+     * The two halves of the raw data buffer are used alternately. While the
+     * data of one capture is converted, the data of the next capture is
+     * already received into the other half.
      */
-    volatile bool data_received = false;
-    std::condition_variable receive_notifier;
-    std::mutex wait_guard;
+    start_capture(m_raw_data.data());
+    for (unsigned capture = 0; capture < num_captures; ++capture)
+    {
+        const uint16_t* raw_data = m_raw_data.data()
+                                   + (capture % 2) * raw_block_size;
+
+        finish_capture();
+
+        if (capture + 1 < num_captures)
+            start_capture(m_raw_data.data()
+                          + ((capture + 1) % 2) * raw_block_size);
+
+        /*
+         * Finally raw data is de-interleaved and converted to floating point
+         * numbers. Maximum 12 bit ADC Range 0...4095 is scaled to -1...1.
+         */
+        float* signal = signals + capture * num_rx_antennas * row_stride;
+        for (size_t antenna = 0; antenna < num_rx_antennas; ++antenna)
+        {
+            auto raw_pointer = raw_data + antenna;
+            for (size_t sample = 0; sample < m_num_samples; ++sample)
+            {
+                signal[sample] = *raw_pointer * (2.f / 4095.f) - 1.f;
+                raw_pointer += num_rx_antennas;
+            }
+            signal += row_stride;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------- prepare_capture
+void Continuous_Wave_Controller::prepare_capture()
+{
+    if (m_capture_prepared)
+        return;
+
+    auto& device_traits = Device_Traits::get(m_driver->get_device_type());
+
+    auto read_port = dynamic_cast<HW::IReadPort<HW::Packed_Raw_Data_t>*>(&m_port);
+    if (read_port == nullptr)
+        throw std::runtime_error("The provided port does not support data acquisition.");
+
+    // Memory to store received raw data is allocated for two captures.
+    size_t raw_block_size = m_num_samples * m_rx_mask.count();
+    m_raw_data.resize(2 * raw_block_size);
 
     /*
      * The data converter is used as a wrapper around the Avian port and takes
-     * care for data unpacking. After starting the converter and assigning a
-     * buffer to it, it is ready to receive acquired data. The callback data
-     * does nothing more than unblocking the waiting main thread.
+     * care for data unpacking. After starting the converter it is ready to
+     * receive acquired data, as soon as a buffer is assigned to it. Usually,
+     * the data receive callback is invoked in a separate thread. It does
+     * nothing more than unblocking the waiting main thread.
      */
-    DataConverter<uint16_t> converter(*read_port);
-    converter.start_reader(m_driver->get_burst_prefix(), raw_block_size,
-                           [&](uint32_t) -> void {
-                               {
-                                   std::unique_lock<std::mutex> lock(wait_guard);
-                                   data_received = true;
-                               }
-                               receive_notifier.notify_one();
-                           });
-    converter.set_buffer(raw_data.data());
+    if (!m_converter)
+        m_converter = std::make_unique<DataConverter<uint16_t>>(*read_port);
+
+    m_converter->start_reader(m_driver->get_burst_prefix(), raw_block_size,
+                              [this](uint32_t) -> void {
+                                  {
+                                      std::lock_guard<std::mutex> lock(m_capture_guard);
+                                      m_data_received = true;
+                                  }
+                                  m_capture_notifier.notify_one();
+                              });
 
     /*
      * For Avian devices without SADC the MADC input may be set to temperature
@@ -645,10 +719,10 @@ std::map<unsigned, std::vector<float>> Continuous_Wave_Controller::capture_rx_si
      * emulate certain test generator modes, that sequence is appended
      * repeatedly for the duration of acquisition.
      */
-    std::vector<HW::Spi_Command_t> spi_commands;
-    spi_commands.push_back(m_driver->get_device_configuration()[BGT60TRxxC_REG_MAIN]
-                           | BGT60TRxxC_SET(MAIN, FRAME_START, 1)
-                           | BGT60TRxxC_SET(MAIN, CW_MODE, 1));
+    m_capture_commands.clear();
+    m_capture_commands.push_back(m_driver->get_device_configuration()[BGT60TRxxC_REG_MAIN]
+                                 | BGT60TRxxC_SET(MAIN, FRAME_START, 1)
+                                 | BGT60TRxxC_SET(MAIN, CW_MODE, 1));
 
     if (m_toggle_commands[0] != 0)
     {
@@ -674,68 +748,69 @@ std::map<unsigned, std::vector<float>> Continuous_Wave_Controller::capture_rx_si
          */
         num_required_cycles = std::min<size_t>(num_required_cycles, 60);
 
-        spi_commands.reserve(2 * num_required_cycles);
+        m_capture_commands.reserve(1 + 2 * num_required_cycles);
         for (unsigned i = 0; i < num_required_cycles; ++i)
         {
-            spi_commands.insert(spi_commands.end(),
-                                m_toggle_commands.begin(),
-                                m_toggle_commands.end());
+            m_capture_commands.insert(m_capture_commands.end(),
+                                      m_toggle_commands.begin(),
+                                      m_toggle_commands.end());
         }
     }
 
-    /*
-     * After starting the ADC the execution blocks and waits for data. The
-     * receive callback handler above will unblock this thread.
-     *
-     * After data has been received calling get_frame_info brings the Avian
-     * state machine back to the point it was before the acquisition. The
-     * frame info structure can be ignored.
-     */
-    std::unique_lock<std::mutex> lock(wait_guard);
+    m_capture_prepared = true;
+}
 
-    m_port.send_commands(spi_commands.data(), spi_commands.size());
+// ---------------------------------------------------------------------------- stop_capture
+void Continuous_Wave_Controller::stop_capture()
+{
+    if (!m_capture_prepared)
+        return;
 
-    receive_notifier.wait_for(lock, std::chrono::seconds(1),
-                              [&]() { return data_received; });
+    m_capture_prepared = false;
+    m_converter->stop_reader();
+}
 
-    if (!data_received || !go_to_active_state())
+// ---------------------------------------------------------------------------- start_capture
+void Continuous_Wave_Controller::start_capture(uint16_t* raw_data)
+{
     {
-        m_port.generate_reset_sequence();
-        m_continuous_wave_enabled = false;
-        throw std::runtime_error("A hardware failure occurred.");
+        std::lock_guard<std::mutex> lock(m_capture_guard);
+        m_data_received = false;
     }
 
+    m_converter->set_buffer(raw_data);
+    m_port.send_commands(m_capture_commands.data(), m_capture_commands.size());
+}
+
+// ---------------------------------------------------------------------------- finish_capture
+void Continuous_Wave_Controller::finish_capture()
+{
     /*
-     * Finally raw data is de-interleaved and converted to floating point
-     * numbers in the range -1...1.
+     * The execution blocks and waits for data. The receive callback set up in
+     * prepare_capture will unblock this thread.
+     *
+     * After data has been received calling go_to_active_state brings the
+     * Avian state machine back to the point it was before the acquisition.
      */
-    std::map<unsigned, std::vector<float>> rx_signals;
-    unsigned start_index = 0;
-    for (unsigned i = 0; i < get_number_of_rx_antennas(); ++i)
+    bool data_received;
     {
-        if (!is_rx_antenna_enabled(i))
-            continue;
-
-        /*
-         * A read pointer is initialized to point at the first sample of the
-         * current RX antenna signal.
-         */
-        auto raw_pointer = raw_data.data() + start_index;
-        ++start_index;
+        std::unique_lock<std::mutex> lock(m_capture_guard);
+        data_received = m_capture_notifier.wait_for(lock, std::chrono::seconds(1),
+                                                    [this]() { return m_data_received; });
+    }
 
-        /*
-         * A output vector created and filled with the current RX antenna's
-         * signal. Maximum 12 bit ADC Range 0...4095 is scaled to -1...1.
-         */
-        auto& signal = rx_signals.emplace(i, m_num_samples).first->second;
-        for (auto& sample : signal)
+    if (!data_received || !go_to_active_state())
+    {
+        try
         {
-            sample = *raw_pointer * (2.f / 4095.f) - 1.f;
-            raw_pointer += num_rx_antennas;
+            stop_capture();
         }
+        catch (...)
+        {}
+        m_port.generate_reset_sequence();
+        m_continuous_wave_enabled = false;
+        throw std::runtime_error("A hardware failure occurred.");
     }
-
-    return rx_signals;
 }
 
 // ---------------------------------------------------------------------------- set_hp_gain
@@ -942,6 +1017,9 @@ bool Continuous_Wave_Controller::get_adc_double_msb_time() const
 // ---------------------------------------------------------------------------- measure_temperature
 float Continuous_Wave_Controller::measure_temperature()
 {
+    // The measurement changes the ADC input, so the capture session is ended.
+    stop_capture();
+
     Sensor_Meter meter(m_port, m_driver->get_device_type());
     if (m_continuous_wave_enabled)
         return meter.measure_temperature();
@@ -967,6 +1045,9 @@ float Continuous_Wave_Controller::measure_tx_power(unsigned antenna,
 
     if (m_continuous_wave_enabled)
     {
+        // The measurement changes the ADC input, so the capture session is ended.
+        stop_capture();
+
         /*
          * The selected power detector is enabled by setting or clearing the
          * according bit field.
@@ -0,0 +1,189 @@
+/**
+ * \file ifxAvian_ShadowControlPort.cpp
+ */
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+// ---------------------------------------------------------------------------- includes
+#include "ports/ifxAvian_ShadowControlPort.hpp"
+#include "../Driver/registers_BGT60TRxxC.h"
+
+// ---------------------------------------------------------------------------- namespaces
+namespace Infineon {
+namespace Avian {
+
+// ---------------------------------------------------------------------------- local definitions
+namespace {
+
+/*
+ * The MAIN register is located at the same address with the same layout of
+ * the lower bits in all Avian devices. These bits trigger an action and are
+ * cleared by the device itself, so they never remain set in the register.
+ */
+constexpr uint32_t self_clearing_main_bits =
+    BGT60TRxxC_MAIN_FRAME_START_msk
+    | BGT60TRxxC_MAIN_SW_RESET_msk
+    | BGT60TRxxC_MAIN_FSM_RESET_msk
+    | BGT60TRxxC_MAIN_FIFO_RESET_msk;
+
+// The burst command uses the write bit, but it does not address a register.
+constexpr uint8_t burst_address = 0x7F;
+
+constexpr HW::Spi_Command_t write_bit = 0x01000000;
+
+}  // namespace
+
+// ---------------------------------------------------------------------------- ShadowControlPort
+ShadowControlPort::ShadowControlPort(std::unique_ptr<HW::IControlPort> port) :
+    m_port(std::move(port))
+{}
+
+// ---------------------------------------------------------------------------- send_commands
+void ShadowControlPort::send_commands(const HW::Spi_Command_t* commands,
+                                      size_t num_words,
+                                      HW::Spi_Response_t* response)
+{
+    try
+    {
+        m_port->send_commands(commands, num_words, response);
+    }
+    catch (...)
+    {
+        /*
+         * It is unknown how many commands have reached the device, so the
+         * shadow can't be trusted any longer.
+         */
+        invalidate();
+        throw;
+    }
+
+    record(commands, num_words);
+}
+
+// ---------------------------------------------------------------------------- generate_reset_sequence
+void ShadowControlPort::generate_reset_sequence()
+{
+    invalidate();
+    m_port->generate_reset_sequence();
+}
+
+// ---------------------------------------------------------------------------- read_irq_level
+bool ShadowControlPort::read_irq_level()
+{
+    return m_port->read_irq_level();
+}
+
+// ---------------------------------------------------------------------------- get_properties
+const ShadowControlPort::Properties& ShadowControlPort::get_properties() const
+{
+    return m_port->get_properties();
+}
+
+// ---------------------------------------------------------------------------- get_device_registers
+const HW::RegisterSet& ShadowControlPort::get_device_registers() const
+{
+    return m_device_registers;
+}
+
+// ---------------------------------------------------------------------------- invalidate
+void ShadowControlPort::invalidate()
+{
+    m_device_registers = HW::RegisterSet();
+}
+
+// ---------------------------------------------------------------------------- is_programmed
+bool ShadowControlPort::is_programmed(HW::Spi_Command_t command_word) const
+{
+    const uint8_t address = uint8_t(command_word >> 25);
+    return m_device_registers.is_defined(address)
+           && (m_device_registers[address] == (command_word & 0x00FFFFFF));
+}
+
+// ---------------------------------------------------------------------------- get_update_sequence
+std::vector<HW::Spi_Command_t>
+ShadowControlPort::get_update_sequence(const HW::RegisterSet& registers,
+                                       bool set_trigger_bit) const
+{
+    auto update = registers.extract_update(m_device_registers);
+
+    /*
+     * Even if the MAIN register is already programmed, it must be written
+     * again to set the FRAME_START bit.
+     */
+    if (set_trigger_bit && registers.is_defined(BGT60TRxxC_REG_MAIN))
+        update.set(BGT60TRxxC_REG_MAIN, registers[BGT60TRxxC_REG_MAIN]);
+
+    return update.get_configuration_sequence(set_trigger_bit);
+}
+
+// ---------------------------------------------------------------------------- program
+size_t ShadowControlPort::program(const HW::RegisterSet& registers,
+                                  bool set_trigger_bit)
+{
+    auto sequence = get_update_sequence(registers, set_trigger_bit);
+    if (!sequence.empty())
+        send_commands(sequence.data(), sequence.size());
+    return sequence.size();
+}
+
+// ---------------------------------------------------------------------------- record
+void ShadowControlPort::record(const HW::Spi_Command_t* commands,
+                               size_t num_words)
+{
+    for (size_t i = 0; i < num_words; ++i)
+    {
+        const auto command = commands[i];
+        const uint8_t address = uint8_t(command >> 25);
+
+        // Read commands don't change the device state.
+        if (!(command & write_bit) || (address == burst_address))
+            continue;
+
+        if (address == BGT60TRxxC_REG_MAIN)
+        {
+            /*
+             * A soft reset sets all registers back to their reset values,
+             * which are not known here.
+             */
+            if (command & BGT60TRxxC_MAIN_SW_RESET_msk)
+            {
+                invalidate();
+                continue;
+            }
+            m_device_registers.set(address, command & ~self_clearing_main_bits);
+            continue;
+        }
+
+        m_device_registers.set(command);
+    }
+}
+
+// ----------------------------------------------------------------------------
+}  // namespace Avian
+}  // namespace Infineon
@@ -34,7 +34,6 @@
 #include "ModelBGT60TRxxC.hpp"
 #include <algorithm>
 #include <limits>
-#include <sstream>
 
 // ---------------------------------------------------------------------------- namespaces
 namespace Infineon {
@@ -246,13 +245,29 @@ bool ModelBGT60TRxxC::isVirtualState() const
 // ---------------------------------------------------------------------------- isStartOfShape
 bool ModelBGT60TRxxC::isStartOfShape() const
 {
-    return std::string::npos != getStateDescription().find("Start of Shape");
+    return hasTimer("Start of Shape");
 }
 
 // ---------------------------------------------------------------------------- isShapeEndDelay
 bool ModelBGT60TRxxC::isShapeEndDelay() const
 {
-    return std::string::npos != getStateDescription().find("Shape End Delay");
+    return hasTimer("Shape End Delay");
+}
+
+// ---------------------------------------------------------------------------- hasTimer
+bool ModelBGT60TRxxC::hasTimer(const char* pDescription) const
+{
+    /*
+     * This is the same check as searching the state description, but without
+     * building the description string. The fixed descriptions of the states
+     * without timers never contain the searched timer descriptions.
+     */
+    for (const auto& sTimer : m_aTimers)
+    {
+        if (sTimer.sDescription.find(pDescription) != std::string::npos)
+            return true;
+    }
+    return false;
 }
 
 // ---------------------------------------------------------------------------- getCurrentFrequency
@@ -379,12 +394,11 @@ void ModelBGT60TRxxC::insertShapeHeader(TimerList_t& aTimers)
 {
     m_eStateFsm = FsmState_e::StartOfShape;
 
-    std::stringstream sHeadLine;
-    sHeadLine << "Start of Shape Set " << (m_uShapeSetRepetition + 1)
-              << ", Shape " << (m_uShape + 1)
-              << ", Repetition " << (m_uShapeRepetition + 1);
+    std::string sHeadLine = "Start of Shape Set " + std::to_string(m_uShapeSetRepetition + 1)
+                            + ", Shape " + std::to_string(m_uShape + 1)
+                            + ", Repetition " + std::to_string(m_uShapeRepetition + 1);
 
-    aTimers.emplace_back(sHeadLine.str(), std::string(), 0,
+    aTimers.emplace_back(std::move(sHeadLine), std::string(), 0,
                          [this](TimerList_t& aTimers) -> void {
                              gotoStatePAEN(aTimers);
                          });
@@ -194,6 +194,8 @@ protected:
     void startPllPostDelay(TimerList_t& aTimers);
 
 private:
+    bool hasTimer(const char* pDescription) const;
+
     const PowerConsumptionTable& m_sPowerConsumptionTable;
     TimerList_t m_aTimers;
 
@@ -36,11 +36,22 @@
 #include "ModelBGT60TR11D.hpp"
 #include "ModelBGT60TRxxC.hpp"
 #include "ModelBGT60TRxxD.hpp"
+#include "../Driver/registers_BGT60TR11D.h"
+#include "../Driver/registers_BGT60TRxxC.h"
+#include "../Driver/registers_BGT60TRxxD.h"
+#include "../Driver/registers_BGT60TRxxE.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstring>
+#include <exception>
 #include <iomanip>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 // ---------------------------------------------------------------------------- namespaces
 namespace Infineon {
@@ -432,6 +443,254 @@ StateSequence::StateSequence(const HW::RegisterSet& registers,
     m_dActiveStateTotalDuration = (dActive + dPrefixActive) / m_dOscFrequency;
 }
 
+// ---------------------------------------------------------------------------- StateSequence cache
+namespace {
+
+using CacheKey = std::vector<uint32_t>;
+
+/*
+ * These are all registers that are read by SequenceParameters and its derived
+ * classes, covering the register layouts of all supported devices. The
+ * timing model does not depend on any other register. Whenever the parameter
+ * extraction is extended to another register, that register must be added
+ * here, otherwise the cache could return the model of a different
+ * configuration.
+ */
+const std::vector<uint8_t>& getTimingRelevantRegisters()
+{
+    static const std::vector<uint8_t> aAddresses = [] {
+        std::vector<uint8_t> aList = {BGT60TRxxC_REG_MAIN,
+                                      BGT60TRxxC_REG_ADC0,
+                                      BGT60TRxxC_REG_PACR2,
+                                      BGT60TRxxC_REG_SFCTL,
+                                      BGT60TRxxD_REG_CSCI};
+
+        // channel set, sequencer and shape registers
+        for (uint8_t uAddress = BGT60TRxxC_REG_CS1_U_0; uAddress <= BGT60TRxxC_REG_PLL4_7; ++uAddress)
+            aList.push_back(uAddress);
+
+        aList.push_back(BGT60TR11D_REG_ADC1);
+        aList.push_back(BGT60TRxxE_REG_FD);
+        aList.push_back(BGT60TR11D_REG_WU);
+        aList.push_back(BGT60TRxxD_REG_FD);
+        return aList;
+    }();
+    return aAddresses;
+}
+
+CacheKey makeCacheKey(const HW::RegisterSet& registers, Device_Type device_type,
+                      double ref_frequency)
+{
+    const auto& aAddresses = getTimingRelevantRegisters();
+
+    uint64_t uFrequencyBits;
+    static_assert(sizeof(uFrequencyBits) == sizeof(ref_frequency), "unexpected size of double");
+    std::memcpy(&uFrequencyBits, &ref_frequency, sizeof(uFrequencyBits));
+
+    CacheKey aKey;
+    aKey.reserve(aAddresses.size() + 3);
+    aKey.push_back(uint32_t(device_type));
+    aKey.push_back(uint32_t(uFrequencyBits));
+    aKey.push_back(uint32_t(uFrequencyBits >> 32));
+
+    /*
+     * Register values have only 24 bits, so an all ones word can't be a valid
+     * value and marks undefined registers. Whether a register is defined
+     * matters, because the parameter extraction stops at the first undefined
+     * shape register.
+     */
+    for (auto uAddress : aAddresses)
+        aKey.push_back(registers.is_defined(uAddress) ? registers[uAddress] : 0xFFFFFFFF);
+
+    return aKey;
+}
+
+class StateSequenceCache
+{
+public:
+    using Model = std::shared_ptr<const StateSequence>;
+
+    Model find(const CacheKey& aKey)
+    {
+        std::lock_guard<std::mutex> lock(m_xMutex);
+        auto itEntry = m_aEntries.find(aKey);
+        if (itEntry == m_aEntries.end())
+            return nullptr;
+
+        itEntry->second.uLastUse = ++m_uUseCounter;
+        return itEntry->second.pModel;
+    }
+
+    void insert(const CacheKey& aKey, Model pModel)
+    {
+        std::lock_guard<std::mutex> lock(m_xMutex);
+        if (m_aEntries.size() >= s_uCapacity)
+        {
+            // the cache is small, so a linear search for the oldest entry is fine
+            auto itOldest = m_aEntries.begin();
+            for (auto itEntry = m_aEntries.begin(); itEntry != m_aEntries.end(); ++itEntry)
+            {
+                if (itEntry->second.uLastUse < itOldest->second.uLastUse)
+                    itOldest = itEntry;
+            }
+            m_aEntries.erase(itOldest);
+        }
+        m_aEntries[aKey] = {std::move(pModel), ++m_uUseCounter};
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_xMutex);
+        m_aEntries.clear();
+    }
+
+    static StateSequenceCache& get()
+    {
+        static StateSequenceCache xInstance;
+        return xInstance;
+    }
+
+private:
+    struct Entry
+    {
+        Model pModel;
+        uint64_t uLastUse;
+    };
+
+    static constexpr size_t s_uCapacity = 256;
+
+    std::mutex m_xMutex;
+    std::map<CacheKey, Entry> m_aEntries;
+    uint64_t m_uUseCounter = 0;
+};
+
+}  // namespace
+
+// ---------------------------------------------------------------------------- create
+std::shared_ptr<const StateSequence>
+StateSequence::create(const HW::RegisterSet& registers, Device_Type device_type,
+                      double ref_frequency)
+{
+    auto& xCache = StateSequenceCache::get();
+
+    const auto aKey = makeCacheKey(registers, device_type, ref_frequency);
+    if (auto pModel = xCache.find(aKey))
+        return pModel;
+
+    auto pModel = std::make_shared<const StateSequence>(registers, device_type, ref_frequency);
+    xCache.insert(aKey, pModel);
+    return pModel;
+}
+
+// ---------------------------------------------------------------------------- create
+std::shared_ptr<const StateSequence> StateSequence::create(const Driver& driver)
+{
+    return create(driver.get_device_configuration(), driver.get_device_type(),
+                  get_ref_frequency_from_driver(driver));
+}
+
+// ---------------------------------------------------------------------------- createBatch
+std::vector<std::shared_ptr<const StateSequence>>
+StateSequence::createBatch(const std::vector<HW::RegisterSet>& candidates,
+                           Device_Type device_type, double ref_frequency)
+{
+    auto& xCache = StateSequenceCache::get();
+
+    std::vector<std::shared_ptr<const StateSequence>> aModels(candidates.size());
+
+    /*
+     * First all candidates are looked up in the cache. The remaining ones are
+     * grouped by their key, so each distinct configuration is simulated only
+     * once. The index of the first candidate of each group is remembered as
+     * the representative to be simulated.
+     */
+    std::map<CacheKey, std::vector<size_t>> aMisses;
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        auto aKey = makeCacheKey(candidates[i], device_type, ref_frequency);
+        aModels[i] = xCache.find(aKey);
+        if (!aModels[i])
+            aMisses[std::move(aKey)].push_back(i);
+    }
+
+    if (aMisses.empty())
+        return aModels;
+
+    struct Job
+    {
+        const CacheKey* pKey;
+        const std::vector<size_t>* pIndices;
+        std::shared_ptr<const StateSequence> pModel;
+        std::exception_ptr pError;
+    };
+    std::vector<Job> aJobs;
+    aJobs.reserve(aMisses.size());
+    for (const auto& xMiss : aMisses)
+        aJobs.push_back({&xMiss.first, &xMiss.second, nullptr, nullptr});
+
+    // the simulations are independent of each other, so they run in parallel
+    std::atomic<size_t> uNextJob(0);
+    auto fnWorker = [&]() {
+        for (size_t uJob = uNextJob++; uJob < aJobs.size(); uJob = uNextJob++)
+        {
+            auto& xJob = aJobs[uJob];
+            try
+            {
+                const auto& registers = candidates[xJob.pIndices->front()];
+                xJob.pModel = std::make_shared<const StateSequence>(registers, device_type, ref_frequency);
+            }
+            catch (...)
+            {
+                xJob.pError = std::current_exception();
+            }
+        }
+    };
+
+    /*
+     * Starting a thread costs about as much as simulating a simple
+     * configuration, so each thread must get a few jobs and small batches are
+     * simulated on the calling thread only. The number of threads is limited
+     * as well, because the calling application usually has other work running.
+     */
+    constexpr size_t uMinJobsPerThread = 4;
+    constexpr size_t uMaxThreads = 8;
+    const size_t uHardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t uNumThreads = std::max<size_t>(1, std::min({aJobs.size() / uMinJobsPerThread,
+                                                             uHardwareThreads, uMaxThreads}));
+    std::vector<std::thread> aThreads;
+    for (size_t i = 1; i < uNumThreads; ++i)
+        aThreads.emplace_back(fnWorker);
+    fnWorker();
+    for (auto& xThread : aThreads)
+        xThread.join();
+
+    std::exception_ptr pFirstError;
+    for (auto& xJob : aJobs)
+    {
+        if (xJob.pError)
+        {
+            if (!pFirstError)
+                pFirstError = xJob.pError;
+            continue;
+        }
+
+        xCache.insert(*xJob.pKey, xJob.pModel);
+        for (auto uIndex : *xJob.pIndices)
+            aModels[uIndex] = xJob.pModel;
+    }
+
+    if (pFirstError)
+        std::rethrow_exception(pFirstError);
+
+    return aModels;
+}
+
+// ---------------------------------------------------------------------------- clearCache
+void StateSequence::clearCache()
+{
+    StateSequenceCache::get().clear();
+}
+
 // ---------------------------------------------------------------------------- getNumStates
 size_t StateSequence::getNumStates() const
 {
@@ -0,0 +1,3 @@
+
+# Catch2 is only needed for the integration tests
+find_package(Catch2 QUIET)
@@ -0,0 +1,3 @@
+
+# GoogleTest is not part of contrib, it has to be installed (or found via CMAKE_PREFIX_PATH)
+find_package(GTest REQUIRED)
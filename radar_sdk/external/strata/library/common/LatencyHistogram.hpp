@@ -0,0 +1,107 @@
+/**
+ * @copyright 2018 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+
+/// \brief Lock-free histogram of latencies with logarithmic buckets
+///
+/// \details Bucket 0 counts latencies below 1 us, bucket i counts latencies in
+///  the range [2^(i-1), 2^i) us, the last bucket also counts all larger values.
+///  Recording only consists of a few relaxed atomic operations, so a histogram
+///  can stay enabled in the data path.
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t bucketCount = 24;
+
+    struct Snapshot
+    {
+        uint64_t count;
+        uint64_t sumUs;
+        uint64_t maxUs;
+        uint64_t buckets[bucketCount];
+    };
+
+    LatencyHistogram()
+    {
+        reset();
+    }
+
+    void record(std::chrono::steady_clock::duration latency)
+    {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+        recordMicroseconds((us > 0) ? static_cast<uint64_t>(us) : 0);
+    }
+
+    void recordSince(std::chrono::steady_clock::time_point start)
+    {
+        record(std::chrono::steady_clock::now() - start);
+    }
+
+    void recordMicroseconds(uint64_t us)
+    {
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sumUs.fetch_add(us, std::memory_order_relaxed);
+        m_buckets[bucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+
+        auto max = m_maxUs.load(std::memory_order_relaxed);
+        while ((us > max) && !m_maxUs.compare_exchange_weak(max, us, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /// \brief Copy the current values
+    /// \details The values are read one after the other while recording may
+    ///  continue, so the sum of the buckets can differ slightly from count.
+    void getSnapshot(Snapshot &snapshot) const
+    {
+        snapshot.count = m_count.load(std::memory_order_relaxed);
+        snapshot.sumUs = m_sumUs.load(std::memory_order_relaxed);
+        snapshot.maxUs = m_maxUs.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < bucketCount; i++)
+        {
+            snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    void reset()
+    {
+        m_count.store(0, std::memory_order_relaxed);
+        m_sumUs.store(0, std::memory_order_relaxed);
+        m_maxUs.store(0, std::memory_order_relaxed);
+        for (auto &bucket : m_buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    static std::size_t bucketIndex(uint64_t us)
+    {
+        std::size_t index = 0;
+        while (us && (index < bucketCount - 1))
+        {
+            us >>= 1;
+            index++;
+        }
+        return index;
+    }
+
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sumUs;
+    std::atomic<uint64_t> m_maxUs;
+    std::atomic<uint64_t> m_buckets[bucketCount];
+};
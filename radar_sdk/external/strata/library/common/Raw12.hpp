@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "Unpack12.hpp"
+
 #include <cstdint>
 
 
@@ -35,6 +37,24 @@ inline void unpackRaw12(InputIt first, InputIt last, OutputIt dest)
 }
 
 
+/**
+ * Unpack Raw12 data from a uint8_t buffer to a uint16_t buffer, using SIMD instructions if available.
+ * The data is unpacked from back to front, so dest may be the same buffer as first.
+ *
+ * @param first beginning of the packed data
+ * @param last end of the packed data
+ * @param dest beginning of unpacked data
+ */
+inline void unpackRaw12(const uint8_t *first, const uint8_t *last, uint16_t *dest)
+{
+    static const uint8_t shuffle[16] = {2, 0, 2, 1, 5, 3, 5, 4, 8, 6, 8, 7, 11, 9, 11, 10};
+
+    const auto blocks = unpack12::simdBlocks(last - first);
+    unpackRaw12<const uint8_t *, uint16_t *>(first + 12 * blocks, last, dest + 8 * blocks);
+    unpack12::unpackBlocks(first, blocks, dest, shuffle, 0xFFFF0FF0, 0x0000000F);
+}
+
+
 /**
  * Unpack Raw12 data within a buffer.
  * The buffer has to be allocated for (last - first) elements!
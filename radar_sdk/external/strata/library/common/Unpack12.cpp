@@ -0,0 +1,102 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+#include "Unpack12.hpp"
+
+#ifdef STRATA_UNPACK12_NEON
+    #include <arm_neon.h>
+#endif
+
+
+namespace
+{
+    unpack12::BlockKernel selectKernel()
+    {
+        if (unpack12::hasSsse3())
+        {
+            return unpack12::unpackBlocksSsse3;
+        }
+        if (unpack12::hasNeon())
+        {
+            return unpack12::unpackBlocksNeon;
+        }
+        return nullptr;
+    }
+
+    unpack12::BlockKernel getKernel()
+    {
+        static const unpack12::BlockKernel kernel = selectKernel();
+        return kernel;
+    }
+}
+
+
+namespace unpack12
+{
+    std::size_t simdBlocks(std::ptrdiff_t length)
+    {
+        if (!getKernel())
+        {
+            return 0;
+        }
+        return (length >= 16) ? static_cast<std::size_t>(length - 4) / 12 : 0;
+    }
+
+    void unpackBlocks(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                      const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask)
+    {
+        if (blocks)
+        {
+            getKernel()(first, blocks, dest, shuffle, maskShift, mask);
+        }
+    }
+
+#ifndef STRATA_UNPACK12_SSSE3
+    bool hasSsse3()
+    {
+        return false;
+    }
+
+    void unpackBlocksSsse3(const uint8_t * /*first*/, std::size_t /*blocks*/, uint16_t * /*dest*/,
+                           const uint8_t (&/*shuffle*/)[16], uint32_t /*maskShift*/, uint32_t /*mask*/)
+    {
+    }
+#endif
+
+#ifdef STRATA_UNPACK12_NEON
+    bool hasNeon()
+    {
+        // Advanced SIMD is mandatory on ARMv8-A
+        return true;
+    }
+
+    void unpackBlocksNeon(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                          const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask)
+    {
+        const uint8x16_t vShuffle   = vld1q_u8(shuffle);
+        const uint16x8_t vMaskShift = vreinterpretq_u16_u32(vdupq_n_u32(maskShift));
+        const uint16x8_t vMask      = vreinterpretq_u16_u32(vdupq_n_u32(mask));
+        while (blocks--)
+        {
+            const uint16x8_t v = vreinterpretq_u16_u8(vqtbl1q_u8(vld1q_u8(first + 12 * blocks), vShuffle));
+            vst1q_u16(dest + 8 * blocks, vorrq_u16(vandq_u16(vshrq_n_u16(v, 4), vMaskShift), vandq_u16(v, vMask)));
+        }
+    }
+#else
+    bool hasNeon()
+    {
+        return false;
+    }
+
+    void unpackBlocksNeon(const uint8_t * /*first*/, std::size_t /*blocks*/, uint16_t * /*dest*/,
+                          const uint8_t (&/*shuffle*/)[16], uint32_t /*maskShift*/, uint32_t /*mask*/)
+    {
+    }
+#endif
+}
@@ -0,0 +1,54 @@
+/**
+ * @copyright 2018 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * Vectorized helpers for unpacking 12-bit samples, used by Packed12.hpp and Raw12.hpp.
+ *
+ * A block consists of 12 bytes (8 samples). The two bytes containing each sample are
+ * moved into its 16-bit lane v by a byte shuffle, the sample is then
+ * ((v >> 4) & maskShift) | (v & mask), where the masks are given for a pair of lanes.
+ * The fastest kernel supported by the CPU is selected at runtime (SSSE3 on x86, NEON on AArch64).
+ */
+namespace unpack12
+{
+    using BlockKernel = void (*)(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                                 const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask);
+
+    /**
+     * Number of blocks which can be unpacked with SIMD instructions from a buffer of length bytes.
+     * Each block reads 16 bytes, so the last 4 bytes are never the start of the last block.
+     * Returns 0 if the CPU does not support any of the kernels.
+     */
+    std::size_t simdBlocks(std::ptrdiff_t length);
+
+    /**
+     * Unpack blocks from first to dest, starting with the last block.
+     * Since each block is read before it is written, and an unpacked block never overlaps
+     * the packed data of a preceding block, this also works in place (dest aliasing first).
+     * Must only be called with a number of blocks returned by simdBlocks().
+     */
+    void unpackBlocks(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                      const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask);
+
+    // The kernels are only exposed separately for comparison and verification.
+    // They must only be called if the matching has...() function returns true.
+    bool hasSsse3();
+    void unpackBlocksSsse3(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                           const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask);
+
+    bool hasNeon();
+    void unpackBlocksNeon(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                          const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask);
+}
@@ -0,0 +1,49 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+// This file is compiled with SSSE3 code generation enabled,
+// the kernel is only called after unpack12::hasSsse3() confirmed CPU support.
+
+#include "Unpack12.hpp"
+
+#include <tmmintrin.h>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+
+namespace unpack12
+{
+    bool hasSsse3()
+    {
+#ifdef _MSC_VER
+        int regs[4];
+        __cpuid(regs, 1);
+        return (regs[2] & (1 << 9)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3");
+#endif
+    }
+
+    void unpackBlocksSsse3(const uint8_t *first, std::size_t blocks, uint16_t *dest,
+                           const uint8_t (&shuffle)[16], uint32_t maskShift, uint32_t mask)
+    {
+        const __m128i vShuffle   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(shuffle));
+        const __m128i vMaskShift = _mm_set1_epi32(static_cast<int>(maskShift));
+        const __m128i vMask      = _mm_set1_epi32(static_cast<int>(mask));
+        while (blocks--)
+        {
+            const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(first + 12 * blocks)), vShuffle);
+            const __m128i s = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 4), vMaskShift), _mm_and_si128(v, vMask));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8 * blocks), s);
+        }
+    }
+}
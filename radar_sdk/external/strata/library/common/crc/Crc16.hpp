@@ -11,8 +11,6 @@
 
 #include <cstdint>
 
-#define CRC16_LUT
-
 #define CRC16_CCITT_FALSE_SEED 0xFFFF
 
 
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #define CRC32_LUT
@@ -24,6 +25,16 @@ uint32_t Crc32Ethernet(const uint16_t buf[], uint16_t len, unsigned int bits, ui
 uint32_t Crc32Mpeg2(const uint16_t buf[], uint16_t len, unsigned int bits, uint32_t crc = CRC32_MPEG2_SEED);
 uint32_t Crc32Autosar(const uint8_t buf[], uint16_t len, uint32_t crc = CRC32_AUTOSAR_SEED);
 
+/**
+* @brief Calculates the Ethernet CRC32 value (as also used by zlib) from a provided byte stream.
+* @note Uses the PCLMULQDQ or ARMv8 CRC32 instructions if the CPU supports them, slicing-by-8 lookup tables otherwise.
+* @param buf The input data to be used for the calculation
+* @param len The length of the input data in bytes
+* @param crc The initial CRC value to start with
+* @return The calculated CRC32 value (XOR-ed with 0xFFFFFFFF)
+*/
+uint32_t Crc32Ethernet(const uint8_t buf[], size_t len, uint32_t crc = CRC32_ETHERNET_SEED);
+
 /**
 * @brief Calculates a CRC32 value from a provided byte stream.
 * @param buf The input data to be used for the calculation
@@ -0,0 +1,57 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+// This file is compiled with the ARMv8 CRC extension enabled,
+// the kernel is only called after crc32HasArmv8() confirmed CPU support.
+
+#include "Crc32Kernels.hpp"
+
+#include <arm_acle.h>
+#include <cstring>
+
+#if defined(__linux__)
+    #include <sys/auxv.h>
+    #ifndef HWCAP_CRC32
+        #define HWCAP_CRC32 (1 << 7)
+    #endif
+#elif defined(_WIN32)
+    #include <windows.h>
+#endif
+
+
+bool crc32HasArmv8()
+{
+#if defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#elif defined(__APPLE__)
+    return true;  // all Apple ARM64 processors implement the CRC extension
+#elif defined(_WIN32)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#else
+    return false;
+#endif
+}
+
+uint32_t crc32ReflectedArmv8(const uint8_t buf[], size_t len, uint32_t crc)
+{
+    // the CRC32 instructions use the reflected polynomial 0x04C11DB7 without inversions
+    while (len >= 8)
+    {
+        uint64_t value;
+        std::memcpy(&value, buf, sizeof(value));
+        crc = __crc32d(crc, value);
+        buf += 8;
+        len -= 8;
+    }
+    while (len--)
+    {
+        crc = __crc32b(crc, *buf++);
+    }
+    return crc;
+}
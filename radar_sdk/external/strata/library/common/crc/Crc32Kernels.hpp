@@ -0,0 +1,29 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Implementations of the reflected CRC-32 (polynomial 0x04C11DB7, as used by Ethernet and zlib).
+// Crc32Ethernet() selects the fastest one supported by the CPU at runtime,
+// they are only exposed separately for comparison and verification.
+//
+// All kernels work on the raw CRC register, i.e. without the final inversion.
+// The hardware kernels must only be called if the matching crc32Has...() function returns true.
+
+uint32_t crc32ReflectedTable(const uint8_t buf[], size_t len, uint32_t crc);
+uint32_t crc32ReflectedSlicing8(const uint8_t buf[], size_t len, uint32_t crc);
+
+bool crc32HasPclmul();
+uint32_t crc32ReflectedPclmul(const uint8_t buf[], size_t len, uint32_t crc);
+
+bool crc32HasArmv8();
+uint32_t crc32ReflectedArmv8(const uint8_t buf[], size_t len, uint32_t crc);
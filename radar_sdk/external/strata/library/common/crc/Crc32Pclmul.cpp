@@ -0,0 +1,122 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+// This file is compiled with PCLMULQDQ and SSE4.1 code generation enabled,
+// the kernel is only called after crc32HasPclmul() confirmed CPU support.
+
+#include "Crc32Kernels.hpp"
+
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+
+namespace
+{
+    // Folding constants for the reflected polynomial 0x04C11DB7, see
+    // "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009)
+    alignas(16) const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};  // x^(4*128+32) mod P, x^(4*128-32) mod P
+    alignas(16) const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};  // x^(128+32) mod P, x^(128-32) mod P
+    alignas(16) const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};  // x^64 mod P
+    alignas(16) const uint64_t poly[] = {0x01db710641, 0x01f7011641};  // P', mu for the Barrett reduction
+
+    const size_t minimumLength = 64;
+
+    inline __m128i fold(__m128i x, __m128i k, __m128i data)
+    {
+        const __m128i low  = _mm_clmulepi64_si128(x, k, 0x00);
+        const __m128i high = _mm_clmulepi64_si128(x, k, 0x11);
+        return _mm_xor_si128(_mm_xor_si128(high, low), data);
+    }
+
+    // len must be a multiple of 16 and at least 64
+    uint32_t foldBlocks(const uint8_t *buf, size_t len, uint32_t crc)
+    {
+        __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00));
+        __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10));
+        __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20));
+        __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30));
+        x1         = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+        buf += 64;
+        len -= 64;
+
+        // fold four blocks of 128 bits in parallel
+        __m128i k = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+        while (len >= 64)
+        {
+            x1 = fold(x1, k, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00)));
+            x2 = fold(x2, k, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10)));
+            x3 = fold(x3, k, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20)));
+            x4 = fold(x4, k, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30)));
+            buf += 64;
+            len -= 64;
+        }
+
+        // fold the four blocks into one, then the remaining blocks of 128 bits into it
+        k  = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+        x1 = fold(x1, k, x2);
+        x1 = fold(x1, k, x3);
+        x1 = fold(x1, k, x4);
+        while (len >= 16)
+        {
+            x1 = fold(x1, k, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf)));
+            buf += 16;
+            len -= 16;
+        }
+
+        // reduce 128 to 64 bits
+        const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+        __m128i x0           = _mm_clmulepi64_si128(x1, k, 0x10);
+        x1                   = _mm_xor_si128(_mm_srli_si128(x1, 8), x0);
+
+        k  = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+        x0 = _mm_srli_si128(x1, 4);
+        x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x00);
+        x1 = _mm_xor_si128(x1, x0);
+
+        // Barrett reduction to 32 bits
+        k  = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+        x0 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);
+        x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k, 0x00);
+        x1 = _mm_xor_si128(x1, x0);
+
+        return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+    }
+}
+
+
+bool crc32HasPclmul()
+{
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 1);
+    const bool pclmul = (regs[2] & (1 << 1)) != 0;
+    const bool sse41  = (regs[2] & (1 << 19)) != 0;
+    return pclmul && sse41;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+uint32_t crc32ReflectedPclmul(const uint8_t buf[], size_t len, uint32_t crc)
+{
+    if (len >= minimumLength)
+    {
+        const size_t blocks = len & ~static_cast<size_t>(15);
+        crc                 = foldBlocks(buf, blocks, crc);
+        buf += blocks;
+        len -= blocks;
+    }
+    return crc32ReflectedSlicing8(buf, len, crc);
+}
@@ -17,7 +17,7 @@ uint8_t Crc8(const uint8_t buf[], uint16_t len, uint16_t polynomial, uint8_t crc
 /// Calculates the CRC-8 value according to the SMBus implementation
 ///
 /// @details A zero initialized CRC value using the generator polynomial x^8 + x^2 + x + 1 is
-/// calculated with the use of a lookup table.
+/// calculated with slicing-by-8 lookup tables.
 ///
 /// @param buf          The input data for the CRC calculation
 /// @param len          Length of the input data in bytes
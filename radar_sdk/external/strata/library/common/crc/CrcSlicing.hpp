@@ -0,0 +1,139 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Slicing-by-8 CRC calculation
+//
+// Table k holds the CRC of a byte followed by k zero bytes, so the CRC of 8 input bytes
+// is the XOR of 8 independent table lookups instead of 8 dependent ones.
+// Table 0 is the usual byte-wise lookup table, which is also used for the remaining bytes.
+
+
+template <typename CrcType>
+struct CrcSlicingTable
+{
+    CrcType table[8][256];
+};
+
+/**
+ * @brief Fills the tables for a CRC which is calculated MSB first (not reflected)
+ */
+template <typename CrcType>
+void crcInitMsbTable(CrcSlicingTable<CrcType> &t, CrcType polynomial)
+{
+    const unsigned int width = sizeof(CrcType) * 8;
+    const CrcType topBit     = static_cast<CrcType>(1u << (width - 1));
+
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        CrcType crc = static_cast<CrcType>(i << (width - 8));
+        for (int b = 0; b < 8; b++)
+        {
+            crc = (crc & topBit) ? static_cast<CrcType>((crc << 1) ^ polynomial) : static_cast<CrcType>(crc << 1);
+        }
+        t.table[0][i] = crc;
+    }
+    for (unsigned int k = 1; k < 8; k++)
+    {
+        for (unsigned int i = 0; i < 256; i++)
+        {
+            const CrcType previous = t.table[k - 1][i];
+            t.table[k][i]          = static_cast<CrcType>((previous << 8) ^ t.table[0][previous >> (width - 8)]);
+        }
+    }
+}
+
+/**
+ * @brief Fills the tables for a CRC which is calculated LSB first (reflected)
+ * @param polynomial The reflected generator polynomial (e.g. 0xEDB88320 for 0x04C11DB7)
+ */
+inline void crcInitReflectedTable(CrcSlicingTable<uint32_t> &t, uint32_t polynomial)
+{
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int b = 0; b < 8; b++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+        }
+        t.table[0][i] = crc;
+    }
+    for (unsigned int k = 1; k < 8; k++)
+    {
+        for (unsigned int i = 0; i < 256; i++)
+        {
+            const uint32_t previous = t.table[k - 1][i];
+            t.table[k][i]           = (previous >> 8) ^ t.table[0][previous & 0xFF];
+        }
+    }
+}
+
+template <typename CrcType>
+inline CrcType crcMsbByte(const CrcSlicingTable<CrcType> &t, uint8_t data, CrcType crc)
+{
+    const unsigned int width = sizeof(CrcType) * 8;
+    return static_cast<CrcType>((crc << 8) ^ t.table[0][static_cast<uint8_t>((crc >> (width - 8)) ^ data)]);
+}
+
+template <typename CrcType>
+CrcType crcMsbSlicing8(const CrcSlicingTable<CrcType> &t, const uint8_t buf[], size_t len, CrcType crc)
+{
+    const unsigned int width = sizeof(CrcType) * 8;
+
+    while (len >= 8)
+    {
+        // the current CRC is combined with the first bytes of the block
+        uint8_t b[8] = {buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf[6], buf[7]};
+        for (unsigned int i = 0; i < sizeof(CrcType); i++)
+        {
+            b[i] ^= static_cast<uint8_t>(crc >> (width - 8 - 8 * i));
+        }
+
+        crc = t.table[7][b[0]] ^ t.table[6][b[1]] ^ t.table[5][b[2]] ^ t.table[4][b[3]] ^
+              t.table[3][b[4]] ^ t.table[2][b[5]] ^ t.table[1][b[6]] ^ t.table[0][b[7]];
+
+        buf += 8;
+        len -= 8;
+    }
+
+    while (len--)
+    {
+        crc = crcMsbByte(t, *buf++, crc);
+    }
+    return crc;
+}
+
+inline uint32_t crcReflectedByte(const CrcSlicingTable<uint32_t> &t, uint8_t data, uint32_t crc)
+{
+    return (crc >> 8) ^ t.table[0][(crc ^ data) & 0xFF];
+}
+
+inline uint32_t crcReflectedSlicing8(const CrcSlicingTable<uint32_t> &t, const uint8_t buf[], size_t len, uint32_t crc)
+{
+    while (len >= 8)
+    {
+        const uint32_t low = crc ^ (buf[0] | (buf[1] << 8) | (buf[2] << 16) | (static_cast<uint32_t>(buf[3]) << 24));
+
+        crc = t.table[7][low & 0xFF] ^ t.table[6][(low >> 8) & 0xFF] ^ t.table[5][(low >> 16) & 0xFF] ^ t.table[4][low >> 24] ^
+              t.table[3][buf[4]] ^ t.table[2][buf[5]] ^ t.table[1][buf[6]] ^ t.table[0][buf[7]];
+
+        buf += 8;
+        len -= 8;
+    }
+
+    while (len--)
+    {
+        crc = crcReflectedByte(t, *buf++, crc);
+    }
+    return crc;
+}
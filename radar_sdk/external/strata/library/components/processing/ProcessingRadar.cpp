@@ -9,29 +9,975 @@
 
 #include "ProcessingRadar.hpp"
 
+#include <common/exception/ENotImplemented.hpp>
+#include <components/exception/ERadar.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+
+constexpr uint8_t ProcessingRadar::customWindow;
+constexpr uint8_t ProcessingRadar::customWindowSlots;
+
+namespace
+{
+    using Complex = std::complex<float>;
+
+    constexpr uint32_t allocationAlignment = 16;
+    constexpr uint32_t strideAlignment     = 4;
+    constexpr double pi                    = 3.14159265358979323846;
+
+    struct FormatInfo
+    {
+        uint8_t size;  // of one element in bytes
+        bool isComplex;
+        bool isSigned;
+        float scale;  // value of the least significant bit
+    };
+
+    FormatInfo getFormatInfo(uint8_t format)
+    {
+        switch (format)
+        {
+            case DataFormat_U8:
+                return {1, false, false, 1.0f / 0x80};
+            case DataFormat_S8:
+                return {1, false, true, 1.0f / 0x80};
+            case DataFormat_U16:
+                return {2, false, false, 1.0f / 0x8000};
+            case DataFormat_S16:
+            case DataFormat_Q15:
+                return {2, false, true, 1.0f / 0x8000};
+            case DataFormat_U32:
+                return {4, false, false, 1.0f / 0x80000000u};
+            case DataFormat_S32:
+            case DataFormat_Q31:
+                return {4, false, true, 1.0f / 0x80000000u};
+            case DataFormat_ComplexQ15:
+                return {4, true, true, 1.0f / 0x8000};
+            case DataFormat_ComplexQ31:
+                return {8, true, true, 1.0f / 0x80000000u};
+            default:
+                throw ERadar("Data format not supported by host processing");
+        }
+    }
+
+    uint32_t alignUp(uint32_t value, uint32_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    bool isPowerOfTwo(uint32_t value)
+    {
+        return value && !(value & (value - 1));
+    }
+
+    uint32_t nextPowerOfTwo(uint32_t value)
+    {
+        uint32_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    float loadComponent(const uint8_t *data, uint8_t size, bool isSigned)
+    {
+        switch (size)
+        {
+            case 1:
+                return isSigned ? static_cast<float>(static_cast<int8_t>(*data)) : static_cast<float>(*data);
+            case 2:
+            {
+                uint16_t value;
+                std::memcpy(&value, data, sizeof(value));
+                return isSigned ? static_cast<float>(static_cast<int16_t>(value)) : static_cast<float>(value);
+            }
+            default:
+            {
+                uint32_t value;
+                std::memcpy(&value, data, sizeof(value));
+                return isSigned ? static_cast<float>(static_cast<int32_t>(value)) : static_cast<float>(value);
+            }
+        }
+    }
+
+    template <typename T>
+    void storeSaturated(uint8_t *data, float value)
+    {
+        constexpr auto min = std::numeric_limits<T>::min();
+        constexpr auto max = std::numeric_limits<T>::max();
+
+        T result;
+        value = std::round(value);
+        if (value >= static_cast<float>(max))
+        {
+            result = max;
+        }
+        else if (value <= static_cast<float>(min))
+        {
+            result = min;
+        }
+        else
+        {
+            result = static_cast<T>(value);
+        }
+        std::memcpy(data, &result, sizeof(result));
+    }
+
+    void storeComponent(uint8_t *data, uint8_t size, bool isSigned, float value)
+    {
+        switch (size)
+        {
+            case 1:
+                isSigned ? storeSaturated<int8_t>(data, value) : storeSaturated<uint8_t>(data, value);
+                break;
+            case 2:
+                isSigned ? storeSaturated<int16_t>(data, value) : storeSaturated<uint16_t>(data, value);
+                break;
+            default:
+                isSigned ? storeSaturated<int32_t>(data, value) : storeSaturated<uint32_t>(data, value);
+                break;
+        }
+    }
+
+    /// In-place radix-2 FFT, twiddles holds exp(-2 pi i k / size) for k < size / 2
+    void fft(Complex *data, uint32_t size, const Complex *twiddles)
+    {
+        for (uint32_t i = 1, j = 0; i < size; i++)
+        {
+            uint32_t bit = size >> 1;
+            for (; j & bit; bit >>= 1)
+            {
+                j ^= bit;
+            }
+            j ^= bit;
+            if (i < j)
+            {
+                std::swap(data[i], data[j]);
+            }
+        }
+
+        for (uint32_t length = 2; length <= size; length <<= 1)
+        {
+            const uint32_t half = length / 2;
+            const uint32_t step = size / length;
+            for (uint32_t i = 0; i < size; i += length)
+            {
+                for (uint32_t k = 0; k < half; k++)
+                {
+                    const Complex w = twiddles[k * step];
+                    const Complex a = data[i + k];
+                    const Complex b = data[i + k + half];
+
+                    // written out to avoid the special handling of infinities by std::complex
+                    const float re = b.real() * w.real() - b.imag() * w.imag();
+                    const float im = b.real() * w.imag() + b.imag() * w.real();
+                    data[i + k]        = Complex(a.real() + re, a.imag() + im);
+                    data[i + k + half] = Complex(a.real() - re, a.imag() - im);
+                }
+            }
+        }
+    }
+
+    ///
+    /// Call work(begin, end) for consecutive ranges of [0, count) on up to maxThreads threads (0 = hardware threads).
+    /// cost is the approximate number of operations for one index, small workloads are done by the calling thread.
+    ///
+    void parallelFor(uint32_t count, uint32_t cost, uint32_t maxThreads, const std::function<void(uint32_t, uint32_t)> &work)
+    {
+        constexpr uint64_t minCostPerThread = 0x4000;
+
+        const uint64_t totalCost = static_cast<uint64_t>(count) * cost;
+        uint32_t numThreads      = maxThreads ? maxThreads : std::max(1u, std::thread::hardware_concurrency());
+        numThreads               = static_cast<uint32_t>(std::min<uint64_t>(numThreads, totalCost / minCostPerThread));
+        numThreads               = std::min(numThreads, count);
+        if (numThreads <= 1)
+        {
+            work(0, count);
+            return;
+        }
+
+        std::exception_ptr error;
+        std::mutex errorLock;
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+
+        auto range = [&](uint32_t thread) {
+            const auto begin = static_cast<uint32_t>(static_cast<uint64_t>(count) * thread / numThreads);
+            const auto end   = static_cast<uint32_t>(static_cast<uint64_t>(count) * (thread + 1) / numThreads);
+            try
+            {
+                work(begin, end);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorLock);
+                error = std::current_exception();
+            }
+        };
+
+        for (uint32_t thread = 1; thread < numThreads; thread++)
+        {
+            threads.emplace_back(range, thread);
+        }
+        range(0);
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    ///
+    /// Noise level estimation of the CFAR algorithms for one cell of a line
+    ///
+    class CfarWindow
+    {
+    public:
+        CfarWindow(const float *line, uint32_t length, bool extension) :
+            m_line {line},
+            m_length {length},
+            m_extension {extension}
+        {}
+
+        /// Collect count cells starting guard + 1 cells away from cell into lead (before) and lag (after)
+        void collect(uint32_t cell, uint32_t guard, uint32_t count, std::vector<float> &lead, std::vector<float> &lag) const
+        {
+            lead.clear();
+            lag.clear();
+            for (uint32_t i = guard + 1; i <= guard + count; i++)
+            {
+                if (m_extension)
+                {
+                    lead.push_back(m_line[(cell + m_length - i % m_length) % m_length]);
+                    lag.push_back(m_line[(cell + i) % m_length]);
+                }
+                else
+                {
+                    if (i <= cell)
+                    {
+                        lead.push_back(m_line[cell - i]);
+                    }
+                    if (cell + i < m_length)
+                    {
+                        lag.push_back(m_line[cell + i]);
+                    }
+                }
+            }
+        }
+
+    private:
+        const float *m_line;
+        uint32_t m_length;
+        bool m_extension;
+    };
+
+    float mean(const std::vector<float> &cells, size_t begin, size_t end)
+    {
+        float sum = 0.0f;
+        for (size_t i = begin; i < end; i++)
+        {
+            sum += cells[i];
+        }
+        return sum / static_cast<float>(end - begin);
+    }
+
+    /// Combine the estimates of both sides, if one side is empty, the other one is used
+    bool combine(uint8_t mode, bool hasLead, float lead, bool hasLag, float lag, float &noise)
+    {
+        if (!hasLead || !hasLag)
+        {
+            noise = hasLead ? lead : lag;
+            return hasLead || hasLag;
+        }
+
+        switch (mode)
+        {
+            case 1:  // greatest of
+                noise = std::max(lead, lag);
+                break;
+            case 2:  // smallest of
+                noise = std::min(lead, lag);
+                break;
+            default:  // average
+                noise = (lead + lag) / 2;
+                break;
+        }
+        return true;
+    }
+
+    bool detectCfarCa(const CfarWindow &window, const float *line, uint32_t cell, const IfxRsp_CfarCaSetting &setting,
+                      std::vector<float> &lead, std::vector<float> &lag)
+    {
+        const uint32_t count = 1u << setting.windowCellsExponent;
+        window.collect(cell, setting.guardCells, count, lead, lag);
+
+        float noise;
+        if (setting.algorithm == IfxRsp_CfarCaAlgorithm_Cash)
+        {
+            const uint32_t subWindow = std::min(1u << setting.cashSubWindowExponent, count);
+            bool found               = false;
+            for (const auto *side : {&lead, &lag})
+            {
+                for (size_t begin = 0; begin + subWindow <= side->size(); begin += subWindow)
+                {
+                    const float level = mean(*side, begin, begin + subWindow);
+                    noise             = found ? std::min(noise, level) : level;
+                    found             = true;
+                }
+            }
+            if (!found)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            static constexpr uint8_t modes[] = {0, 0, 0, 1, 2};  // indexed by IfxRsp_CfarCaAlgorithm_*
+            const bool hasLead               = !lead.empty();
+            const bool hasLag                = !lag.empty();
+            if (!combine(modes[setting.algorithm], hasLead, hasLead ? mean(lead, 0, lead.size()) : 0.0f,
+                         hasLag, hasLag ? mean(lag, 0, lag.size()) : 0.0f, noise))
+            {
+                return false;
+            }
+        }
+
+        return line[cell] > noise * (setting.betaThreshold / 256.0f);
+    }
+
+    bool detectCfarGos(const CfarWindow &window, const float *line, uint32_t cell, const IfxRsp_CfarGosSetting &setting,
+                       std::vector<float> &lead, std::vector<float> &lag)
+    {
+        window.collect(cell, setting.guardCells, setting.windowCells, lead, lag);
+
+        auto orderedStatistic = [](std::vector<float> &cells, uint8_t index) {
+            const auto k = std::min<size_t>(std::max<uint8_t>(index, 1), cells.size()) - 1;
+            std::nth_element(cells.begin(), cells.begin() + k, cells.end());
+            return cells[k];
+        };
+
+        static constexpr uint8_t modes[] = {0, 0, 1, 2};  // indexed by IfxRsp_CfarGosAlgorithm_*
+        const bool hasLead               = !lead.empty();
+        const bool hasLag                = !lag.empty();
+        float noise;
+        if (!combine(modes[setting.algorithm], hasLead, hasLead ? orderedStatistic(lead, setting.indexLead) : 0.0f,
+                     hasLag, hasLag ? orderedStatistic(lag, setting.indexLag) : 0.0f, noise))
+        {
+            return false;
+        }
+
+        return line[cell] > noise * (setting.betaThreshold / 256.0f);
+    }
+
+    bool detectLocalMax(const float *line, uint32_t length, uint32_t cell, const IfxRsp_LocalMaxSetting &setting, bool extension)
+    {
+        const auto value = line[cell];
+        if ((setting.mode != IfxRsp_LocalMaxMode_LocalMaxOnly) && !(value > static_cast<float>(setting.threshold)))
+        {
+            return false;
+        }
+        if (setting.mode == IfxRsp_LocalMaxMode_ThresholdOnly)
+        {
+            return true;
+        }
+
+        const uint32_t width = std::max<uint8_t>(setting.windowWidth, 1);
+        for (uint32_t i = 1; i <= width; i++)
+        {
+            if (extension)
+            {
+                if ((line[(cell + length - i % length) % length] >= value) || (line[(cell + i) % length] >= value))
+                {
+                    return (i % length) == 0;
+                }
+            }
+            else if (((i <= cell) && (line[cell - i] >= value)) || ((cell + i < length) && (line[cell + i] >= value)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+
+struct ProcessingRadar::Layout
+{
+    uint8_t *data;
+    uint32_t pages;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t stride;
+    FormatInfo format;
+
+    uint8_t *at(uint32_t page, uint32_t row, uint32_t col) const
+    {
+        return data + (static_cast<size_t>(page) * rows + row) * stride + static_cast<size_t>(col) * format.size;
+    }
+
+    Complex load(uint32_t page, uint32_t row, uint32_t col) const
+    {
+        const auto *element = at(page, row, col);
+        if (format.isComplex)
+        {
+            const uint8_t size = format.size / 2;
+            return {loadComponent(element, size, true) * format.scale,
+                    loadComponent(element + size, size, true) * format.scale};
+        }
+        return {loadComponent(element, format.size, format.isSigned) * format.scale, 0.0f};
+    }
+
+    void store(uint32_t page, uint32_t row, uint32_t col, Complex value, float gain) const
+    {
+        auto *element = at(page, row, col);
+        if (format.isComplex)
+        {
+            const uint8_t size = format.size / 2;
+            storeComponent(element, size, true, value.real() * gain / format.scale);
+            storeComponent(element + size, size, true, value.imag() * gain / format.scale);
+        }
+        else
+        {
+            storeComponent(element, format.size, format.isSigned, std::abs(value) * gain / format.scale);
+        }
+    }
+};
+
+
+ProcessingRadar::ProcessingRadar(uint32_t memorySize) :
+    Memory<uint32_t, uint8_t>(1),
+    m_memory(memorySize),
+    m_allocated {0},
+    m_threadCount {0}
+{
+}
+
+uint32_t ProcessingRadar::allocate(uint32_t size)
+{
+    const auto address = alignUp(m_allocated, allocationAlignment);
+    if ((address < m_allocated) || (size > m_memory.size() - std::min<size_t>(address, m_memory.size())))
+    {
+        throw ERadar("Processing memory exhausted");
+    }
+
+    m_allocated = address + size;
+    return address;
+}
+
+IMemory<uint32_t, uint8_t> *ProcessingRadar::getIMemory()
+{
+    return this;
+}
+
+void ProcessingRadar::setThreadCount(uint32_t count)
+{
+    m_threadCount = count;
+}
+
+void ProcessingRadar::checkAccess(uint32_t address, uint32_t length) const
+{
+    if ((address > m_memory.size()) || (length > m_memory.size() - address))
+    {
+        throw ERadar("Access outside of processing memory");
+    }
+}
+
+uint8_t ProcessingRadar::read(uint32_t address)
+{
+    checkAccess(address, 1);
+    return m_memory[address];
+}
+
+void ProcessingRadar::read(uint32_t address, uint32_t length, uint8_t data[])
+{
+    checkAccess(address, length);
+    std::copy_n(m_memory.data() + address, length, data);
+}
+
+void ProcessingRadar::write(uint32_t address, uint8_t value)
+{
+    checkAccess(address, 1);
+    m_memory[address] = value;
+}
+
+void ProcessingRadar::write(uint32_t address, uint32_t length, const uint8_t data[])
+{
+    checkAccess(address, length);
+    std::copy_n(data, length, m_memory.data() + address);
+}
+
+ProcessingRadar::Layout ProcessingRadar::getLayout(const IfxRsp_Signal *signal)
+{
+    if (signal == nullptr)
+    {
+        throw ERadar("No input signal");
+    }
+
+    Layout layout;
+    layout.format = getFormatInfo(signal->format);
+    layout.pages  = std::max<uint32_t>(signal->pages, 1);
+    layout.rows   = signal->rows;
+    layout.cols   = signal->cols;
+    layout.stride = signal->stride;
+    if (!layout.rows || !layout.cols || (layout.stride < layout.cols * layout.format.size))
+    {
+        throw ERadar("Invalid signal dimensions");
+    }
+
+    const uint64_t extent = static_cast<uint64_t>(layout.pages * layout.rows - 1) * layout.stride + layout.cols * layout.format.size;
+    if ((signal->baseAddress > m_memory.size()) || (extent > m_memory.size() - signal->baseAddress))
+    {
+        throw ERadar("Signal exceeds processing memory");
+    }
+
+    layout.data = m_memory.data() + signal->baseAddress;
+    return layout;
+}
+
+ProcessingRadar::Layout ProcessingRadar::createOutput(IfxRsp_Signal *output, uint16_t pages, uint16_t rows, uint16_t cols, uint8_t format)
+{
+    if (output == nullptr)
+    {
+        throw ERadar("No output signal");
+    }
+
+    const auto info   = getFormatInfo(format);
+    const auto stride = alignUp(cols * info.size, strideAlignment);
+    const auto size   = static_cast<uint64_t>(pages) * rows * stride;
+    if (size > std::numeric_limits<uint32_t>::max())
+    {
+        throw ERadar("Processing memory exhausted");
+    }
+
+    output->baseAddress = allocate(static_cast<uint32_t>(size));
+    output->size        = static_cast<uint32_t>(size);
+    output->stride      = stride;
+    output->rows        = rows;
+    output->cols        = cols;
+    output->pages       = pages;
+    output->format      = format;
+
+    return getLayout(output);
+}
+
+const std::vector<Complex> &ProcessingRadar::getTwiddles(uint32_t fftSize)
+{
+    auto &twiddles = m_twiddles[fftSize];
+    if (twiddles.empty())
+    {
+        twiddles.resize(std::max(fftSize / 2, 1u));
+        for (uint32_t k = 0; k < twiddles.size(); k++)
+        {
+            const double angle = -2.0 * pi * k / fftSize;
+            twiddles[k]        = Complex(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+        }
+    }
+    return twiddles;
+}
+
+std::vector<float> ProcessingRadar::getWindow(const IfxRsp_FftSetting *settings, uint16_t samples) const
+{
+    std::vector<float> window(samples, 1.0f);
+    if (samples == 1)
+    {
+        return window;
+    }
+
+    const double n = samples - 1;
+    switch (settings->window)
+    {
+        case 0:
+        case IfxRsp_FftWindow_NoWindow:
+            break;
+        case IfxRsp_FftWindow_Hann:
+            for (uint16_t i = 0; i < samples; i++)
+            {
+                window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2 * pi * i / n));
+            }
+            break;
+        case IfxRsp_FftWindow_Hamming:
+            for (uint16_t i = 0; i < samples; i++)
+            {
+                window[i] = static_cast<float>(0.54 - 0.46 * std::cos(2 * pi * i / n));
+            }
+            break;
+        case IfxRsp_FftWindow_BlackmanHarris:
+            for (uint16_t i = 0; i < samples; i++)
+            {
+                window[i] = static_cast<float>(0.35875 - 0.48829 * std::cos(2 * pi * i / n)
+                                               + 0.14128 * std::cos(4 * pi * i / n) - 0.01168 * std::cos(6 * pi * i / n));
+            }
+            break;
+        default:
+        {
+            if ((settings->window < customWindow) || (settings->window >= customWindow + customWindowSlots))
+            {
+                throw ERadar("Unknown FFT window");
+            }
+
+            const auto &coefficients = m_customWindows[settings->window - customWindow];
+            if (coefficients.size() < samples)
+            {
+                throw ERadar("Custom window has less coefficients than samples");
+            }
+            for (uint16_t i = 0; i < samples; i++)
+            {
+                if (settings->windowFormat == DataFormat_Q31)
+                {
+                    window[i] = static_cast<float>(static_cast<int32_t>(coefficients[i])) / 0x80000000u;
+                }
+                else
+                {
+                    window[i] = static_cast<float>(static_cast<int16_t>(coefficients[i] & 0xFFFF)) / 0x8000;
+                }
+            }
+            break;
+        }
+    }
+    return window;
+}
+
 void ProcessingRadar::configure(uint8_t /*dataSource*/, const IDataProperties_t * /*dataProperties*/, const IProcessingRadarInput_t * /*radarInfo*/,
                                 const IfxRsp_Stages * /*stages*/, const IfxRsp_AntennaCalibration * /*antennaConfig*/)
 {
+    throw ENotImplemented("Automatic processing of a data source is not available on the host");
 }
 
-void ProcessingRadar::doFft(const IfxRsp_Signal * /*input*/, const IfxRsp_FftSetting * /*settings*/, IfxRsp_Signal * /*output*/, uint16_t /*samples*/, uint16_t /*offset*/, uint8_t /*dimension*/, uint8_t /*format*/)
+void ProcessingRadar::doFft(const IfxRsp_Signal *input, const IfxRsp_FftSetting *settings, IfxRsp_Signal *output, uint16_t samples, uint16_t offset, uint8_t dimension, uint8_t format)
 {
+    const auto in = getLayout(input);
+    if (settings == nullptr)
+    {
+        throw ERadar("No FFT settings");
+    }
+    if (dimension > 1)
+    {
+        throw ERadar("Invalid FFT dimension");
+    }
+
+    // a line is a row for dimension 0, a column for dimension 1
+    const uint32_t lineLength = dimension ? in.rows : in.cols;
+    const uint32_t numLines   = dimension ? in.cols : in.rows;
+    if (offset >= lineLength)
+    {
+        throw ERadar("FFT offset exceeds signal");
+    }
+    if (samples == 0)
+    {
+        samples = static_cast<uint16_t>(lineLength - offset);
+    }
+    if (samples > lineLength - offset)
+    {
+        throw ERadar("FFT samples exceed signal");
+    }
+
+    const uint32_t fftSize = settings->size ? settings->size : nextPowerOfTwo(samples);
+    if (!isPowerOfTwo(fftSize) || (fftSize < samples) || (fftSize > 0x8000))
+    {
+        throw ERadar("Invalid FFT size");
+    }
+
+    uint32_t bins = fftSize;
+    if (settings->flags & FFT_FLAGS_DISCARD_HALF)
+    {
+        if (settings->acceptedBins)
+        {
+            throw ERadar("Accepted bins have to be 0 when discarding half of the FFT");
+        }
+        bins = std::max(fftSize / 2, 1u);
+    }
+    else if (settings->acceptedBins)
+    {
+        if (settings->acceptedBins > fftSize)
+        {
+            throw ERadar("Accepted bins exceed FFT size");
+        }
+        bins = settings->acceptedBins;
+    }
+
+    if ((format == DataFormat_Disabled) || (format == DataFormat_Auto))
+    {
+        format = DataFormat_ComplexQ31;
+    }
+    const auto outInfo   = getFormatInfo(format);
+    const auto outRows   = static_cast<uint16_t>(dimension ? bins : in.rows);
+    const auto outCols   = static_cast<uint16_t>(dimension ? in.cols : bins);
+    const auto outPages  = static_cast<uint16_t>(in.pages);
+    const float exponent = (outInfo.size / (outInfo.isComplex ? 2 : 1) == 2) ? std::ldexp(1.0f, settings->exponent) : 1.0f;
+    const float gain     = exponent / static_cast<float>(fftSize);
+
+    Layout out;
+    if (settings->flags & FFT_FLAGS_INPLACE)
+    {
+        if ((outCols * outInfo.size > in.stride) || (outRows > in.rows))
+        {
+            throw ERadar("FFT result does not fit into input signal");
+        }
+        out        = in;
+        out.rows   = outRows;
+        out.cols   = outCols;
+        out.format = outInfo;
+
+        output->baseAddress = input->baseAddress;
+        output->stride      = in.stride;
+        output->size        = outPages * outRows * in.stride;
+        output->rows        = outRows;
+        output->cols        = outCols;
+        output->pages       = outPages;
+        output->format      = format;
+    }
+    else
+    {
+        out = createOutput(output, outPages, outRows, outCols, format);
+    }
+
+    const auto window    = getWindow(settings, samples);
+    const auto &twiddles = getTwiddles(fftSize);
+
+    // All lines are transformed before the first result is stored, so that the result can overwrite the input
+    const uint32_t numUnits = in.pages * numLines;
+    m_results.resize(static_cast<size_t>(numUnits) * bins);
+
+    const uint32_t cost = fftSize * (1 + static_cast<uint32_t>(std::log2(fftSize)));
+    parallelFor(numUnits, cost, m_threadCount, [&](uint32_t begin, uint32_t end) {
+        std::vector<Complex> buffer(fftSize);
+        for (uint32_t unit = begin; unit < end; unit++)
+        {
+            const uint32_t page = unit / numLines;
+            const uint32_t line = unit % numLines;
+            for (uint32_t i = 0; i < samples; i++)
+            {
+                const auto value = dimension ? in.load(page, offset + i, line) : in.load(page, line, offset + i);
+                buffer[i]        = value * window[i];
+            }
+            std::fill(buffer.begin() + samples, buffer.end(), Complex());
+
+            fft(buffer.data(), fftSize, twiddles.data());
+            std::copy_n(buffer.begin(), bins, m_results.begin() + static_cast<size_t>(unit) * bins);
+        }
+    });
+
+    parallelFor(numUnits, bins, m_threadCount, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t unit = begin; unit < end; unit++)
+        {
+            const uint32_t page = unit / numLines;
+            const uint32_t line = unit % numLines;
+            const auto *result  = m_results.data() + static_cast<size_t>(unit) * bins;
+            for (uint32_t bin = 0; bin < bins; bin++)
+            {
+                if (dimension)
+                {
+                    out.store(page, bin, line, result[bin], gain);
+                }
+                else
+                {
+                    out.store(page, line, bin, result[bin], gain);
+                }
+            }
+        }
+    });
 }
 
-void ProcessingRadar::doNci(const IfxRsp_Signal * /*input*/, uint8_t /*format*/, IfxRsp_Signal * /*output*/)
+void ProcessingRadar::doNci(const IfxRsp_Signal *input, uint8_t format, IfxRsp_Signal *output)
 {
+    const auto in = getLayout(input);
+    if ((format == DataFormat_Disabled) || (format == DataFormat_Auto))
+    {
+        format = DataFormat_Q31;
+    }
+    if ((format != DataFormat_Q15) && (format != DataFormat_Q31))
+    {
+        throw ERadar("NCI format has to be Q15 or Q31");
+    }
+
+    const auto out   = createOutput(output, 1, static_cast<uint16_t>(in.rows), static_cast<uint16_t>(in.cols), format);
+    const float gain = 1.0f / static_cast<float>(in.pages);
+
+    parallelFor(in.rows, in.cols * in.pages, m_threadCount, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t row = begin; row < end; row++)
+        {
+            for (uint32_t col = 0; col < in.cols; col++)
+            {
+                float sum = 0.0f;
+                for (uint32_t page = 0; page < in.pages; page++)
+                {
+                    sum += std::abs(in.load(page, row, col));
+                }
+                out.store(0, row, col, sum, gain);
+            }
+        }
+    });
 }
 
-void ProcessingRadar::doThresholding(const IfxRsp_Signal * /*input*/, uint8_t /*dimension*/, const IfxRsp_ThresholdingSetting * /*settings*/, IfxRsp_Signal * /*output*/)
+void ProcessingRadar::doThresholding(const IfxRsp_Signal *input, uint8_t dimension, const IfxRsp_ThresholdingSetting *settings, IfxRsp_Signal *output)
 {
+    const auto in = getLayout(input);
+    if (settings == nullptr)
+    {
+        throw ERadar("No thresholding settings");
+    }
+    if (dimension > 1)
+    {
+        throw ERadar("Invalid thresholding dimension");
+    }
+    if ((settings->localMax.mode > IfxRsp_LocalMaxMode_Both) || (settings->cfarCa.algorithm > IfxRsp_CfarCaAlgorithm_Caso) || (settings->cfarGos.algorithm > IfxRsp_CfarGosAlgorithm_Gosso))
+    {
+        throw ERadar("Invalid thresholding mode");
+    }
+
+    const bool useLocalMax = (settings->localMax.mode != IfxRsp_LocalMaxMode_Disable);
+    const bool useCfarCa   = (settings->cfarCa.algorithm != IfxRsp_CfarCaAlgorithm_Disable);
+    const bool useCfarGos  = (settings->cfarGos.algorithm != IfxRsp_CfarGosAlgorithm_Disable);
+    if (!useLocalMax && !useCfarCa && !useCfarGos)
+    {
+        throw ERadar("No thresholding enabled");
+    }
+    if (useCfarCa && (std::max(settings->cfarCa.windowCellsExponent, settings->cfarCa.cashSubWindowExponent) > 5))
+    {
+        throw ERadar("Invalid CFAR CA window");
+    }
+
+    // the output is a bit map with one bit per cell
+    if (output == nullptr)
+    {
+        throw ERadar("No output signal");
+    }
+    const uint32_t outStride = alignUp((in.cols + 7) / 8, strideAlignment);
+    const uint32_t outSize   = in.pages * in.rows * outStride;
+    output->baseAddress      = allocate(outSize);
+    output->size             = outSize;
+    output->stride           = outStride;
+    output->rows             = static_cast<uint16_t>(in.rows);
+    output->cols             = static_cast<uint16_t>(in.cols);
+    output->pages            = static_cast<uint16_t>(in.pages);
+    output->format           = DataFormat_Bits;
+
+    const uint32_t lineLength = dimension ? in.rows : in.cols;
+    const uint32_t numLines   = dimension ? in.cols : in.rows;
+    const uint32_t numUnits   = in.pages * numLines;
+    const float lsb           = in.format.scale;
+
+    std::vector<uint8_t> detections(static_cast<size_t>(in.pages) * in.rows * in.cols);
+
+    const uint32_t cost = lineLength * (1u << 6);
+    parallelFor(numUnits, cost, m_threadCount, [&](uint32_t begin, uint32_t end) {
+        std::vector<float> line(lineLength);
+        std::vector<float> lead;
+        std::vector<float> lag;
+        for (uint32_t unit = begin; unit < end; unit++)
+        {
+            const uint32_t page = unit / numLines;
+            const uint32_t l    = unit % numLines;
+            for (uint32_t i = 0; i < lineLength; i++)
+            {
+                line[i] = std::abs(dimension ? in.load(page, i, l) : in.load(page, l, i)) / lsb;
+            }
+
+            const CfarWindow window(line.data(), lineLength, settings->spectrumExtension);
+            for (uint32_t cell = 0; cell < lineLength; cell++)
+            {
+                bool cfar = true;
+                if (useCfarCa)
+                {
+                    cfar = detectCfarCa(window, line.data(), cell, settings->cfarCa, lead, lag);
+                }
+                if (cfar && useCfarGos)
+                {
+                    cfar = detectCfarGos(window, line.data(), cell, settings->cfarGos, lead, lag);
+                }
+
+                bool detected = cfar;
+                if (useLocalMax)
+                {
+                    const bool localMax = detectLocalMax(line.data(), lineLength, cell, settings->localMax, settings->spectrumExtension);
+                    if (!useCfarCa && !useCfarGos)
+                    {
+                        detected = localMax;
+                    }
+                    else
+                    {
+                        detected = settings->localMax.combineAnd ? (localMax && cfar) : (localMax || cfar);
+                    }
+                }
+
+                const uint32_t row = dimension ? cell : l;
+                const uint32_t col = dimension ? l : cell;
+                detections[(static_cast<size_t>(page) * in.rows + row) * in.cols + col] = detected;
+            }
+        }
+    });
+
+    // lines of dimension 1 share the bytes of a row, so the bits are packed afterwards
+    auto *bits = m_memory.data() + output->baseAddress;
+    std::fill_n(bits, outSize, 0);
+    parallelFor(in.pages * in.rows, in.cols, m_threadCount, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t row = begin; row < end; row++)
+        {
+            const auto *flags = detections.data() + static_cast<size_t>(row) * in.cols;
+            auto *rowBits     = bits + static_cast<size_t>(row) * outStride;
+            for (uint32_t col = 0; col < in.cols; col++)
+            {
+                rowBits[col / 8] |= static_cast<uint8_t>(flags[col] << (col % 8));
+            }
+        }
+    });
 }
 
-void ProcessingRadar::doPsd(const IfxRsp_Signal * /*input*/, uint16_t /*nFft*/, IfxRsp_Signal * /*output*/)
+void ProcessingRadar::doPsd(const IfxRsp_Signal *input, uint16_t nFft, IfxRsp_Signal *output)
 {
+    const auto in = getLayout(input);
+
+    const uint32_t fftSize = nFft ? nFft : nextPowerOfTwo(in.cols);
+    if (!isPowerOfTwo(fftSize) || (fftSize > 0x8000))
+    {
+        throw ERadar("Invalid FFT size");
+    }
+
+    const uint32_t samples = std::min(fftSize, in.cols);
+    const uint32_t bins    = in.format.isComplex ? fftSize : std::max(fftSize / 2, 1u);
+    const auto out         = createOutput(output, static_cast<uint16_t>(in.pages), static_cast<uint16_t>(in.rows), static_cast<uint16_t>(bins), DataFormat_Q31);
+    const auto &twiddles   = getTwiddles(fftSize);
+    const float gain       = 1.0f / static_cast<float>(fftSize);
+
+    const uint32_t cost = fftSize * (1 + static_cast<uint32_t>(std::log2(fftSize)));
+    parallelFor(in.pages * in.rows, cost, m_threadCount, [&](uint32_t begin, uint32_t end) {
+        std::vector<Complex> buffer(fftSize);
+        for (uint32_t unit = begin; unit < end; unit++)
+        {
+            const uint32_t page = unit / in.rows;
+            const uint32_t row  = unit % in.rows;
+            for (uint32_t i = 0; i < samples; i++)
+            {
+                buffer[i] = in.load(page, row, i);
+            }
+            std::fill(buffer.begin() + samples, buffer.end(), Complex());
+
+            fft(buffer.data(), fftSize, twiddles.data());
+            for (uint32_t bin = 0; bin < bins; bin++)
+            {
+                const auto value = buffer[bin] * gain;
+                out.store(page, row, bin, std::norm(value), 1.0f);
+            }
+        }
+    });
 }
 
 void ProcessingRadar::start()
 {
+    // the operations are completed synchronously
 }
 
 bool ProcessingRadar::isBusy()
@@ -39,14 +985,31 @@ bool ProcessingRadar::isBusy()
     return false;
 }
 
-void ProcessingRadar::writeConfigRam(uint16_t /*offset*/, uint16_t /*count*/, const uint32_t /*ramContent*/[])
+void ProcessingRadar::writeConfigRam(uint16_t offset, uint16_t count, const uint32_t ramContent[])
 {
+    if (m_configRam.size() < static_cast<size_t>(offset) + count)
+    {
+        m_configRam.resize(static_cast<size_t>(offset) + count);
+    }
+    std::copy_n(ramContent, count, m_configRam.begin() + offset);
 }
 
-void ProcessingRadar::writeCustomWindowCoefficients(uint8_t /*slotNr*/, uint16_t /*offset*/, uint16_t /*count*/, const uint32_t /*coefficients*/[])
+void ProcessingRadar::writeCustomWindowCoefficients(uint8_t slotNr, uint16_t offset, uint16_t count, const uint32_t coefficients[])
 {
+    if (slotNr >= customWindowSlots)
+    {
+        throw ERadar("Invalid custom window slot");
+    }
+
+    auto &window = m_customWindows[slotNr];
+    if (window.size() < static_cast<size_t>(offset) + count)
+    {
+        window.resize(static_cast<size_t>(offset) + count);
+    }
+    std::copy_n(coefficients, count, window.begin() + offset);
 }
 
 void ProcessingRadar::reinitialize()
 {
+    m_allocated = 0;
 }
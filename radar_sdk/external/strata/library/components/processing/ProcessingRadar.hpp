@@ -9,19 +9,100 @@
 
 #pragma once
 
+#include <Definitions.hpp>
 #include <components/interfaces/IProcessingRadar.hpp>
+#include <platform/Memory.hpp>
 
+#include <array>
+#include <complex>
+#include <map>
+#include <vector>
+
+
+///
+/// Host-side implementation of the radar signal processor (RSP).
+///
+/// The signals are kept in a memory owned by this class, which takes the place of the
+/// RAM of an on-chip processor. IfxRsp_Signal::baseAddress is a byte address within this memory,
+/// the element (page p, row r, column c) is located at baseAddress + (p * rows + r) * stride + c * element size.
+/// Input data is placed with allocate() and getIMemory(), the result of each operation is allocated
+/// from the same memory, unless it overwrites the input (FFT_FLAGS_INPLACE).
+///
+/// The operations are executed synchronously, the lines of a signal are distributed to several threads.
+/// The computation is done in single precision floating point, fixed point formats are interpreted as
+/// fractional numbers (integer formats like the fractional format of the same size).
+///
 class ProcessingRadar :
-    public IProcessingRadar
+    public IProcessingRadar,
+    private Memory<uint32_t, uint8_t>
 {
 public:
+    /// The window setting customWindow + n selects the coefficients written to slot n with writeCustomWindowCoefficients()
+    static constexpr uint8_t customWindow      = 0x10;
+    static constexpr uint8_t customWindowSlots = 4;
+
+    ///
+    /// \param memorySize Size of the memory holding the signals in bytes
+    ///
+    STRATA_API explicit ProcessingRadar(uint32_t memorySize = 0x1000000);
     virtual ~ProcessingRadar() = default;
 
+    ///
+    /// Reserve memory for a signal. The memory is released by reinitialize().
+    /// \param size Number of bytes
+    /// \return the address to be used as IfxRsp_Signal::baseAddress
+    ///
+    STRATA_API uint32_t allocate(uint32_t size);
+
+    ///
+    /// \return access to the memory holding the signals
+    ///
+    STRATA_API IMemory<uint32_t, uint8_t> *getIMemory();
+
+    ///
+    /// Limit the number of threads the lines of a signal are distributed to.
+    /// The results do not depend on the number of threads.
+    /// \param count Maximum number of threads, 0 (default) uses all hardware threads
+    ///
+    STRATA_API void setThreadCount(uint32_t count);
+
+    ///
+    /// Automatic processing of a data source needs the processor of a board, so this throws ENotImplemented
+    ///
     void configure(uint8_t dataSource, const IDataProperties_t *dataProperties, const IProcessingRadarInput_t *radarInfo,
                    const IfxRsp_Stages *stages, const IfxRsp_AntennaCalibration *antennaConfig) override;
+
+    ///
+    /// FFT of each line of a signal.
+    /// dimension 0 transforms along the rows (each row is a line), dimension 1 along the columns.
+    /// samples (0 = all) values starting at offset are taken from each line, windowed and zero-padded to the FFT size.
+    /// The result is scaled by 1 / FFT size (and 2^exponent for 16 bit formats).
+    /// A real output format (Q15, Q31) stores the magnitude, a complex one (ComplexQ15, ComplexQ31) the spectrum.
+    ///
     void doFft(const IfxRsp_Signal *input, const IfxRsp_FftSetting *settings, IfxRsp_Signal *output, uint16_t samples, uint16_t offset, uint8_t dimension, uint8_t format) override;
+
+    ///
+    /// Non-coherent integration: the mean of the magnitudes of all pages, stored in one page of format Q15 or Q31
+    ///
     void doNci(const IfxRsp_Signal *input, uint8_t format, IfxRsp_Signal *output) override;
+
+    ///
+    /// Detection along the rows (dimension 0) or columns (dimension 1) of the magnitude of a signal.
+    /// The result is a signal of format DataFormat_Bits with the same dimensions, bit c % 8 of byte c / 8 of a row
+    /// is set for a detection in column c.
+    ///
+    /// - localMax.threshold is compared to the magnitude in units of the least significant bit of the input format
+    /// - betaThreshold of the CFAR settings is a factor with 8 fractional bits
+    /// - CASH takes the minimum of the sub-window averages on both sides as noise level
+    /// - when both CFAR algorithms are enabled, both have to detect, combineAnd combines this with the local maximum search
+    /// - spectrumExtension extends the lines cyclically, otherwise only the cells within the line are used
+    ///
     void doThresholding(const IfxRsp_Signal *input, uint8_t dimension, const IfxRsp_ThresholdingSetting *settings, IfxRsp_Signal *output) override;
+
+    ///
+    /// Power spectral density |X / nFft|^2 of each row, stored in format Q31.
+    /// For real input only the first half of the spectrum is stored.
+    ///
     void doPsd(const IfxRsp_Signal *input, uint16_t nFft, IfxRsp_Signal *output) override;
 
     void start() override;
@@ -31,5 +112,32 @@ public:
     void writeConfigRam(uint16_t offset, uint16_t count, const uint32_t ramContent[]) override;
     void writeCustomWindowCoefficients(uint8_t slotNr, uint16_t offset, uint16_t count, const uint32_t coefficients[]) override;
 
+    ///
+    /// Release all memory reserved by allocate() and by the operations
+    ///
     void reinitialize() override;
+
+private:
+    struct Layout;
+
+    // IMemory
+    uint8_t read(uint32_t address) override;
+    void read(uint32_t address, uint32_t length, uint8_t data[]) override;
+    void write(uint32_t address, uint8_t value) override;
+    void write(uint32_t address, uint32_t length, const uint8_t data[]) override;
+
+    void checkAccess(uint32_t address, uint32_t length) const;
+    Layout getLayout(const IfxRsp_Signal *signal);
+    Layout createOutput(IfxRsp_Signal *output, uint16_t pages, uint16_t rows, uint16_t cols, uint8_t format);
+    const std::vector<std::complex<float>> &getTwiddles(uint32_t fftSize);
+    std::vector<float> getWindow(const IfxRsp_FftSetting *settings, uint16_t samples) const;
+
+    std::vector<uint8_t> m_memory;
+    uint32_t m_allocated;
+    uint32_t m_threadCount;
+
+    std::vector<uint32_t> m_configRam;
+    std::array<std::vector<uint32_t>, customWindowSlots> m_customWindows;
+    std::map<uint32_t, std::vector<std::complex<float>>> m_twiddles;
+    std::vector<std::complex<float>> m_results;  // intermediate results, reused between operations
 };
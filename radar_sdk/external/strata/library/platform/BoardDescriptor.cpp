@@ -34,6 +34,15 @@ IBridge *BoardDescriptor::getIBridge()
     return m_bridge.get();
 }
 
+void BoardDescriptor::releaseConnection()
+{
+    if (m_bridge && !m_released)
+    {
+        m_bridge->closeConnection();
+        m_released = true;
+    }
+}
+
 std::shared_ptr<IBridge> BoardDescriptor::createBridge()
 {
     throw EConnection("BoardDescriptor does not contain any bridge");
@@ -45,6 +54,12 @@ void BoardDescriptor::checkBridge()
     {
         m_bridge = createBridge();
     }
+    if (m_released)
+    {
+        m_bridge->openConnection();
+        m_bridge->getIBridgeControl()->setDefaultTimeout();
+        m_released = false;
+    }
     if (!m_checked)
     {
         auto bridge = m_bridge.get();
@@ -83,9 +83,18 @@ public:
         return getIBridge()->getIBridgeControl()->getUuidString();
     }
 
+    // true while a board instance created from this descriptor exists
+    inline bool isInUse() const
+    {
+        return m_bridge.use_count() > 1;
+    }
+
     STRATA_API std::unique_ptr<BoardInstance> createBoardInstance();
     STRATA_API IBridge *getIBridge();
 
+    // closes the connection of an unused board, it is reopened when the board is accessed again
+    STRATA_API void releaseConnection();
+
 protected:
     virtual std::shared_ptr<IBridge> createBridge();
 
@@ -97,5 +106,6 @@ protected:
 private:
     void checkBridge();
 
-    bool m_checked = false;
+    bool m_checked  = false;
+    bool m_released = false;
 };
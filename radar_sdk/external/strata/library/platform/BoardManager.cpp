@@ -27,22 +27,351 @@
     #include <platform/wiggler/EnumeratorWiggler.hpp>
 #endif
 
+#include <algorithm>
 #include <common/cpp11/memory.hpp>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <thread>
+
+
+namespace
+{
+    class EnumerationSession;
+
+    class EnumerationSessionListener :
+        public IEnumerationListener
+    {
+    public:
+        EnumerationSessionListener(EnumerationSession &session, size_t index) :
+            m_session(session),
+            m_index {index}
+        {}
+
+        bool onEnumerate(std::unique_ptr<BoardDescriptor> &&descriptor) override;
+
+    private:
+        EnumerationSession &m_session;
+        size_t m_index;
+    };
+
+    /**
+     * Collects the results of the enumerators, which run concurrently in their own threads.
+     * The threads share ownership of the session, so an enumerator which is still running
+     * after the deadline does not access the BoardManager's list anymore.
+     */
+    class EnumerationSession
+    {
+    public:
+        EnumerationSession(BoardData::const_iterator begin, BoardData::const_iterator end, IEnumerationSelector *selector, uint16_t maxCount, size_t enumeratorCount) :
+            m_data(begin, end),
+            m_selector {selector},
+            m_maxCount {maxCount},
+            m_count {0},
+            m_pending {enumeratorCount},
+            m_closed {false},
+            m_results(enumeratorCount),
+            m_errors(enumeratorCount)
+        {}
+
+        void run(size_t index, const std::shared_ptr<IEnumerator> &enumerator)
+        {
+            EnumerationSessionListener listener(*this, index);
+            std::exception_ptr error;
+            try
+            {
+                enumerator->enumerate(listener, m_data.data(), m_data.data() + m_data.size());
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_errors[index] = error;
+            m_pending--;
+            m_condition.notify_all();
+        }
+
+        bool add(size_t index, std::unique_ptr<BoardDescriptor> &&descriptor)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_closed)
+            {
+                // enumeration is already finished, stop this enumerator
+                return true;
+            }
+            if (m_selector && !m_selector->select(descriptor.get()))
+            {
+                return false;
+            }
+
+            m_results[index].push_back(std::move(descriptor));
+            m_count++;
+            if (m_maxCount && (m_count >= m_maxCount))
+            {
+                m_closed = true;
+                m_condition.notify_all();
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Waits until all enumerators are finished, enough boards are found or the timeout expired.
+         * Afterwards, no more boards are accepted.
+         */
+        void wait(uint16_t timeout)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            const auto done = [this] { return m_closed || !m_pending; };
+            if (timeout)
+            {
+                if (!m_condition.wait_for(lock, std::chrono::milliseconds(timeout), done))
+                {
+                    LOG(DEBUG) << "Enumeration deadline reached, " << m_pending << " enumerator(s) still running";
+                }
+            }
+            else
+            {
+                m_condition.wait(lock, done);
+            }
+            m_closed = true;
+        }
+
+        /**
+         * Moves the found boards to the list, in the order of the enumerators
+         * @return The first error thrown by an enumerator, if any
+         */
+        std::exception_ptr collect(BoardDescriptorList &list)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto &result : m_results)
+            {
+                std::move(result.begin(), result.end(), std::back_inserter(list));
+                result.clear();
+            }
+            for (auto &error : m_errors)
+            {
+                if (error)
+                {
+                    return error;
+                }
+            }
+            return nullptr;
+        }
+
+    private:
+        // copy of the board list, since the caller's list may go out of scope while an enumerator is still running
+        const std::vector<BoardData> m_data;
+        IEnumerationSelector *m_selector;
+        const uint16_t m_maxCount;
+
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        uint16_t m_count;
+        size_t m_pending;
+        bool m_closed;
+
+        std::vector<BoardDescriptorList> m_results;
+        std::vector<std::exception_ptr> m_errors;
+    };
+
+    bool EnumerationSessionListener::onEnumerate(std::unique_ptr<BoardDescriptor> &&descriptor)
+    {
+        return m_session.add(m_index, std::move(descriptor));
+    }
+
+
+    /**
+     * Keeps the unused boards of the last enumeration for a short time, so that opening a board
+     * does not require a new discovery. Boards which are in use are not cached, their connection
+     * is closed as soon as the instance is released.
+     */
+    class DescriptorCache
+    {
+    public:
+        void store(uint32_t connections, const std::vector<BoardData> &data, const std::string &signature, std::chrono::steady_clock::time_point expiry, BoardDescriptorList &descriptors)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (matches(connections, data.data(), data.data() + data.size(), signature))
+            {
+                m_expiry = std::min(m_expiry, expiry);
+            }
+            else
+            {
+                m_descriptors.clear();
+                m_connections = connections;
+                m_data        = std::vector<BoardData>(data);
+                m_signature   = signature;
+                m_expiry      = expiry;
+            }
+
+            if (std::chrono::steady_clock::now() < m_expiry)
+            {
+                for (auto &d : descriptors)
+                {
+                    if (d && !d->isInUse())
+                    {
+                        // other processes may open the board in the meantime, it is reconnected when reused
+                        d->releaseConnection();
+                        m_descriptors.push_back(std::move(d));
+                    }
+                }
+            }
+            else
+            {
+                m_descriptors.clear();
+            }
+            descriptors.clear();
+        }
+
+        bool take(uint32_t connections, BoardData::const_iterator begin, BoardData::const_iterator end, const std::string &signature, BoardDescriptorList &descriptors, std::chrono::steady_clock::time_point &expiry)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_descriptors.empty() || !matches(connections, begin, end, signature) || (std::chrono::steady_clock::now() >= m_expiry))
+            {
+                m_descriptors.clear();
+                return false;
+            }
+
+            std::move(m_descriptors.begin(), m_descriptors.end(), std::back_inserter(descriptors));
+            m_descriptors.clear();
+            expiry = m_expiry;
+            return true;
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_descriptors.clear();
+        }
+
+    private:
+        bool matches(uint32_t connections, BoardData::const_iterator begin, BoardData::const_iterator end, const std::string &signature)
+        {
+            if ((connections != m_connections) || (signature != m_signature) || (static_cast<size_t>(end - begin) != m_data.size()))
+            {
+                return false;
+            }
+            return std::equal(begin, end, m_data.begin(), [](const BoardData &a, const BoardData &b) {
+                return (a.vid == b.vid) && (a.pid == b.pid) && (&a.factory == &b.factory);
+            });
+        }
+
+        std::mutex m_mutex;
+        uint32_t m_connections = 0;
+        std::vector<BoardData> m_data;
+        std::string m_signature;
+        std::chrono::steady_clock::time_point m_expiry;
+        BoardDescriptorList m_descriptors;
+    };
+
+    DescriptorCache &getDescriptorCache()
+    {
+        // never destroyed, so that no connections are closed during static destruction
+        static auto *cache = new DescriptorCache;
+        return *cache;
+    }
+
+    /**
+     * Takes over the enumeration threads which are still running after the deadline, so that neither
+     * enumerate() nor the destructor of the BoardManager waits for e.g. an unanswered Ethernet discovery.
+     * A new enumeration of the same connection type waits for them instead, since it would compete
+     * for the same resources (e.g. serial ports). The remaining threads are joined at exit.
+     */
+    class EnumerationThreads
+    {
+    public:
+        ~EnumerationThreads()
+        {
+            for (auto &t : m_threads)
+            {
+                t.second.join();
+            }
+        }
+
+        void add(unsigned int type, std::thread &&thread)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_threads.emplace(type, std::move(thread));
+        }
+
+        void join(unsigned int type)
+        {
+            std::vector<std::thread> threads;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                const auto range = m_threads.equal_range(type);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    threads.push_back(std::move(it->second));
+                }
+                m_threads.erase(range.first, range.second);
+            }
+            for (auto &t : threads)
+            {
+                t.join();
+            }
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::multimap<unsigned int, std::thread> m_threads;
+    };
+
+    EnumerationThreads &getEnumerationThreads()
+    {
+        static EnumerationThreads threads;
+        return threads;
+    }
+
+    bool isResponding(std::unique_ptr<BoardDescriptor> &descriptor)
+    {
+        try
+        {
+            auto bridge = descriptor->getIBridge();
+            if (!bridge->isConnected())
+            {
+                return false;
+            }
+            IBridgeControl::BoardInfo_t boardInfo;
+            bridge->getIBridgeControl()->getBoardInfo(boardInfo);
+            return true;
+        }
+        catch (const EException &)
+        {
+            return false;
+        }
+    }
+}
+
 
 BoardManager::BoardManager() :
-    m_selector {nullptr}
+    m_selector {nullptr},
+    m_timeout {0},
+    m_cacheLifetime {0},
+    m_enumeratedConnections {0}
 {
 }
 
 BoardManager::BoardManager(const char *interfaces) :
-    m_selector {nullptr}
+    m_selector {nullptr},
+    m_timeout {0},
+    m_cacheLifetime {0},
+    m_enumeratedConnections {0}
 {
     parseConnectionTypes(interfaces, ',');
 }
 
 BoardManager::BoardManager(bool serial, bool ethernetUdp, bool uvc, bool wiggler, bool libusb) :
-    m_selector {nullptr}
+    m_selector {nullptr},
+    m_timeout {0},
+    m_cacheLifetime {0},
+    m_enumeratedConnections {0}
 {
     LOG(WARN) << "This BoardManager constructor implementation is deprecated. Please don't use it anymore.";
     if (serial)
@@ -59,6 +388,7 @@ BoardManager::BoardManager(bool serial, bool ethernetUdp, bool uvc, bool wiggler
 
 BoardManager::~BoardManager()
 {
+    releaseToCache();
 }
 
 BoardManager &BoardManager::useSerial()
@@ -127,7 +457,7 @@ BoardManager::ConnectionType BoardManager::getConnectionTypeByName(std::string n
     return ConnectionType::unknown;
 }
 
-void BoardManager::addConnectionType(BoardManager::ConnectionType type)
+std::unique_ptr<IEnumerator> BoardManager::createEnumerator(BoardManager::ConnectionType type)
 {
     std::unique_ptr<IEnumerator> enumerator;
     switch (type)
@@ -136,30 +466,10 @@ void BoardManager::addConnectionType(BoardManager::ConnectionType type)
             enumerator = std::make_unique<EnumeratorSerialImpl>();
             break;
         case ConnectionType::udp:
-            if (m_enumerators.find(ConnectionType::tcp) != m_enumerators.end())
-            {
-                // A board supporting TCP always has to support UDP too for being found via broadcast (enumeration).
-                // So it will always be recognized as UDP board if UDP is enabled. That's why only UDP OR TCP may be used,
-                // not both at the same time.
-                LOG(WARN) << "UDP and TCP cannot be used at the same time. UDP is ignored.";
-            }
-            else
-            {
-                enumerator = std::make_unique<EnumeratorEthernet>(false);
-            }
+            enumerator = std::make_unique<EnumeratorEthernet>(false);
             break;
         case ConnectionType::tcp:
-            if (m_enumerators.find(ConnectionType::udp) != m_enumerators.end())
-            {
-                // A board supporting TCP always has to support UDP too for being found via broadcast (enumeration).
-                // So it will always be recognized as UDP board if UDP is enabled. That's why only UDP OR TCP may be used,
-                // not both at the same time.
-                LOG(WARN) << "UDP and TCP cannot be used at the same time. TCP is ignored.";
-            }
-            else
-            {
-                enumerator = std::make_unique<EnumeratorEthernet>(true);
-            }
+            enumerator = std::make_unique<EnumeratorEthernet>(true);
             break;
         case ConnectionType::uvc:
             enumerator = std::make_unique<EnumeratorUvcImpl>();
@@ -182,6 +492,26 @@ void BoardManager::addConnectionType(BoardManager::ConnectionType type)
             LOG(WARN) << "Unknown connection type will be ignored.";
             break;
     }
+    return enumerator;
+}
+
+void BoardManager::addConnectionType(BoardManager::ConnectionType type)
+{
+    // A board supporting TCP always has to support UDP too for being found via broadcast (enumeration).
+    // So it will always be recognized as UDP board if UDP is enabled. That's why only UDP OR TCP may be used,
+    // not both at the same time.
+    if ((type == ConnectionType::udp) && (m_enumerators.find(ConnectionType::tcp) != m_enumerators.end()))
+    {
+        LOG(WARN) << "UDP and TCP cannot be used at the same time. UDP is ignored.";
+        return;
+    }
+    if ((type == ConnectionType::tcp) && (m_enumerators.find(ConnectionType::udp) != m_enumerators.end()))
+    {
+        LOG(WARN) << "UDP and TCP cannot be used at the same time. TCP is ignored.";
+        return;
+    }
+
+    auto enumerator = createEnumerator(type);
     if (enumerator)
     {
         m_enumerators[type] = std::move(enumerator);
@@ -221,6 +551,21 @@ void BoardManager::setEnumerationSelector(IEnumerationSelector *selector)
     m_selector = selector;
 }
 
+void BoardManager::setEnumerationTimeout(uint16_t timeout)
+{
+    m_timeout = timeout;
+}
+
+void BoardManager::setCacheLifetime(uint16_t lifetime)
+{
+    m_cacheLifetime = lifetime;
+}
+
+void BoardManager::invalidateCache()
+{
+    getDescriptorCache().clear();
+}
+
 uint16_t BoardManager::enumerate(uint16_t maxCount)
 {
     return enumerate(BoardListProtocol::begin, BoardListProtocol::end, maxCount);
@@ -228,24 +573,135 @@ uint16_t BoardManager::enumerate(uint16_t maxCount)
 
 uint16_t BoardManager::enumerate(BoardData::const_iterator begin, BoardData::const_iterator end, uint16_t maxCount)
 {
-    m_maxCount = maxCount;
+    // Enumerators which were still running at the last deadline may not be used concurrently
+    joinEnumerators();
+    releaseToCache();
     m_enumeratedList.clear();
 
+    // Only a full discovery finds all boards, including newly plugged ones
+    if (m_cacheLifetime && maxCount && enumerateCached(begin, end, maxCount))
+    {
+        return static_cast<uint16_t>(m_enumeratedList.size());
+    }
+
+    // The discovery creates new descriptors for the cached boards
+    invalidateCache();
+
     if (m_enumerators.empty())
     {
         LOG(WARN) << "No enumerators (connection types) selected. No boards will be found.";
     }
 
+    m_enumeratedConnections = getConnectionMask();
+    m_enumeratedData        = std::vector<BoardData>(begin, end);
+    m_enumeratedSignature   = getDeviceSignature();
+    m_cacheExpiry           = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_cacheLifetime);
+
+    auto session = std::make_shared<EnumerationSession>(begin, end, m_selector, maxCount, m_enumerators.size());
+    auto &threads = getEnumerationThreads();
+    size_t index  = 0;
+    for (auto &e : m_enumerators)
+    {
+        threads.add(static_cast<unsigned int>(e.first), std::thread(&EnumerationSession::run, session, index++, e.second));
+    }
+
+    session->wait(m_timeout);
+
+    const auto error = session->collect(m_enumeratedList);
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    return static_cast<uint16_t>(m_enumeratedList.size());
+}
+
+uint32_t BoardManager::getConnectionMask() const
+{
+    uint32_t mask = 0;
+    for (auto &e : m_enumerators)
+    {
+        mask |= 1u << static_cast<unsigned int>(e.first);
+    }
+    return mask;
+}
+
+std::string BoardManager::getDeviceSignature() const
+{
+    std::string signature;
+    for (auto &e : m_enumerators)
+    {
+        signature.append(e.second->getDeviceSignature()).push_back('|');
+    }
+    return signature;
+}
+
+void BoardManager::joinEnumerators()
+{
+    auto &threads = getEnumerationThreads();
     for (auto &e : m_enumerators)
     {
-        e.second->enumerate(*this, begin, end);
-        if (m_maxCount && (m_enumeratedList.size() >= m_maxCount))
+        threads.join(static_cast<unsigned int>(e.first));
+    }
+}
+
+bool BoardManager::enumerateCached(BoardData::const_iterator begin, BoardData::const_iterator end, uint16_t maxCount)
+{
+    const auto connections = getConnectionMask();
+    const auto signature   = getDeviceSignature();
+    BoardDescriptorList cached;
+    std::chrono::steady_clock::time_point expiry;
+    if (!getDescriptorCache().take(connections, begin, end, signature, cached, expiry))
+    {
+        // the cache is empty, expired or devices have been plugged or unplugged in the meantime
+        return false;
+    }
+
+    BoardDescriptorList unused;
+    for (auto &d : cached)
+    {
+        if (!isResponding(d))
         {
-            break;
+            // the board has been unplugged or reset in the meantime
+            LOG(DEBUG) << "Cached board does not respond anymore, discovering boards again";
+            m_enumeratedList.clear();
+            return false;
+        }
+
+        const bool full = (m_enumeratedList.size() >= maxCount);
+        if (full || (m_selector && !m_selector->select(d.get())))
+        {
+            unused.push_back(std::move(d));
+        }
+        else
+        {
+            m_enumeratedList.push_back(std::move(d));
         }
     }
 
-    return static_cast<uint16_t>(m_enumeratedList.size());
+    if (m_enumeratedList.size() < maxCount)
+    {
+        // more boards may have been connected since the cached enumeration
+        m_enumeratedList.clear();
+        return false;
+    }
+
+    LOG(DEBUG) << "Reusing " << m_enumeratedList.size() << " cached board(s)";
+
+    m_enumeratedConnections = connections;
+    m_enumeratedData        = std::vector<BoardData>(begin, end);
+    m_enumeratedSignature   = signature;
+    m_cacheExpiry           = expiry;
+    getDescriptorCache().store(m_enumeratedConnections, m_enumeratedData, m_enumeratedSignature, m_cacheExpiry, unused);
+    return true;
+}
+
+void BoardManager::releaseToCache()
+{
+    if (m_cacheLifetime && !m_enumeratedList.empty())
+    {
+        getDescriptorCache().store(m_enumeratedConnections, m_enumeratedData, m_enumeratedSignature, m_cacheExpiry, m_enumeratedList);
+    }
 }
 
 BoardDescriptorList &BoardManager::getEnumeratedList()
@@ -376,23 +832,3 @@ STRATA_API std::unique_ptr<BoardInstance> BoardManager::createSpecificBoardInsta
 
     throw EConnection("Specified board not found");
 }
-
-bool BoardManager::onEnumerate(std::unique_ptr<BoardDescriptor> &&descriptor)
-{
-    bool select;
-    if (m_selector)
-    {
-        select = m_selector->select(descriptor.get());
-    }
-    else
-    {
-        select = true;
-    }
-
-    if (select)
-    {
-        m_enumeratedList.push_back(std::move(descriptor));
-    }
-
-    return (m_maxCount && (m_enumeratedList.size() >= m_maxCount));
-}
@@ -13,9 +13,12 @@
 #include <platform/BoardInstance.hpp>
 #include <platform/interfaces/IEnumerator.hpp>
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #define UUID_LENGTH 16
 
@@ -56,8 +59,7 @@ private:
 /**
  * @brief Class to enumerate and create board instances
  */
-class BoardManager :
-    private IEnumerationListener
+class BoardManager
 {
 public:
     /**
@@ -90,7 +92,7 @@ public:
      */
     STRATA_API BoardManager(bool serial, bool ethernetUdp = true, bool uvc = false, bool wiggler = false, bool libusb = true);
 
-    STRATA_API virtual ~BoardManager() override;
+    STRATA_API virtual ~BoardManager();
 
     /**
      * @brief Add the serial connection type to be used during board enumeration
@@ -130,6 +132,32 @@ public:
 
     STRATA_API void setEnumerationSelector(IEnumerationSelector *selector);
 
+    /**
+     * @brief Set a deadline for the whole enumeration
+     * @note The enumerators of all interfaces run concurrently. When the deadline is reached,
+     *       enumerate() returns the boards found so far and ignores the enumerators which are still running.
+     *       They finish in the background, also after the BoardManager is destroyed. The next enumeration
+     *       of the same connection type waits for them.
+     * @param timeout The deadline in milliseconds, 0 waits for all enumerators to finish (default)
+     */
+    STRATA_API void setEnumerationTimeout(uint16_t timeout);
+
+    /**
+     * @brief Allow enumerate() to reuse the boards found by a recent enumeration
+     * @note When a BoardManager is destroyed or enumerates again, its enumerated boards which are not in use are kept for the specified time.
+     *       An enumeration with the same interfaces, board list and a maxCount then only checks that the boards still respond,
+     *       instead of discovering them again. The connections of cached boards are closed and reopened when they are reused.
+     *       A full discovery is done if a cached board does not respond, if fewer than maxCount boards are cached,
+     *       if devices have been plugged or unplugged (only detected for serial ports), or if maxCount is 0.
+     * @param lifetime The time in milliseconds after discovery in which the boards may be reused, 0 disables the cache (default)
+     */
+    STRATA_API void setCacheLifetime(uint16_t lifetime);
+
+    /**
+     * @brief Drop all cached boards and close their connections, e.g. after a hot-plug notification
+     */
+    STRATA_API static void invalidateCache();
+
     /**
      * @brief Enumerate (collect) all boards on the activated interfaces (see constructor)
      * @note The function used an internal list to identify the board type.
@@ -213,19 +241,34 @@ protected:
     };
 
     ///
-    /// List of all instantiated enumerators
+    /// List of all instantiated enumerators.
+    /// They are shared with the enumeration threads, which may outlive an enumerate() call and the BoardManager when the deadline is reached.
+    /// Such threads are joined before an enumerator of the same connection type is used again.
     ///
-    std::map<ConnectionType, std::unique_ptr<IEnumerator>> m_enumerators;
+    std::map<ConnectionType, std::shared_ptr<IEnumerator>> m_enumerators;
 
 private:
+    IEnumerationSelector *m_selector;
+    uint16_t m_timeout;
+    uint16_t m_cacheLifetime;
+
     ///
-    /// This will be called by enumerators with descriptors of found board.
+    /// Parameters of the enumeration which found the boards in m_enumeratedList,
+    /// used as key when they are handed over to the cache.
     ///
-    bool onEnumerate(std::unique_ptr<BoardDescriptor> &&descriptor) override;
-    IEnumerationSelector *m_selector;
-    uint16_t m_maxCount;
+    uint32_t m_enumeratedConnections;
+    std::vector<BoardData> m_enumeratedData;
+    std::string m_enumeratedSignature;
+    std::chrono::steady_clock::time_point m_cacheExpiry;
 
     static ConnectionType getConnectionTypeByName(std::string name);
+    static std::unique_ptr<IEnumerator> createEnumerator(ConnectionType type);
     void addConnectionType(ConnectionType type);
     void parseConnectionTypes(const char *types, char separator);
+
+    uint32_t getConnectionMask() const;
+    std::string getDeviceSignature() const;
+    void joinEnumerators();
+    bool enumerateCached(BoardData::const_iterator begin, BoardData::const_iterator end, uint16_t maxCount);
+    void releaseToCache();
 };
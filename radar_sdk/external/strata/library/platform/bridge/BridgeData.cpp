@@ -8,11 +8,36 @@
  */
 
 #include "BridgeData.hpp"
+#include <common/Time.hpp>
 #include <platform/exception/EBridgeData.hpp>
+#include <universal/data_definitions.h>
+
+#include <algorithm>
+
+namespace
+{
+    // Frame timestamps are compared to the host time to measure the receive latency.
+    // Timestamps set by a board with an unrelated clock give implausible values, which are ignored.
+    constexpr uint64_t maxPlausibleReceiveLatencyUs = 10000000;
+
+    // A grown queue is checked for shrinking after receiving this many times its size in frames
+    constexpr uint32_t shrinkWindowFactor = 4;
+}
 
 BridgeData::BridgeData() :
     m_frameForwarder(&m_frameQueue),
-    m_dataStarted(false)
+    m_dataStarted(false),
+    m_policy(BackPressurePolicy::DropOldest),
+    m_baseQueueSize(0),
+    m_maxQueueSize(0),
+    m_queueSize(0),
+    m_windowFrames(0),
+    m_windowHighWaterMark(0),
+    m_framesReceived(0),
+    m_framesDropped(0),
+    m_framePoolDepleted(0),
+    m_frameSizeExceeded(0),
+    m_otherErrors(0)
 {
 }
 
@@ -32,11 +57,85 @@ void BridgeData::setFrameQueueSize(uint16_t count)
     {
         throw EBridgeData("The frame queue size 0 is not allowed");
     }
+    std::lock_guard<std::mutex> lock(m_queueSizeLock);
+    m_baseQueueSize = count;
+    applyQueueSize(count);
+}
+
+void BridgeData::setBackPressurePolicy(BackPressurePolicy policy, uint16_t maxCount)
+{
+    if (isBridgeDataStarted())
+    {
+        throw EBridgeData("The back pressure policy cannot be changed while streaming");
+    }
+    if ((policy == BackPressurePolicy::Grow) && (maxCount == 0))
+    {
+        throw EBridgeData("Growing the frame queue requires a maximum size");
+    }
+
+    std::lock_guard<std::mutex> lock(m_queueSizeLock);
+    m_policy       = policy;
+    m_maxQueueSize = maxCount;
+    m_frameQueue.setPolicy(policy);
+    if (policy == BackPressurePolicy::Grow)
+    {
+        //the queue can only allocate its storage while not streaming
+        m_frameQueue.reserve(maxCount);
+    }
+    if (m_baseQueueSize)
+    {
+        applyQueueSize(m_baseQueueSize);
+    }
+}
+
+void BridgeData::applyQueueSize(uint16_t count)
+{
     m_frameQueue.setMaxCount(count);
     //The frame pool must contain one entry more than the queue.
     //When a new frame is received, it needs a frame buffer to be queued
     //before the oldest buffer is released.
-    setFramePoolCount(count + 1);
+    //A blocked producer does not release the oldest buffer, so one more buffer
+    //is needed for the frame the consumer is working on.
+    const uint32_t poolReserve = (m_policy == BackPressurePolicy::BlockProducer) ? 2 : 1;
+    setFramePoolCount(static_cast<uint16_t>(std::min<uint32_t>(count + poolReserve, UINT16_MAX)));
+
+    m_queueSize           = count;
+    m_windowFrames        = 0;
+    m_windowHighWaterMark = 0;
+}
+
+void BridgeData::adaptQueueSize()
+{
+    std::lock_guard<std::mutex> lock(m_queueSizeLock);
+    if (!m_baseQueueSize)
+    {
+        return;
+    }
+
+    // the queue holds one more frame after this one was queued
+    const auto depth = m_frameQueue.size() + 1;
+    if ((depth > m_queueSize) && (m_queueSize < m_maxQueueSize))
+    {
+        const auto count = std::min<uint32_t>(m_queueSize + m_baseQueueSize, std::max(m_maxQueueSize, m_baseQueueSize));
+        applyQueueSize(static_cast<uint16_t>(count));
+        return;
+    }
+
+    m_windowHighWaterMark = std::max(m_windowHighWaterMark, depth);
+    if (++m_windowFrames < shrinkWindowFactor * m_queueSize)
+    {
+        return;
+    }
+
+    // shrink by one chunk if the frames would have fit into half of the smaller queue,
+    // which leaves enough headroom not to grow again right away
+    const uint32_t shrunkSize = m_queueSize - m_baseQueueSize;
+    if ((m_queueSize > m_baseQueueSize) && (2 * m_windowHighWaterMark <= shrunkSize))
+    {
+        applyQueueSize(static_cast<uint16_t>(shrunkSize));
+    }
+    m_windowFrames        = 0;
+    m_windowHighWaterMark = 0;
 }
 
 void BridgeData::clearFrameQueue()
@@ -48,6 +147,39 @@ void BridgeData::queueFrame(IFrame *frame)
 {
     if (isBridgeDataStarted())
     {
+        switch (frame->getStatusCode())
+        {
+            case DataError_NoError:
+                m_framesReceived.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case DataError_FrameDropped:
+                m_framesDropped.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case DataError_FramePoolDepleted:
+                m_framePoolDepleted.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case DataError_FrameSizeExceeded:
+                m_frameSizeExceeded.fetch_add(1, std::memory_order_relaxed);
+                break;
+            default:
+                m_otherErrors.fetch_add(1, std::memory_order_relaxed);
+                break;
+        }
+
+        const uint64_t timestamp = frame->getTimestamp();
+        if (timestamp)
+        {
+            const uint64_t now = static_cast<uint64_t>(getEpochTime());
+            if ((now >= timestamp) && (now - timestamp < maxPlausibleReceiveLatencyUs))
+            {
+                m_receiveLatency.recordMicroseconds(now - timestamp);
+            }
+        }
+
+        if (m_policy == BackPressurePolicy::Grow)
+        {
+            adaptQueueSize();
+        }
         m_frameQueue.enqueue(frame);
     }
     else
@@ -87,3 +219,38 @@ bool BridgeData::isBridgeDataStarted() const
 {
     return m_dataStarted;
 }
+
+void BridgeData::getStatistics(BridgeDataStatistics &statistics) const
+{
+    statistics                   = {};
+    statistics.framesReceived    = m_framesReceived.load(std::memory_order_relaxed);
+    statistics.framesDropped     = m_framesDropped.load(std::memory_order_relaxed);
+    statistics.framePoolDepleted = m_framePoolDepleted.load(std::memory_order_relaxed);
+    statistics.frameSizeExceeded = m_frameSizeExceeded.load(std::memory_order_relaxed);
+    statistics.otherErrors       = m_otherErrors.load(std::memory_order_relaxed);
+    m_receiveLatency.getSnapshot(statistics.receiveLatency);
+    m_frameQueue.getStatistics(statistics.queueDepth, statistics.queueHighWaterMark, statistics.framesTrimmed, statistics.queueLatency);
+    getFramePoolStatistics(statistics.framePoolSize, statistics.framePoolHighWaterMark);
+}
+
+void BridgeData::resetStatistics()
+{
+    m_framesReceived    = 0;
+    m_framesDropped     = 0;
+    m_framePoolDepleted = 0;
+    m_frameSizeExceeded = 0;
+    m_otherErrors       = 0;
+    m_receiveLatency.reset();
+    m_frameQueue.resetStatistics();
+    resetFramePoolStatistics();
+}
+
+void BridgeData::getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const
+{
+    count         = 0;
+    highWaterMark = 0;
+}
+
+void BridgeData::resetFramePoolStatistics()
+{
+}
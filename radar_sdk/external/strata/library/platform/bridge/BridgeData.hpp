@@ -14,6 +14,8 @@
 #include <platform/frames/FrameQueue.hpp>
 #include <platform/interfaces/IBridgeData.hpp>
 
+#include <mutex>
+
 class BridgeData :
     public IBridgeData
 {
@@ -23,12 +25,16 @@ public:
     virtual ~BridgeData();
 
     void setFrameQueueSize(uint16_t count) override;
+    void setBackPressurePolicy(BackPressurePolicy policy, uint16_t maxCount = 0) override;
     void clearFrameQueue() override;
 
     void registerListener(IFrameListener<> *listener) override;
 
     IFrame *getFrame(uint16_t timeoutMs = 5000) override;
 
+    void getStatistics(BridgeDataStatistics &statistics) const override;
+    void resetStatistics() override;
+
 protected:
     void startBridgeData();
     void stopBridgeData();
@@ -45,9 +51,36 @@ protected:
     FrameQueue m_frameQueue;
     FrameForwarder m_frameForwarder;
 
+    /**
+     * Get the usage of the frame pool for the statistics.
+     * Bridges without a frame pool report zero.
+     * @param count The number of frame buffers in the pool
+     * @param highWaterMark The maximum number of frame buffers in use at the same time
+     */
+    virtual void getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const;
+    virtual void resetFramePoolStatistics();
+
 private:
+    void applyQueueSize(uint16_t count);
+    void adaptQueueSize();
+
     std::atomic_bool m_dataStarted;
 
+    std::mutex m_queueSizeLock;
+    BackPressurePolicy m_policy;
+    uint16_t m_baseQueueSize;         //size set by setFrameQueueSize(), also the chunk size for growing
+    uint16_t m_maxQueueSize;          //limit for growing
+    uint16_t m_queueSize;             //current size
+    uint32_t m_windowFrames;          //frames received since the last shrink check
+    uint32_t m_windowHighWaterMark;   //maximum queue depth since the last shrink check
+
+    std::atomic<uint64_t> m_framesReceived;
+    std::atomic<uint64_t> m_framesDropped;
+    std::atomic<uint64_t> m_framePoolDepleted;
+    std::atomic<uint64_t> m_frameSizeExceeded;
+    std::atomic<uint64_t> m_otherErrors;
+    LatencyHistogram m_receiveLatency;
+
     /**
      * Set the size of the frame pool
      * @param count The number of frame buffers to be available in the frame pool
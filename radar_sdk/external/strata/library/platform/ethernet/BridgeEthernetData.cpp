@@ -9,6 +9,7 @@
 
 #include "BridgeEthernetData.hpp"
 
+#include <algorithm>
 #include <array>
 #include <common/Logger.hpp>
 #include <common/Serialization.hpp>
@@ -19,6 +20,9 @@
 #include <platform/frames/ErrorFrame.hpp>
 #include <universal/protocol/protocol_definitions.h>
 
+#include <cstring>
+#include <vector>
+
 
 //#define BRIDGE_ETHERNET_DATA_DEBUG
 
@@ -27,13 +31,15 @@ namespace
 {
     constexpr bool setLocalTimestamp = false;
 
-    constexpr const uint16_t frameHeaderSize   = 6;
-    constexpr const uint32_t timestampSize     = sizeof(uint64_t);
-    constexpr const uint32_t bufferPrefixSize  = sizeof(uint64_t);
-    constexpr const uint32_t bufferPrefixStart = bufferPrefixSize - frameHeaderSize;
+    constexpr const uint16_t frameHeaderSize  = 6;
+    constexpr const uint32_t timestampSize    = sizeof(uint64_t);
+    constexpr const uint32_t bufferPrefixSize = sizeof(uint64_t);
+
+    constexpr const uint16_t dataPort               = 55056;
+    constexpr const uint32_t defaultInputBufferSize = 4 * 1024 * 1024;
 
-    constexpr const uint16_t dataPort   = 55056;
-    constexpr const int inputBufferSize = 4 * 1024 * 1024;
+    // maximum number of packets received at once
+    constexpr const uint16_t receiveBatchSize = 64;
 
     constexpr const uint16_t defaultTimeout = 1000;
 }
@@ -41,7 +47,9 @@ namespace
 
 BridgeEthernetData::BridgeEthernetData(ISocket &socket, ipAddress_t ipAddr) :
     m_socket(socket),
-    m_ipAddr {ipAddr[0], ipAddr[1], ipAddr[2], ipAddr[3]}
+    m_ipAddr {ipAddr[0], ipAddr[1], ipAddr[2], ipAddr[3]},
+    m_inputBufferSize {defaultInputBufferSize},
+    m_frameCapacity {0}
 {
     openConnection();
 }
@@ -55,7 +63,7 @@ void BridgeEthernetData::openConnection()
 {
     m_packetCounter = 0;
     m_socket.open(0, dataPort, m_ipAddr, defaultTimeout);
-    m_socket.setInputBufferSize(inputBufferSize);
+    m_socket.setInputBufferSize(m_inputBufferSize);
     m_socket.send(nullptr, 0);  // let the board know where to send the data to (anyways, this pipecleaner is needed for receiving to work)
 }
 
@@ -67,8 +75,21 @@ void BridgeEthernetData::closeConnection()
 
 void BridgeEthernetData::setFrameBufferSize(uint32_t size)
 {
-    // allocate enough buffer memory for header to avoid memory copying
-    m_framePool.setFrameBufferSize(bufferPrefixSize + size + timestampSize);
+    m_frameCapacity = size + timestampSize;
+
+    // With datagrams, leave room for one more packet behind the frame data,
+    // so that a packet can be received completely even if it is not at the expected position.
+    const uint32_t packetSlack = (m_socket.getMode() == ISocket::Mode::Datagram) ? m_socket.maxPayload() : 0;
+    m_framePool.setFrameBufferSize(bufferPrefixSize + m_frameCapacity + packetSlack);
+}
+
+void BridgeEthernetData::setReceiveBufferSize(uint32_t size)
+{
+    m_inputBufferSize = size;
+    if (m_socket.isOpened())
+    {
+        m_socket.setInputBufferSize(m_inputBufferSize);
+    }
 }
 
 void BridgeEthernetData::setFramePoolCount(uint16_t count)
@@ -76,6 +97,16 @@ void BridgeEthernetData::setFramePoolCount(uint16_t count)
     m_framePool.setFrameCount(count);
 }
 
+void BridgeEthernetData::getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const
+{
+    m_framePool.getStatistics(count, highWaterMark);
+}
+
+void BridgeEthernetData::resetFramePoolStatistics()
+{
+    m_framePool.resetStatistics();
+}
+
 void BridgeEthernetData::startStreaming()
 {
     if (isBridgeDataStarted())
@@ -132,17 +163,30 @@ void BridgeEthernetData::cleanupStreaming()
 
 void BridgeEthernetData::dataThreadFunctionDatagrams()
 {
-    IFrame *frame = nullptr;
-    uint8_t *bufBegin, *bufEnd;
-    uint8_t *buf;
+    IFrame *frame     = nullptr;
+    uint8_t *data     = nullptr;  // start of the frame data in the frame buffer
+    uint32_t capacity = 0;        // maximum size of the frame data
+    uint32_t offset   = 0;        // size of the frame data already received
 
     bool firstFrame         = true;
     uint64_t epochTimestamp = 0;
     uint8_t virtualChannel  = 0;
 
-    // in our frame buffer, we overwrite the last bytes of the previous packet with the header of the new one.
-    // so we have to restore them after reading a new packet, but we don't have to copy the whole payload every time.
-    uint8_t backup[frameHeaderSize];
+    // The payload of the packets is received directly into the frame buffer, each one behind the previous one,
+    // only the packet headers are received separately. This expects all packets of a frame except the last one
+    // to have the maximum size. Otherwise (e.g. after packet loss) the payload is moved to the right place.
+    const uint16_t payloadStride = m_socket.maxPayload() - frameHeaderSize;
+    uint8_t headers[receiveBatchSize][frameHeaderSize];
+    ISocket::ReceiveVector vectors[receiveBatchSize];
+
+    // packets received after the end of a frame have to be moved out of its buffer before queueing it
+    std::vector<uint8_t> spill(receiveBatchSize * payloadStride);
+
+    auto prepareFrame = [&] {
+        data     = frame->getBuffer() + bufferPrefixSize;
+        capacity = m_frameCapacity;
+        offset   = 0;
+    };
 
     while (isBridgeDataStarted())
     {
@@ -162,197 +206,231 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                 }
                 continue;
             }
+            prepareFrame();
+        }
+
+        uint16_t count;
+        try
+        {
+            // only request as many packets as fit into the frame, so that usually no packet of the next frame ends up in it
+            const uint32_t remaining = capacity - offset;
+            count                    = static_cast<uint16_t>(std::min<uint32_t>(receiveBatchSize, std::max<uint32_t>(1, (remaining + payloadStride - 1) / payloadStride)));
+            for (uint16_t i = 0; i < count; i++)
+            {
+                // the frame buffer has room for a whole packet behind the frame data
+                vectors[i].header        = headers[i];
+                vectors[i].headerLength  = frameHeaderSize;
+                vectors[i].payload       = data + offset + i * payloadStride;
+                vectors[i].payloadLength = payloadStride;
+                vectors[i].received      = 0;
+            }
 
-            // prepare frame buffer variables
-            bufBegin = frame->getBuffer() + bufferPrefixStart;
-            bufEnd   = bufBegin + frame->getBufferSize();
-            buf      = bufBegin;  // this will point to (frameHeaderSize) bytes before the end of the current data!
+            count = m_socket.receiveMultiple(vectors, count);
+        }
+        catch (const std::exception &e)
+        {
+            queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+            LOG(DEBUG) << "Data read thread - " << e.what();
+            continue;
         }
 
-        while (isBridgeDataStarted())
+        for (uint16_t i = 0; i < count; i++)
         {
-            // fill buffer with frame from multiple packets
-            try
+            const auto &vector = vectors[i];
+            if (!frame)
             {
-                const auto remainingSize    = bufEnd - buf;
-                const uint16_t readSize     = (remainingSize > m_socket.maxPayload()) ? m_socket.maxPayload() : static_cast<uint16_t>(remainingSize);
-                const uint16_t returnedSize = m_socket.receive(buf, readSize);
-                if (returnedSize == 0)
+                // the previous frame was completed by a packet of this batch
+                frame = m_framePool.dequeueFrame();
+                if (!frame)
                 {
-                    // no packet available, continue while loop
+                    queueFrame(ErrorFrame::create(DataError_FramePoolDepleted, VIRTUAL_CHANNEL_UNDEFINED));
+                    LOG(DEBUG) << "Data read thread - dumped packet";
+                    m_packetCounter++;
                     continue;
                 }
+                prepareFrame();
+            }
 
-                if (returnedSize < frameHeaderSize)
-                {
-                    LOG(DEBUG) << "Data read thread - Packet header incomplete";
-                    continue;
-                }
+            if (vector.received < frameHeaderSize)
+            {
+                LOG(DEBUG) << "Data read thread - Packet header incomplete";
+                continue;
+            }
+
+            const auto bmPktType = serialToHost<uint8_t>(vector.header);
+            if ((bmPktType & 0xF0) != DATA_FRAME_PACKET)
+            {
+                LOG(DEBUG) << "Data read thread - Packet type error: 0x" << std::hex << static_cast<int>(bmPktType);
+                continue;
+            }
 
-                const auto bmPktType = serialToHost<uint8_t>(buf);
-                if ((bmPktType & 0xF0) != DATA_FRAME_PACKET)
+            const auto bChannel = serialToHost<uint8_t>(vector.header + 1);
+            if (bmPktType & DATA_FRAME_FLAG_FIRST)
+            {
+                if (setLocalTimestamp)
                 {
-                    LOG(DEBUG) << "Data read thread - Packet type error: 0x" << std::hex << static_cast<int>(bmPktType);
-                    continue;
+                    epochTimestamp = getEpochTime();
                 }
+                virtualChannel = bChannel;
+            }
 
-                const auto bChannel = serialToHost<uint8_t>(buf + 1);
-                if (bmPktType & DATA_FRAME_FLAG_FIRST)
+            const auto wLength = serialToHost<uint16_t>(vector.header + 4);
+            if (vector.received != frameHeaderSize + wLength)
+            {
+                if (capacity - offset < wLength)
                 {
-                    if (setLocalTimestamp)
-                    {
-                        epochTimestamp = getEpochTime();
-                    }
-                    virtualChannel = bChannel;
+                    queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
+                    LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength - (capacity - offset) << " bytes discarded";
                 }
-
-                const auto wLength = serialToHost<uint16_t>(buf + 4);
-                if (returnedSize != frameHeaderSize + wLength)
+                else
                 {
-                    if (remainingSize < frameHeaderSize + wLength)
-                    {
-                        queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
-                        LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength + frameHeaderSize - remainingSize << " bytes discarded";
-                    }
-                    else
-                    {
-                        LOG(DEBUG) << "Data read thread - Packet length wrong: " << returnedSize << "; expected: " << (frameHeaderSize + wLength);
-                    }
-                    continue;
+                    LOG(DEBUG) << "Data read thread - Packet length wrong: " << vector.received << "; expected: " << (frameHeaderSize + wLength);
                 }
+                continue;
+            }
 
-                const auto wCounter = serialToHost<uint16_t>(buf + 2);
-                if (firstFrame)
-                {
+            const auto wCounter = serialToHost<uint16_t>(vector.header + 2);
+            if (firstFrame)
+            {
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
-                    if (wCounter != m_packetCounter)
-                    {
-                        LOG(DEBUG) << "Data read thread - First frame packet counter reset: received = 0x" << std::hex << wCounter << " , current = 0x" << m_packetCounter;
-                    }
-#endif
-                    firstFrame      = false;
-                    m_packetCounter = wCounter + 1;
-                }
-                else if (wCounter != m_packetCounter)
+                if (wCounter != m_packetCounter)
                 {
-                    LOG(INFO) << "Data read thread - Packet loss";
+                    LOG(DEBUG) << "Data read thread - First frame packet counter reset: received = 0x" << std::hex << wCounter << " , current = 0x" << m_packetCounter;
+                }
+#endif
+                firstFrame      = false;
+                m_packetCounter = wCounter + 1;
+            }
+            else if (wCounter != m_packetCounter)
+            {
+                LOG(INFO) << "Data read thread - Packet loss";
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
-                    LOG(DEBUG) << "     counter mismatch: received = 0x" << std::hex << wCounter << " , expected = 0x" << m_packetCounter;
+                LOG(DEBUG) << "     counter mismatch: received = 0x" << std::hex << wCounter << " , expected = 0x" << m_packetCounter;
 #endif
-                    m_packetCounter = wCounter + 1;
+                m_packetCounter = wCounter + 1;
 
-                    queueFrame(ErrorFrame::create(DataError_FrameDropped, bChannel));
+                queueFrame(ErrorFrame::create(DataError_FrameDropped, bChannel));
 
-                    if (!(bmPktType & DATA_FRAME_FLAG_FIRST))
-                    {
-                        // if this was a follow-up frame, discard the whole already received part
-                        buf = bufBegin;
+                if (!(bmPktType & DATA_FRAME_FLAG_FIRST))
+                {
+                    // if this was a follow-up frame, discard the whole already received part
+                    offset = 0;
 
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - discarding current frame";
+                    LOG(DEBUG) << "Data read thread - discarding current frame";
 #endif
-                        continue;
-                    }
-                }
-                else
-                {
-                    m_packetCounter++;
+                    continue;
                 }
+            }
+            else
+            {
+                m_packetCounter++;
+            }
 
-                if (bmPktType & DATA_FRAME_FLAG_FIRST)
+            if (bmPktType & DATA_FRAME_FLAG_FIRST)
+            {
+                if (offset != 0)
                 {
-                    if (buf != bufBegin)
-                    {
-                        // we already started receiving a frame, but now a new frame starts
-                        // copy received payload to the beginning of buffer, to try to continue with new frame
-                        std::copy(buf + frameHeaderSize, buf + frameHeaderSize + wLength, bufBegin);
-                        buf = bufBegin;  // continue normally for a single/first packet
+                    // we already started receiving a frame, but now a new frame starts
+                    // continue with the new frame at the beginning of the buffer
+                    offset = 0;
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - previous frame incomplete: wCounter = 0x" << std::hex << wCounter;
+                    LOG(DEBUG) << "Data read thread - previous frame incomplete: wCounter = 0x" << std::hex << wCounter;
 #endif
-                    }
                 }
-                else
+            }
+            else
+            {
+                if (offset == 0)
                 {
-                    if (buf == bufBegin)
-                    {
-                        // we expected a new frame, but we received a follow-up packet
+                    // we expected a new frame, but we received a follow-up packet
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - discarding unexpected follow-up packet";
+                    LOG(DEBUG) << "Data read thread - discarding unexpected follow-up packet";
 #endif
-                        continue;  // don't do anything with the received packet and start over
-                    }
+                    continue;  // don't do anything with the received packet and start over
+                }
 
-                    if (virtualChannel != bChannel)
-                    {
+                if (virtualChannel != bChannel)
+                {
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - Channel mismatch: received = 0x" << std::hex << static_cast<int>(bChannel) << " , expected = 0x" << static_cast<int>(virtualChannel);
+                    LOG(DEBUG) << "Data read thread - Channel mismatch: received = 0x" << std::hex << static_cast<int>(bChannel) << " , expected = 0x" << static_cast<int>(virtualChannel);
 #endif
-                        continue;  // don't do anything with the received packet and start over
-                    }
-
-                    // restore backup of previous packet, since we overwrote it with the beginning of the current packet
-                    std::copy(backup, backup + frameHeaderSize, buf);
+                    continue;  // don't do anything with the received packet and start over
                 }
+            }
 
-                buf += wLength;
+            if (capacity - offset < wLength)
+            {
+                queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
+                LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength - (capacity - offset) << " bytes discarded";
+                offset = 0;
+                continue;
+            }
+
+            // the payload is only moved if it did not arrive at its place
+            if (vector.payload != data + offset)
+            {
+                std::memmove(data + offset, vector.payload, wLength);
+            }
+            offset += wLength;
 
-                if (bmPktType & DATA_FRAME_FLAG_LAST)
+            if (bmPktType & DATA_FRAME_FLAG_LAST)
+            {
+                if (bmPktType & DATA_FRAME_FLAG_TIMESTAMP)
                 {
-                    if (bmPktType & DATA_FRAME_FLAG_TIMESTAMP)
-                    {
-                        buf -= sizeof(epochTimestamp);
-                        if (!setLocalTimestamp)
-                        {
-                            serialToHost(buf + frameHeaderSize, epochTimestamp);
-                        }
-                    }
-                    else if (!setLocalTimestamp)
+                    offset -= sizeof(epochTimestamp);
+                    if (!setLocalTimestamp)
                     {
-                        epochTimestamp = 0;
+                        serialToHost(data + offset, epochTimestamp);
                     }
+                }
+                else if (!setLocalTimestamp)
+                {
+                    epochTimestamp = 0;
+                }
 
-                    if (bmPktType & DATA_FRAME_FLAG_ERROR)
+                if (bmPktType & DATA_FRAME_FLAG_ERROR)
+                {
+                    uint32_t code;
+                    const auto errorFrameLength = sizeof(code) + ((bmPktType & DATA_FRAME_FLAG_TIMESTAMP) ? sizeof(epochTimestamp) : 0);
+                    if (wLength == errorFrameLength)
                     {
-                        uint32_t code;
-                        const auto errorFrameLength = sizeof(code) + ((bmPktType & DATA_FRAME_FLAG_TIMESTAMP) ? sizeof(epochTimestamp) : 0);
-                        if (wLength == errorFrameLength)
-                        {
-                            buf -= sizeof(code);
-                            serialToHost(buf + frameHeaderSize, code);
-                            queueFrame(ErrorFrame::create(code, bChannel, epochTimestamp));
-                        }
-                        else
-                        {
-                            buf -= wLength;
-                            DebugFrame::log(buf + frameHeaderSize, wLength, epochTimestamp);
-                        }
-                        buf = bufBegin;
+                        offset -= sizeof(code);
+                        serialToHost(data + offset, code);
+                        queueFrame(ErrorFrame::create(code, bChannel, epochTimestamp));
                     }
                     else
                     {
-                        frame->setDataOffset(bufferPrefixSize);
-                        frame->setDataSize(static_cast<uint32_t>(buf - bufBegin));
-                        frame->setVirtualChannel(virtualChannel);
-                        frame->setTimestamp(epochTimestamp);
-
-                        queueFrame(frame);
-                        frame = nullptr;
+                        offset -= wLength;
+                        DebugFrame::log(data + offset, wLength, epochTimestamp);
                     }
-
-                    break;
+                    offset = 0;
                 }
                 else
                 {
-                    // save backup of current packet, since it will be overwritten by next packet
-                    std::copy(buf, buf + frameHeaderSize, backup);
+                    // packets of the following frames in this batch must not stay in the queued buffer
+                    for (uint16_t j = i + 1; j < count; j++)
+                    {
+                        auto &next                 = vectors[j];
+                        uint8_t *const spillSlot   = spill.data() + (j * payloadStride);
+                        const uint16_t payloadSize = (next.received > frameHeaderSize) ? std::min<uint16_t>(next.received - frameHeaderSize, next.payloadLength) : 0;
+                        // after a previous frame of this batch, the payload may already be in its spill slot
+                        if (next.payload != spillSlot)
+                        {
+                            std::memmove(spillSlot, next.payload, payloadSize);
+                            next.payload = spillSlot;
+                        }
+                    }
+
+                    frame->setDataOffset(bufferPrefixSize);
+                    frame->setDataSize(offset);
+                    frame->setVirtualChannel(virtualChannel);
+                    frame->setTimestamp(epochTimestamp);
+
+                    queueFrame(frame);
+                    frame = nullptr;
                 }
             }
-            catch (const std::exception &e)
-            {
-                queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
-                LOG(DEBUG) << "Data read thread - " << e.what();
-            }
         }
     }
 
@@ -560,9 +638,9 @@ void BridgeEthernetData::dropPayload(uint16_t length)
 
 BridgeEthernetData::State BridgeEthernetData::handleFirstPacket(IFrame *&frame, uint8_t bmPktType, uint8_t bChannel, uint16_t wLength)
 {
-    // Reset everything of the frame in case it is re-used
+    // Reset everything of the frame in case it is re-used, the consumer may have moved the data offset
     frame->setVirtualChannel(bChannel);
-    frame->setDataSize(0);
+    frame->setDataOffsetAndSize(0, 0);
     frame->setTimestamp(setLocalTimestamp ? getEpochTime() : 0);
 
     return receivePayload(frame, wLength, bmPktType);
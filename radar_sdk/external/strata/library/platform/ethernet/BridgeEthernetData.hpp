@@ -31,6 +31,9 @@ public:
     // IBridgeData implementation
     void setFrameBufferSize(uint32_t size) override;
     void setFramePoolCount(uint16_t count) override;
+    void setReceiveBufferSize(uint32_t size) override;
+    void getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const override;
+    void resetFramePoolStatistics() override;
     void startStreaming() override;
     void stopStreaming() override;
 
@@ -40,6 +43,8 @@ private:
     FramePool m_framePool;
     ISocket &m_socket;
     uint8_t m_ipAddr[4];
+    uint32_t m_inputBufferSize;
+    uint32_t m_frameCapacity;  // maximum size of the data received for one frame
     std::thread m_dataThread;
     uint16_t m_packetCounter;
 
@@ -17,7 +17,8 @@ Frame::Frame(IFramePool *owner, uint32_t bufferSize) :
     m_owner {owner},
     m_offset {0},
     m_dataSize {0},
-    m_bufferSize {bufferSize}
+    m_bufferSize {bufferSize},
+    m_poolIndex {0}
 {
 }
 
@@ -40,6 +41,16 @@ void Frame::unpool()
     m_owner = nullptr;
 }
 
+uint32_t Frame::getPoolIndex() const
+{
+    return m_poolIndex;
+}
+
+void Frame::setPoolIndex(uint32_t index)
+{
+    m_poolIndex = index;
+}
+
 uint8_t *Frame::getData() const
 {
     return reinterpret_cast<uint8_t *>(m_buffer) + m_offset;
@@ -27,6 +27,10 @@ public:
     /* Release the frame from the pool */
     void unpool();
 
+    /* Position of the frame in the pool, assigned by the owner */
+    uint32_t getPoolIndex() const;
+    void setPoolIndex(uint32_t index);
+
     //IFrame
     uint8_t *getData() const override;
     uint32_t getDataSize() const override;
@@ -48,4 +52,5 @@ private:
     uint32_t m_offset;
     uint32_t m_dataSize;
     uint32_t m_bufferSize;
+    uint32_t m_poolIndex;
 };
@@ -83,10 +83,10 @@ void FrameForwarder::waitForThreadReturn()
     /// to make sure there are no race conditions, before changing anything referenced by the potentially
     /// still running thread, we wait for the flag m_returned, which signals that the thread actually has exited.
     /// This allows also calling stop() from the thread context in a callback
-    while (!m_threadReturned)
-    {
-        std::this_thread::yield();
-    }
+    std::unique_lock<std::mutex> lock(m_returnLock);
+    m_returnCv.wait(lock, [this] {
+        return m_threadReturned.load();
+    });
 }
 
 void FrameForwarder::forwardingThreadFunction()
@@ -100,5 +100,8 @@ void FrameForwarder::forwardingThreadFunction()
         }
     } while (!m_stopThread);
 
+    // notify while holding the lock, since the waiting thread may destroy this object right after waking up
+    std::lock_guard<std::mutex> lock(m_returnLock);
     m_threadReturned = true;
+    m_returnCv.notify_all();
 }
@@ -13,6 +13,8 @@
 #include <platform/interfaces/IFrameQueue.hpp>
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 
@@ -43,6 +45,8 @@ private:
     std::atomic<bool> m_isRunning;
     std::atomic<bool> m_stopThread;
     std::atomic<bool> m_threadReturned;
+    std::mutex m_returnLock;
+    std::condition_variable m_returnCv;
 
     std::thread m_forwardingThread;
     void forwardingThreadFunction();
@@ -13,10 +13,27 @@
 #include <common/cpp11/memory.hpp>
 #include <common/exception/EGenericException.hpp>
 
+#include <algorithm>
+
+
+constexpr uint32_t FramePool::chunkBits;
+constexpr uint32_t FramePool::chunkSize;
+constexpr uint32_t FramePool::maxChunks;
+constexpr uint32_t FramePool::invalidIndex;
 
 FramePool::FramePool() :
-    m_size {0}
+    m_size {0},
+    m_pendingCount {0},
+    m_nextIndex {0},
+    m_freeTop {invalidIndex},
+    m_freeCount {0},
+    m_count {0},
+    m_highWaterMark {0}
 {
+    for (auto &chunk : m_chunks)
+    {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 FramePool::~FramePool()
@@ -28,18 +45,102 @@ FramePool::~FramePool()
     // still access them.  This would indicate a bug, but we leave the still-accessible buffers
     // still allocated to hopefully avoid memory corruption.
     // If the size was not yet set (still 0), we don't need to worry about dequeued buffers
-    const auto dequedCount = m_pool.size() - m_queue.size();
+    const auto dequedCount = m_count.load() - m_freeCount.load();
     if (dequedCount && (m_size != 0))
     {
         LOG(ERROR) << "Destroying FramePool with some buffers still dequeued: " << std::dec << dequedCount << " of " << m_pool.size();
         for (auto &buffer : m_pool)
         {
+            const bool isFree = getSlot(buffer->getPoolIndex()).free.load();
             buffer->unpool();
-            buffer.release();  // NOLINT - we rather release the buffer, preferring a memory leak over memory corruption
+            auto *frame = buffer.release();  // NOLINT - we rather release the buffer, preferring a memory leak over memory corruption
+            if (isFree)
+            {
+                delete frame;
+            }
         }
-        for (auto buffer : m_queue)
+    }
+
+    for (auto &chunk : m_chunks)
+    {
+        delete[] chunk.load();
+    }
+}
+
+FramePool::Slot &FramePool::getSlot(uint32_t index) const
+{
+    return m_chunks[index >> chunkBits].load(std::memory_order_acquire)[index & (chunkSize - 1)];
+}
+
+void FramePool::addFrame(std::unique_ptr<Frame> frame)
+{
+    uint32_t index;
+    if (!m_unusedIndices.empty())
+    {
+        index = m_unusedIndices.back();
+        m_unusedIndices.pop_back();
+    }
+    else
+    {
+        index = m_nextIndex++;
+        auto &chunk = m_chunks[index >> chunkBits];
+        if (chunk.load(std::memory_order_relaxed) == nullptr)
         {
-            delete buffer;
+            auto *slots = new Slot[chunkSize];
+            for (uint32_t i = 0; i < chunkSize; i++)
+            {
+                slots[i].frame = nullptr;
+                slots[i].next.store(invalidIndex, std::memory_order_relaxed);
+                slots[i].free.store(false, std::memory_order_relaxed);
+            }
+            chunk.store(slots, std::memory_order_release);
+        }
+    }
+
+    frame->setPoolIndex(index);
+    getSlot(index).frame = frame.get();
+    m_pool.push_back(std::move(frame));
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    getSlot(index).free.store(true, std::memory_order_relaxed);
+    pushFree(index);
+}
+
+void FramePool::pushFree(uint32_t index)
+{
+    // counted before the buffer can be popped, so that the counter never drops below zero
+    m_freeCount.fetch_add(1, std::memory_order_relaxed);
+
+    auto &slot = getSlot(index);
+    uint64_t top = m_freeTop.load(std::memory_order_relaxed);
+    uint64_t newTop;
+    do
+    {
+        slot.next.store(static_cast<uint32_t>(top), std::memory_order_relaxed);
+        newTop = (((top >> 32) + 1) << 32) | index;
+    } while (!m_freeTop.compare_exchange_weak(top, newTop, std::memory_order_release, std::memory_order_relaxed));
+}
+
+Frame *FramePool::popFree()
+{
+    uint64_t top = m_freeTop.load(std::memory_order_acquire);
+    while (true)
+    {
+        const auto index = static_cast<uint32_t>(top);
+        if (index == invalidIndex)
+        {
+            return nullptr;
+        }
+
+        // the slot may be popped and pushed again meanwhile, then the tag has changed and the exchange fails
+        auto &slot        = getSlot(index);
+        const auto next   = slot.next.load(std::memory_order_relaxed);
+        const auto newTop = (((top >> 32) + 1) << 32) | next;
+        if (m_freeTop.compare_exchange_weak(top, newTop, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            slot.free.store(false, std::memory_order_relaxed);
+            m_freeCount.fetch_sub(1, std::memory_order_relaxed);
+            return slot.frame;
         }
     }
 }
@@ -57,19 +158,16 @@ void FramePool::setFrameBufferSize(uint32_t size)
     {
         for (auto &b : m_pool)
         {
-            if (b)
-            {
-                //Only resize if there are already real buffers in the queue
-                b->resizeBuffer(size);
-            }
-            else
-            {
-                //Create a real buffer
-                b.reset(new Frame(this, size));
-                m_queue.push_back(b.get());
-            }
+            //Only resize if there are already real buffers in the pool
+            b->resizeBuffer(size);
         }
         m_size = size;
+
+        //Create the real buffers which were requested before the size was known
+        while (m_pool.size() < m_pendingCount)
+        {
+            addFrame(std::make_unique<Frame>(this, m_size));
+        }
     }
 }
 
@@ -77,86 +175,104 @@ void FramePool::setFrameCount(uint16_t count)
 {
     std::lock_guard<std::mutex> lock(m_lock);
 
-    if ((m_size == 0) && (m_pool.size() != count))
+    m_pendingCount = count;
+    if (m_size == 0)
     {
-        //Fill the queue with empty pointers, will be initialized when setting size
-        m_pool.resize(count);
+        //The buffers will be created when setting size
         return;
     }
 
     if (m_pool.size() > count)
     {
         size_t delta = m_pool.size() - count;
-        if (delta > m_queue.size())
+        if (delta > m_freeCount.load())
         {
             LOG(ERROR) << "Too many buffers dequeued to reduce pool count";
-            delta = m_queue.size();  // only dequeue what we can
         }
 
         for (auto i = delta; i > 0; i--)
         {
-            IFrame *frame = m_queue.back();
-            m_queue.pop_back();
-            for (auto it = m_pool.begin(); it != m_pool.end(); it++)
+            Frame *frame = popFree();
+            if (frame == nullptr)
             {
-                if (frame == it->get())
-                {
-                    m_pool.erase(it);
-                    break;
-                }
+                break;  // only dequeue what we can
             }
+
+            const auto index = frame->getPoolIndex();
+            getSlot(index).frame = nullptr;
+            m_unusedIndices.push_back(index);
+            m_count.fetch_sub(1, std::memory_order_relaxed);
+
+            auto it = std::find_if(m_pool.begin(), m_pool.end(), [frame](const std::unique_ptr<Frame> &b) {
+                return b.get() == frame;
+            });
+            m_pool.erase(it);
         }
     }
 
     if (m_pool.size() < count)
     {
-        m_queue.reserve(count);
         m_pool.reserve(count);
 
         const size_t delta = count - m_pool.size();
         for (auto i = delta; i > 0; i--)
         {
-            auto buffer = std::make_unique<Frame>(this, m_size);
-            m_queue.push_back(buffer.get());
-            m_pool.push_back(std::move(buffer));
+            addFrame(std::make_unique<Frame>(this, m_size));
         }
     }
 }
 
 void FramePool::queueFrame(IFrame *frame)
 {
-    std::lock_guard<std::mutex> lock(m_lock);
     auto buffer = dynamic_cast<Frame *>(frame);
     if (buffer == nullptr)
     {
         throw EGenericException("Queueing a buffer that wasn't allocated by this class");
     }
 
-    for (auto &b : m_queue)
+    const auto index = buffer->getPoolIndex();
+    if ((m_chunks[index >> chunkBits].load(std::memory_order_acquire) == nullptr) || (getSlot(index).frame != buffer))
     {
-        if (b == buffer)
-        {
-            throw EGenericException("Queueing already-queued buffer");
-        }
+        throw EGenericException("Queueing a buffer that wasn't allocated by this class");
+    }
+
+    if (getSlot(index).free.exchange(true, std::memory_order_relaxed))
+    {
+        throw EGenericException("Queueing already-queued buffer");
     }
 
-    m_queue.push_back(buffer);
+    pushFree(index);
 }
 
 bool FramePool::initialized() const
 {
-    return m_size && !m_pool.empty();
+    return m_size && m_count.load();
 }
 
 IFrame *FramePool::dequeueFrame()
 {
-    std::lock_guard<std::mutex> lock(m_lock);
-
-    if (m_queue.empty())
+    IFrame *frame = popFree();
+    if (frame == nullptr)
     {
         return nullptr;
     }
-    IFrame *frame = m_queue.back();
-    m_queue.pop_back();
+
+    const auto dequeuedCount = m_count.load(std::memory_order_relaxed) - m_freeCount.load(std::memory_order_relaxed);
+    if (dequeuedCount > m_highWaterMark.load(std::memory_order_relaxed))
+    {
+        m_highWaterMark.store(dequeuedCount, std::memory_order_relaxed);
+    }
     return frame;
 }
+
+void FramePool::getStatistics(uint32_t &count, uint32_t &highWaterMark) const
+{
+    count         = m_count.load(std::memory_order_relaxed);
+    highWaterMark = m_highWaterMark.load(std::memory_order_relaxed);
+}
+
+void FramePool::resetStatistics()
+{
+    const auto dequeuedCount = m_count.load(std::memory_order_relaxed) - m_freeCount.load(std::memory_order_relaxed);
+    m_highWaterMark.store(m_size ? dequeuedCount : 0, std::memory_order_relaxed);
+}
@@ -12,11 +12,21 @@
 #include <platform/frames/Frame.hpp>
 #include <platform/interfaces/IFramePool.hpp>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 
+/**
+ * Pool of frame buffers.
+ *
+ * Getting and returning a buffer is lock-free, so that the receiving thread of a bridge
+ * never waits for the consumer (or any other thread) returning a buffer.
+ * The free buffers are kept in a LIFO stack, which reuses the most recently returned
+ * (and probably still cached) buffer first.
+ * Changing the size or count of the buffers takes a lock.
+ */
 class FramePool :
     public IFramePool
 {
@@ -31,11 +41,45 @@ public:
 
     bool initialized() const override;
 
+    /**
+     * Get the number of buffers and the maximum number of buffers dequeued at the same time
+     */
+    void getStatistics(uint32_t &count, uint32_t &highWaterMark) const;
+    void resetStatistics();
+
 private:
-    std::mutex m_lock;
+    // The free stack links the buffers by their index in a slot table.
+    // Slots are allocated in chunks and never moved, so a slot can be accessed without lock.
+    struct Slot
+    {
+        Frame *frame;
+        std::atomic<uint32_t> next;
+        std::atomic<bool> free;
+    };
 
-    uint32_t m_size;
+    static constexpr uint32_t chunkBits    = 8;
+    static constexpr uint32_t chunkSize    = 1u << chunkBits;
+    static constexpr uint32_t maxChunks    = 0x10000 / chunkSize;
+    static constexpr uint32_t invalidIndex = 0xFFFFFFFF;
 
+    Slot &getSlot(uint32_t index) const;
+    void addFrame(std::unique_ptr<Frame> frame);
+    void pushFree(uint32_t index);
+    Frame *popFree();
+
+    std::mutex m_lock;  // serializes configuration changes
+
+    uint32_t m_size;
     std::vector<std::unique_ptr<Frame>> m_pool;
-    std::vector<IFrame *> m_queue;
+    uint32_t m_pendingCount;  // frames to be created once the size is known
+    std::vector<uint32_t> m_unusedIndices;
+    uint32_t m_nextIndex;
+
+    std::atomic<Slot *> m_chunks[maxChunks];
+
+    // lower 32 bits: index of the top slot, upper 32 bits: tag incremented on each change to avoid ABA
+    std::atomic<uint64_t> m_freeTop;
+    std::atomic<uint32_t> m_freeCount;
+    std::atomic<uint32_t> m_count;
+    std::atomic<uint32_t> m_highWaterMark;
 };
@@ -11,11 +11,72 @@
 #include "ErrorFrame.hpp"
 #include <universal/data_definitions.h>
 
+#include <algorithm>
+
+
+namespace
+{
+    constexpr uint32_t defaultCapacity = 1024;
+
+    uint32_t roundUpToPowerOfTwo(uint32_t value)
+    {
+        uint32_t result = 1;
+        while ((result < value) && (result < 0x80000000u))
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::chrono::steady_clock::rep now()
+    {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+}
+
+constexpr uint64_t FrameQueue::gapFlag;
+
+FrameQueue::Ring::Ring(uint32_t capacity) :
+    capacity {capacity},
+    slots {new Slot[capacity]}
+{
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        slots[i].frame.store(nullptr, std::memory_order_relaxed);
+        slots[i].enqueued.store(0, std::memory_order_relaxed);
+    }
+}
+
+FrameQueue::RingUse::RingUse(std::atomic<uint32_t> &users) :
+    m_users(users)
+{
+    // pairs with the fence in reclaimRings(): either the ring is loaded after it was replaced,
+    // or the replacing thread sees this use and keeps the old ring
+    m_users.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+FrameQueue::RingUse::~RingUse()
+{
+    m_users.fetch_sub(1, std::memory_order_release);
+}
 
 FrameQueue::FrameQueue() :
-    m_queueing {false},
-    m_maxCount {0}
+    m_ring {nullptr},
+    m_producerRingUsers {0},
+    m_consumerRingUsers {0},
+    m_maxCount {0},
+    m_head {0},
+    m_tail {0},
+    m_policy {BackPressurePolicy::DropOldest},
+    m_newestDropped {false},
+    m_consumersWaiting {0},
+    m_producerWaiting {false},
+    m_highWaterMark {0},
+    m_trimmedCount {0},
+    m_queueing {false}
 {
+    resize(defaultCapacity);
 }
 
 FrameQueue::~FrameQueue()
@@ -24,114 +85,379 @@ FrameQueue::~FrameQueue()
     FrameQueue::clear();
 }
 
-void FrameQueue::trimQueue()
+void FrameQueue::resize(uint32_t capacity)
+{
+    // The ring is only replaced while the queue is stopped. A consumer that is still about to
+    // read may use the previous ring, which is kept with identical content until it is reclaimed.
+    std::unique_ptr<Ring> ring(new Ring(roundUpToPowerOfTwo(capacity)));
+    const auto *current = m_ring.load(std::memory_order_acquire);
+    if (current)
+    {
+        const uint64_t tail = m_tail.load(std::memory_order_acquire);
+        for (uint64_t i = m_head.load(std::memory_order_acquire) & ~gapFlag; i < tail; i++)
+        {
+            const auto &from = current->slots[i & (current->capacity - 1)];
+            auto &to         = ring->slots[i & (ring->capacity - 1)];
+            to.frame.store(from.frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            to.enqueued.store(from.enqueued.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+    m_ring.store(ring.get(), std::memory_order_release);
+    m_rings.push_back(std::move(ring));
+    reclaimRings();
+}
+
+void FrameQueue::reclaimRings()
 {
-    if (m_maxCount == 0)
+    // Only called with m_configLock held. A producer or consumer, which loaded an old ring,
+    // is still counted as user. Later ones load the current ring, so the old ones can be freed
+    // once no user is left. Otherwise this is tried again on the next configuration change or start.
+    if (m_rings.size() < 2)
     {
-        // no limitation on queue count
         return;
     }
 
-    if (m_queue.size() > m_maxCount)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if ((m_producerRingUsers.load(std::memory_order_acquire) == 0) && (m_consumerRingUsers.load(std::memory_order_acquire) == 0))
     {
-        // try to remove one more frame, since in the end we also want to prepend an error frame
-        auto count = m_queue.size() - m_maxCount + 1;
-        while (count--)
+        m_rings.erase(m_rings.begin(), m_rings.end() - 1);
+    }
+}
+
+uint32_t FrameQueue::getLimit() const
+{
+    const auto maxCount = m_maxCount.load(std::memory_order_relaxed);
+    return maxCount ? maxCount : m_ring.load(std::memory_order_acquire)->capacity;
+}
+
+bool FrameQueue::isFull(uint32_t needed) const
+{
+    const auto limit = getLimit();
+    return size() + std::min(needed, limit) > limit;
+}
+
+bool FrameQueue::isEmpty() const
+{
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    return !(head & gapFlag) && (head == m_tail.load(std::memory_order_acquire));
+}
+
+uint32_t FrameQueue::size() const
+{
+    // the head is read first, so the tail is never behind it
+    const uint64_t head = m_head.load(std::memory_order_acquire) & ~gapFlag;
+    return static_cast<uint32_t>(m_tail.load(std::memory_order_acquire) - head);
+}
+
+bool FrameQueue::dropOldest()
+{
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    while (true)
+    {
+        const uint64_t index = head & ~gapFlag;
+        if (index == m_tail.load(std::memory_order_acquire))
         {
-            auto frame = m_queue.front();
-            m_queue.pop_front();
+            return false;
+        }
+
+        const auto *ring = m_ring.load(std::memory_order_acquire);
+        auto *frame      = ring->slots[index & (ring->capacity - 1)].frame.load(std::memory_order_relaxed);
+
+        // the consumer may take the same frame meanwhile, then the exchange fails and we try the next one
+        if (m_head.compare_exchange_weak(head, (index + 1) | gapFlag, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            if (frame->getStatusCode() == DataError_NoError)
+            {
+                m_trimmedCount.fetch_add(1, std::memory_order_relaxed);
+            }
             frame->release();
+            return true;
+        }
+    }
+}
+
+void FrameQueue::trimQueue(uint32_t needed)
+{
+    // remove the oldest frames until the new ones fit, the consumer is informed by an error frame
+    while (isFull(needed) && dropOldest())
+    {
+    }
+}
+
+void FrameQueue::push(IFrame *frame)
+{
+    const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    const auto *ring    = m_ring.load(std::memory_order_acquire);
+    auto &slot          = ring->slots[tail & (ring->capacity - 1)];
+    slot.frame.store(frame, std::memory_order_relaxed);
+    slot.enqueued.store(now(), std::memory_order_relaxed);
+    m_tail.store(tail + 1, std::memory_order_release);
+}
+
+IFrame *FrameQueue::popFront()
+{
+    RingUse use(m_consumerRingUsers);
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    while (true)
+    {
+        if (head & gapFlag)
+        {
+            if (m_head.compare_exchange_weak(head, head & ~gapFlag, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return ErrorFrame::create(DataError_FrameQueueTrimmed, VIRTUAL_CHANNEL_UNDEFINED);
+            }
+            continue;
+        }
+
+        // the tail is read before the ring, so a ring replaced while stopped is always seen with its frames
+        if (head == m_tail.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        const auto *ring    = m_ring.load(std::memory_order_acquire);
+        const auto &slot    = ring->slots[head & (ring->capacity - 1)];
+        auto *frame         = slot.frame.load(std::memory_order_relaxed);
+        const auto enqueued = slot.enqueued.load(std::memory_order_relaxed);
+
+        // the producer may drop the same frame meanwhile, then the exchange fails and we try again
+        if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            m_latency.recordSince(std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(enqueued)));
+            notifyProducer();
+            return frame;
         }
-        m_queue.push_front(ErrorFrame::create(DataError_FrameQueueTrimmed, VIRTUAL_CHANNEL_UNDEFINED));
+    }
+}
+
+void FrameQueue::notifyConsumer()
+{
+    // pairs with the fence in blockingDequeue(): either the consumer sees the new frame, or we see it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumersWaiting.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(m_waitLock);
+        m_dataCv.notify_one();
+    }
+}
+
+void FrameQueue::notifyProducer()
+{
+    // only a blocked producer waits for space, the policy does not change while frames are queued
+    if (m_policy.load(std::memory_order_relaxed) != BackPressurePolicy::BlockProducer)
+    {
+        return;
+    }
+
+    // pairs with the fence in waitForSpace()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_producerWaiting.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(m_waitLock);
+        m_spaceCv.notify_all();
+    }
+}
+
+bool FrameQueue::waitForSpace(uint32_t needed)
+{
+    std::unique_lock<std::mutex> lock(m_waitLock);
+    m_producerWaiting.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    m_spaceCv.wait(lock, [&] {
+        return !m_queueing || (m_policy != BackPressurePolicy::BlockProducer) || !isFull(needed);
+    });
+    m_producerWaiting.store(false);
+    return m_queueing;
+}
+
+void FrameQueue::reserve(uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(m_configLock);
+    if (!m_queueing && (count > m_ring.load()->capacity))
+    {
+        resize(count);
     }
 }
 
 void FrameQueue::setMaxCount(uint32_t count)
 {
-    std::unique_lock<std::mutex> lock(m_lock);
+    std::lock_guard<std::mutex> lock(m_configLock);
+    const auto capacity = m_ring.load()->capacity;
+    if (count > capacity)
+    {
+        if (m_queueing)
+        {
+            count = capacity;
+        }
+        else
+        {
+            resize(count);
+        }
+    }
     m_maxCount = count;
-    trimQueue();
+    trimQueue(0);
+    notifyProducer();
+}
+
+void FrameQueue::setPolicy(BackPressurePolicy policy)
+{
+    m_policy = policy;
+    std::lock_guard<std::mutex> lock(m_waitLock);
+    m_spaceCv.notify_all();
 }
 
 void FrameQueue::enqueue(IFrame *frame)
 {
-    if (m_queueing)
+    if (!m_queueing)
     {
-        std::unique_lock<std::mutex> lock(m_lock);
-        m_queue.push_back(frame);
-        trimQueue();
-        m_cv.notify_one();
+        frame->release();
+        return;
     }
-    else
+
+    RingUse use(m_producerRingUsers);
+
+    // a pending error frame also needs a place in the queue
+    const uint32_t needed = m_newestDropped ? 2 : 1;
+    if (isFull(needed))
     {
-        frame->release();
+        switch (m_policy.load(std::memory_order_relaxed))
+        {
+            case BackPressurePolicy::DropNewest:
+                // the consumer is informed about the gap before the next frame that fits into the queue
+                m_newestDropped = true;
+                m_trimmedCount.fetch_add(1, std::memory_order_relaxed);
+                frame->release();
+                return;
+            case BackPressurePolicy::BlockProducer:
+                if (!waitForSpace(needed))
+                {
+                    frame->release();
+                    return;
+                }
+                break;
+            default:
+                trimQueue(needed);
+                break;
+        }
+    }
+
+    if (m_newestDropped.exchange(false))
+    {
+        push(ErrorFrame::create(DataError_FrameQueueTrimmed, VIRTUAL_CHANNEL_UNDEFINED));
+    }
+    push(frame);
+
+    const auto depth = size();
+    if (depth > m_highWaterMark.load(std::memory_order_relaxed))
+    {
+        m_highWaterMark.store(depth, std::memory_order_relaxed);
     }
+    notifyConsumer();
 }
 
 IFrame *FrameQueue::dequeue()
 {
-    std::unique_lock<std::mutex> lock(m_lock);
-    if (!m_queueing || m_queue.empty())
+    if (!m_queueing)
     {
         return nullptr;
     }
 
-    auto frame = m_queue.front();
-    m_queue.pop_front();
-    return frame;
+    return popFront();
 }
 
 IFrame *FrameQueue::blockingDequeue(uint16_t timeoutMs)
 {
+    auto *frame = popFront();
+    if (frame || !m_queueing)
+    {
+        return frame;
+    }
+
     //Predicate for the condition_variable to exit
     auto predicate = [&] {
-        return (!m_queueing || !m_queue.empty());
+        return (!m_queueing || !isEmpty());
     };
 
-    std::unique_lock<std::mutex> lock(m_lock);
-
-    //Wait for new frames or timeout. The condition variable checks the predicate before blocking.
-    if (timeoutMs != 0)
-    {
-        m_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), predicate);
-    }
-    else
     {
-        m_cv.wait(lock, predicate);
-    }
+        std::unique_lock<std::mutex> lock(m_waitLock);
+        m_consumersWaiting.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
 
-    if (m_queue.empty())
-    {
-        return nullptr;
+        //Wait for new frames or timeout. The condition variable checks the predicate before blocking.
+        if (timeoutMs != 0)
+        {
+            m_dataCv.wait_for(lock, std::chrono::milliseconds(timeoutMs), predicate);
+        }
+        else
+        {
+            m_dataCv.wait(lock, predicate);
+        }
+        m_consumersWaiting.fetch_sub(1);
     }
 
-    auto frame = m_queue.front();
-    m_queue.pop_front();
-    return frame;
+    return popFront();
 }
 
 void FrameQueue::clear()
 {
     // release buffers before clearing the queue, since this is expected by the consumer
-    std::unique_lock<std::mutex> lock(m_lock);
-    if (!m_queue.empty())
+    std::lock_guard<std::mutex> lock(m_configLock);
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    while (true)
     {
-        for (auto &frame : m_queue)
+        const uint64_t index = head & ~gapFlag;
+        if (index == m_tail.load(std::memory_order_acquire))
+        {
+            if ((head & gapFlag) && !m_head.compare_exchange_weak(head, index, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                continue;
+            }
+            break;
+        }
+
+        const auto *ring = m_ring.load(std::memory_order_acquire);
+        auto *frame      = ring->slots[index & (ring->capacity - 1)].frame.load(std::memory_order_relaxed);
+        if (m_head.compare_exchange_weak(head, index + 1, std::memory_order_acq_rel, std::memory_order_acquire))
         {
             frame->release();
+            head = index + 1;
         }
-        m_queue.clear();
     }
+    m_newestDropped = false;
+    notifyProducer();
 }
 
 void FrameQueue::start()
 {
+    std::lock_guard<std::mutex> lock(m_configLock);
+    reclaimRings();
     m_queueing = true;
 }
 
 bool FrameQueue::stop()
 {
-    const bool wasQueueing = m_queueing.exchange(false);
-    m_cv.notify_all();  //using notify_all in case multiple threads are waiting for frames
+    bool wasQueueing;
+    {
+        // lock to update the condition variables without race condition
+        std::unique_lock<std::mutex> lock(m_waitLock);
+        wasQueueing = m_queueing.exchange(false);
+    }
+    m_dataCv.notify_all();  //using notify_all in case multiple threads are waiting for frames
+    m_spaceCv.notify_all();
     return wasQueueing;
 }
+
+void FrameQueue::getStatistics(uint32_t &depth, uint32_t &highWaterMark, uint64_t &trimmedCount, LatencyHistogram::Snapshot &latency) const
+{
+    depth         = size();
+    highWaterMark = m_highWaterMark.load(std::memory_order_relaxed);
+    trimmedCount  = m_trimmedCount.load(std::memory_order_relaxed);
+    m_latency.getSnapshot(latency);
+}
+
+void FrameQueue::resetStatistics()
+{
+    m_highWaterMark = size();
+    m_trimmedCount  = 0;
+    m_latency.reset();
+}
@@ -11,14 +11,29 @@
 
 #include <Definitions.hpp>
 #include <platform/interfaces/IFrameListener.hpp>
+#include <common/LatencyHistogram.hpp>
+#include <platform/interfaces/IBridgeData.hpp>
 #include <platform/interfaces/IFrameQueue.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <deque>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 
+///
+/// Bounded queue of frames between one producer (the receiving thread of a bridge)
+/// and one consumer.
+///
+/// Enqueueing and dequeueing are lock-free. The frames are kept in a ring buffer,
+/// the consumer advances the head, the producer advances the tail.
+/// To drop the oldest frames when the queue is full, the producer also advances the head
+/// and marks the gap in it, so that the consumer receives an error frame at the right position.
+/// A blocking call only takes a lock if it actually has to wait, and the other side only
+/// takes the lock to wake it up if somebody is waiting.
+///
 class FrameQueue :
     public IFrameQueue
 {
@@ -29,9 +44,27 @@ public:
     ///
     /// Set the maximum number of entries in the queue.
     /// When there are too many entries queued, the oldest one will be deleted (circular buffer).
-    /// @param count The maximum number, 0 means no limitation
+    /// While the queue is started, the count is limited to the capacity reserved before.
+    /// @param count The maximum number, 0 means the whole capacity (at least 1024 frames)
     STRATA_API void setMaxCount(uint32_t count);
 
+    ///
+    /// Reserve capacity for the given number of entries, so that setMaxCount() can grow the queue
+    /// up to this count while the queue is started. Has only an effect while the queue is stopped.
+    /// @param count The number of entries
+    STRATA_API void reserve(uint32_t count);
+
+    ///
+    /// Set what happens to a new frame when the queue is full (see BackPressurePolicy).
+    /// BackPressurePolicy::Grow is handled by the owner of the queue, the queue itself drops the oldest frames.
+    /// @param policy The policy to apply
+    STRATA_API void setPolicy(BackPressurePolicy policy);
+
+    ///
+    /// \return the number of frames currently in the queue
+    ///
+    STRATA_API uint32_t size() const;
+
     ///
     /// Clear the queue and free all frames
     ///
@@ -39,6 +72,8 @@ public:
 
     ///
     /// Enqueues a frame at the end of the queue
+    /// Only one thread at a time may enqueue frames.
+    /// With BackPressurePolicy::BlockProducer, this blocks while the queue is full.
     /// \param frame Pointer to the frame to enqueue. Ownership is taken by this function.
     ///
     STRATA_API void enqueue(IFrame *frame);
@@ -67,13 +102,86 @@ public:
     ///
     STRATA_API bool stop() override;
 
+    ///
+    /// Get the usage of the queue
+    /// \param depth Number of frames currently in the queue
+    /// \param highWaterMark Maximum number of frames that were in the queue
+    /// \param trimmedCount Number of frames removed because the queue was full
+    /// \param latency Time the frames spent in the queue
+    ///
+    STRATA_API void getStatistics(uint32_t &depth, uint32_t &highWaterMark, uint64_t &trimmedCount, LatencyHistogram::Snapshot &latency) const;
+
+    ///
+    /// Reset the values returned by getStatistics()
+    ///
+    STRATA_API void resetStatistics();
+
 private:
-    void trimQueue();
+    struct Slot
+    {
+        std::atomic<IFrame *> frame;
+        std::atomic<std::chrono::steady_clock::rep> enqueued;
+    };
+
+    struct Ring
+    {
+        explicit Ring(uint32_t capacity);
+
+        uint32_t capacity;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    // set in m_head when the oldest frames were dropped, until the consumer got the error frame
+    static constexpr uint64_t gapFlag = 1ull << 63;
+
+    // marks a producer or consumer accessing the ring, see reclaimRings()
+    class RingUse
+    {
+    public:
+        explicit RingUse(std::atomic<uint32_t> &users);
+        ~RingUse();
+
+    private:
+        std::atomic<uint32_t> &m_users;
+    };
+
+    void resize(uint32_t capacity);
+    void reclaimRings();
+    uint32_t getLimit() const;
+    bool isFull(uint32_t needed) const;
+    bool isEmpty() const;
+    bool dropOldest();
+    void trimQueue(uint32_t needed);
+    void push(IFrame *frame);
+    IFrame *popFront();
+    bool waitForSpace(uint32_t needed);
+    void notifyConsumer();
+    void notifyProducer();
+
+    std::mutex m_configLock;                   //serializes setMaxCount(), reserve() and clear()
+    std::vector<std::unique_ptr<Ring>> m_rings;  //the last one is in use, older ones are kept until no reader is left
+    std::atomic<Ring *> m_ring;
+    std::atomic<uint32_t> m_producerRingUsers;  //producers and consumers count separately,
+    char m_usersPadding[64];                    //so that they do not share a cache line
+    std::atomic<uint32_t> m_consumerRingUsers;
+    std::atomic<uint32_t> m_maxCount;          //maximum number of elements in the queue
+
+    std::atomic<uint64_t> m_head;              //index of the oldest frame, with gapFlag
+    char m_padding[64];                        //keep producer and consumer index in different cache lines
+    std::atomic<uint64_t> m_tail;              //index of the next frame to be enqueued
+
+    std::atomic<BackPressurePolicy> m_policy;
+    std::atomic<bool> m_newestDropped;         //an error frame has to be queued before the next frame
+
+    std::mutex m_waitLock;
+    std::condition_variable m_dataCv;          //signalled when a frame was added
+    std::condition_variable m_spaceCv;         //signalled when a frame was removed
+    std::atomic<uint32_t> m_consumersWaiting;
+    std::atomic<bool> m_producerWaiting;
 
-    std::mutex m_lock;
-    std::deque<IFrame *> m_queue;
-    std::condition_variable m_cv;
+    std::atomic<uint32_t> m_highWaterMark;
+    std::atomic<uint64_t> m_trimmedCount;
+    LatencyHistogram m_latency;
 
     std::atomic<bool> m_queueing;  //true as long as the queue works
-    uint32_t m_maxCount;           //maximum number of elements in the queue
 };
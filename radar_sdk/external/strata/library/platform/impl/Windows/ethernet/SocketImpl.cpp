@@ -171,3 +171,43 @@ uint16_t SocketImpl::receive(uint8_t buffer[], uint16_t length)
 
     return static_cast<uint16_t>(ret);
 }
+
+uint16_t SocketImpl::receiveMultiple(ReceiveVector vectors[], uint16_t count)
+{
+    // Windows has no call to receive several datagrams at once,
+    // so only wait for the first one and take the others while they are available.
+    uint16_t received = 0;
+    while ((received < count) && ((received == 0) || checkInputBuffer()))
+    {
+        auto &vector     = vectors[received];
+        WSABUF buffers[] = {
+            {vector.headerLength, reinterpret_cast<CHAR *>(vector.header)},
+            {vector.payloadLength, reinterpret_cast<CHAR *>(vector.payload)},
+        };
+        DWORD bytes   = 0;
+        DWORD flags   = 0;
+        const int ret = ::WSARecv(m_socket, buffers, 2, &bytes, &flags, nullptr, nullptr);
+        if (ret == SOCKET_ERROR)
+        {
+            const int code = WSAGetLastError();
+            if (code == WSAETIMEDOUT)
+            {
+                //LOG(DEBUG) << "SocketImpl::receiveMultiple - WSARecv() timeout";
+                break;
+            }
+            else if (code == WSAEMSGSIZE)
+            {
+                //LOG(DEBUG) << "SocketImpl::receiveMultiple - WSARecv() message size greater than provided buffer";
+                bytes = vector.headerLength + vector.payloadLength;
+            }
+            else
+            {
+                throw EConnection("SocketImpl::receiveMultiple - WSARecv() failed", code);
+            }
+        }
+
+        vector.received = static_cast<uint16_t>(bytes);
+        received++;
+    }
+    return received;
+}
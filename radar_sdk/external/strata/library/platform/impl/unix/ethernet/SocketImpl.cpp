@@ -12,15 +12,24 @@
 #include <common/Logger.hpp>
 #include <platform/exception/EConnection.hpp>
 
+#include <algorithm>
 #include <errno.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #define INVALID_SOCKET -1
 
 
+namespace
+{
+    // number of datagrams received with one system call
+    constexpr const uint16_t maxReceiveVectors = 64;
+}
+
+
 SocketImpl::SocketImpl() :
     m_socket {INVALID_SOCKET}
 {
@@ -38,6 +47,15 @@ void SocketImpl::setInputBufferSize(uint32_t size)
     if (ret < 0)
     {
         LOG(ERROR) << "SocketImpl::setInputBufferSize - error setting SO_RCVBUF: " << errno;
+        return;
+    }
+
+    // the kernel silently limits the size, which is a common reason for lost packets
+    int actual       = 0;
+    socklen_t length = sizeof(actual);
+    if ((::getsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &actual, &length) == 0) && (actual < param))
+    {
+        LOG(WARN) << "SocketImpl::setInputBufferSize - SO_RCVBUF limited to " << actual << " bytes instead of " << size;
     }
 }
 
@@ -174,3 +192,67 @@ uint16_t SocketImpl::receive(uint8_t buffer[], uint16_t length)
 
     return static_cast<uint16_t>(ret);
 }
+
+uint16_t SocketImpl::receiveMultiple(ReceiveVector vectors[], uint16_t count)
+{
+    count = std::min(count, maxReceiveVectors);
+
+    struct iovec iov[maxReceiveVectors][2];
+    for (uint16_t i = 0; i < count; i++)
+    {
+        iov[i][0].iov_base = vectors[i].header;
+        iov[i][0].iov_len  = vectors[i].headerLength;
+        iov[i][1].iov_base = vectors[i].payload;
+        iov[i][1].iov_len  = vectors[i].payloadLength;
+    }
+
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+    struct mmsghdr messages[maxReceiveVectors] = {};
+    for (uint16_t i = 0; i < count; i++)
+    {
+        messages[i].msg_hdr.msg_iov    = iov[i];
+        messages[i].msg_hdr.msg_iovlen = 2;
+    }
+
+    // wait (up to the timeout) only for the first datagram, take all others which are already there
+    const int ret = ::recvmmsg(m_socket, messages, count, MSG_WAITFORONE, nullptr);
+    if (ret < 0)
+    {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            //LOG(DEBUG) << "SocketImpl::receiveMultiple - recvmmsg() timeout";
+            return 0;
+        }
+        throw EConnection("SocketImpl::receiveMultiple - recvmmsg() failed", errno);
+    }
+
+    for (int i = 0; i < ret; i++)
+    {
+        vectors[i].received = static_cast<uint16_t>(messages[i].msg_len);
+    }
+    return static_cast<uint16_t>(ret);
+#else
+    // portable fallback: one system call per datagram, but still scattered into the given buffers
+    uint16_t received = 0;
+    while (received < count)
+    {
+        struct msghdr message = {};
+        message.msg_iov       = iov[received];
+        message.msg_iovlen    = 2;
+
+        const ssize_t ret = ::recvmsg(m_socket, &message, received ? MSG_DONTWAIT : 0);
+        if (ret < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                break;
+            }
+            throw EConnection("SocketImpl::receiveMultiple - recvmsg() failed", errno);
+        }
+
+        vectors[received].received = static_cast<uint16_t>(ret);
+        received++;
+    }
+    return received;
+#endif
+}
@@ -42,6 +42,7 @@ public:
 
     void send(const uint8_t buffer[], uint16_t length) override;
     uint16_t receive(uint8_t buffer[], uint16_t length) override;
+    uint16_t receiveMultiple(ReceiveVector vectors[], uint16_t count) override;
 
 protected:
     using SocketType = int;
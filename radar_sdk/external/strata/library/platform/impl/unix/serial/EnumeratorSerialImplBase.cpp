@@ -12,8 +12,6 @@
 #include <platform/serial/BoardSerial.hpp>
 #include <platform/templates/enumerateFunction.hpp>
 
-#include <glob.h>
-
 
 EnumeratorSerialImplBase::EnumeratorSerialImplBase(const char *devBegin[], const char *devEnd[]) :
     m_devBegin {devBegin},
@@ -21,14 +19,18 @@ EnumeratorSerialImplBase::EnumeratorSerialImplBase(const char *devBegin[], const
 {
 }
 
-void EnumeratorSerialImplBase::enumerate(IEnumerationListener &listener, BoardData::const_iterator begin, BoardData::const_iterator end)
+void EnumeratorSerialImplBase::findDevices(glob_t &results)
 {
-    glob_t glob_results = {};
-
     for (auto d = m_devBegin; d < m_devEnd; d++)
     {
-        glob(*d, GLOB_APPEND, nullptr, &glob_results);
+        glob(*d, GLOB_APPEND, nullptr, &results);
     }
+}
+
+void EnumeratorSerialImplBase::enumerate(IEnumerationListener &listener, BoardData::const_iterator begin, BoardData::const_iterator end)
+{
+    glob_t glob_results = {};
+    findDevices(glob_results);
 
     for (uint_fast16_t i = 0; i < glob_results.gl_pathc; i++)
     {
@@ -40,3 +42,18 @@ void EnumeratorSerialImplBase::enumerate(IEnumerationListener &listener, BoardDa
 
     globfree(&glob_results);
 }
+
+std::string EnumeratorSerialImplBase::getDeviceSignature()
+{
+    glob_t glob_results = {};
+    findDevices(glob_results);
+
+    std::string signature;
+    for (uint_fast16_t i = 0; i < glob_results.gl_pathc; i++)
+    {
+        signature.append(glob_results.gl_pathv[i]).push_back(';');
+    }
+
+    globfree(&glob_results);
+    return signature;
+}
@@ -11,6 +11,8 @@
 
 #include <platform/interfaces/IEnumerator.hpp>
 
+#include <glob.h>
+
 
 class EnumeratorSerialImplBase :
     public IEnumerator
@@ -19,11 +21,14 @@ public:
     EnumeratorSerialImplBase() = delete;
 
     void enumerate(IEnumerationListener &listener, BoardData::const_iterator begin, BoardData::const_iterator end) override;
+    std::string getDeviceSignature() override;
 
 protected:
     EnumeratorSerialImplBase(const char *devBegin[], const char *devEnd[]);
 
 private:
+    void findDevices(glob_t &results);
+
     const char **m_devBegin;
     const char **m_devEnd;
 };
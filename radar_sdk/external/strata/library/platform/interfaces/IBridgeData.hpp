@@ -10,6 +10,44 @@
 #pragma once
 
 #include "IFrameListener.hpp"
+#include <common/LatencyHistogram.hpp>
+
+#include <cstdint>
+
+
+/**
+ * Behaviour of the data path when frames are received faster than the consumer fetches them.
+ */
+enum class BackPressurePolicy
+{
+    DropOldest,     ///< a full queue discards its oldest frames (default)
+    DropNewest,     ///< a full queue discards newly received frames
+    BlockProducer,  ///< the receiving thread waits until the consumer fetched a frame
+    Grow,           ///< queue and frame pool grow in chunks up to a limit, then the oldest frames are discarded
+};
+
+
+/**
+ * Counters of the data path of a bridge.
+ * The frames are the data frames sent by the board (e.g. slices of a radar frame).
+ */
+struct BridgeDataStatistics
+{
+    uint64_t framesReceived;                    ///< frames successfully received and queued
+    uint64_t framesDropped;                     ///< DataError_FrameDropped reported by the bridge
+    uint64_t framePoolDepleted;                 ///< frames lost because no buffer was available
+    uint64_t frameSizeExceeded;                 ///< frames lost because the buffer was too small
+    uint64_t framesTrimmed;                     ///< frames removed because the queue was full
+    uint64_t otherErrors;                       ///< other error frames, e.g. a FIFO overflow on the board
+
+    uint32_t queueDepth;                        ///< frames currently waiting in the queue
+    uint32_t queueHighWaterMark;                ///< maximum number of frames waiting in the queue
+    uint32_t framePoolSize;                     ///< number of buffers in the frame pool
+    uint32_t framePoolHighWaterMark;            ///< maximum number of buffers in use at the same time
+
+    LatencyHistogram::Snapshot receiveLatency;  ///< first packet of a frame received until frame queued
+    LatencyHistogram::Snapshot queueLatency;    ///< frame queued until frame fetched by the consumer
+};
 
 
 class IBridgeData
@@ -31,6 +69,45 @@ public:
      */
     virtual void setFrameQueueSize(uint16_t count) = 0;
 
+    /**
+     * Set the behaviour of a full frame queue. Must not be called while streaming.
+     * With BackPressurePolicy::Grow, the queue starts with the size given to setFrameQueueSize()
+     * and grows in chunks of that size up to maxCount frames. When the queue is not used
+     * for a while, it shrinks again in chunks.
+     * Bridges that do not support back pressure keep discarding the oldest frames.
+     * Bridges that must not block while receiving drop the newest frames instead of blocking the producer.
+     *
+     * @param policy The policy to apply
+     * @param maxCount Maximum number of frames in the queue for BackPressurePolicy::Grow, ignored otherwise
+     */
+    virtual void setBackPressurePolicy(BackPressurePolicy /*policy*/, uint16_t /*maxCount*/ = 0)
+    {
+    }
+
+    /**
+     * Set the size of the receive buffer of the operating system, for bridges receiving data over a socket.
+     * A larger buffer avoids losing packets while the receiving thread is not scheduled.
+     * The operating system may limit the size (e.g. net.core.rmem_max on Linux).
+     * Bridges without a socket ignore this setting.
+     *
+     * @param size The size in bytes
+     */
+    virtual void setReceiveBufferSize(uint32_t /*size*/)
+    {
+    }
+
+    /**
+     * Set the asynchronous transfers kept queued while streaming, for bridges receiving data over USB.
+     * More transfers bridge longer delays of the receiving thread. Must not be called while streaming.
+     * Bridges without asynchronous transfers ignore this setting.
+     *
+     * @param count Number of transfers queued at the same time
+     * @param size Size of each transfer in bytes, the bridge may round it up
+     */
+    virtual void setTransferRing(uint16_t /*count*/, uint32_t /*size*/)
+    {
+    }
+
     /**
       * Removes all frames from the internal frame queue
       */
@@ -66,4 +143,22 @@ public:
      * @return pointer to frame or nullptr if no frame was received within the timeout
      */
     virtual IFrame *getFrame(uint16_t timeoutMs = 5000) = 0;
+
+    /**
+     * Get the counters of the data path since creation or the last call to resetStatistics().
+     * Bridges that do not collect statistics report all values as zero.
+     *
+     * @param statistics The structure to be filled
+     */
+    virtual void getStatistics(BridgeDataStatistics &statistics) const
+    {
+        statistics = {};
+    }
+
+    /**
+     * Reset all counters of the data path
+     */
+    virtual void resetStatistics()
+    {
+    }
 };
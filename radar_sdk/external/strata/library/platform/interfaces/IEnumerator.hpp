@@ -11,6 +11,8 @@
 
 #include <platform/BoardDescriptor.hpp>
 
+#include <string>
+
 
 class IEnumerationListener
 {
@@ -27,4 +29,13 @@ public:
     virtual ~IEnumerator() = default;
 
     virtual void enumerate(IEnumerationListener &listener, BoardData::const_iterator begin, BoardData::const_iterator end) = 0;
+
+    ///
+    /// Describes the devices which would be enumerated, without opening them.
+    /// It changes when devices are plugged or unplugged, an empty string means that this is not detected.
+    ///
+    virtual std::string getDeviceSignature()
+    {
+        return {};
+    }
 };
@@ -100,5 +100,31 @@ public:
     */
     virtual uint16_t receive(uint8_t buffer[], uint16_t length) = 0;
 
+    /**
+    * Describes where to store one datagram for receiveMultiple().
+    * The first headerLength bytes are stored in header, the remaining ones in payload.
+    */
+    struct ReceiveVector
+    {
+        uint8_t *header;
+        uint16_t headerLength;
+        uint8_t *payload;
+        uint16_t payloadLength;
+        uint16_t received;  ///< number of bytes stored in header and payload
+    };
+
+    /**
+    * Receive several datagrams with as few system calls as possible.
+    * The function waits up to the timeout for the first datagram,
+    * then it only returns the ones which are already available.
+    * If a buffer is smaller than the datagram, the remainder of the datagram will be lost.
+    * This is only supported for Mode::Datagram.
+    *
+    * @param vectors descriptors of where to store the datagrams
+    * @param count maximum number of datagrams to receive
+    * @return the number of datagrams received, 0 if there was none
+    */
+    virtual uint16_t receiveMultiple(ReceiveVector vectors[], uint16_t count) = 0;
+
     virtual bool dumpPacket() = 0;
 };
@@ -9,7 +9,6 @@
 
 #include "BridgeLibUsb.hpp"
 #include "LibUsbHelper.hpp"
-#include <common/Buffer.hpp>
 #include <common/Logger.hpp>
 #include <common/Serialization.hpp>
 #include <common/Time.hpp>
@@ -21,6 +20,8 @@
 #include <platform/frames/ErrorFrame.hpp>
 #include <universal/protocol/protocol_definitions.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 
 
@@ -31,14 +32,20 @@ namespace
 {
     constexpr bool setLocalTimestamp = false;
 
-    constexpr const uint16_t frameHeaderSize   = 6;
-    constexpr const uint32_t timestampSize     = sizeof(uint64_t);
-    constexpr const uint32_t bufferPrefixSize  = sizeof(uint64_t);
-    constexpr const uint32_t bufferPrefixStart = bufferPrefixSize - frameHeaderSize;
+    constexpr const uint16_t frameHeaderSize  = 6;
+    constexpr const uint32_t timestampSize    = sizeof(uint64_t);
+    constexpr const uint32_t bufferPrefixSize = sizeof(uint64_t);
 
     constexpr const uint16_t controlTimeout = 1000;
     constexpr const uint16_t dataTimeout    = 200;
-    constexpr const uint16_t dumpTimeout    = 10;
+
+    constexpr const uint16_t defaultTransferCount = 8;
+
+    // failed transfers are resubmitted until this many failures happened in a row
+    constexpr const uint32_t maxConsecutiveFailures = 16;
+
+    // time to wait for cancelled transfers to finish, before they are given up
+    constexpr const uint16_t cancelTimeout = 2000;
 
     constexpr const int defaultInterface       = 0;
     constexpr const unsigned char dataEndpoint = LIBUSB_DATA_ENDPOINT;
@@ -50,7 +57,12 @@ BridgeLibUsb::BridgeLibUsb(libusb_device *device, int fd) :
     m_context {LibUsbHelper::defaultContext},
     m_device {device},
     m_fd {fd},
-    m_deviceHandle {nullptr}
+    m_deviceHandle {nullptr},
+    m_transferCount {defaultTransferCount},
+    m_transferSize {m_maxPacketSize},
+    m_pendingTransfers {0},
+    m_consecutiveFailures {0},
+    m_frame {nullptr}
 {
     if (m_fd && m_device)
     {
@@ -142,6 +154,28 @@ void BridgeLibUsb::setFramePoolCount(uint16_t count)
     m_framePool.setFrameCount(count);
 }
 
+void BridgeLibUsb::setBackPressurePolicy(BackPressurePolicy policy, uint16_t maxCount)
+{
+    // Frames are queued from the transfer callbacks, which must not block. They may be called
+    // by a thread doing a control transfer, and the other transfers would not be resubmitted.
+    if (policy == BackPressurePolicy::BlockProducer)
+    {
+        LOG(DEBUG) << "BridgeLibUsb::setBackPressurePolicy - blocking is not supported, dropping the newest frames instead";
+        policy = BackPressurePolicy::DropNewest;
+    }
+    BridgeData::setBackPressurePolicy(policy, maxCount);
+}
+
+void BridgeLibUsb::getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const
+{
+    m_framePool.getStatistics(count, highWaterMark);
+}
+
+void BridgeLibUsb::resetFramePoolStatistics()
+{
+    m_framePool.resetStatistics();
+}
+
 IBridgeControl *BridgeLibUsb::getIBridgeControl()
 {
     return &m_protocol;
@@ -265,249 +299,395 @@ void BridgeLibUsb::vendorTransfer(uint8_t bRequest, uint16_t wValue, uint16_t wI
     wLengthReceive = controlEndpointReadChecked(VENDOR_REQ_TRANSFER_2, bRequest, wValue, wIndex, wLengthReceive, bufferReceive);
 }
 
-bool BridgeLibUsb::dumpPacket()
+void BridgeLibUsb::setTransferRing(uint16_t count, uint32_t size)
 {
-    try
+    if (isBridgeDataStarted())
     {
-        stdext::buffer<uint8_t> buf(LIBUSB_MAX_DATA_LENGTH);
-        return (LibUsbHelper::readBulk(m_deviceHandle, (LIBUSB_ENDPOINT_IN | dataEndpoint), buf.data(), LIBUSB_MAX_DATA_LENGTH, dumpTimeout) > 0);
+        throw EBridgeData("The transfers cannot be changed while streaming");
     }
-    catch (const EProtocol &)
+    if ((count == 0) || (size == 0))
     {
-        return false;
+        throw EBridgeData("At least one transfer with a size greater than 0 is required");
     }
+
+    // A packet of maximum size is not terminated by a short USB packet, so the following one would be
+    // appended to the same transfer. A multiple of the maximum size ensures packets are never split.
+    const uint32_t packets = (size + m_maxPacketSize - 1) / m_maxPacketSize;
+    m_transferCount        = count;
+    m_transferSize         = packets * m_maxPacketSize;
 }
 
-void BridgeLibUsb::dataThreadFunction()
+void BridgeLibUsb::startTransfers()
 {
-    IFrame *frame = nullptr;
-    uint8_t *bufBegin, *bufEnd;
-    uint8_t *buf;
+    m_pendingTransfers    = 0;
+    m_consecutiveFailures = 0;
+    for (uint16_t i = 0; i < m_transferCount; i++)
+    {
+        libusb_transfer *transfer = libusb_alloc_transfer(0);
+        if (transfer == nullptr)
+        {
+            throw EConnection("BridgeLibUsb::startTransfers - libusb_alloc_transfer() failed");
+        }
+        m_transfers.push_back({transfer, nullptr});
+        auto &entry = m_transfers.back();
 
-    bool firstFrame         = true;
-    uint64_t epochTimestamp = 0;
-    uint8_t virtualChannel  = 0;
+        // memory mapped from the kernel saves copying the data from kernel to user space, if supported
+        uint8_t *buffer = nullptr;
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+        buffer = libusb_dev_mem_alloc(m_deviceHandle, m_transferSize);
+#endif
+        if (buffer == nullptr)
+        {
+            entry.heapBuffer.reset(new uint8_t[m_transferSize]);
+            buffer = entry.heapBuffer.get();
+        }
 
-    // in our frame buffer, we overwrite the last bytes of the previous packet with the header of the new one.
-    // so we have to restore them after reading a new packet, but we don't have to copy the whole payload every time.
-    uint8_t backup[frameHeaderSize];
+        // no timeout, the transfers stay queued until data arrives or they are cancelled
+        libusb_fill_bulk_transfer(transfer, m_deviceHandle, (LIBUSB_ENDPOINT_IN | dataEndpoint), buffer, static_cast<int>(m_transferSize), &BridgeLibUsb::transferCallback, this, 0);
 
-    while (isBridgeDataStarted())
+        const int ret = libusb_submit_transfer(transfer);
+        if (ret != LIBUSB_SUCCESS)
+        {
+            throw EConnection("BridgeLibUsb::startTransfers - libusb_submit_transfer() failed", ret);
+        }
+        m_pendingTransfers++;
+    }
+}
+
+void BridgeLibUsb::stopTransfers()
+{
+    // Cancelled transfers are only finished after their callback was called, until then
+    // libusb still uses them. Cancelling is repeated, in case a transfer was just being resubmitted.
+    const auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(cancelTimeout);
+    while (m_pendingTransfers > 0)
     {
-        if (!frame)
+        for (auto &entry : m_transfers)
         {
-            // try to dequeue frame to read data into
-            frame = m_framePool.dequeueFrame();
-            if (!frame)
-            {
-                queueFrame(ErrorFrame::create(DataError_FramePoolDepleted, VIRTUAL_CHANNEL_UNDEFINED));
-
-                // try to discard one packet and try again
-                if (dumpPacket())
-                {
-                    LOG(DEBUG) << "Data read thread - dumped packet";
-                    m_packetCounter++;
-                }
-                continue;
-            }
+            libusb_cancel_transfer(entry.transfer);
+        }
 
-            // prepare frame buffer variables
-            bufBegin = frame->getBuffer() + bufferPrefixStart;
-            bufEnd   = bufBegin + frame->getBufferSize();
-            buf      = bufBegin;  // this will point to (frameHeaderSize) bytes before the end of the current data!
+        struct timeval tv = {0, dataTimeout * 1000};
+        const int ret     = libusb_handle_events_timeout_completed(m_context, &tv, nullptr);
+        if ((ret < 0) && (ret != LIBUSB_ERROR_INTERRUPTED))
+        {
+            LOG(DEBUG) << "BridgeLibUsb::stopTransfers - libusb_handle_events_timeout_completed() failed: " << ret;
+        }
+
+        if (std::chrono::steady_clock::now() > expiry)
+        {
+            break;
         }
+    }
 
-        while (isBridgeDataStarted())
+    if (m_pendingTransfers > 0)
+    {
+        // Freeing a transfer that is still submitted would let libusb write to freed memory.
+        // This only happens if the device is gone, so leaking the transfers is the lesser evil.
+        LOG(ERROR) << "BridgeLibUsb::stopTransfers - " << m_pendingTransfers << " transfers did not finish, leaking " << m_transfers.size() << " transfers";
+        for (auto &entry : m_transfers)
         {
-            // fill buffer with frame from multiple packets
+            entry.heapBuffer.release();
+        }
+        m_transfers.clear();
+        return;
+    }
+
+    for (auto &entry : m_transfers)
+    {
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+        if (!entry.heapBuffer)
+        {
+            libusb_dev_mem_free(m_deviceHandle, entry.transfer->buffer, m_transferSize);
+        }
+#endif
+        libusb_free_transfer(entry.transfer);
+    }
+    m_transfers.clear();
+}
+
+void LIBUSB_CALL BridgeLibUsb::transferCallback(libusb_transfer *transfer)
+{
+    static_cast<BridgeLibUsb *>(transfer->user_data)->transferCompleted(transfer);
+}
+
+void BridgeLibUsb::transferCompleted(libusb_transfer *transfer)
+{
+    // Callbacks are called by whichever thread handles libusb events, which is usually the data thread,
+    // but can also be a thread doing a synchronous control transfer. libusb calls them one at a time.
+    switch (transfer->status)
+    {
+        case LIBUSB_TRANSFER_COMPLETED:
+            m_consecutiveFailures = 0;
             try
             {
-                const auto remainingSize = static_cast<int>(bufEnd - buf);
-                const auto readSize      = (remainingSize > m_maxPacketSize) ? m_maxPacketSize : remainingSize;
-                const auto returnedSize  = LibUsbHelper::readBulk(m_deviceHandle, (LIBUSB_ENDPOINT_IN | dataEndpoint), buf, readSize, dataTimeout);
-
-                if (returnedSize == 0)
-                {
-                    // no packet available, continue while loop
-                    continue;
-                }
-
-                if (returnedSize < frameHeaderSize)
-                {
-                    LOG(DEBUG) << "Data read thread - Packet header incomplete";
-                    continue;
-                }
-
-                const auto bmPktType = serialToHost<uint8_t>(buf);
-                if ((bmPktType & 0xF0) != DATA_FRAME_PACKET)
-                {
-                    LOG(DEBUG) << "Data read thread - Packet type error: 0x" << std::hex << static_cast<int>(bmPktType);
-                    continue;
-                }
-
-                const auto bChannel = serialToHost<uint8_t>(buf + 1);
-                if (bmPktType & DATA_FRAME_FLAG_FIRST)
-                {
-                    if (setLocalTimestamp)
-                    {
-                        epochTimestamp = getEpochTime();
-                    }
-                    virtualChannel = bChannel;
-                }
-
-                const auto wLength = serialToHost<uint16_t>(buf + 4);
-                if (returnedSize != frameHeaderSize + wLength)
-                {
-                    if (remainingSize < frameHeaderSize + wLength)
-                    {
-                        queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
-                        LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength + frameHeaderSize - remainingSize << " bytes discarded";
-                    }
-                    else
-                    {
-                        LOG(DEBUG) << "Data read thread - Packet length wrong: " << returnedSize << "; expected: " << (frameHeaderSize + wLength);
-                    }
-                    continue;
-                }
-
-                const auto wCounter = serialToHost<uint16_t>(buf + 2);
-                if (firstFrame)
-                {
+                processTransfer(transfer->buffer, transfer->actual_length);
+            }
+            catch (const std::exception &e)
+            {
+                queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+                LOG(DEBUG) << "Data read thread - " << e.what();
+            }
+            break;
+        case LIBUSB_TRANSFER_CANCELLED:
+            m_pendingTransfers--;
+            return;
+        default:
+            queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+            LOG(DEBUG) << "Data read thread - bulk transfer failed with status " << transfer->status;
+
+            // A halted endpoint fails every transfer until the halt is cleared, which needs a synchronous
+            // control transfer that must not be done from a callback. Other errors are resubmitted,
+            // unless they keep failing, so that a broken endpoint cannot keep the event thread busy.
+            if ((transfer->status == LIBUSB_TRANSFER_NO_DEVICE) || (transfer->status == LIBUSB_TRANSFER_STALL) ||
+                (++m_consecutiveFailures >= maxConsecutiveFailures))
+            {
+                m_pendingTransfers--;
+                LOG(DEBUG) << "Data read thread - bulk transfer given up, " << m_pendingTransfers << " transfers left";
+                return;
+            }
+            break;
+    }
+
+    if (!isBridgeDataStarted())
+    {
+        m_pendingTransfers--;
+        return;
+    }
+
+    const int ret = libusb_submit_transfer(transfer);
+    if (ret != LIBUSB_SUCCESS)
+    {
+        m_pendingTransfers--;
+        queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+        LOG(DEBUG) << "Data read thread - libusb_submit_transfer() failed: " << ret;
+    }
+}
+
+void BridgeLibUsb::processTransfer(const uint8_t *data, int length)
+{
+    // a transfer contains one or more packets, only the last one may be shorter than the maximum packet size
+    while (length > 0)
+    {
+        if (length < frameHeaderSize)
+        {
+            LOG(DEBUG) << "Data read thread - Packet header incomplete";
+            return;
+        }
+
+        const auto wLength   = serialToHost<uint16_t>(data + 4);
+        const int packetSize = std::min(length, frameHeaderSize + wLength);
+        processPacket(data, packetSize);
+
+        data += packetSize;
+        length -= packetSize;
+    }
+}
+
+void BridgeLibUsb::processPacket(const uint8_t *packet, int length)
+{
+    if (!m_frame)
+    {
+        // try to dequeue frame to read data into
+        m_frame = m_framePool.dequeueFrame();
+        if (!m_frame)
+        {
+            queueFrame(ErrorFrame::create(DataError_FramePoolDepleted, VIRTUAL_CHANNEL_UNDEFINED));
+            LOG(DEBUG) << "Data read thread - dumped packet";
+            m_packetCounter++;
+            return;
+        }
+        m_frameOffset = 0;
+    }
+
+    uint8_t *data           = m_frame->getBuffer() + bufferPrefixSize;
+    const uint32_t capacity = m_frame->getBufferSize() - bufferPrefixSize;
+
+    const auto bmPktType = serialToHost<uint8_t>(packet);
+    if ((bmPktType & 0xF0) != DATA_FRAME_PACKET)
+    {
+        LOG(DEBUG) << "Data read thread - Packet type error: 0x" << std::hex << static_cast<int>(bmPktType);
+        return;
+    }
+
+    const auto bChannel = serialToHost<uint8_t>(packet + 1);
+    if (bmPktType & DATA_FRAME_FLAG_FIRST)
+    {
+        if (setLocalTimestamp)
+        {
+            m_epochTimestamp = getEpochTime();
+        }
+        m_virtualChannel = bChannel;
+    }
+
+    const auto wLength = serialToHost<uint16_t>(packet + 4);
+    if (length != frameHeaderSize + wLength)
+    {
+        LOG(DEBUG) << "Data read thread - Packet length wrong: " << length << "; expected: " << (frameHeaderSize + wLength);
+        return;
+    }
+
+    const auto wCounter = serialToHost<uint16_t>(packet + 2);
+    if (m_firstFrame)
+    {
 #ifdef BRIDGE_LIBUSB_DATA_DEBUG
-                    if (wCounter != m_packetCounter)
-                    {
-                        LOG(DEBUG) << "Data read thread - First frame packet counter reset: received = 0x" << std::hex << wCounter << " , current = 0x" << m_packetCounter;
-                    }
+        if (wCounter != m_packetCounter)
+        {
+            LOG(DEBUG) << "Data read thread - First frame packet counter reset: received = 0x" << std::hex << wCounter << " , current = 0x" << m_packetCounter;
+        }
 #endif
-                    firstFrame      = false;
-                    m_packetCounter = wCounter + 1;
-                }
-                else if (wCounter != m_packetCounter)
-                {
-                    LOG(INFO) << "Data read thread - Packet loss";
+        m_firstFrame    = false;
+        m_packetCounter = wCounter + 1;
+    }
+    else if (wCounter != m_packetCounter)
+    {
+        LOG(INFO) << "Data read thread - Packet loss";
 #ifdef BRIDGE_LIBUSB_DATA_DEBUG
-                    LOG(DEBUG) << "    counter mismatch: received = 0x" << std::hex << wCounter << " , current = 0x" << m_packetCounter;
+        LOG(DEBUG) << "    counter mismatch: received = 0x" << std::hex << wCounter << " , current = 0x" << m_packetCounter;
 #endif
-                    m_packetCounter = wCounter + 1;
+        m_packetCounter = wCounter + 1;
 
-                    queueFrame(ErrorFrame::create(DataError_FrameDropped, bChannel));
+        queueFrame(ErrorFrame::create(DataError_FrameDropped, bChannel));
 
-                    if (!(bmPktType & DATA_FRAME_FLAG_FIRST))
-                    {
-                        // if this was a follow-up frame, discard the whole already received part
-                        buf = bufBegin;
+        if (!(bmPktType & DATA_FRAME_FLAG_FIRST))
+        {
+            // if this was a follow-up frame, discard the whole already received part
+            m_frameOffset = 0;
 
 #ifdef BRIDGE_LIBUSB_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - discarding current frame";
+            LOG(DEBUG) << "Data read thread - discarding current frame";
 #endif
-                        continue;
-                    }
-                }
-                else
-                {
-                    m_packetCounter++;
-                }
-
-                if (bmPktType & DATA_FRAME_FLAG_FIRST)
-                {
-                    if (buf != bufBegin)
-                    {
-                        // we already started receiving a frame, but now a new frame starts
-                        // copy received payload to the beginning of buffer, to try to continue with new frame
-                        std::copy(buf + frameHeaderSize, buf + frameHeaderSize + wLength, bufBegin);
-                        buf = bufBegin;  // continue normally for a single/first packet
+            return;
+        }
+    }
+    else
+    {
+        m_packetCounter++;
+    }
+
+    if (bmPktType & DATA_FRAME_FLAG_FIRST)
+    {
+        if (m_frameOffset != 0)
+        {
+            // we already started receiving a frame, but now a new frame starts
+            // continue with the new frame at the beginning of the buffer
+            m_frameOffset = 0;
 #ifdef BRIDGE_LIBUSB_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - previous frame incomplete: wCounter = 0x" << std::hex << wCounter;
+            LOG(DEBUG) << "Data read thread - previous frame incomplete: wCounter = 0x" << std::hex << wCounter;
 #endif
-                    }
-                }
-                else
-                {
-                    if (buf == bufBegin)
-                    {
-                        // we expected a new frame, but we received a follow-up packet
+        }
+    }
+    else
+    {
+        if (m_frameOffset == 0)
+        {
+            // we expected a new frame, but we received a follow-up packet
 #ifdef BRIDGE_LIBUSB_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - discarding unexpected follow-up packet";
+            LOG(DEBUG) << "Data read thread - discarding unexpected follow-up packet";
 #endif
-                        continue;  // don't do anything with the received packet and start over
-                    }
+            return;  // don't do anything with the received packet and start over
+        }
 
-                    if (virtualChannel != bChannel)
-                    {
+        if (m_virtualChannel != bChannel)
+        {
 #ifdef BRIDGE_LIBUSB_DATA_DEBUG
-                        LOG(DEBUG) << "Data read thread - Channel mismatch: received = 0x" << std::hex << static_cast<int>(bChannel) << " , expected = 0x" << static_cast<int>(virtualChannel);
+            LOG(DEBUG) << "Data read thread - Channel mismatch: received = 0x" << std::hex << static_cast<int>(bChannel) << " , expected = 0x" << static_cast<int>(m_virtualChannel);
 #endif
-                        continue;  // don't do anything with the received packet and start over
-                    }
-
-                    // restore backup of previous packet, since we overwrote it with the beginning of the current packet
-                    std::copy(backup, backup + frameHeaderSize, buf);
-                }
-
-                buf += wLength;
-
-                if (bmPktType & DATA_FRAME_FLAG_LAST)
-                {
-                    if (bmPktType & DATA_FRAME_FLAG_TIMESTAMP)
-                    {
-                        buf -= sizeof(epochTimestamp);
-                        if (!setLocalTimestamp)
-                        {
-                            serialToHost(buf + frameHeaderSize, epochTimestamp);
-                        }
-                    }
-                    else if (!setLocalTimestamp)
-                    {
-                        epochTimestamp = 0;
-                    }
-
-                    if (bmPktType & DATA_FRAME_FLAG_ERROR)
-                    {
-                        uint32_t code;
-                        const auto errorFrameLength = sizeof(code) + ((bmPktType & DATA_FRAME_FLAG_TIMESTAMP) ? sizeof(epochTimestamp) : 0);
-                        if (wLength == errorFrameLength)
-                        {
-                            buf -= sizeof(code);
-                            serialToHost(buf + frameHeaderSize, code);
-                            queueFrame(ErrorFrame::create(code, bChannel, epochTimestamp));
-                        }
-                        else
-                        {
-                            buf -= wLength;
-                            DebugFrame::log(buf + frameHeaderSize, wLength, epochTimestamp);
-                        }
-                        buf = bufBegin;
-                    }
-                    else
-                    {
-                        frame->setDataOffset(bufferPrefixSize);
-                        frame->setDataSize(static_cast<uint32_t>(buf - bufBegin));
-                        frame->setVirtualChannel(virtualChannel);
-                        frame->setTimestamp(epochTimestamp);
-
-                        queueFrame(frame);
-                        frame = nullptr;
-                    }
-
-                    break;
-                }
-                else
-                {
-                    // save backup of current packet, since it will be overwritten by next packet
-                    std::copy(buf, buf + frameHeaderSize, backup);
-                }
+            return;  // don't do anything with the received packet and start over
+        }
+    }
+
+    if (capacity - m_frameOffset < wLength)
+    {
+        queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
+        LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength - (capacity - m_frameOffset) << " bytes discarded";
+        m_frameOffset = 0;
+        return;
+    }
+
+    std::copy(packet + frameHeaderSize, packet + frameHeaderSize + wLength, data + m_frameOffset);
+    m_frameOffset += wLength;
+
+    if (bmPktType & DATA_FRAME_FLAG_LAST)
+    {
+        if (bmPktType & DATA_FRAME_FLAG_TIMESTAMP)
+        {
+            m_frameOffset -= sizeof(m_epochTimestamp);
+            if (!setLocalTimestamp)
+            {
+                serialToHost(data + m_frameOffset, m_epochTimestamp);
             }
-            catch (const std::exception &e)
+        }
+        else if (!setLocalTimestamp)
+        {
+            m_epochTimestamp = 0;
+        }
+
+        if (bmPktType & DATA_FRAME_FLAG_ERROR)
+        {
+            uint32_t code;
+            const auto errorFrameLength = sizeof(code) + ((bmPktType & DATA_FRAME_FLAG_TIMESTAMP) ? sizeof(m_epochTimestamp) : 0);
+            if (wLength == errorFrameLength)
             {
-                queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
-                LOG(DEBUG) << "Data read thread - " << e.what();
+                m_frameOffset -= sizeof(code);
+                serialToHost(data + m_frameOffset, code);
+                queueFrame(ErrorFrame::create(code, bChannel, m_epochTimestamp));
+            }
+            else
+            {
+                m_frameOffset -= wLength;
+                DebugFrame::log(data + m_frameOffset, wLength, m_epochTimestamp);
             }
+            m_frameOffset = 0;
+        }
+        else
+        {
+            m_frame->setDataOffset(bufferPrefixSize);
+            m_frame->setDataSize(m_frameOffset);
+            m_frame->setVirtualChannel(m_virtualChannel);
+            m_frame->setTimestamp(m_epochTimestamp);
+
+            queueFrame(m_frame);
+            m_frame = nullptr;
+        }
+    }
+}
+
+void BridgeLibUsb::dataThreadFunction()
+{
+    m_frame          = nullptr;
+    m_firstFrame     = true;
+    m_epochTimestamp = 0;
+    m_virtualChannel = 0;
+
+    // several transfers are queued at the same time, so that the device can continue sending
+    // while the data of a completed transfer is processed
+    try
+    {
+        startTransfers();
+    }
+    catch (const std::exception &e)
+    {
+        queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+        LOG(ERROR) << "Data read thread - " << e.what();
+    }
+
+    while (isBridgeDataStarted() && (m_pendingTransfers > 0))
+    {
+        struct timeval tv = {0, dataTimeout * 1000};
+        const int ret     = libusb_handle_events_timeout_completed(m_context, &tv, nullptr);
+        if ((ret < 0) && (ret != LIBUSB_ERROR_INTERRUPTED))
+        {
+            queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+            LOG(DEBUG) << "Data read thread - libusb_handle_events_timeout_completed() failed: " << ret;
         }
     }
 
+    stopTransfers();
+
     // if we own a dequeued frame buffer, make sure we return it
-    if (frame)
+    if (m_frame)
     {
-        m_framePool.queueFrame(frame);
+        m_framePool.queueFrame(m_frame);
+        m_frame = nullptr;
     }
 }
@@ -17,9 +17,12 @@
 #include <universal/link_definitions.h>
 
 #include <libusb-1.0/libusb.h>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 
 class BridgeLibUsb :
@@ -45,6 +48,10 @@ public:
     // IBridgeData implementation
     void setFrameBufferSize(uint32_t size) override;
     void setFramePoolCount(uint16_t count) override;
+    void setBackPressurePolicy(BackPressurePolicy policy, uint16_t maxCount = 0) override;
+    void setTransferRing(uint16_t count, uint32_t size) override;
+    void getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const override;
+    void resetFramePoolStatistics() override;
     void startStreaming() override;
     void stopStreaming() override;
 
@@ -63,7 +70,13 @@ private:
     uint16_t controlEndpointReadChecked(uint8_t bmReqType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint16_t wLength, uint8_t buffer[]);
 
     uint16_t bulkEndpointRead(uint8_t buffer[], uint16_t length, const uint16_t timeout);
-    bool dumpPacket();
+
+    void startTransfers();
+    void stopTransfers();
+    static void LIBUSB_CALL transferCallback(libusb_transfer *transfer);
+    void transferCompleted(libusb_transfer *transfer);
+    void processTransfer(const uint8_t *data, int length);
+    void processPacket(const uint8_t *packet, int length);
 
     BridgeProtocol m_protocol;
     FramePool m_framePool;
@@ -77,4 +90,23 @@ private:
 
     void dataThreadFunction();
     std::thread m_dataThread;
+
+    // asynchronous bulk transfers
+    uint16_t m_transferCount;
+    uint32_t m_transferSize;
+    struct Transfer
+    {
+        libusb_transfer *transfer;
+        std::unique_ptr<uint8_t[]> heapBuffer;  // nullptr if the buffer is mapped from the kernel
+    };
+    std::vector<Transfer> m_transfers;
+    std::atomic<int> m_pendingTransfers;
+    uint32_t m_consecutiveFailures;  // only used by the callbacks, which libusb calls one at a time
+
+    // state of the frame currently received
+    IFrame *m_frame;
+    uint32_t m_frameOffset;
+    bool m_firstFrame;
+    uint64_t m_epochTimestamp;
+    uint8_t m_virtualChannel;
 };
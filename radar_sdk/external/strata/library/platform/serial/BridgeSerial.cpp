@@ -94,6 +94,16 @@ void BridgeSerial::setFramePoolCount(uint16_t count)
     m_framePool.setFrameCount(count);
 }
 
+void BridgeSerial::getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const
+{
+    m_framePool.getStatistics(count, highWaterMark);
+}
+
+void BridgeSerial::resetFramePoolStatistics()
+{
+    m_framePool.resetStatistics();
+}
+
 IBridgeControl *BridgeSerial::getIBridgeControl()
 {
     return &m_protocol;
@@ -45,6 +45,8 @@ public:
     // IBridgeData implementation
     void setFrameBufferSize(uint32_t size) override;
     void setFramePoolCount(uint16_t count) override;
+    void getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const override;
+    void resetFramePoolStatistics() override;
     void startStreaming() override;
     void stopStreaming() override;
 
@@ -0,0 +1,241 @@
+/**
+ * Microbenchmark of FrameQueue and FramePool against the implementations they replaced,
+ * which are reproduced here as LockingFrameQueue and LockingFramePool:
+ * - the queue used a mutex, a std::deque and a condition variable for every call
+ * - the pool used a mutex and a std::vector, and searched it for duplicates when a frame was returned
+ *
+ * Usage: benchmark_FrameQueue [iterations]
+ */
+
+#include <platform/frames/Frame.hpp>
+#include <platform/frames/FramePool.hpp>
+#include <platform/frames/FrameQueue.hpp>
+#include <platform/interfaces/IFramePool.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+    constexpr uint16_t queueSize = 64;
+
+    class LockingFramePool :
+        public IFramePool
+    {
+    public:
+        bool initialized() const override
+        {
+            return !m_pool.empty();
+        }
+
+        void queueFrame(IFrame *frame) override
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            for (auto *f : m_free)
+            {
+                if (f == frame)
+                {
+                    throw std::logic_error("Queueing already-queued buffer");
+                }
+            }
+            m_free.push_back(frame);
+        }
+
+        void setFrameBufferSize(uint32_t size) override
+        {
+            m_size = size;
+        }
+
+        void setFrameCount(uint16_t count) override
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            while (m_pool.size() < count)
+            {
+                m_pool.emplace_back(new Frame(this, m_size));
+                m_free.push_back(m_pool.back().get());
+            }
+        }
+
+        IFrame *dequeueFrame() override
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            if (m_free.empty())
+            {
+                return nullptr;
+            }
+            auto *frame = m_free.back();
+            m_free.pop_back();
+            return frame;
+        }
+
+    private:
+        std::mutex m_lock;
+        uint32_t m_size = 0;
+        std::vector<std::unique_ptr<Frame>> m_pool;
+        std::vector<IFrame *> m_free;
+    };
+
+    class LockingFrameQueue
+    {
+    public:
+        void setMaxCount(uint32_t count)
+        {
+            m_maxCount = count;
+        }
+
+        void start()
+        {
+            m_queueing = true;
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                m_queueing = false;
+            }
+            m_cv.notify_all();
+        }
+
+        void enqueue(IFrame *frame)
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_queue.push_back({frame, std::chrono::steady_clock::now()});
+            while (m_queue.size() > m_maxCount)
+            {
+                m_queue.front().frame->release();
+                m_queue.pop_front();
+            }
+            m_cv.notify_one();
+        }
+
+        IFrame *dequeue()
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            return m_queue.empty() ? nullptr : popFront();
+        }
+
+        IFrame *blockingDequeue(uint16_t timeoutMs)
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return !m_queueing || !m_queue.empty(); });
+            return m_queue.empty() ? nullptr : popFront();
+        }
+
+    private:
+        struct Entry
+        {
+            IFrame *frame;
+            std::chrono::steady_clock::time_point enqueued;
+        };
+
+        IFrame *popFront()
+        {
+            auto *frame = m_queue.front().frame;
+            m_queue.pop_front();
+            return frame;
+        }
+
+        std::mutex m_lock;
+        std::condition_variable m_cv;
+        std::deque<Entry> m_queue;
+        uint32_t m_maxCount = 0;
+        bool m_queueing     = false;
+    };
+
+    double nanosecondsPerFrame(std::chrono::steady_clock::duration duration, uint32_t iterations)
+    {
+        return std::chrono::duration<double, std::nano>(duration).count() / iterations;
+    }
+
+    // the bridge thread takes a buffer, queues it and the consumer returns it, all on one thread
+    template <typename Pool, typename Queue>
+    double roundTrip(uint32_t iterations)
+    {
+        Pool pool;
+        pool.setFrameBufferSize(64);
+        pool.setFrameCount(queueSize + 1);
+        Queue queue;
+        queue.setMaxCount(queueSize);
+        queue.start();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            queue.enqueue(pool.dequeueFrame());
+            queue.dequeue()->release();
+        }
+        const auto duration = std::chrono::steady_clock::now() - start;
+        queue.stop();
+        return nanosecondsPerFrame(duration, iterations);
+    }
+
+    // a producer and a consumer thread, the producer waits if the consumer holds all buffers
+    template <typename Pool, typename Queue>
+    double producerConsumer(uint32_t iterations)
+    {
+        Pool pool;
+        pool.setFrameBufferSize(64);
+        pool.setFrameCount(queueSize + 1);
+        Queue queue;
+        queue.setMaxCount(queueSize);
+        queue.start();
+
+        const auto start = std::chrono::steady_clock::now();
+        std::thread producer([&] {
+            for (uint32_t i = 0; i < iterations; i++)
+            {
+                IFrame *frame;
+                while ((frame = pool.dequeueFrame()) == nullptr)
+                {
+                    std::this_thread::yield();
+                }
+                queue.enqueue(frame);
+            }
+        });
+
+        // frames dropped by a full queue are not received, so only wait for the producer to finish
+        std::thread consumer([&] {
+            while (auto *frame = queue.blockingDequeue(100))
+            {
+                frame->release();
+            }
+        });
+
+        producer.join();
+        const auto duration = std::chrono::steady_clock::now() - start;
+        consumer.join();
+        queue.stop();
+        return nanosecondsPerFrame(duration, iterations);
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    const uint32_t iterations = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    if (iterations == 0)
+    {
+        std::fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    std::printf("%u iterations, queue size %u, %u hardware threads\n", iterations, queueSize, std::thread::hardware_concurrency());
+    std::printf("%-20s %12s %12s\n", "ns per frame", "locking", "lock-free");
+    std::printf("%-20s %12.1f %12.1f\n", "round trip",
+                roundTrip<LockingFramePool, LockingFrameQueue>(iterations),
+                roundTrip<FramePool, FrameQueue>(iterations));
+    std::printf("%-20s %12.1f %12.1f\n", "producer/consumer",
+                producerConsumer<LockingFramePool, LockingFrameQueue>(iterations),
+                producerConsumer<FramePool, FrameQueue>(iterations));
+    return 0;
+}
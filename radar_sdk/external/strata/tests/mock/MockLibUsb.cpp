@@ -0,0 +1,401 @@
+#include "MockLibUsb.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+
+
+struct libusb_device
+{
+};
+
+struct libusb_device_handle
+{
+};
+
+
+namespace
+{
+    libusb_device mockDevice;
+    libusb_device_handle mockHandle;
+
+    std::mutex lock;
+    std::set<libusb_transfer *> allocated;
+    std::deque<libusb_transfer *> submitted;
+    std::set<libusb_transfer *> cancelled;
+    std::deque<std::vector<uint8_t>> outgoing;
+    uint32_t inCallback;
+
+    uint32_t allocatedCount;
+    uint32_t freedCount;
+    uint32_t freedWhileSubmittedCount;
+    int lastLength;
+
+    uint32_t eventErrors;
+    int eventError;
+    uint32_t transferFailures;
+    libusb_transfer_status transferStatus;
+    uint32_t failedCount;
+    uint32_t cancellationDelay;
+    bool cancellationStalled;
+
+    bool isSubmitted(libusb_transfer *transfer)
+    {
+        return std::find(submitted.begin(), submitted.end(), transfer) != submitted.end();
+    }
+
+    void unsubmit(libusb_transfer *transfer)
+    {
+        submitted.erase(std::find(submitted.begin(), submitted.end(), transfer));
+        cancelled.erase(transfer);
+    }
+
+    // picks the next transfer to complete, nullptr if there is none
+    libusb_transfer *nextCompletion()
+    {
+        if (!cancelled.empty() && !cancellationStalled)
+        {
+            if (cancellationDelay > 0)
+            {
+                cancellationDelay--;
+            }
+            else
+            {
+                auto *transfer = *cancelled.begin();
+                unsubmit(transfer);
+                transfer->status        = LIBUSB_TRANSFER_CANCELLED;
+                transfer->actual_length = 0;
+                return transfer;
+            }
+        }
+
+        auto it = std::find_if(submitted.begin(), submitted.end(), [](libusb_transfer *transfer) {
+            return cancelled.count(transfer) == 0;
+        });
+        if (it == submitted.end())
+        {
+            return nullptr;
+        }
+
+        if (transferFailures > 0)
+        {
+            auto *transfer = *it;
+            transferFailures--;
+            failedCount++;
+            unsubmit(transfer);
+            transfer->status        = transferStatus;
+            transfer->actual_length = 0;
+            return transfer;
+        }
+
+        if (outgoing.empty())
+        {
+            return nullptr;
+        }
+
+        auto *transfer    = *it;
+        const auto &data  = outgoing.front();
+        const auto length = std::min<int>(transfer->length, static_cast<int>(data.size()));
+        std::memcpy(transfer->buffer, data.data(), length);
+        outgoing.pop_front();
+        unsubmit(transfer);
+        transfer->status        = LIBUSB_TRANSFER_COMPLETED;
+        transfer->actual_length = length;
+        return transfer;
+    }
+
+    template <typename Predicate>
+    bool waitFor(uint16_t timeoutMs, Predicate predicate)
+    {
+        const auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (std::chrono::steady_clock::now() < expiry)
+        {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                if (predicate())
+                {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+}
+
+
+namespace MockLibUsb
+{
+    void reset()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        // a bridge gives up the transfers which never finish, together with their heap buffers
+        for (auto *transfer : allocated)
+        {
+            if (isSubmitted(transfer))
+            {
+                delete[] transfer->buffer;
+            }
+            std::free(transfer);
+        }
+        allocated.clear();
+        submitted.clear();
+        cancelled.clear();
+        outgoing.clear();
+        inCallback = 0;
+
+        allocatedCount           = 0;
+        freedCount               = 0;
+        freedWhileSubmittedCount = 0;
+        lastLength               = 0;
+
+        eventErrors         = 0;
+        eventError          = 0;
+        transferFailures    = 0;
+        transferStatus      = LIBUSB_TRANSFER_ERROR;
+        failedCount         = 0;
+        cancellationDelay   = 0;
+        cancellationStalled = false;
+    }
+
+    libusb_device *device()
+    {
+        return &mockDevice;
+    }
+
+    void send(const std::vector<uint8_t> &data)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        outgoing.push_back(data);
+    }
+
+    bool waitUntilSent(uint16_t timeoutMs)
+    {
+        return waitFor(timeoutMs, [] {
+            return outgoing.empty() && (inCallback == 0);
+        });
+    }
+
+    bool waitUntilSubmitted(uint32_t count, uint16_t timeoutMs)
+    {
+        return waitFor(timeoutMs, [count] {
+            return submitted.size() == count;
+        });
+    }
+
+    uint32_t submittedTransfers()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return static_cast<uint32_t>(submitted.size());
+    }
+
+    int transferLength()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return lastLength;
+    }
+
+    void failEvents(uint32_t count, int error)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        eventErrors = count;
+        eventError  = error;
+    }
+
+    void failTransfers(uint32_t count, libusb_transfer_status status)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        transferFailures = count;
+        transferStatus   = status;
+    }
+
+    uint32_t failedTransfers()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return failedCount;
+    }
+
+    void delayCancellation(uint32_t eventCalls)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        cancellationDelay = eventCalls;
+    }
+
+    void stallCancellation()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        cancellationStalled = true;
+    }
+
+    uint32_t allocatedTransfers()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return allocatedCount;
+    }
+
+    uint32_t freedTransfers()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return freedCount;
+    }
+
+    uint32_t freedWhileSubmitted()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return freedWhileSubmittedCount;
+    }
+}
+
+
+extern "C"
+{
+    int LIBUSB_CALL libusb_init(libusb_context ** /*ctx*/)
+    {
+        return LIBUSB_SUCCESS;
+    }
+
+    void LIBUSB_CALL libusb_exit(libusb_context * /*ctx*/)
+    {
+    }
+
+    int LIBUSB_CALL libusb_set_option(libusb_context * /*ctx*/, enum libusb_option /*option*/, ...)
+    {
+        return LIBUSB_SUCCESS;
+    }
+
+    int LIBUSB_CALL libusb_wrap_sys_device(libusb_context * /*ctx*/, intptr_t /*sys_dev*/, libusb_device_handle **dev_handle)
+    {
+        *dev_handle = &mockHandle;
+        return LIBUSB_SUCCESS;
+    }
+
+    int LIBUSB_CALL libusb_open(libusb_device * /*dev*/, libusb_device_handle **dev_handle)
+    {
+        *dev_handle = &mockHandle;
+        return LIBUSB_SUCCESS;
+    }
+
+    void LIBUSB_CALL libusb_close(libusb_device_handle * /*dev_handle*/)
+    {
+    }
+
+    int LIBUSB_CALL libusb_claim_interface(libusb_device_handle * /*dev_handle*/, int /*interface_number*/)
+    {
+        return LIBUSB_SUCCESS;
+    }
+
+    int LIBUSB_CALL libusb_release_interface(libusb_device_handle * /*dev_handle*/, int /*interface_number*/)
+    {
+        return LIBUSB_SUCCESS;
+    }
+
+    unsigned char *LIBUSB_CALL libusb_dev_mem_alloc(libusb_device_handle * /*dev_handle*/, size_t /*length*/)
+    {
+        // not supported, the bridge falls back to heap buffers
+        return nullptr;
+    }
+
+    int LIBUSB_CALL libusb_dev_mem_free(libusb_device_handle * /*dev_handle*/, unsigned char * /*buffer*/, size_t /*length*/)
+    {
+        return LIBUSB_ERROR_NOT_SUPPORTED;
+    }
+
+    int LIBUSB_CALL libusb_control_transfer(libusb_device_handle * /*dev_handle*/, uint8_t /*request_type*/, uint8_t /*bRequest*/, uint16_t /*wValue*/, uint16_t /*wIndex*/,
+                                            unsigned char * /*data*/, uint16_t wLength, unsigned int /*timeout*/)
+    {
+        return wLength;
+    }
+
+    int LIBUSB_CALL libusb_bulk_transfer(libusb_device_handle * /*dev_handle*/, unsigned char /*endpoint*/, unsigned char * /*data*/, int /*length*/,
+                                         int *actual_length, unsigned int /*timeout*/)
+    {
+        *actual_length = 0;
+        return LIBUSB_ERROR_TIMEOUT;
+    }
+
+    struct libusb_transfer *LIBUSB_CALL libusb_alloc_transfer(int iso_packets)
+    {
+        const size_t size = sizeof(libusb_transfer) + iso_packets * sizeof(libusb_iso_packet_descriptor);
+        auto *transfer    = static_cast<libusb_transfer *>(std::calloc(1, size));
+
+        std::lock_guard<std::mutex> guard(lock);
+        allocated.insert(transfer);
+        allocatedCount++;
+        return transfer;
+    }
+
+    void LIBUSB_CALL libusb_free_transfer(struct libusb_transfer *transfer)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (isSubmitted(transfer))
+        {
+            // keep it, so that the emulated device does not write to freed memory itself
+            freedWhileSubmittedCount++;
+            return;
+        }
+        allocated.erase(transfer);
+        std::free(transfer);
+        freedCount++;
+    }
+
+    int LIBUSB_CALL libusb_submit_transfer(struct libusb_transfer *transfer)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (isSubmitted(transfer))
+        {
+            return LIBUSB_ERROR_BUSY;
+        }
+        submitted.push_back(transfer);
+        lastLength = transfer->length;
+        return LIBUSB_SUCCESS;
+    }
+
+    int LIBUSB_CALL libusb_cancel_transfer(struct libusb_transfer *transfer)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (!isSubmitted(transfer))
+        {
+            return LIBUSB_ERROR_NOT_FOUND;
+        }
+        cancelled.insert(transfer);
+        return LIBUSB_SUCCESS;
+    }
+
+    int LIBUSB_CALL libusb_handle_events_timeout_completed(libusb_context * /*ctx*/, struct timeval * /*tv*/, int * /*completed*/)
+    {
+        libusb_transfer *transfer;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (eventErrors > 0)
+            {
+                eventErrors--;
+                return eventError;
+            }
+
+            transfer = nextCompletion();
+            if (transfer)
+            {
+                inCallback++;
+            }
+        }
+
+        if (!transfer)
+        {
+            // nothing happened within the timeout, which is shortened to keep the tests fast
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return LIBUSB_SUCCESS;
+        }
+
+        transfer->callback(transfer);
+
+        std::lock_guard<std::mutex> guard(lock);
+        inCallback--;
+        return LIBUSB_SUCCESS;
+    }
+}
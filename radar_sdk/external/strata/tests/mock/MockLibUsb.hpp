@@ -0,0 +1,66 @@
+#pragma once
+
+#include <libusb-1.0/libusb.h>
+
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * Replaces the libusb functions used by BridgeLibUsb with an emulated device.
+ * It completes the submitted transfers one at a time from libusb_handle_events_timeout_completed(),
+ * in the order they were submitted, and keeps track of how the transfers are used.
+ */
+namespace MockLibUsb
+{
+    /**
+     * Forget all data and settings, and free the transfers a test left behind.
+     */
+    void reset();
+
+    libusb_device *device();
+
+    /**
+     * Queue data to be sent by the device, each call completes one transfer.
+     */
+    void send(const std::vector<uint8_t> &data);
+
+    /**
+     * Wait until all queued data was delivered to the completion callbacks.
+     */
+    bool waitUntilSent(uint16_t timeoutMs);
+
+    /**
+     * Wait until the given number of transfers is submitted.
+     */
+    bool waitUntilSubmitted(uint32_t count, uint16_t timeoutMs);
+
+    uint32_t submittedTransfers();
+    int transferLength();  ///< length of the transfer submitted last
+
+    /**
+     * Let event handling fail with the given error for the given number of calls.
+     */
+    void failEvents(uint32_t count, int error = LIBUSB_ERROR_OTHER);
+
+    /**
+     * Let the given number of transfers fail with the given status, before any queued data is sent.
+     */
+    void failTransfers(uint32_t count, libusb_transfer_status status);
+
+    uint32_t failedTransfers();  ///< number of transfers completed with an error status
+
+    /**
+     * Report cancelled transfers only after the given number of event handling calls.
+     */
+    void delayCancellation(uint32_t eventCalls);
+
+    /**
+     * Never report cancelled transfers, like a device which is gone.
+     */
+    void stallCancellation();
+
+    uint32_t allocatedTransfers();
+    uint32_t freedTransfers();
+    uint32_t freedWhileSubmitted();  ///< transfers freed while libusb would still use them
+}
@@ -0,0 +1,292 @@
+#include <gtest/gtest.h>
+
+#include <common/crc/Crc16.hpp>
+#include <common/crc/Crc32.hpp>
+#include <common/crc/Crc32Kernels.hpp>
+#include <common/crc/Crc8.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    // bitwise references, most significant bit first unless reflected
+
+    uint32_t reflectBits(uint32_t value, unsigned int bits)
+    {
+        uint32_t result = 0;
+        for (unsigned int i = 0; i < bits; i++)
+        {
+            result = (result << 1) | (value & 1);
+            value >>= 1;
+        }
+        return result;
+    }
+
+    // feeds the lowest bits of value into an MSB-first CRC register of the given width
+    uint32_t referenceMsbBits(uint32_t crc, uint32_t value, unsigned int bits, uint32_t polynomial, unsigned int width)
+    {
+        const uint32_t top = 1u << (width - 1);
+        const uint32_t all = (width == 32) ? 0xFFFFFFFF : (1u << width) - 1;
+        for (unsigned int b = bits; b > 0; b--)
+        {
+            const bool feedback = ((crc & top) != 0) != (((value >> (b - 1)) & 1) != 0);
+            crc                 = (crc << 1) & all;
+            if (feedback)
+            {
+                crc ^= polynomial;
+            }
+        }
+        return crc;
+    }
+
+    // feeds the lowest bits of value, least significant first, into a reflected CRC-32 register
+    uint32_t referenceReflectedBits(uint32_t crc, uint32_t value, unsigned int bits)
+    {
+        for (unsigned int b = 0; b < bits; b++)
+        {
+            const bool feedback = ((crc ^ (value >> b)) & 1) != 0;
+            crc >>= 1;
+            if (feedback)
+            {
+                crc ^= 0xEDB88320;
+            }
+        }
+        return crc;
+    }
+
+    uint32_t referenceMsb(const uint8_t *buf, size_t len, uint32_t polynomial, unsigned int width, uint32_t crc)
+    {
+        while (len--)
+        {
+            crc = referenceMsbBits(crc, *buf++, 8, polynomial, width);
+        }
+        return crc;
+    }
+
+    uint32_t referenceCrc32(const uint8_t *buf, size_t len, uint32_t polynomial, bool reflectIn, bool reflectOut, bool invertOut, uint32_t crc)
+    {
+        while (len--)
+        {
+            const uint8_t value = *buf++;
+            crc                 = referenceMsbBits(crc, reflectIn ? reflectBits(value, 8) : value, 8, polynomial, 32);
+        }
+        if (reflectOut)
+        {
+            crc = reflectBits(crc, 32);
+        }
+        return invertOut ? ~crc : crc;
+    }
+
+    uint32_t referenceEthernet(const uint8_t *buf, size_t len, uint32_t crc)
+    {
+        while (len--)
+        {
+            crc = referenceReflectedBits(crc, *buf++, 8);
+        }
+        return crc;
+    }
+
+    std::vector<uint8_t> randomBytes(size_t count, std::mt19937 &rng)
+    {
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<uint8_t> bytes(count);
+        for (auto &b : bytes)
+        {
+            b = static_cast<uint8_t>(dist(rng));
+        }
+        return bytes;
+    }
+
+    // odd lengths and offsets exercise the head and tail handling of the block implementations
+    const size_t lengths[] = {0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 63, 64, 65, 127, 128, 255, 256, 1000, 4095, 4096};
+
+    template <typename Function, typename Reference>
+    void compare(const char *name, Function function, Reference reference)
+    {
+        std::mt19937 rng(42);
+        const auto data = randomBytes(4096 + 8, rng);
+        for (const auto length : lengths)
+        {
+            for (size_t offset = 0; offset < 8; offset++)
+            {
+                const auto *buf = data.data() + offset;
+                ASSERT_EQ(function(buf, length), reference(buf, length)) << name << " length " << length << " offset " << offset;
+            }
+        }
+    }
+
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+}
+
+
+TEST(Crc, CheckValues)
+{
+    // the standard check values of the CRC catalogue for "123456789"
+    EXPECT_EQ(Crc8Smbus(check, sizeof(check)), 0xF4);
+    EXPECT_EQ(Crc16CcittFalse(check, sizeof(check)), 0x29B1);
+    EXPECT_EQ(Crc32Ethernet(check, sizeof(check)), 0xCBF43926u);
+    EXPECT_EQ(Crc32Bzip2(check, sizeof(check)), 0xFC891918u);
+    EXPECT_EQ(Crc32Mpeg2(check, sizeof(check)), 0x0376E6E7u);
+}
+
+TEST(Crc, Crc8)
+{
+    compare("Crc8Smbus", [](const uint8_t *buf, size_t len) { return Crc8Smbus(buf, static_cast<uint16_t>(len)); },
+            [](const uint8_t *buf, size_t len) { return referenceMsb(buf, len, 0x07, 8, 0); });
+
+    for (const uint16_t polynomial : {0x07, 0x1D, 0x31, 0x9B})
+    {
+        for (const uint8_t initial : {0x00, 0xFF, 0x5A})
+        {
+            compare(
+                "Crc8", [=](const uint8_t *buf, size_t len) { return Crc8(buf, static_cast<uint16_t>(len), polynomial, initial); },
+                [=](const uint8_t *buf, size_t len) { return referenceMsb(buf, len, polynomial, 8, initial); });
+        }
+    }
+}
+
+TEST(Crc, Crc16)
+{
+    for (const uint16_t seed : {0xFFFF, 0x0000, 0x1D0F})
+    {
+        compare(
+            "Crc16CcittFalse", [=](const uint8_t *buf, size_t len) { return Crc16CcittFalse(buf, static_cast<unsigned int>(len), seed); },
+            [=](const uint8_t *buf, size_t len) { return referenceMsb(buf, len, 0x1021, 16, seed); });
+    }
+
+    // integral values are processed most significant byte first
+    const uint32_t value = 0x12345678;
+    const uint8_t bytes[] = {0x12, 0x34, 0x56, 0x78};
+    EXPECT_EQ(Crc16CcittFalse(value), Crc16CcittFalse(bytes, sizeof(bytes)));
+}
+
+TEST(Crc, Crc32Autosar)
+{
+    for (const uint32_t seed : {0xFFFFFFFFu, 0x00000000u, 0x12345678u})
+    {
+        compare(
+            "Crc32Autosar", [=](const uint8_t *buf, size_t len) { return Crc32Autosar(buf, static_cast<uint16_t>(len), seed); },
+            [=](const uint8_t *buf, size_t len) { return referenceMsb(buf, len, 0xF4ACFB13, 32, seed); });
+    }
+}
+
+TEST(Crc, Crc32ReflectedKernels)
+{
+    for (const uint32_t seed : {0xFFFFFFFFu, 0x00000000u, 0x12345678u})
+    {
+        const auto reference = [=](const uint8_t *buf, size_t len) { return referenceEthernet(buf, len, seed); };
+        compare(
+            "crc32ReflectedTable", [=](const uint8_t *buf, size_t len) { return crc32ReflectedTable(buf, len, seed); }, reference);
+        compare(
+            "crc32ReflectedSlicing8", [=](const uint8_t *buf, size_t len) { return crc32ReflectedSlicing8(buf, len, seed); }, reference);
+        if (crc32HasPclmul())
+        {
+            compare(
+                "crc32ReflectedPclmul", [=](const uint8_t *buf, size_t len) { return crc32ReflectedPclmul(buf, len, seed); }, reference);
+        }
+        if (crc32HasArmv8())
+        {
+            compare(
+                "crc32ReflectedArmv8", [=](const uint8_t *buf, size_t len) { return crc32ReflectedArmv8(buf, len, seed); }, reference);
+        }
+        compare(
+            "Crc32Ethernet", [=](const uint8_t *buf, size_t len) { return Crc32Ethernet(buf, len, seed); },
+            [=](const uint8_t *buf, size_t len) { return ~referenceEthernet(buf, len, seed); });
+    }
+
+    // long buffers use the folding loops of the hardware kernels
+    std::mt19937 rng(1);
+    const auto data = randomBytes(100000, rng);
+    EXPECT_EQ(Crc32Ethernet(data.data(), data.size()), ~referenceEthernet(data.data(), data.size(), 0xFFFFFFFF));
+}
+
+TEST(Crc, Crc32Generic)
+{
+    // 0x04C11DB7 with equal input and output reflection uses the tables, all others the bitwise loop
+    for (const uint32_t polynomial : {0x04C11DB7u, 0x1EDC6F41u, 0xF4ACFB13u})
+    {
+        for (int flags = 0; flags < 8; flags++)
+        {
+            const bool reflectIn  = (flags & 1) != 0;
+            const bool reflectOut = (flags & 2) != 0;
+            const bool invertOut  = (flags & 4) != 0;
+            for (const uint32_t seed : {0xFFFFFFFFu, 0x12345678u})
+            {
+                compare(
+                    "Crc32",
+                    [=](const uint8_t *buf, size_t len) { return Crc32(buf, static_cast<uint16_t>(len), polynomial, reflectIn, reflectOut, invertOut, seed); },
+                    [=](const uint8_t *buf, size_t len) { return referenceCrc32(buf, len, polynomial, reflectIn, reflectOut, invertOut, seed); });
+            }
+        }
+    }
+}
+
+TEST(Crc, Crc32Values)
+{
+    const uint16_t values[] = {0x1234, 0xABCD, 0x0F0F, 0x8001, 0x7FFE};
+    const uint8_t littleEndian[] = {0x34, 0x12, 0xCD, 0xAB, 0x0F, 0x0F, 0x01, 0x80, 0xFE, 0x7F};
+    const uint8_t bigEndian[]    = {0x12, 0x34, 0xAB, 0xCD, 0x0F, 0x0F, 0x80, 0x01, 0x7F, 0xFE};
+    const uint16_t count         = sizeof(values) / sizeof(values[0]);
+
+    EXPECT_EQ(Crc32Bzip2(values, count), referenceCrc32(littleEndian, sizeof(littleEndian), 0x04C11DB7, false, false, true, 0xFFFFFFFF));
+    EXPECT_EQ(Crc32Bzip2(values, count, true), referenceCrc32(bigEndian, sizeof(bigEndian), 0x04C11DB7, false, false, true, 0xFFFFFFFF));
+    EXPECT_EQ(Crc32Mpeg2(values, count, true), referenceCrc32(bigEndian, sizeof(bigEndian), 0x04C11DB7, false, false, false, 0xFFFFFFFF));
+}
+
+TEST(Crc, Crc32Words)
+{
+    // words of 1 to 16 bits, the bytes of 8 and 16 bit words use the tables
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> dist(0, 0xFFFF);
+    std::vector<uint16_t> words(300);
+    for (unsigned int bits = 1; bits <= 16; bits++)
+    {
+        const uint16_t mask = static_cast<uint16_t>((1u << bits) - 1);
+        for (auto &w : words)
+        {
+            w = static_cast<uint16_t>(dist(rng)) & mask;
+        }
+
+        for (const uint16_t length : {0, 1, 2, 3, 17, 300})
+        {
+            uint32_t mpeg2    = 0xFFFFFFFF;
+            uint32_t ethernet = 0xFFFFFFFF;
+            for (uint16_t i = 0; i < length; i++)
+            {
+                mpeg2    = referenceMsbBits(mpeg2, words[i], bits, 0x04C11DB7, 32);
+                ethernet = referenceReflectedBits(ethernet, words[i], bits);
+            }
+            EXPECT_EQ(Crc32Mpeg2(words.data(), length, bits), mpeg2) << bits << " bits, length " << length;
+            EXPECT_EQ(Crc32Ethernet(words.data(), length, bits), ~ethernet) << bits << " bits, length " << length;
+        }
+    }
+}
+
+TEST(Crc, Crc16Words)
+{
+    // shorter words always feed a whole byte, so only 8 bits and more are checked
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> dist(0, 0xFFFF);
+    std::vector<uint16_t> words(300);
+    for (unsigned int bits = 8; bits <= 16; bits++)
+    {
+        const uint16_t mask = static_cast<uint16_t>((1u << bits) - 1);
+        for (auto &w : words)
+        {
+            w = static_cast<uint16_t>(dist(rng)) & mask;
+        }
+
+        for (const unsigned int length : {0u, 1u, 2u, 17u, 300u})
+        {
+            uint32_t crc = 0xFFFF;
+            for (unsigned int i = 0; i < length; i++)
+            {
+                crc = referenceMsbBits(crc, words[i], bits, 0x1021, 16);
+            }
+            EXPECT_EQ(Crc16CcittFalse(words.data(), length, bits), crc) << bits << " bits, length " << length;
+        }
+    }
+}
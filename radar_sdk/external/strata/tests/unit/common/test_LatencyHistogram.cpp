@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <common/LatencyHistogram.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+TEST(LatencyHistogram, Buckets)
+{
+    LatencyHistogram histogram;
+    LatencyHistogram::Snapshot snapshot;
+
+    // bucket 0 is below 1 us, bucket i is [2^(i-1), 2^i) us
+    histogram.recordMicroseconds(0);
+    histogram.recordMicroseconds(1);
+    histogram.recordMicroseconds(2);
+    histogram.recordMicroseconds(3);
+    histogram.recordMicroseconds(1000);
+    histogram.recordMicroseconds(UINT64_C(1) << 40);
+    histogram.record(std::chrono::nanoseconds(500));
+    histogram.record(-std::chrono::milliseconds(1));
+
+    histogram.getSnapshot(snapshot);
+    EXPECT_EQ(snapshot.count, 8u);
+    EXPECT_EQ(snapshot.sumUs, 1006u + (UINT64_C(1) << 40));
+    EXPECT_EQ(snapshot.maxUs, UINT64_C(1) << 40);
+    EXPECT_EQ(snapshot.buckets[0], 3u);
+    EXPECT_EQ(snapshot.buckets[1], 1u);
+    EXPECT_EQ(snapshot.buckets[2], 2u);
+    EXPECT_EQ(snapshot.buckets[10], 1u);  // 512 <= 1000 < 1024
+    EXPECT_EQ(snapshot.buckets[LatencyHistogram::bucketCount - 1], 1u);
+
+    histogram.reset();
+    histogram.getSnapshot(snapshot);
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.sumUs, 0u);
+    EXPECT_EQ(snapshot.maxUs, 0u);
+    for (const auto bucket : snapshot.buckets)
+    {
+        EXPECT_EQ(bucket, 0u);
+    }
+}
+
+TEST(LatencyHistogram, ConcurrentRecording)
+{
+    constexpr unsigned int threadCount = 4;
+    constexpr uint64_t perThread       = 10000;
+
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&histogram, t] {
+            for (uint64_t i = 0; i < perThread; i++)
+            {
+                histogram.recordMicroseconds(t * perThread + i);
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    LatencyHistogram::Snapshot snapshot;
+    histogram.getSnapshot(snapshot);
+    const uint64_t total = threadCount * perThread;
+    EXPECT_EQ(snapshot.count, total);
+    EXPECT_EQ(snapshot.sumUs, total * (total - 1) / 2);
+    EXPECT_EQ(snapshot.maxUs, total - 1);
+    uint64_t bucketSum = 0;
+    for (const auto bucket : snapshot.buckets)
+    {
+        bucketSum += bucket;
+    }
+    EXPECT_EQ(bucketSum, total);
+}
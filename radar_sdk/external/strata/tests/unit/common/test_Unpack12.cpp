@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <common/Packed12.hpp>
+#include <common/Raw12.hpp>
+#include <common/Unpack12.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    // element-wise reference, as the samples were unpacked before the SIMD overloads were added
+    void referencePacked12(const std::vector<uint8_t> &in, std::vector<uint16_t> &out)
+    {
+        for (size_t i = 0; i < in.size() / 3; i++)
+        {
+            out[2 * i + 0] = static_cast<uint16_t>((in[3 * i + 0] << 4) | (in[3 * i + 1] >> 4));
+            out[2 * i + 1] = static_cast<uint16_t>(((in[3 * i + 1] & 0x0F) << 8) | in[3 * i + 2]);
+        }
+    }
+
+    void referenceRaw12(const std::vector<uint8_t> &in, std::vector<uint16_t> &out)
+    {
+        for (size_t i = 0; i < in.size() / 3; i++)
+        {
+            out[2 * i + 0] = static_cast<uint16_t>((in[3 * i + 0] << 4) | (in[3 * i + 2] & 0x0F));
+            out[2 * i + 1] = static_cast<uint16_t>((in[3 * i + 1] << 4) | (in[3 * i + 2] >> 4));
+        }
+    }
+
+    std::vector<uint8_t> randomBytes(size_t count, std::mt19937 &rng)
+    {
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<uint8_t> bytes(count);
+        for (auto &b : bytes)
+        {
+            b = static_cast<uint8_t>(dist(rng));
+        }
+        return bytes;
+    }
+
+    using OutOfPlace = void (*)(const uint8_t *, const uint8_t *, uint16_t *);
+    using InPlace    = void (*)(uint16_t *, uint16_t *);
+    using Reference  = void (*)(const std::vector<uint8_t> &, std::vector<uint16_t> &);
+
+    void checkUnpack(OutOfPlace unpack, InPlace unpackInPlace, Reference reference)
+    {
+        std::mt19937 rng(12);
+        for (size_t samples = 0; samples <= 200; samples += 2)
+        {
+            const auto packed = randomBytes(samples / 2 * 3, rng);
+            std::vector<uint16_t> expected(samples);
+            reference(packed, expected);
+
+            // one guard element behind the output detects writes past the end
+            std::vector<uint16_t> out(samples + 1, 0xDEAD);
+            unpack(packed.data(), packed.data() + packed.size(), out.data());
+            EXPECT_EQ(std::vector<uint16_t>(out.begin(), out.begin() + samples), expected) << "samples = " << samples;
+            EXPECT_EQ(out[samples], 0xDEAD) << "samples = " << samples;
+
+            std::vector<uint16_t> buffer(samples + 1, 0xDEAD);
+            std::copy(packed.begin(), packed.end(), reinterpret_cast<uint8_t *>(buffer.data()));
+            unpackInPlace(buffer.data(), buffer.data() + samples);
+            EXPECT_EQ(std::vector<uint16_t>(buffer.begin(), buffer.begin() + samples), expected) << "samples = " << samples;
+            EXPECT_EQ(buffer[samples], 0xDEAD) << "samples = " << samples;
+        }
+    }
+}
+
+
+TEST(Unpack12, Packed12)
+{
+    checkUnpack(unpackPacked12, unpackPacked12, referencePacked12);
+}
+
+TEST(Unpack12, Packed12Generic)
+{
+    checkUnpack(unpackPacked12<const uint8_t *, uint16_t *>, unpackPacked12, referencePacked12);
+}
+
+TEST(Unpack12, Raw12)
+{
+    checkUnpack(unpackRaw12, unpackRaw12, referenceRaw12);
+}
+
+TEST(Unpack12, Raw12Generic)
+{
+    checkUnpack(unpackRaw12<const uint8_t *, uint16_t *>, unpackRaw12, referenceRaw12);
+}
+
+// the dispatched overloads above only cover the kernel selected for this CPU
+TEST(Unpack12, Kernels)
+{
+    static const uint8_t packed12Shuffle[16] = {1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10};
+
+    const struct
+    {
+        const char *name;
+        bool supported;
+        unpack12::BlockKernel kernel;
+    } kernels[] = {
+        {"SSSE3", unpack12::hasSsse3(), unpack12::unpackBlocksSsse3},
+        {"NEON", unpack12::hasNeon(), unpack12::unpackBlocksNeon},
+    };
+
+    std::mt19937 rng(21);
+    const size_t blocks = 10;
+    const auto packed   = randomBytes(blocks * 12 + 4, rng);
+    std::vector<uint16_t> expected(blocks * 8);
+    referencePacked12(packed, expected);
+
+    for (const auto &k : kernels)
+    {
+        if (!k.supported)
+        {
+            continue;
+        }
+        std::vector<uint16_t> out(blocks * 8 + 1, 0xDEAD);
+        k.kernel(packed.data(), blocks, out.data(), packed12Shuffle, 0x0000FFFF, 0x0FFF0000);
+        EXPECT_EQ(std::vector<uint16_t>(out.begin(), out.begin() + blocks * 8), expected) << k.name;
+        EXPECT_EQ(out[blocks * 8], 0xDEAD) << k.name;
+    }
+}
@@ -0,0 +1,509 @@
+#include <gtest/gtest.h>
+
+#include <components/exception/ERadar.hpp>
+#include <components/processing/ProcessingRadar.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    using Complex = std::complex<double>;
+
+    constexpr double pi        = 3.14159265358979323846;
+    constexpr double q31       = 2147483648.0;
+    constexpr double q15       = 32768.0;
+    constexpr double tolerance = 1e-5;  // of the full scale, for single precision FFTs
+
+    struct FftCase
+    {
+        const char *name;
+        uint8_t dimension;
+        uint16_t samples;
+        uint16_t offset;
+        uint16_t size;
+        uint16_t acceptedBins;
+        uint8_t flags;
+        uint8_t window;
+        uint8_t exponent;
+        uint8_t format;
+    };
+
+    class ProcessingRadarTest :
+        public ::testing::Test
+    {
+    protected:
+        /// Write values (pages * rows * cols, row-major) as a signal of format Q31 (real part only) or ComplexQ31
+        IfxRsp_Signal writeSignal(uint16_t pages, uint16_t rows, uint16_t cols, const std::vector<Complex> &values, uint8_t format)
+        {
+            const bool isComplex = (format == DataFormat_ComplexQ31);
+            const uint32_t size  = isComplex ? 8 : 4;
+
+            IfxRsp_Signal signal = {};
+            signal.stride        = cols * size;
+            signal.size          = pages * rows * signal.stride;
+            signal.baseAddress   = m_radar.allocate(signal.size);
+            signal.rows          = rows;
+            signal.cols          = cols;
+            signal.pages         = pages;
+            signal.format        = format;
+
+            std::vector<int32_t> raw;
+            for (const auto &value : values)
+            {
+                raw.push_back(static_cast<int32_t>(std::lround(value.real() * q31)));
+                if (isComplex)
+                {
+                    raw.push_back(static_cast<int32_t>(std::lround(value.imag() * q31)));
+                }
+            }
+            m_radar.getIMemory()->write(signal.baseAddress, signal.size, reinterpret_cast<const uint8_t *>(raw.data()));
+            return signal;
+        }
+
+        std::vector<uint8_t> readBytes(const IfxRsp_Signal &signal)
+        {
+            std::vector<uint8_t> bytes(signal.pages * signal.rows * signal.stride);
+            m_radar.getIMemory()->read(signal.baseAddress, static_cast<uint32_t>(bytes.size()), bytes.data());
+            return bytes;
+        }
+
+        /// Read a signal of format Q15, Q31, ComplexQ15 or ComplexQ31 (pages * rows * cols, row-major)
+        std::vector<Complex> readSignal(const IfxRsp_Signal &signal)
+        {
+            const auto bytes     = readBytes(signal);
+            const bool isComplex = (signal.format == DataFormat_ComplexQ15) || (signal.format == DataFormat_ComplexQ31);
+            const bool is16Bit   = (signal.format == DataFormat_ComplexQ15) || (signal.format == DataFormat_Q15);
+            const size_t size    = is16Bit ? 2 : 4;
+
+            auto component = [&](size_t offset) {
+                if (is16Bit)
+                {
+                    int16_t value;
+                    std::memcpy(&value, &bytes[offset], sizeof(value));
+                    return value / q15;
+                }
+                int32_t value;
+                std::memcpy(&value, &bytes[offset], sizeof(value));
+                return value / q31;
+            };
+
+            std::vector<Complex> values;
+            for (size_t row = 0; row < static_cast<size_t>(signal.pages) * signal.rows; row++)
+            {
+                for (size_t col = 0; col < signal.cols; col++)
+                {
+                    const size_t offset = row * signal.stride + col * size * (isComplex ? 2 : 1);
+                    values.emplace_back(component(offset), isComplex ? component(offset + size) : 0.0);
+                }
+            }
+            return values;
+        }
+
+        std::vector<Complex> randomValues(size_t count, double amplitude)
+        {
+            std::uniform_real_distribution<double> dist(-amplitude, amplitude);
+            std::vector<Complex> values(count);
+            for (auto &value : values)
+            {
+                value = Complex(dist(m_rng), dist(m_rng));
+            }
+            return values;
+        }
+
+        ProcessingRadar m_radar;
+        std::mt19937 m_rng {44};
+    };
+
+    /// The window as documented, computed in double precision
+    double window(uint8_t type, uint32_t i, uint32_t samples)
+    {
+        const double n = samples - 1;
+        switch (type)
+        {
+            case IfxRsp_FftWindow_Hann:
+                return 0.5 - 0.5 * std::cos(2 * pi * i / n);
+            case IfxRsp_FftWindow_Hamming:
+                return 0.54 - 0.46 * std::cos(2 * pi * i / n);
+            default:
+                return 1.0;
+        }
+    }
+
+    /// Direct DFT of the line of each page: values[page][line][i]
+    std::vector<Complex> referenceFft(const std::vector<Complex> &values, uint16_t pages, uint16_t rows, uint16_t cols, const FftCase &c)
+    {
+        const uint32_t lineLength = c.dimension ? rows : cols;
+        const uint32_t numLines   = c.dimension ? cols : rows;
+        const uint32_t samples    = c.samples ? c.samples : lineLength - c.offset;
+        uint32_t fftSize          = c.size;
+        if (!fftSize)
+        {
+            for (fftSize = 1; fftSize < samples; fftSize <<= 1)
+            {
+            }
+        }
+        const uint32_t bins = (c.flags & FFT_FLAGS_DISCARD_HALF) ? fftSize / 2 : (c.acceptedBins ? c.acceptedBins : fftSize);
+        const double gain   = ((c.format == DataFormat_ComplexQ15) || (c.format == DataFormat_Q15)) ? std::ldexp(1.0, c.exponent) / fftSize : 1.0 / fftSize;
+
+        const uint32_t outRows = c.dimension ? bins : rows;
+        const uint32_t outCols = c.dimension ? cols : bins;
+        std::vector<Complex> result(static_cast<size_t>(pages) * outRows * outCols);
+        for (uint32_t page = 0; page < pages; page++)
+        {
+            for (uint32_t line = 0; line < numLines; line++)
+            {
+                for (uint32_t k = 0; k < bins; k++)
+                {
+                    Complex sum;
+                    for (uint32_t i = 0; i < samples; i++)
+                    {
+                        const uint32_t pos = c.offset + i;
+                        const auto &x      = c.dimension ? values[(page * rows + pos) * cols + line] : values[(page * rows + line) * cols + pos];
+                        sum += x * window(c.window, i, samples) * std::polar(1.0, -2 * pi * k * i / fftSize);
+                    }
+                    auto &out = c.dimension ? result[(page * outRows + k) * outCols + line] : result[(page * outRows + line) * outCols + k];
+                    out       = sum * gain;
+                    if ((c.format == DataFormat_Q15) || (c.format == DataFormat_Q31))
+                    {
+                        out = std::abs(out);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    /// Magnitudes in units of the LSB of format Q31, as seen by the thresholding
+    std::vector<double> toMagnitudes(const std::vector<Complex> &values)
+    {
+        std::vector<double> magnitudes;
+        for (const auto &value : values)
+        {
+            magnitudes.push_back(std::round(std::abs(value.real()) * q31));
+        }
+        return magnitudes;
+    }
+
+    /// Cells guard + 1 .. guard + count away from cell on one side (direction -1: lead, +1: lag)
+    std::vector<double> windowCells(const std::vector<double> &line, uint32_t cell, uint32_t guard, uint32_t count, int direction, bool extension)
+    {
+        const auto length = static_cast<int64_t>(line.size());
+        std::vector<double> cells;
+        for (int64_t i = guard + 1; i <= guard + count; i++)
+        {
+            int64_t pos = static_cast<int64_t>(cell) + direction * i;
+            if (extension)
+            {
+                pos = ((pos % length) + length) % length;
+            }
+            else if ((pos < 0) || (pos >= length))
+            {
+                continue;
+            }
+            cells.push_back(line[pos]);
+        }
+        return cells;
+    }
+
+    double average(const std::vector<double> &cells)
+    {
+        double sum = 0;
+        for (auto cell : cells)
+        {
+            sum += cell;
+        }
+        return sum / cells.size();
+    }
+
+    /// Noise estimate of a CFAR algorithm from the estimates of both sides, false if both sides are empty
+    bool combineSides(int mode, const std::vector<double> &lead, double leadLevel, const std::vector<double> &lag, double lagLevel, double &noise)
+    {
+        if (lead.empty() || lag.empty())
+        {
+            noise = lead.empty() ? lagLevel : leadLevel;
+            return !lead.empty() || !lag.empty();
+        }
+        noise = (mode == 1) ? std::max(leadLevel, lagLevel) : (mode == 2) ? std::min(leadLevel, lagLevel) : (leadLevel + lagLevel) / 2;
+        return true;
+    }
+
+    /// Noise level of CFAR CA at a cell, false if there is no estimate
+    bool noiseCfarCa(const std::vector<double> &line, uint32_t cell, const IfxRsp_CfarCaSetting &s, bool extension, double &noise)
+    {
+        const uint32_t count = 1u << s.windowCellsExponent;
+        const auto lead      = windowCells(line, cell, s.guardCells, count, -1, extension);
+        const auto lag       = windowCells(line, cell, s.guardCells, count, +1, extension);
+
+        if (s.algorithm == IfxRsp_CfarCaAlgorithm_Cash)
+        {
+            const size_t subWindow = std::min(1u << s.cashSubWindowExponent, count);
+            bool found             = false;
+            for (const auto *side : {&lead, &lag})
+            {
+                for (size_t begin = 0; begin + subWindow <= side->size(); begin += subWindow)
+                {
+                    const double level = average(std::vector<double>(side->begin() + begin, side->begin() + begin + subWindow));
+                    noise              = found ? std::min(noise, level) : level;
+                    found              = true;
+                }
+            }
+            return found;
+        }
+
+        const int mode = (s.algorithm == IfxRsp_CfarCaAlgorithm_Cago) ? 1 : (s.algorithm == IfxRsp_CfarCaAlgorithm_Caso) ? 2 : 0;
+        return combineSides(mode, lead, lead.empty() ? 0 : average(lead), lag, lag.empty() ? 0 : average(lag), noise);
+    }
+
+    /// Noise level of CFAR GOS at a cell, false if there is no estimate
+    bool noiseCfarGos(const std::vector<double> &line, uint32_t cell, const IfxRsp_CfarGosSetting &s, bool extension, double &noise)
+    {
+        auto lead = windowCells(line, cell, s.guardCells, s.windowCells, -1, extension);
+        auto lag  = windowCells(line, cell, s.guardCells, s.windowCells, +1, extension);
+        std::sort(lead.begin(), lead.end());
+        std::sort(lag.begin(), lag.end());
+
+        auto ordered = [](const std::vector<double> &cells, uint8_t index) {
+            return cells.empty() ? 0.0 : cells[std::min<size_t>(std::max<uint8_t>(index, 1), cells.size()) - 1];
+        };
+        const int mode = (s.algorithm == IfxRsp_CfarGosAlgorithm_Gosgo) ? 1 : (s.algorithm == IfxRsp_CfarGosAlgorithm_Gosso) ? 2 : 0;
+        return combineSides(mode, lead, ordered(lead, s.indexLead), lag, ordered(lag, s.indexLag), noise);
+    }
+
+    bool readBit(const std::vector<uint8_t> &bits, const IfxRsp_Signal &signal, uint32_t row, uint32_t col)
+    {
+        return (bits[row * signal.stride + col / 8] >> (col % 8)) & 1;
+    }
+}
+
+
+TEST_F(ProcessingRadarTest, FftMatchesDft)
+{
+    const FftCase cases[] = {
+        {"all samples", 0, 0, 0, 0, 0, 0, IfxRsp_FftWindow_NoWindow, 0, DataFormat_ComplexQ31},
+        {"offset and zero padding", 0, 13, 5, 32, 0, 0, IfxRsp_FftWindow_Hann, 0, DataFormat_ComplexQ31},
+        {"discard half", 0, 0, 0, 0, 0, FFT_FLAGS_DISCARD_HALF, IfxRsp_FftWindow_Hamming, 0, DataFormat_ComplexQ31},
+        {"accepted bins", 0, 16, 2, 0, 5, 0, IfxRsp_FftWindow_NoWindow, 0, DataFormat_ComplexQ31},
+        {"magnitude", 0, 20, 1, 0, 0, 0, IfxRsp_FftWindow_Hann, 0, DataFormat_Q31},
+        {"16 bit with exponent", 0, 0, 0, 0, 0, 0, IfxRsp_FftWindow_NoWindow, 2, DataFormat_ComplexQ15},
+        {"columns", 1, 6, 3, 16, 0, 0, IfxRsp_FftWindow_Hann, 0, DataFormat_ComplexQ31},
+        {"columns magnitude discard half", 1, 0, 0, 0, 0, FFT_FLAGS_DISCARD_HALF, IfxRsp_FftWindow_NoWindow, 0, DataFormat_Q31},
+    };
+
+    const uint16_t pages = 2, rows = 10, cols = 24;
+    const auto values    = randomValues(pages * rows * cols, 0.5);
+
+    for (const auto &c : cases)
+    {
+        SCOPED_TRACE(c.name);
+        m_radar.reinitialize();
+        auto input = writeSignal(pages, rows, cols, values, DataFormat_ComplexQ31);
+
+        IfxRsp_FftSetting settings = {};
+        settings.size              = c.size;
+        settings.acceptedBins      = c.acceptedBins;
+        settings.window            = c.window;
+        settings.exponent          = c.exponent;
+        settings.flags             = c.flags;
+
+        IfxRsp_Signal output = {};
+        m_radar.doFft(&input, &settings, &output, c.samples, c.offset, c.dimension, c.format);
+        EXPECT_EQ(output.format, c.format);
+        EXPECT_EQ(output.pages, pages);
+
+        const auto expected = referenceFft(values, pages, rows, cols, c);
+        const auto actual   = readSignal(output);
+        ASSERT_EQ(actual.size(), expected.size());
+        const double lsb = ((c.format == DataFormat_ComplexQ15) || (c.format == DataFormat_Q15)) ? 1 / q15 : 0.0;
+        for (size_t i = 0; i < actual.size(); i++)
+        {
+            EXPECT_NEAR(actual[i].real(), expected[i].real(), tolerance + lsb) << "i = " << i;
+            EXPECT_NEAR(actual[i].imag(), expected[i].imag(), tolerance + lsb) << "i = " << i;
+        }
+    }
+}
+
+TEST_F(ProcessingRadarTest, InPlaceFft)
+{
+    const uint16_t rows = 4, cols = 16;
+    const auto values   = randomValues(rows * cols, 0.5);
+    auto input          = writeSignal(1, rows, cols, values, DataFormat_ComplexQ31);
+
+    IfxRsp_FftSetting settings = {};
+    settings.window            = IfxRsp_FftWindow_NoWindow;
+    settings.flags             = FFT_FLAGS_INPLACE;
+
+    IfxRsp_Signal output = {};
+    m_radar.doFft(&input, &settings, &output, 0, 0, 0, DataFormat_ComplexQ31);
+    EXPECT_EQ(output.baseAddress, input.baseAddress);
+
+    const FftCase c     = {"in place", 0, 0, 0, 0, 0, 0, IfxRsp_FftWindow_NoWindow, 0, DataFormat_ComplexQ31};
+    const auto expected = referenceFft(values, 1, rows, cols, c);
+    const auto actual   = readSignal(output);
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        EXPECT_NEAR(std::abs(actual[i] - expected[i]), 0.0, 2 * tolerance) << "i = " << i;
+    }
+}
+
+TEST_F(ProcessingRadarTest, InvalidFftSettingsAreRejected)
+{
+    auto input = writeSignal(1, 2, 16, randomValues(32, 0.5), DataFormat_ComplexQ31);
+
+    IfxRsp_FftSetting settings = {};
+    IfxRsp_Signal output       = {};
+
+    settings.size = 24;
+    EXPECT_THROW(m_radar.doFft(&input, &settings, &output, 0, 0, 0, DataFormat_ComplexQ31), ERadar);
+    settings.size = 8;
+    EXPECT_THROW(m_radar.doFft(&input, &settings, &output, 0, 0, 0, DataFormat_ComplexQ31), ERadar);
+    settings.size = 0;
+    EXPECT_THROW(m_radar.doFft(&input, &settings, &output, 8, 9, 0, DataFormat_ComplexQ31), ERadar);
+
+    settings.flags        = FFT_FLAGS_DISCARD_HALF;
+    settings.acceptedBins = 4;
+    EXPECT_THROW(m_radar.doFft(&input, &settings, &output, 0, 0, 0, DataFormat_ComplexQ31), ERadar);
+}
+
+TEST_F(ProcessingRadarTest, CfarMatchesBruteForce)
+{
+    const uint16_t rows = 6, cols = 48;
+
+    // noise with a few targets, as non-negative integers so that the magnitudes are exact
+    std::uniform_int_distribution<int> noise(0, 1000);
+    std::uniform_int_distribution<int> target(5000, 20000);
+    std::vector<Complex> values(rows * cols);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = (i % 7 == 3) ? target(m_rng) / q31 : noise(m_rng) / q31;
+    }
+    const auto magnitudes = toMagnitudes(values);
+
+    struct CfarCase
+    {
+        IfxRsp_CfarCaSetting ca;
+        IfxRsp_CfarGosSetting gos;
+    };
+    const CfarCase cases[] = {
+        {{IfxRsp_CfarCaAlgorithm_Ca, 1, 3, 0, 600}, {}},
+        {{IfxRsp_CfarCaAlgorithm_Cago, 2, 2, 0, 512}, {}},
+        {{IfxRsp_CfarCaAlgorithm_Caso, 0, 4, 0, 700}, {}},
+        {{IfxRsp_CfarCaAlgorithm_Cash, 1, 3, 1, 600}, {}},
+        {{}, {IfxRsp_CfarGosAlgorithm_Gosca, 1, 3, 5, 8, 600}},
+        {{}, {IfxRsp_CfarGosAlgorithm_Gosgo, 0, 8, 2, 8, 512}},
+        {{}, {IfxRsp_CfarGosAlgorithm_Gosso, 2, 1, 4, 6, 800}},
+        {{IfxRsp_CfarCaAlgorithm_Ca, 1, 3, 0, 400}, {IfxRsp_CfarGosAlgorithm_Gosca, 1, 3, 5, 8, 400}},
+    };
+
+    size_t detections = 0;
+    for (const bool extension : {false, true})
+    {
+        for (const uint8_t dimension : {0, 1})
+        {
+            for (const auto &c : cases)
+            {
+                SCOPED_TRACE(testing::Message() << "extension = " << extension << ", dimension = " << int(dimension)
+                                                << ", ca = " << int(c.ca.algorithm) << ", gos = " << int(c.gos.algorithm));
+                m_radar.reinitialize();
+                auto input = writeSignal(1, rows, cols, values, DataFormat_Q31);
+
+                IfxRsp_ThresholdingSetting settings = {};
+                settings.spectrumExtension          = extension;
+                settings.cfarCa                     = c.ca;
+                settings.cfarGos                    = c.gos;
+
+                IfxRsp_Signal output = {};
+                m_radar.doThresholding(&input, dimension, &settings, &output);
+                EXPECT_EQ(output.format, DataFormat_Bits);
+                const auto bits = readBytes(output);
+
+                const uint32_t lineLength = dimension ? rows : cols;
+                const uint32_t numLines   = dimension ? cols : rows;
+                for (uint32_t l = 0; l < numLines; l++)
+                {
+                    std::vector<double> line(lineLength);
+                    for (uint32_t i = 0; i < lineLength; i++)
+                    {
+                        line[i] = dimension ? magnitudes[i * cols + l] : magnitudes[l * cols + i];
+                    }
+
+                    for (uint32_t cell = 0; cell < lineLength; cell++)
+                    {
+                        bool expected = true;
+                        bool exact    = true;
+                        double level;
+                        if (c.ca.algorithm)
+                        {
+                            const double threshold = noiseCfarCa(line, cell, c.ca, extension, level) ? level * c.ca.betaThreshold / 256 : -1;
+                            expected               = (threshold >= 0) && (line[cell] > threshold);
+                            exact                  = exact && (std::abs(line[cell] - threshold) > 1e-3 * line[cell]);
+                        }
+                        if (expected && c.gos.algorithm)
+                        {
+                            const double threshold = noiseCfarGos(line, cell, c.gos, extension, level) ? level * c.gos.betaThreshold / 256 : -1;
+                            expected               = (threshold >= 0) && (line[cell] > threshold);
+                            exact                  = exact && (std::abs(line[cell] - threshold) > 1e-3 * line[cell]);
+                        }
+
+                        // single precision rounding may decide cells right at the threshold differently
+                        if (exact)
+                        {
+                            const uint32_t row = dimension ? cell : l;
+                            const uint32_t col = dimension ? l : cell;
+                            EXPECT_EQ(readBit(bits, output, row, col), expected) << "row = " << row << ", col = " << col;
+                            detections += expected;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_GT(detections, 0u);
+}
+
+TEST_F(ProcessingRadarTest, ThreadsDoNotChangeResults)
+{
+    // large enough to be distributed to several threads
+    const uint16_t pages = 2, rows = 64, cols = 128;
+    const auto values    = randomValues(pages * rows * cols, 0.5);
+
+    IfxRsp_FftSetting fft = {};
+    fft.window            = IfxRsp_FftWindow_Hann;
+
+    IfxRsp_ThresholdingSetting thresholding = {};
+    thresholding.spectrumExtension          = true;
+    thresholding.localMax                   = {IfxRsp_LocalMaxMode_LocalMaxOnly, 0, 1, true};
+    thresholding.cfarCa                     = {IfxRsp_CfarCaAlgorithm_Ca, 1, 4, 0, 512};
+    thresholding.cfarGos                    = {IfxRsp_CfarGosAlgorithm_Gosgo, 1, 4, 4, 8, 512};
+
+    auto run = [&](uint32_t threads) {
+        m_radar.reinitialize();
+        m_radar.setThreadCount(threads);
+        auto input = writeSignal(pages, rows, cols, values, DataFormat_ComplexQ31);
+
+        std::vector<std::vector<uint8_t>> results;
+        IfxRsp_Signal range = {}, doppler = {}, nci = {}, detections = {}, psd = {};
+        m_radar.doFft(&input, &fft, &range, 0, 0, 0, DataFormat_ComplexQ31);
+        m_radar.doFft(&range, &fft, &doppler, 0, 0, 1, DataFormat_ComplexQ31);
+        m_radar.doNci(&doppler, DataFormat_Q31, &nci);
+        m_radar.doThresholding(&nci, 0, &thresholding, &detections);
+        m_radar.doPsd(&input, 0, &psd);
+        for (const auto *signal : {&range, &doppler, &nci, &detections, &psd})
+        {
+            results.push_back(readBytes(*signal));
+        }
+        return results;
+    };
+
+    const auto single = run(1);
+    for (uint32_t threads : {2u, 3u, 8u})
+    {
+        EXPECT_EQ(run(threads), single) << "threads = " << threads;
+    }
+}
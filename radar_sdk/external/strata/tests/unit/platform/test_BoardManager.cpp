@@ -0,0 +1,371 @@
+#include <gtest/gtest.h>
+
+#include <common/cpp11/memory.hpp>
+
+#include <platform/BoardManager.hpp>
+#include <platform/exception/EConnection.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+    constexpr uint16_t cacheLifetimeMs = 10000;
+
+    /**
+     * A bridge which only answers the requests done during enumeration and while checking cached boards.
+     */
+    class FakeBridge :
+        public IBridge,
+        public IBridgeControl
+    {
+    public:
+        bool isConnected() override
+        {
+            return m_connected;
+        }
+
+        void openConnection() override
+        {
+            m_connected = true;
+        }
+
+        void closeConnection() override
+        {
+            m_connected = false;
+        }
+
+        IBridgeControl *getIBridgeControl() override
+        {
+            return this;
+        }
+
+        IBridgeData *getIBridgeData() override
+        {
+            return nullptr;
+        }
+
+        IVendorCommands *getIVendorCommands() override
+        {
+            return nullptr;
+        }
+
+        void checkVersion() override
+        {}
+
+        void getBoardInfo(BoardInfo_t & /*buffer*/) override
+        {
+            if (!m_responding)
+            {
+                throw EConnection("board does not respond");
+            }
+        }
+
+        const VersionInfo_t &getVersionInfo() override
+        {
+            return m_versionInfo;
+        }
+
+        const std::string &getVersionString() override
+        {
+            return m_string;
+        }
+
+        const std::string &getExtendedVersionString() override
+        {
+            return m_string;
+        }
+
+        const Uuid_t &getUuid() override
+        {
+            return m_uuid;
+        }
+
+        const std::string &getUuidString() override
+        {
+            return m_string;
+        }
+
+        void activateBootloader() override
+        {}
+
+        void setDefaultTimeout() override
+        {}
+
+        uint16_t getMaxTransfer() const override
+        {
+            return 0;
+        }
+
+        IData *getIData() override
+        {
+            return nullptr;
+        }
+
+        IGpio *getIGpio() override
+        {
+            return nullptr;
+        }
+
+        II2c *getII2c() override
+        {
+            return nullptr;
+        }
+
+        ISpi *getISpi() override
+        {
+            return nullptr;
+        }
+
+        IFlash *getIFlash() override
+        {
+            return nullptr;
+        }
+
+        IMemory<uint32_t> *getIMemory() override
+        {
+            return nullptr;
+        }
+
+        std::atomic<bool> m_connected {true};
+        std::atomic<bool> m_responding {true};
+
+    private:
+        VersionInfo_t m_versionInfo = {};
+        Uuid_t m_uuid               = {};
+        std::string m_string;
+    };
+
+    std::unique_ptr<BoardInstance> createTestInstance(std::shared_ptr<IBridge> &&bridge, BoardDescriptor *d)
+    {
+        return std::make_unique<BoardInstance>(std::move(bridge), nullptr, d->getName());
+    }
+
+    BoardData testBoards[] = {
+        {0x1234, 0x0001, createTestInstance},
+    };
+
+    /**
+     * Reports a number of boards after an optional delay and counts the discoveries.
+     * Like a real enumerator, it opens a new connection for each board it finds and
+     * leaves the ownership to the descriptor.
+     */
+    class FakeEnumerator :
+        public IEnumerator
+    {
+    public:
+        FakeEnumerator(uint16_t boardCount, uint16_t delayMs = 0) :
+            m_boardCount {boardCount},
+            m_delayMs {delayMs}
+        {
+        }
+
+        void enumerate(IEnumerationListener &listener, BoardData::const_iterator begin, BoardData::const_iterator /*end*/) override
+        {
+            if (++m_running > 1)
+            {
+                m_concurrent = true;
+            }
+            m_calls++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_delayMs));
+            m_bridges.clear();
+            for (uint16_t i = 0; i < m_boardCount; i++)
+            {
+                auto bridge = std::make_shared<FakeBridge>();
+                m_bridges.push_back(bridge);
+                auto descriptor = std::make_unique<BoardDescriptor>(*begin, "Test Board", std::move(bridge));
+                if (listener.onEnumerate(std::move(descriptor)))
+                {
+                    break;
+                }
+            }
+            m_finished = true;
+            m_running--;
+        }
+
+        std::string getDeviceSignature() override
+        {
+            return m_signature;
+        }
+
+        uint16_t m_boardCount;
+        std::vector<std::weak_ptr<FakeBridge>> m_bridges;  ///< connections opened by the last discovery
+        std::string m_signature;
+        std::atomic<uint32_t> m_calls {0};
+        std::atomic<bool> m_finished {false};
+        std::atomic<bool> m_concurrent {false};
+
+    private:
+        std::atomic<uint32_t> m_running {0};
+        const uint16_t m_delayMs;
+    };
+
+    class TestBoardManager :
+        public BoardManager
+    {
+    public:
+        explicit TestBoardManager(const std::shared_ptr<IEnumerator> &enumerator)
+        {
+            m_enumerators[ConnectionType::serial] = enumerator;
+        }
+
+        uint16_t enumerate(uint16_t maxCount = 0)
+        {
+            return BoardManager::enumerate(std::begin(testBoards), std::end(testBoards), maxCount);
+        }
+    };
+
+    class BoardManagerCache :
+        public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            BoardManager::invalidateCache();
+        }
+
+        void TearDown() override
+        {
+            BoardManager::invalidateCache();
+        }
+
+        // enumerates with a new BoardManager, which hands its unused boards to the cache when it is destroyed
+        uint16_t enumerate(uint16_t maxCount)
+        {
+            TestBoardManager manager(m_enumerator);
+            manager.setCacheLifetime(cacheLifetimeMs);
+            return manager.enumerate(maxCount);
+        }
+
+        bool isConnected(size_t index)
+        {
+            auto bridge = m_enumerator->m_bridges[index].lock();
+            return bridge && bridge->m_connected;
+        }
+
+        std::shared_ptr<FakeEnumerator> m_enumerator = std::make_shared<FakeEnumerator>(2);
+    };
+}
+
+
+TEST(BoardManager, LateEnumeratorsDoNotBlockDestruction)
+{
+    auto enumerator = std::make_shared<FakeEnumerator>(1, 200);
+    {
+        TestBoardManager manager(enumerator);
+        manager.setEnumerationTimeout(1);
+        EXPECT_EQ(manager.enumerate(), 0);
+    }
+    EXPECT_FALSE(enumerator->m_finished);
+
+    // a new enumeration of the same connection type waits for the late one
+    TestBoardManager manager(enumerator);
+    EXPECT_EQ(manager.enumerate(), 1);
+    EXPECT_EQ(enumerator->m_calls, 2u);
+    EXPECT_FALSE(enumerator->m_concurrent);
+}
+
+TEST(BoardManager, EnumeratorIsReusedAfterDeadline)
+{
+    auto enumerator = std::make_shared<FakeEnumerator>(1, 50);
+    TestBoardManager manager(enumerator);
+    manager.setEnumerationTimeout(1);
+    EXPECT_EQ(manager.enumerate(), 0);
+
+    // the next enumeration waits for the previous one, instead of running the same enumerator concurrently
+    manager.setEnumerationTimeout(0);
+    EXPECT_EQ(manager.enumerate(), 1);
+    EXPECT_EQ(enumerator->m_calls, 2u);
+}
+
+TEST_F(BoardManagerCache, ReusesCachedBoards)
+{
+    EXPECT_EQ(enumerate(2), 2);
+    EXPECT_EQ(enumerate(2), 2);
+    EXPECT_EQ(enumerate(1), 1);
+    EXPECT_EQ(m_enumerator->m_calls, 1u);
+}
+
+TEST_F(BoardManagerCache, CachedBoardsAreDisconnected)
+{
+    EXPECT_EQ(enumerate(2), 2);
+    EXPECT_FALSE(isConnected(0));
+    EXPECT_FALSE(isConnected(1));
+
+    // only the reused boards are connected again
+    TestBoardManager manager(m_enumerator);
+    manager.setCacheLifetime(cacheLifetimeMs);
+    EXPECT_EQ(manager.enumerate(1), 1);
+    EXPECT_EQ(m_enumerator->m_calls, 1u);
+    EXPECT_TRUE(isConnected(0));
+    EXPECT_FALSE(isConnected(1));
+}
+
+TEST_F(BoardManagerCache, UnlimitedEnumerationAlwaysDiscovers)
+{
+    EXPECT_EQ(enumerate(0), 2);
+
+    // a newly plugged board has to be found
+    m_enumerator->m_boardCount++;
+    EXPECT_EQ(enumerate(0), 3);
+    EXPECT_EQ(m_enumerator->m_calls, 2u);
+}
+
+TEST_F(BoardManagerCache, BoardsInUseAreNotCached)
+{
+    std::unique_ptr<BoardInstance> board;
+    {
+        TestBoardManager manager(m_enumerator);
+        manager.setCacheLifetime(cacheLifetimeMs);
+        EXPECT_EQ(manager.enumerate(2), 2);
+        board = manager.createBoardInstance(uint8_t(0));
+    }
+
+    // only the opened board holds its connection, which is closed when it is released
+    EXPECT_EQ(m_enumerator->m_bridges[0].use_count(), 1);
+    board.reset();
+    EXPECT_TRUE(m_enumerator->m_bridges[0].expired());
+
+    // a cached board is missing, so the boards are discovered again
+    EXPECT_EQ(enumerate(2), 2);
+    EXPECT_EQ(m_enumerator->m_calls, 2u);
+}
+
+TEST_F(BoardManagerCache, HotPlugInvalidatesCache)
+{
+    EXPECT_EQ(enumerate(1), 1);
+    m_enumerator->m_signature = "/dev/ttyACM0;";
+    EXPECT_EQ(enumerate(1), 1);
+    EXPECT_EQ(m_enumerator->m_calls, 2u);
+}
+
+TEST_F(BoardManagerCache, UnresponsiveBoardInvalidatesCache)
+{
+    EXPECT_EQ(enumerate(2), 2);
+    auto bridge = m_enumerator->m_bridges[1].lock();
+    ASSERT_NE(bridge, nullptr);
+    bridge->m_responding = false;
+    bridge.reset();
+    EXPECT_EQ(enumerate(1), 1);
+    EXPECT_EQ(m_enumerator->m_calls, 2u);
+}
+
+TEST_F(BoardManagerCache, ExpiredBoardsAreDropped)
+{
+    {
+        TestBoardManager manager(m_enumerator);
+        manager.setCacheLifetime(1);
+        EXPECT_EQ(manager.enumerate(2), 2);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // the connections are closed when the boards are released, not only by the next enumeration
+    EXPECT_TRUE(m_enumerator->m_bridges[0].expired());
+    EXPECT_TRUE(m_enumerator->m_bridges[1].expired());
+}
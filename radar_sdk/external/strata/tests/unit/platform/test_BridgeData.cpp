@@ -0,0 +1,368 @@
+#include <gtest/gtest.h>
+
+#include <platform/bridge/BridgeData.hpp>
+#include <platform/frames/ErrorFrame.hpp>
+#include <platform/frames/FramePool.hpp>
+#include <universal/data_definitions.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+    constexpr uint16_t timeoutMs = 1000;
+
+    // consecutive numbers, the value of a trimmed frame (DataError_FrameQueueTrimmed)
+    constexpr uint32_t gap = 0xFFFFFFFF;
+
+    /**
+     * Bridge with a synthetic producer instead of a receiving thread.
+     * Each produced frame carries a sequence number, like a bridge taking buffers from its pool.
+     */
+    class SyntheticBridge :
+        public BridgeData
+    {
+    public:
+        SyntheticBridge()
+        {
+            m_pool.setFrameBufferSize(sizeof(uint32_t));
+        }
+
+        ~SyntheticBridge() override
+        {
+            // the queued frames belong to the pool, which is destroyed before the base class
+            stopBridgeData();
+        }
+
+        void setFrameBufferSize(uint32_t /*size*/) override
+        {
+        }
+
+        void startStreaming() override
+        {
+            startBridgeData();
+        }
+
+        void stopStreaming() override
+        {
+            stopBridgeData();
+        }
+
+        // returns false if the pool had no buffer left
+        bool produce(uint32_t sequence)
+        {
+            auto *frame = m_pool.dequeueFrame();
+            if (!frame)
+            {
+                queueFrame(ErrorFrame::create(DataError_FramePoolDepleted, VIRTUAL_CHANNEL_UNDEFINED));
+                return false;
+            }
+            frame->setDataSize(sizeof(sequence));
+            std::memcpy(frame->getData(), &sequence, sizeof(sequence));
+            queueFrame(frame);
+            return true;
+        }
+
+        void produceError(uint32_t statusCode)
+        {
+            queueFrame(ErrorFrame::create(statusCode, VIRTUAL_CHANNEL_UNDEFINED));
+        }
+
+        // returns the sequence number of the next frame, gap for a trimmed queue
+        bool consume(uint32_t &sequence, uint16_t timeout = timeoutMs)
+        {
+            auto *frame = getFrame(timeout);
+            if (!frame)
+            {
+                return false;
+            }
+            if (frame->getStatusCode() == DataError_FrameQueueTrimmed)
+            {
+                sequence = gap;
+            }
+            else
+            {
+                EXPECT_EQ(frame->getStatusCode(), DataError_NoError);
+                std::memcpy(&sequence, frame->getData(), sizeof(sequence));
+            }
+            frame->release();
+            return true;
+        }
+
+        std::vector<uint32_t> consumeAll()
+        {
+            std::vector<uint32_t> sequences;
+            uint32_t sequence;
+            while (consume(sequence, 10))
+            {
+                sequences.push_back(sequence);
+            }
+            return sequences;
+        }
+
+        BridgeDataStatistics statistics() const
+        {
+            BridgeDataStatistics result;
+            getStatistics(result);
+            return result;
+        }
+
+    protected:
+        void getFramePoolStatistics(uint32_t &count, uint32_t &highWaterMark) const override
+        {
+            m_pool.getStatistics(count, highWaterMark);
+        }
+
+        void resetFramePoolStatistics() override
+        {
+            m_pool.resetStatistics();
+        }
+
+    private:
+        void setFramePoolCount(uint16_t count) override
+        {
+            m_pool.setFrameCount(count);
+        }
+
+        FramePool m_pool;
+    };
+
+    std::vector<uint32_t> sequence(uint32_t first, uint32_t last)
+    {
+        std::vector<uint32_t> result;
+        for (auto i = first; i <= last; i++)
+        {
+            result.push_back(i);
+        }
+        return result;
+    }
+}
+
+
+TEST(BridgeDataBackPressure, DropOldest)
+{
+    SyntheticBridge bridge;
+    bridge.setFrameQueueSize(4);
+    bridge.startStreaming();
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(bridge.produce(i));
+    }
+
+    auto expected = sequence(6, 9);
+    expected.insert(expected.begin(), gap);
+    EXPECT_EQ(bridge.consumeAll(), expected);
+
+    const auto statistics = bridge.statistics();
+    EXPECT_EQ(statistics.framesReceived, 10u);
+    EXPECT_EQ(statistics.framesTrimmed, 6u);
+    EXPECT_EQ(statistics.framePoolDepleted, 0u);
+    EXPECT_EQ(statistics.framePoolSize, 5u);
+}
+
+TEST(BridgeDataBackPressure, DropNewest)
+{
+    SyntheticBridge bridge;
+    bridge.setBackPressurePolicy(BackPressurePolicy::DropNewest);
+    bridge.setFrameQueueSize(4);
+    bridge.startStreaming();
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(bridge.produce(i));
+    }
+    EXPECT_EQ(bridge.consumeAll(), sequence(0, 3));
+
+    // the consumer learns about the gap before the next frame
+    EXPECT_TRUE(bridge.produce(10));
+    EXPECT_EQ(bridge.consumeAll(), (std::vector<uint32_t> {gap, 10}));
+
+    const auto statistics = bridge.statistics();
+    EXPECT_EQ(statistics.framesTrimmed, 6u);
+    EXPECT_EQ(statistics.framePoolDepleted, 0u);
+}
+
+TEST(BridgeDataBackPressure, BlockProducer)
+{
+    constexpr uint32_t count = 200;
+
+    SyntheticBridge bridge;
+    bridge.setBackPressurePolicy(BackPressurePolicy::BlockProducer);
+    bridge.setFrameQueueSize(4);
+    bridge.startStreaming();
+
+    std::atomic<uint32_t> produced {0};
+    std::atomic<uint32_t> depleted {0};
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (!bridge.produce(i))
+            {
+                depleted++;
+            }
+            produced++;
+        }
+    });
+
+    // a slow consumer: the producer has to wait, but no frame is lost
+    std::vector<uint32_t> received;
+    uint32_t value;
+    while ((received.size() < count) && bridge.consume(value))
+    {
+        received.push_back(value);
+        if (received.size() % 16 == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            EXPECT_LE(produced.load(), received.size() + 4 + 1);
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(received, sequence(0, count - 1));
+    EXPECT_EQ(depleted.load(), 0u);
+    EXPECT_EQ(bridge.statistics().framesTrimmed, 0u);
+}
+
+TEST(BridgeDataBackPressure, StopReleasesBlockedProducer)
+{
+    SyntheticBridge bridge;
+    bridge.setBackPressurePolicy(BackPressurePolicy::BlockProducer);
+    bridge.setFrameQueueSize(2);
+    bridge.startStreaming();
+
+    std::atomic<bool> done {false};
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            bridge.produce(i);
+        }
+        done = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(done.load());
+
+    bridge.stopStreaming();
+    producer.join();
+    EXPECT_TRUE(done.load());
+}
+
+TEST(BridgeDataBackPressure, GrowAndShrink)
+{
+    SyntheticBridge bridge;
+    bridge.setBackPressurePolicy(BackPressurePolicy::Grow, 16);
+    bridge.setFrameQueueSize(4);
+    bridge.startStreaming();
+
+    // the queue grows in chunks of 4 without losing frames
+    for (uint32_t i = 0; i < 12; i++)
+    {
+        EXPECT_TRUE(bridge.produce(i));
+    }
+    auto statistics = bridge.statistics();
+    EXPECT_EQ(statistics.queueDepth, 12u);
+    EXPECT_EQ(statistics.framePoolSize, 13u);
+    EXPECT_EQ(statistics.framesTrimmed, 0u);
+
+    // at the limit the oldest frames are dropped
+    for (uint32_t i = 12; i < 20; i++)
+    {
+        EXPECT_TRUE(bridge.produce(i));
+    }
+    statistics = bridge.statistics();
+    EXPECT_EQ(statistics.queueDepth, 16u);
+    EXPECT_EQ(statistics.framePoolSize, 17u);
+    EXPECT_EQ(statistics.framesTrimmed, 4u);
+
+    auto expected = sequence(4, 19);
+    expected.insert(expected.begin(), gap);
+    EXPECT_EQ(bridge.consumeAll(), expected);
+
+    // a consumer keeping up lets the queue shrink back to its initial size
+    uint32_t value;
+    for (uint32_t i = 20; i < 400; i++)
+    {
+        ASSERT_TRUE(bridge.produce(i));
+        ASSERT_TRUE(bridge.consume(value));
+        ASSERT_EQ(value, i);
+    }
+    statistics = bridge.statistics();
+    EXPECT_EQ(statistics.framePoolSize, 5u);
+    EXPECT_EQ(statistics.framePoolDepleted, 0u);
+}
+
+TEST(BridgeDataStatistics, CountsPerReason)
+{
+    SyntheticBridge bridge;
+    bridge.setFrameQueueSize(16);
+    bridge.startStreaming();
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(bridge.produce(i));
+    }
+    bridge.produceError(DataError_FrameDropped);
+    bridge.produceError(DataError_FramePoolDepleted);
+    bridge.produceError(DataError_FrameSizeExceeded);
+    bridge.produceError(DataError_FrameSizeExceeded);
+    bridge.produceError(DataError_LowLevelError);
+
+    auto statistics = bridge.statistics();
+    EXPECT_EQ(statistics.framesReceived, 3u);
+    EXPECT_EQ(statistics.framesDropped, 1u);
+    EXPECT_EQ(statistics.framePoolDepleted, 1u);
+    EXPECT_EQ(statistics.frameSizeExceeded, 2u);
+    EXPECT_EQ(statistics.otherErrors, 1u);
+    EXPECT_EQ(statistics.framesTrimmed, 0u);
+    EXPECT_EQ(statistics.queueDepth, 8u);
+    EXPECT_EQ(statistics.queueHighWaterMark, 8u);
+    EXPECT_EQ(statistics.framePoolHighWaterMark, 3u);
+    EXPECT_EQ(statistics.queueLatency.count, 0u);
+
+    // every fetched frame records its time in the queue
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        auto *frame = bridge.getFrame(timeoutMs);
+        ASSERT_NE(frame, nullptr);
+        frame->release();
+    }
+    statistics = bridge.statistics();
+    EXPECT_EQ(statistics.queueDepth, 0u);
+    EXPECT_EQ(statistics.queueHighWaterMark, 8u);
+    EXPECT_EQ(statistics.queueLatency.count, 8u);
+    uint64_t bucketSum = 0;
+    for (const auto bucket : statistics.queueLatency.buckets)
+    {
+        bucketSum += bucket;
+    }
+    EXPECT_EQ(bucketSum, 8u);
+
+    bridge.resetStatistics();
+    statistics = bridge.statistics();
+    EXPECT_EQ(statistics.framesReceived, 0u);
+    EXPECT_EQ(statistics.framesDropped, 0u);
+    EXPECT_EQ(statistics.framePoolDepleted, 0u);
+    EXPECT_EQ(statistics.frameSizeExceeded, 0u);
+    EXPECT_EQ(statistics.otherErrors, 0u);
+    EXPECT_EQ(statistics.queueHighWaterMark, 0u);
+    EXPECT_EQ(statistics.framePoolHighWaterMark, 0u);
+    EXPECT_EQ(statistics.queueLatency.count, 0u);
+}
+
+TEST(BridgeDataStatistics, StoppedBridgeDoesNotCount)
+{
+    SyntheticBridge bridge;
+    bridge.setFrameQueueSize(4);
+    EXPECT_TRUE(bridge.produce(0));
+    bridge.produceError(DataError_FrameDropped);
+
+    const auto statistics = bridge.statistics();
+    EXPECT_EQ(statistics.framesReceived, 0u);
+    EXPECT_EQ(statistics.framesDropped, 0u);
+    EXPECT_EQ(statistics.queueDepth, 0u);
+}
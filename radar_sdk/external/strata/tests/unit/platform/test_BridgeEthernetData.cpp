@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <common/Serialization.hpp>
+#include <platform/ethernet/BridgeEthernetData.hpp>
+#include <platform/ethernet/SocketUdp.hpp>
+#include <universal/data_definitions.h>
+#include <universal/link_definitions.h>
+#include <universal/protocol/protocol_definitions.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+namespace
+{
+    constexpr uint16_t dataPort        = 55056;
+    constexpr uint16_t frameHeaderSize = 6;
+    constexpr uint16_t payloadStride   = ETH_UDP_MAX_PAYLOAD - frameHeaderSize;
+    constexpr uint16_t queueSize       = 32;
+    constexpr uint16_t timeoutMs       = 1000;
+
+    ipAddress_t loopback = {127, 0, 0, 1};
+
+    std::vector<uint8_t> framePayload(uint32_t index, uint32_t size)
+    {
+        std::vector<uint8_t> payload(size);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            payload[i] = static_cast<uint8_t>(index * 7 + i);
+        }
+        return payload;
+    }
+
+    /**
+     * Emulates the streaming side of a board on the loopback interface.
+     * The bridge connects to the data port and sends an empty datagram,
+     * which tells the board where to send the frames to.
+     */
+    class LoopbackBoard
+    {
+    public:
+        LoopbackBoard()
+        {
+            m_socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+            sockaddr_in local     = {};
+            local.sin_family      = AF_INET;
+            local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            local.sin_port        = htons(dataPort);
+            m_bound               = (m_socket >= 0) && (::bind(m_socket, reinterpret_cast<sockaddr *>(&local), sizeof(local)) == 0);
+
+            timeval timeout = {1, 0};
+            ::setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
+
+        ~LoopbackBoard()
+        {
+            if (m_socket >= 0)
+            {
+                ::close(m_socket);
+            }
+        }
+
+        bool bound() const
+        {
+            return m_bound;
+        }
+
+        bool waitForBridge()
+        {
+            uint8_t buffer[1];
+            socklen_t size = sizeof(m_bridge);
+            return ::recvfrom(m_socket, buffer, sizeof(buffer), 0, reinterpret_cast<sockaddr *>(&m_bridge), &size) >= 0;
+        }
+
+        void sendPacket(uint8_t bmPktType, uint8_t channel, const uint8_t *payload, uint16_t length)
+        {
+            std::vector<uint8_t> packet(frameHeaderSize + length);
+            auto *it = hostToSerial(packet.data(), bmPktType);
+            it       = hostToSerial(it, channel);
+            it       = hostToSerial(it, m_counter++);
+            it       = hostToSerial(it, length);
+            std::copy(payload, payload + length, it);
+
+            const auto ret = ::sendto(m_socket, packet.data(), packet.size(), 0, reinterpret_cast<sockaddr *>(&m_bridge), sizeof(m_bridge));
+            ASSERT_EQ(ret, static_cast<ssize_t>(packet.size()));
+        }
+
+        // splits the frame into packets of the maximum size, like the firmware
+        void sendFrame(const std::vector<uint8_t> &frame, uint8_t channel = 0)
+        {
+            uint32_t offset = 0;
+            do
+            {
+                const auto length = static_cast<uint16_t>(std::min<size_t>(frame.size() - offset, payloadStride));
+                uint8_t bmPktType = DATA_FRAME_PACKET;
+                if (offset == 0)
+                {
+                    bmPktType |= DATA_FRAME_FLAG_FIRST;
+                }
+                if (offset + length == frame.size())
+                {
+                    bmPktType |= DATA_FRAME_FLAG_LAST;
+                }
+                sendPacket(bmPktType, channel, frame.data() + offset, length);
+                offset += length;
+            } while (offset < frame.size());
+        }
+
+        void skipPacket()
+        {
+            m_counter++;
+        }
+
+    private:
+        int m_socket;
+        bool m_bound;
+        sockaddr_in m_bridge = {};
+        uint16_t m_counter   = 0;
+    };
+
+    class BridgeEthernetDataLoopback :
+        public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!m_board.bound())
+            {
+                GTEST_SKIP() << "data port " << dataPort << " is not available on the loopback interface";
+            }
+            m_bridge.reset(new BridgeEthernetData(m_socket, loopback));
+            ASSERT_TRUE(m_board.waitForBridge());
+        }
+
+        void start(uint32_t frameBufferSize)
+        {
+            m_bridge->setFrameBufferSize(frameBufferSize);
+            m_bridge->setFrameQueueSize(queueSize);
+            m_bridge->startStreaming();
+        }
+
+        void expectFrame(const std::vector<uint8_t> &expected, uint8_t channel = 0)
+        {
+            auto *frame = m_bridge->getFrame(timeoutMs);
+            ASSERT_NE(frame, nullptr);
+            EXPECT_EQ(frame->getStatusCode(), DataError_NoError);
+            EXPECT_EQ(frame->getVirtualChannel(), channel);
+            ASSERT_EQ(frame->getDataSize(), expected.size());
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), frame->getData()));
+            frame->release();
+        }
+
+        void expectError(uint32_t code)
+        {
+            auto *frame = m_bridge->getFrame(timeoutMs);
+            ASSERT_NE(frame, nullptr);
+            EXPECT_EQ(frame->getStatusCode(), code);
+            frame->release();
+        }
+
+        LoopbackBoard m_board;
+        SocketUdp m_socket;
+        std::unique_ptr<BridgeEthernetData> m_bridge;
+    };
+}
+
+
+TEST_F(BridgeEthernetDataLoopback, MultiPacketFrames)
+{
+    const uint32_t frameSize = 3 * payloadStride + 100;
+    start(frameSize);
+
+    for (uint32_t i = 0; i < queueSize / 2; i++)
+    {
+        m_board.sendFrame(framePayload(i, frameSize), static_cast<uint8_t>(i & 1));
+    }
+    for (uint32_t i = 0; i < queueSize / 2; i++)
+    {
+        expectFrame(framePayload(i, frameSize), static_cast<uint8_t>(i & 1));
+    }
+}
+
+TEST_F(BridgeEthernetDataLoopback, SeveralFramesInOneBatch)
+{
+    // the bridge asks for as many packets as fit into the frame buffer,
+    // so small frames make packets of the following frames arrive in the same batch
+    start(8 * payloadStride);
+
+    std::vector<std::vector<uint8_t>> frames;
+    for (uint32_t i = 0; i < queueSize; i++)
+    {
+        frames.push_back(framePayload(i, 50 + i * 97 % payloadStride));
+        m_board.sendFrame(frames.back());
+    }
+    for (const auto &frame : frames)
+    {
+        expectFrame(frame);
+    }
+}
+
+TEST_F(BridgeEthernetDataLoopback, TimestampIsTakenFromLastPacket)
+{
+    const uint32_t frameSize = payloadStride + 10;
+    start(frameSize);
+
+    const uint64_t timestamp = 0x0123456789ABCDEF;
+    const auto payload       = framePayload(0, frameSize);
+    std::vector<uint8_t> last(payload.begin() + payloadStride, payload.end());
+    last.resize(last.size() + sizeof(timestamp));
+    auto *it = hostToSerial(&last[last.size() - sizeof(timestamp)], static_cast<uint32_t>(timestamp));
+    hostToSerial(it, static_cast<uint32_t>(timestamp >> 32));
+
+    m_board.sendPacket(DATA_FRAME_FIRST_PACKET, 0, payload.data(), payloadStride);
+    m_board.sendPacket(DATA_FRAME_LAST_PACKET | DATA_FRAME_FLAG_TIMESTAMP, 0, last.data(), static_cast<uint16_t>(last.size()));
+
+    auto *frame = m_bridge->getFrame(timeoutMs);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->getTimestamp(), timestamp);
+    ASSERT_EQ(frame->getDataSize(), frameSize);
+    EXPECT_TRUE(std::equal(payload.begin(), payload.end(), frame->getData()));
+    frame->release();
+}
+
+TEST_F(BridgeEthernetDataLoopback, PacketLossDropsFrame)
+{
+    const uint32_t frameSize = 2 * payloadStride + 100;
+    start(frameSize);
+
+    const auto first  = framePayload(1, frameSize);
+    const auto lost   = framePayload(2, frameSize);
+    const auto second = framePayload(3, frameSize);
+
+    m_board.sendFrame(first);
+    m_board.sendPacket(DATA_FRAME_FIRST_PACKET, 0, lost.data(), payloadStride);
+    m_board.skipPacket();
+    m_board.sendPacket(DATA_FRAME_LAST_PACKET, 0, lost.data() + 2 * payloadStride, 100);
+    m_board.sendFrame(second);
+
+    expectFrame(first);
+    expectError(DataError_FrameDropped);
+    expectFrame(second);
+}
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <common/Serialization.hpp>
+#include <mock/MockLibUsb.hpp>
+#include <platform/exception/EBridgeData.hpp>
+#include <platform/libusb/BridgeLibUsb.hpp>
+#include <universal/data_definitions.h>
+#include <universal/link_definitions.h>
+#include <universal/protocol/protocol_definitions.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+    constexpr uint16_t frameHeaderSize = 6;
+    constexpr uint16_t timeoutMs       = 1000;
+    constexpr uint32_t frameSize       = 1000;
+
+    std::vector<uint8_t> framePayload(uint32_t index, uint32_t size)
+    {
+        std::vector<uint8_t> payload(size);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            payload[i] = static_cast<uint8_t>(index * 7 + i);
+        }
+        return payload;
+    }
+
+    class BridgeLibUsbMocked :
+        public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            MockLibUsb::reset();
+            m_bridge.reset(new BridgeLibUsb(MockLibUsb::device()));
+            m_data = m_bridge->getIBridgeData();
+            m_data->setFrameBufferSize(frameSize);
+        }
+
+        void TearDown() override
+        {
+            m_bridge.reset();
+            MockLibUsb::reset();
+        }
+
+        // appends one packet of the streaming protocol
+        void appendPacket(std::vector<uint8_t> &transfer, uint8_t bmPktType, const uint8_t *payload, uint16_t length)
+        {
+            const auto offset = transfer.size();
+            transfer.resize(offset + frameHeaderSize + length);
+            auto *it = hostToSerial(&transfer[offset], bmPktType);
+            it       = hostToSerial(it, uint8_t(0));
+            it       = hostToSerial(it, m_counter++);
+            it       = hostToSerial(it, length);
+            std::copy(payload, payload + length, it);
+        }
+
+        void expectFrame(const std::vector<uint8_t> &expected)
+        {
+            auto *frame = m_data->getFrame(timeoutMs);
+            ASSERT_NE(frame, nullptr);
+            EXPECT_EQ(frame->getStatusCode(), DataError_NoError);
+            ASSERT_EQ(frame->getDataSize(), expected.size());
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), frame->getData()));
+            frame->release();
+        }
+
+        std::unique_ptr<BridgeLibUsb> m_bridge;
+        IBridgeData *m_data;
+        uint16_t m_counter = 0;
+    };
+}
+
+
+TEST_F(BridgeLibUsbMocked, FramesFromSeveralTransfers)
+{
+    m_data->setFrameQueueSize(8);
+    m_data->startStreaming();
+
+    // a frame in three transfers
+    const auto first = framePayload(1, frameSize);
+    std::vector<uint8_t> transfer;
+    appendPacket(transfer, DATA_FRAME_FIRST_PACKET, first.data(), 400);
+    MockLibUsb::send(transfer);
+    transfer.clear();
+    appendPacket(transfer, DATA_FRAME_MIDDLE_PACKET, first.data() + 400, 400);
+    MockLibUsb::send(transfer);
+    transfer.clear();
+    appendPacket(transfer, DATA_FRAME_LAST_PACKET, first.data() + 800, 200);
+    MockLibUsb::send(transfer);
+
+    // several packets and frames in one transfer
+    const auto second = framePayload(2, frameSize);
+    const auto third  = framePayload(3, 10);
+    transfer.clear();
+    appendPacket(transfer, DATA_FRAME_FIRST_PACKET, second.data(), 500);
+    appendPacket(transfer, DATA_FRAME_LAST_PACKET, second.data() + 500, 500);
+    appendPacket(transfer, DATA_FRAME_SINGLE_PACKET, third.data(), 10);
+    MockLibUsb::send(transfer);
+
+    expectFrame(first);
+    expectFrame(second);
+    expectFrame(third);
+    m_data->stopStreaming();
+
+    EXPECT_EQ(MockLibUsb::freedWhileSubmitted(), 0u);
+    EXPECT_EQ(MockLibUsb::freedTransfers(), MockLibUsb::allocatedTransfers());
+}
+
+TEST_F(BridgeLibUsbMocked, TransferRingIsConfigurable)
+{
+    m_data->setFrameQueueSize(8);
+    m_data->setTransferRing(3, LIBUSB_MAX_DATA_LENGTH + 1);
+    m_data->startStreaming();
+
+    EXPECT_TRUE(MockLibUsb::waitUntilSubmitted(3, timeoutMs));
+    // rounded up, so that packets of maximum size are never split
+    EXPECT_EQ(MockLibUsb::transferLength(), 2 * LIBUSB_MAX_DATA_LENGTH);
+    EXPECT_THROW(m_data->setTransferRing(4, LIBUSB_MAX_DATA_LENGTH), EBridgeData);
+
+    m_data->stopStreaming();
+    EXPECT_EQ(MockLibUsb::allocatedTransfers(), 3u);
+    EXPECT_EQ(MockLibUsb::freedTransfers(), 3u);
+}
+
+TEST_F(BridgeLibUsbMocked, StopWaitsForCancelledTransfers)
+{
+    m_data->setFrameQueueSize(8);
+    m_data->startStreaming();
+    ASSERT_TRUE(MockLibUsb::waitUntilSubmitted(8, timeoutMs));
+
+    // event handling fails for a while and cancelling takes some time
+    MockLibUsb::failEvents(5);
+    MockLibUsb::delayCancellation(20);
+    m_data->stopStreaming();
+
+    EXPECT_EQ(MockLibUsb::freedWhileSubmitted(), 0u);
+    EXPECT_EQ(MockLibUsb::freedTransfers(), 8u);
+}
+
+TEST_F(BridgeLibUsbMocked, TransfersOfVanishedDeviceAreNotFreed)
+{
+    m_data->setFrameQueueSize(8);
+    m_data->startStreaming();
+    ASSERT_TRUE(MockLibUsb::waitUntilSubmitted(8, timeoutMs));
+
+    MockLibUsb::stallCancellation();
+    MockLibUsb::failEvents(UINT32_MAX, LIBUSB_ERROR_NO_DEVICE);
+    m_data->stopStreaming();
+
+    EXPECT_EQ(MockLibUsb::freedWhileSubmitted(), 0u);
+    EXPECT_EQ(MockLibUsb::freedTransfers(), 0u);
+}
+
+TEST_F(BridgeLibUsbMocked, FullQueueDoesNotBlockCallbacks)
+{
+    // the callbacks drop the newest frames instead of waiting for the consumer
+    m_data->setBackPressurePolicy(BackPressurePolicy::BlockProducer);
+    m_data->setFrameQueueSize(2);
+    m_data->startStreaming();
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        const auto payload = framePayload(i, 10);
+        std::vector<uint8_t> transfer;
+        appendPacket(transfer, DATA_FRAME_SINGLE_PACKET, payload.data(), 10);
+        MockLibUsb::send(transfer);
+    }
+    EXPECT_TRUE(MockLibUsb::waitUntilSent(timeoutMs));
+
+    BridgeDataStatistics statistics;
+    m_data->getStatistics(statistics);
+    EXPECT_EQ(statistics.framesReceived, 10u);
+    EXPECT_EQ(statistics.framesTrimmed, 8u);
+
+    expectFrame(framePayload(0, 10));
+    expectFrame(framePayload(1, 10));
+    m_data->stopStreaming();
+}
+
+TEST_F(BridgeLibUsbMocked, StalledTransfersAreNotResubmitted)
+{
+    m_data->setFrameQueueSize(8);
+    m_data->startStreaming();
+    ASSERT_TRUE(MockLibUsb::waitUntilSubmitted(8, timeoutMs));
+
+    MockLibUsb::failTransfers(UINT32_MAX, LIBUSB_TRANSFER_STALL);
+    EXPECT_TRUE(MockLibUsb::waitUntilSubmitted(0, timeoutMs));
+    EXPECT_EQ(MockLibUsb::failedTransfers(), 8u);
+
+    m_data->stopStreaming();
+    EXPECT_EQ(MockLibUsb::freedWhileSubmitted(), 0u);
+    EXPECT_EQ(MockLibUsb::freedTransfers(), 8u);
+}
+
+TEST_F(BridgeLibUsbMocked, PersistentErrorsAreBounded)
+{
+    m_data->setFrameQueueSize(8);
+    m_data->startStreaming();
+    ASSERT_TRUE(MockLibUsb::waitUntilSubmitted(8, timeoutMs));
+
+    // every transfer keeps failing, so the ring is given up instead of busy-looping
+    MockLibUsb::failTransfers(UINT32_MAX, LIBUSB_TRANSFER_OVERFLOW);
+    EXPECT_TRUE(MockLibUsb::waitUntilSubmitted(0, timeoutMs));
+    const auto failed = MockLibUsb::failedTransfers();
+    EXPECT_LE(failed, 16u + 8u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(MockLibUsb::failedTransfers(), failed);
+    m_data->stopStreaming();
+    EXPECT_EQ(MockLibUsb::freedTransfers(), 8u);
+}
+
+TEST_F(BridgeLibUsbMocked, SporadicErrorsAreResubmitted)
+{
+    m_data->setFrameQueueSize(16);
+    m_data->startStreaming();
+    ASSERT_TRUE(MockLibUsb::waitUntilSubmitted(8, timeoutMs));
+
+    // fewer failures in a row than the bridge tolerates, the transfers stay in use
+    MockLibUsb::failTransfers(12, LIBUSB_TRANSFER_ERROR);
+    const auto payload = framePayload(1, 10);
+    std::vector<uint8_t> transfer;
+    appendPacket(transfer, DATA_FRAME_SINGLE_PACKET, payload.data(), 10);
+    MockLibUsb::send(transfer);
+
+    // each failure is reported by an error frame
+    for (uint32_t i = 0; i < 12; i++)
+    {
+        auto *frame = m_data->getFrame(timeoutMs);
+        ASSERT_NE(frame, nullptr);
+        EXPECT_EQ(frame->getStatusCode(), DataError_LowLevelError);
+        frame->release();
+    }
+    expectFrame(payload);
+    EXPECT_EQ(MockLibUsb::failedTransfers(), 12u);
+    EXPECT_EQ(MockLibUsb::submittedTransfers(), 8u);
+    m_data->stopStreaming();
+
+    EXPECT_EQ(MockLibUsb::freedWhileSubmitted(), 0u);
+    EXPECT_EQ(MockLibUsb::freedTransfers(), 8u);
+}
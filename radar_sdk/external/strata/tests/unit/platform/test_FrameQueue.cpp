@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+
+#include <platform/frames/ErrorFrame.hpp>
+#include <platform/frames/FramePool.hpp>
+#include <platform/frames/FrameQueue.hpp>
+#include <universal/data_definitions.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+    constexpr uint32_t frameCount = 100000;
+    constexpr uint16_t queueSize  = 16;
+
+    // value of a trimmed frame (DataError_FrameQueueTrimmed)
+    constexpr uint32_t gap = 0xFFFFFFFF;
+
+    // returns frames from a third thread, like a forwarder or an application thread would
+    class Releaser
+    {
+    public:
+        Releaser() :
+            m_stop {false},
+            m_thread {&Releaser::run, this}
+        {
+        }
+
+        ~Releaser()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                m_stop = true;
+            }
+            m_cv.notify_one();
+            m_thread.join();
+        }
+
+        void release(IFrame *frame)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                m_frames.push_back(frame);
+            }
+            m_cv.notify_one();
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            while (true)
+            {
+                m_cv.wait(lock, [this] { return m_stop || !m_frames.empty(); });
+                if (m_frames.empty())
+                {
+                    return;
+                }
+                auto *frame = m_frames.front();
+                m_frames.pop_front();
+                lock.unlock();
+                frame->release();
+                lock.lock();
+            }
+        }
+
+        std::mutex m_lock;
+        std::condition_variable m_cv;
+        std::deque<IFrame *> m_frames;
+        bool m_stop;
+        std::thread m_thread;
+    };
+
+    struct Result
+    {
+        std::vector<uint32_t> received;  // sequence numbers and gaps in the order they were dequeued
+        uint64_t trimmed;
+    };
+
+    // One producer taking numbered frames from a pool, one consumer returning every second frame
+    // itself and passing the others to another thread.
+    Result runProducerConsumer(BackPressurePolicy policy)
+    {
+        FramePool pool;
+        pool.setFrameBufferSize(sizeof(uint32_t));
+        pool.setFrameCount(queueSize + 2);
+
+        FrameQueue queue;
+        queue.setPolicy(policy);
+        queue.setMaxCount(queueSize);
+        queue.start();
+
+        std::atomic<bool> finished {false};
+        std::thread producer([&] {
+            for (uint32_t i = 0; i < frameCount; i++)
+            {
+                IFrame *frame;
+                while ((frame = pool.dequeueFrame()) == nullptr)
+                {
+                    std::this_thread::yield();
+                }
+                frame->setDataSize(sizeof(i));
+                std::memcpy(frame->getData(), &i, sizeof(i));
+                queue.enqueue(frame);
+            }
+            finished = true;
+        });
+
+        Result result;
+        {
+            Releaser releaser;
+            while (true)
+            {
+                // the last frames may be dropped, so the end is detected by the producer finishing
+                const bool last = finished;
+                auto *frame     = queue.blockingDequeue(10);
+                if (!frame)
+                {
+                    if (last)
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                if (frame->getStatusCode() == DataError_FrameQueueTrimmed)
+                {
+                    result.received.push_back(gap);
+                    frame->release();
+                    continue;
+                }
+
+                uint32_t sequence;
+                std::memcpy(&sequence, frame->getData(), sizeof(sequence));
+                result.received.push_back(sequence);
+                if (sequence % 2)
+                {
+                    releaser.release(frame);
+                }
+                else
+                {
+                    frame->release();
+                }
+            }
+        }
+        producer.join();
+
+        uint32_t depth, highWaterMark;
+        LatencyHistogram::Snapshot latency;
+        queue.getStatistics(depth, highWaterMark, result.trimmed, latency);
+        EXPECT_LE(highWaterMark, queueSize);
+
+        queue.stop();
+        queue.clear();
+        return result;
+    }
+
+    // frames arrive in order, and every missing frame is announced by a trimmed frame before it
+    void checkOrder(const Result &result)
+    {
+        uint64_t next        = 0;
+        uint64_t frames      = 0;
+        bool gapAnnounced    = false;
+        uint64_t missingSeen = 0;
+        for (auto value : result.received)
+        {
+            if (value == gap)
+            {
+                gapAnnounced = true;
+                continue;
+            }
+            ASSERT_GE(value, next);
+            if (value != next)
+            {
+                ASSERT_TRUE(gapAnnounced) << "frames " << next << " to " << value - 1 << " were lost silently";
+                missingSeen += value - next;
+            }
+            gapAnnounced = false;
+            next         = value + 1;
+            frames++;
+        }
+        missingSeen += frameCount - next;
+        EXPECT_EQ(frames + result.trimmed, frameCount);
+        EXPECT_EQ(missingSeen, result.trimmed);
+    }
+}
+
+
+TEST(FrameQueueStress, DropOldest)
+{
+    checkOrder(runProducerConsumer(BackPressurePolicy::DropOldest));
+}
+
+TEST(FrameQueueStress, DropNewest)
+{
+    checkOrder(runProducerConsumer(BackPressurePolicy::DropNewest));
+}
+
+TEST(FrameQueueStress, BlockProducer)
+{
+    const auto result = runProducerConsumer(BackPressurePolicy::BlockProducer);
+    ASSERT_EQ(result.received.size(), frameCount);
+    for (uint32_t i = 0; i < frameCount; i++)
+    {
+        ASSERT_EQ(result.received[i], i);
+    }
+    EXPECT_EQ(result.trimmed, 0u);
+}
+
+TEST(FrameQueueStress, ResizeWhileConsumerPolls)
+{
+    FramePool pool;
+    pool.setFrameBufferSize(sizeof(uint32_t));
+    pool.setFrameCount(8);
+
+    FrameQueue queue;
+    std::atomic<bool> done {false};
+    std::atomic<uint32_t> received {0};
+    std::thread consumer([&] {
+        while (!done)
+        {
+            if (auto *frame = queue.blockingDequeue(1))
+            {
+                received++;
+                frame->release();
+            }
+        }
+    });
+
+    // the ring is replaced while stopped, frames queued before are kept
+    uint32_t queued = 0;
+    for (uint32_t count = 1024; count <= 0x10000; count *= 2)
+    {
+        queue.start();
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            IFrame *frame;
+            while ((frame = pool.dequeueFrame()) == nullptr)
+            {
+                std::this_thread::yield();
+            }
+            queue.enqueue(frame);
+            queued++;
+        }
+        queue.stop();
+        queue.setMaxCount(count);
+        queue.reserve(2 * count);
+    }
+    queue.start();
+    while (received < queued)
+    {
+        std::this_thread::yield();
+    }
+    done = true;
+    consumer.join();
+
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(FramePoolStress, ConcurrentDequeueAndRelease)
+{
+    constexpr uint16_t poolSize   = 64;
+    constexpr uint32_t iterations = 50000;
+    constexpr int threadCount     = 4;
+
+    FramePool pool;
+    pool.setFrameBufferSize(16);
+    pool.setFrameCount(poolSize);
+
+    // a buffer must never be handed out twice
+    std::vector<std::atomic<bool>> inUse(poolSize);
+    for (auto &flag : inUse)
+    {
+        flag = false;
+    }
+
+    std::atomic<uint32_t> duplicates {0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&] {
+            std::vector<Frame *> held;
+            for (uint32_t i = 0; i < iterations; i++)
+            {
+                auto *frame = static_cast<Frame *>(pool.dequeueFrame());
+                if (frame)
+                {
+                    if (inUse[frame->getPoolIndex()].exchange(true))
+                    {
+                        duplicates++;
+                    }
+                    held.push_back(frame);
+                }
+                if (!frame || (held.size() > (i % 8)))
+                {
+                    for (auto *h : held)
+                    {
+                        inUse[h->getPoolIndex()] = false;
+                        h->release();
+                    }
+                    held.clear();
+                }
+            }
+            for (auto *h : held)
+            {
+                inUse[h->getPoolIndex()] = false;
+                h->release();
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(duplicates.load(), 0u);
+
+    // all buffers are back
+    std::vector<IFrame *> all;
+    while (auto *frame = pool.dequeueFrame())
+    {
+        all.push_back(frame);
+    }
+    EXPECT_EQ(all.size(), poolSize);
+    for (auto *frame : all)
+    {
+        frame->release();
+    }
+}
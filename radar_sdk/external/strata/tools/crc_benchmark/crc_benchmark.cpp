@@ -0,0 +1,223 @@
+/**
+ * @copyright 2024 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+// Compares the CRC implementations of the common library against
+// straightforward byte-at-a-time reference implementations.
+//
+// Usage: crc_benchmark [buffer size in bytes] [iterations]
+//
+// The throughput of every variant is reported in GB/s and, on x86, in bytes per TSC cycle.
+// Their results are checked by the unit test test_Crc.
+
+#include <common/crc/Crc16.hpp>
+#include <common/crc/Crc32.hpp>
+#include <common/crc/Crc32Kernels.hpp>
+#include <common/crc/Crc8.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define CRC_BENCHMARK_TSC
+#endif
+
+
+namespace
+{
+    // reference implementations, one table lookup or one bit at a time
+
+    uint8_t referenceCrc8Smbus(const uint8_t buf[], size_t len)
+    {
+        uint8_t crc = 0;
+        while (len--)
+        {
+            crc ^= *buf++;
+            for (int i = 0; i < 8; i++)
+            {
+                crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+            }
+        }
+        return crc;
+    }
+
+    uint16_t referenceCrc16CcittFalse(const uint8_t buf[], size_t len)
+    {
+        static uint16_t table[256];
+        static bool initialized = false;
+        if (!initialized)
+        {
+            for (unsigned int i = 0; i < 256; i++)
+            {
+                uint16_t crc = static_cast<uint16_t>(i << 8);
+                for (int b = 0; b < 8; b++)
+                {
+                    crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+                }
+                table[i] = crc;
+            }
+            initialized = true;
+        }
+
+        uint16_t crc = 0xFFFF;
+        while (len--)
+        {
+            crc = static_cast<uint16_t>((crc << 8) ^ table[(crc >> 8) ^ *buf++]);
+        }
+        return crc;
+    }
+
+    uint32_t referenceCrc32Msb(const uint8_t buf[], size_t len, uint32_t polynomial)
+    {
+        uint32_t crc = 0xFFFFFFFF;
+        while (len--)
+        {
+            crc ^= static_cast<uint32_t>(*buf++) << 24;
+            for (int b = 0; b < 8; b++)
+            {
+                crc = (crc & 0x80000000) ? (crc << 1) ^ polynomial : crc << 1;
+            }
+        }
+        return crc;
+    }
+
+    uint32_t referenceCrc32Ethernet(const uint8_t buf[], size_t len)
+    {
+        uint32_t crc = 0xFFFFFFFF;
+        while (len--)
+        {
+            crc ^= *buf++;
+            for (int b = 0; b < 8; b++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+            }
+        }
+        return ~crc;
+    }
+
+
+    struct Candidate
+    {
+        const char *name;
+        std::function<uint32_t(const uint8_t *, size_t)> function;
+    };
+
+    void measure(const Candidate &candidate, const std::vector<uint8_t> &data, unsigned int iterations)
+    {
+        volatile uint32_t sink = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+#ifdef CRC_BENCHMARK_TSC
+        const auto startCycles = __rdtsc();
+#endif
+        for (unsigned int i = 0; i < iterations; i++)
+        {
+            sink = sink ^ candidate.function(data.data(), data.size());
+        }
+#ifdef CRC_BENCHMARK_TSC
+        const auto cycles = __rdtsc() - startCycles;
+#endif
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        const double bytes = static_cast<double>(data.size()) * iterations;
+        std::printf("%-28s %8.3f GB/s", candidate.name, bytes / elapsed.count() / 1e9);
+#ifdef CRC_BENCHMARK_TSC
+        std::printf("  %7.3f bytes/cycle", bytes / static_cast<double>(cycles));
+#endif
+        std::printf("\n");
+    }
+
+    void run(const char *title, const Candidate &reference, const std::vector<Candidate> &candidates,
+             const std::vector<uint8_t> &data, unsigned int iterations)
+    {
+        std::printf("\n%s\n", title);
+
+        measure(reference, data, iterations);
+        for (const auto &candidate : candidates)
+        {
+            measure(candidate, data, iterations);
+        }
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    const size_t size             = (argc > 1) ? std::strtoul(argv[1], nullptr, 0) : 65535;
+    const unsigned int iterations = (argc > 2) ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 0)) : 2000;
+
+    // the existing interfaces take a 16 bit length
+    if ((size < 4096) || (size > 0xFFFF))
+    {
+        std::printf("buffer size has to be between 4096 and 65535 bytes\n");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<uint8_t> data(size);
+    std::mt19937 generator(42);
+    for (auto &value : data)
+    {
+        value = static_cast<uint8_t>(generator());
+    }
+
+    std::printf("buffer size %zu bytes, %u iterations\n", size, iterations);
+    std::printf("hardware CRC32: PCLMULQDQ %s, ARMv8 CRC32 %s\n",
+                crc32HasPclmul() ? "yes" : "no", crc32HasArmv8() ? "yes" : "no");
+
+    run("CRC-8 SMBus",
+        {"reference (bitwise)", [](const uint8_t *buf, size_t len) -> uint32_t { return referenceCrc8Smbus(buf, len); }},
+        {
+            {"Crc8Smbus", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc8Smbus(buf, static_cast<uint16_t>(len)); }},
+            {"Crc8", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc8(buf, static_cast<uint16_t>(len), 0x07); }},
+        },
+        data, iterations);
+
+    run("CRC-16 CCITT-FALSE",
+        {"reference (byte table)", [](const uint8_t *buf, size_t len) -> uint32_t { return referenceCrc16CcittFalse(buf, len); }},
+        {
+            {"Crc16CcittFalse", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc16CcittFalse(buf, static_cast<unsigned int>(len)); }},
+        },
+        data, iterations);
+
+    run("CRC-32 AUTOSAR (not reflected, not inverted)",
+        {"reference (bitwise)", [](const uint8_t *buf, size_t len) -> uint32_t { return referenceCrc32Msb(buf, len, 0xF4ACFB13); }},
+        {
+            {"Crc32Autosar", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc32Autosar(buf, static_cast<uint16_t>(len)); }},
+        },
+        data, iterations);
+
+    run("CRC-32 MPEG-2",
+        {"reference (bitwise)", [](const uint8_t *buf, size_t len) -> uint32_t { return referenceCrc32Msb(buf, len, 0x04C11DB7); }},
+        {
+            {"Crc32Mpeg2", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc32Mpeg2(buf, static_cast<uint16_t>(len)); }},
+        },
+        data, iterations);
+
+    run("CRC-32 Ethernet",
+        {"reference (bitwise)", [](const uint8_t *buf, size_t len) -> uint32_t { return referenceCrc32Ethernet(buf, len); }},
+        {
+            {"crc32ReflectedTable", [](const uint8_t *buf, size_t len) -> uint32_t { return ~crc32ReflectedTable(buf, len, 0xFFFFFFFF); }},
+            {"crc32ReflectedSlicing8", [](const uint8_t *buf, size_t len) -> uint32_t { return ~crc32ReflectedSlicing8(buf, len, 0xFFFFFFFF); }},
+            {"crc32ReflectedPclmul", [](const uint8_t *buf, size_t len) -> uint32_t { return ~(crc32HasPclmul() ? crc32ReflectedPclmul(buf, len, 0xFFFFFFFF) : crc32ReflectedSlicing8(buf, len, 0xFFFFFFFF)); }},
+            {"crc32ReflectedArmv8", [](const uint8_t *buf, size_t len) -> uint32_t { return ~(crc32HasArmv8() ? crc32ReflectedArmv8(buf, len, 0xFFFFFFFF) : crc32ReflectedSlicing8(buf, len, 0xFFFFFFFF)); }},
+            {"Crc32Ethernet", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc32Ethernet(buf, len); }},
+            {"Crc32 (reflected)", [](const uint8_t *buf, size_t len) -> uint32_t { return Crc32(buf, static_cast<uint16_t>(len), 0x04C11DB7, true, true, true); }},
+        },
+        data, iterations);
+
+    return EXIT_SUCCESS;
+}
@@ -206,8 +206,8 @@ void ifx_2dmti_run_c(ifx_2DMTI_C_t* handle,
                      ifx_Matrix_C_t* output)
 {
     IFX_ERR_BRK_NULL(handle);
-    IFX_MAT_BRK_VALID(input);
-    IFX_MAT_BRK_VALID(output);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(input);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(output);
     IFX_MAT_BRK_DIM(handle->filter_history_c, input);
     IFX_MAT_BRK_DIM(input, output);
 
@@ -217,6 +217,29 @@ void ifx_2dmti_run_c(ifx_2DMTI_C_t* handle,
     const ifx_Float_t alpha = handle->alpha_MTI_filter;
     ifx_Matrix_C_t* history = handle->filter_history_c;
 
+    if (IFX_MDA_IS_SPLIT(input) || IFX_MDA_IS_SPLIT(output))
+    {
+        IFX_ERR_BRK_COND(!IFX_MDA_IS_SPLIT(input) || !IFX_MDA_IS_SPLIT(output), IFX_ERROR_NOT_SUPPORTED);
+
+        // the filter is linear, so real and imaginary parts are filtered
+        // independently; the history keeps the interleaved layout
+        for (uint32_t r = 0; r < rows; r++)
+        {
+            for (uint32_t c = 0; c < cols; c++)
+            {
+                const ifx_Float_t input_re = mReAt(input, r, c);
+                const ifx_Float_t input_im = mImAt(input, r, c);
+                const ifx_Complex_t history_rc = mAt(history, r, c);
+                mReAt(output, r, c) = input_re - IFX_COMPLEX_REAL(history_rc);
+                mImAt(output, r, c) = input_im - IFX_COMPLEX_IMAG(history_rc);
+                IFX_COMPLEX_SET(mAt(history, r, c),
+                                alpha * input_re + (1 - alpha) * IFX_COMPLEX_REAL(history_rc),
+                                alpha * input_im + (1 - alpha) * IFX_COMPLEX_IMAG(history_rc));
+            }
+        }
+        return;
+    }
+
     // output_n := input_n - history_n
     // history_n := alpha*input_n + (1-alpha)*history_{n-1}
     for (uint32_t r = 0; r < rows; r++)
@@ -168,6 +168,9 @@ void ifx_2dmti_run_r(ifx_2DMTI_R_t* handle,
  * @param [in]     input     Complex value matrix used as an input for 2D MTI filter
  * @param [out]    output    Complex value matrix used as an output of 2D MTI filter
  *
+ * Input and output may use the split complex layout (see \ref IFX_MDA_FLAG_SPLIT_COMPLEX)
+ * as long as both use it.
+ *
  */
 IFX_DLL_PUBLIC
 void ifx_2dmti_run_c(ifx_2DMTI_C_t* handle,
@@ -37,6 +37,7 @@
 #include "ifxBase/Math.h"
 #include "ifxBase/Mem.h"
 #include "ifxBase/Vector.h"
+#include "ifxBase/internal/Kernels.h"
 
 /*
 ==============================================================================
@@ -88,9 +89,20 @@ static void copy_to_buffer_zeropadded_c(const ifx_Vector_C_t* input, ifx_Complex
     // length of FFT input
     const uint32_t len = MIN(fft_size, vLen(input));
 
-    // Do not use memcpy because of potential stride != 1
-    for (uint32_t i = 0; i < len; i++)
-        buffer[i] = vAt(input, i);
+    if (IFX_MDA_IS_SPLIT(input))
+    {
+        if (vStride(input) == 1)
+            ifx_kernels_get()->interleave_c(IFX_MDA_REAL_DATA(input), IFX_MDA_IMAG_DATA(input), buffer, len);
+        else
+            for (uint32_t i = 0; i < len; i++)
+                IFX_COMPLEX_SET(buffer[i], vReAt(input, i), vImAt(input, i));
+    }
+    else
+    {
+        // Do not use memcpy because of potential stride != 1
+        for (uint32_t i = 0; i < len; i++)
+            buffer[i] = vAt(input, i);
+    }
 
     // zero padding
     const ifx_Complex_t complex_zero = IFX_COMPLEX_DEF(0, 0);
@@ -112,6 +124,32 @@ static void copy_to_buffer_zeropadded_r(const ifx_Vector_R_t* input, ifx_Float_t
         buffer[i] = 0;
 }
 
+/** @brief Copy first len elements of buffer to vector
+ *
+ * The vector output may have a stride != 1 and may use the split complex
+ * layout.
+ */
+static void copy_from_buffer_c(const ifx_Complex_t* buffer, ifx_Vector_C_t* output, uint32_t len)
+{
+    if (IFX_MDA_IS_SPLIT(output))
+    {
+        if (vStride(output) == 1)
+            ifx_kernels_get()->deinterleave_c(buffer, IFX_MDA_REAL_DATA(output), IFX_MDA_IMAG_DATA(output), len);
+        else
+            for (uint32_t i = 0; i < len; i++)
+            {
+                vReAt(output, i) = IFX_COMPLEX_REAL(buffer[i]);
+                vImAt(output, i) = IFX_COMPLEX_IMAG(buffer[i]);
+            }
+    }
+    else
+    {
+        // Do not use memcpy here because of a potential stride != 1
+        for (uint32_t i = 0; i < len; i++)
+            vAt(output, i) = buffer[i];
+    }
+}
+
 static void fill_negative_half(ifx_Complex_t* output, uint32_t output_size, uint32_t fft_size)
 {
     if (output_size >= fft_size)  // Needs to fill negative half
@@ -210,7 +248,7 @@ void ifx_fft_run_rc(ifx_FFT_t* handle, const ifx_Vector_R_t* input, ifx_Vector_C
 {
     IFX_ERR_BRK_NULL(handle);
     IFX_VEC_BRK_VALID(input);
-    IFX_VEC_BRK_VALID(output);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(output);
     IFX_VEC_BRK_MINSIZE(output, handle->fft_size / 2);  // Half spectrum output supported
     IFX_ERR_BRK_COND(handle->fft_type != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
 
@@ -226,9 +264,11 @@ void ifx_fft_run_rc(ifx_FFT_t* handle, const ifx_Vector_R_t* input, ifx_Vector_C
      *   - the output vector is not aligned (muFFT requires aligned input and due
      *     views a the data of a ifx_Vector_C_t vector is not necessarily
      *     aligned),
-     *   - the stride is not 1 (might happen due to views).
+     *   - the stride is not 1 (might happen due to views),
+     *   - the output vector uses the split complex layout.
      */
-    bool copy_output = vLen(output) < (N / 2 + 1) || !IFX_IS_ALIGNED(vDat(output), MUFFT_REQUIRED_ALIGNMENT) || vStride(output) != 1;
+    bool copy_output = vLen(output) < (N / 2 + 1) || !IFX_IS_ALIGNED(vDat(output), MUFFT_REQUIRED_ALIGNMENT) || vStride(output) != 1
+                       || IFX_MDA_IS_SPLIT(output);
 
     const ifx_Float_t* in = vDat(input);
     if (copy_input)
@@ -258,9 +298,7 @@ void ifx_fft_run_rc(ifx_FFT_t* handle, const ifx_Vector_R_t* input, ifx_Vector_C
         else
             len = N / 2;
 
-        // Do not use memcpy here because of a potential stride != 1
-        for (uint32_t i = 0; i < len; i++)
-            vAt(output, i) = out[i];
+        copy_from_buffer_c(out, output, len);
     }
 }
 
@@ -269,8 +307,8 @@ void ifx_fft_run_rc(ifx_FFT_t* handle, const ifx_Vector_R_t* input, ifx_Vector_C
 void ifx_fft_run_c(ifx_FFT_t* handle, const ifx_Vector_C_t* input, ifx_Vector_C_t* output)
 {
     IFX_ERR_BRK_NULL(handle);
-    IFX_VEC_BRK_VALID(input);
-    IFX_VEC_BRK_VALID(output);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(input);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(output);
     IFX_VEC_BRK_MINSIZE(output, handle->fft_size);
     IFX_ERR_BRK_COND(handle->fft_type != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
 
@@ -283,15 +321,19 @@ void ifx_fft_run_c(ifx_FFT_t* handle, const ifx_Vector_C_t* input, ifx_Vector_C_
      *   - the input vector is not aligned (muFFT requires aligned input and due
      *     views a the data of a ifx_Vector_C_t vector is not necessarily
      *     aligned),
-     *   - the stride is not 1 (might happen due to views).
+     *   - the stride is not 1 (might happen due to views),
+     *   - the input vector uses the split complex layout.
      */
-    bool copy_input = vLen(input) < N || !IFX_IS_ALIGNED(vDat(input), MUFFT_REQUIRED_ALIGNMENT) || vStride(input) != 1;
+    bool copy_input = vLen(input) < N || !IFX_IS_ALIGNED(vDat(input), MUFFT_REQUIRED_ALIGNMENT) || vStride(input) != 1
+                      || IFX_MDA_IS_SPLIT(input);
 
     /* We need to use an internal buffer for the output if
      *   - the output vector is not aligned (might happen due to views),
-     *   - the stride of the output vector is not 1 (might happen due to views).
+     *   - the stride of the output vector is not 1 (might happen due to views),
+     *   - the output vector uses the split complex layout.
      */
-    bool copy_output = !IFX_IS_ALIGNED(vDat(output), MUFFT_REQUIRED_ALIGNMENT) || vStride(output) != 1;
+    bool copy_output = !IFX_IS_ALIGNED(vDat(output), MUFFT_REQUIRED_ALIGNMENT) || vStride(output) != 1
+                       || IFX_MDA_IS_SPLIT(output);
 
     const ifx_Complex_t* in = vDat(input);
     if (copy_input)
@@ -303,10 +345,7 @@ void ifx_fft_run_c(ifx_FFT_t* handle, const ifx_Vector_C_t* input, ifx_Vector_C_
     if (copy_output)
     {
         mufft_execute_plan_1d(handle->plan_c2c, handle->fft_output_c, in);
-
-        // Do not use memcpy here because of a potential stride != 1
-        for (uint32_t i = 0; i < N; i++)
-            vAt(output, i) = handle->fft_output_c[i];
+        copy_from_buffer_c(handle->fft_output_c, output, N);
     }
     else
         mufft_execute_plan_1d(handle->plan_c2c, vDat(output), in);
@@ -70,6 +70,16 @@ ifx_Cube_C_t* ifx_cube_create_c(uint32_t rows, uint32_t columns, uint32_t slices
 
 //----------------------------------------------------------------------------
 
+ifx_Cube_C_t* ifx_cube_create_split_c(uint32_t rows, uint32_t columns, uint32_t slices)
+{
+    ifx_Cube_C_t* cube = IFX_MDA_CREATE_SPLIT_C(rows, columns, slices);
+    if (cube)
+        ifx_mda_clear_c(cube);
+    return cube;
+}
+
+//----------------------------------------------------------------------------
+
 void ifx_cube_get_slice_r(const ifx_Cube_R_t* cube, uint32_t depth_index, ifx_Matrix_R_t* slice)
 {
     IFX_CUBE_BRK_VALID(cube);
@@ -82,7 +92,7 @@ void ifx_cube_get_slice_r(const ifx_Cube_R_t* cube, uint32_t depth_index, ifx_Ma
 
 void ifx_cube_get_slice_c(const ifx_Cube_C_t* cube, uint32_t depth_index, ifx_Matrix_C_t* slice)
 {
-    IFX_CUBE_BRK_VALID(cube);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(cube);
     IFX_ERR_BRK_NULL(slice);
 
     IFX_MDA_VIEW_C(slice, cube, IFX_MDA_SLICE_FULL(), IFX_MDA_SLICE_FULL(), IFX_MDA_INDEX(depth_index));
@@ -102,7 +112,7 @@ void ifx_cube_get_row_r(const ifx_Cube_R_t* cube, uint32_t row_index, ifx_Matrix
 
 void ifx_cube_get_row_c(const ifx_Cube_C_t* cube, uint32_t row_index, ifx_Matrix_C_t* row_matrix)
 {
-    IFX_CUBE_BRK_VALID(cube);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(cube);
     IFX_ERR_BRK_NULL(row_matrix);
 
     IFX_MDA_VIEW_C(row_matrix, cube, IFX_MDA_INDEX(row_index), IFX_MDA_SLICE_FULL(), IFX_MDA_SLICE_FULL());
@@ -122,7 +132,7 @@ void ifx_cube_get_col_r(const ifx_Cube_R_t* cube, uint32_t col_index, ifx_Matrix
 
 void ifx_cube_get_col_c(const ifx_Cube_C_t* cube, uint32_t col_index, ifx_Matrix_C_t* col_matrix)
 {
-    IFX_CUBE_BRK_VALID(cube);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(cube);
     IFX_ERR_BRK_NULL(col_matrix);
 
     IFX_MDA_VIEW_C(col_matrix, cube, IFX_MDA_SLICE_FULL(), IFX_MDA_INDEX(col_index), IFX_MDA_SLICE_FULL());
@@ -178,17 +188,14 @@ void ifx_cube_col_abs_r(const ifx_Cube_C_t* cube,
                         uint32_t column_index,
                         ifx_Matrix_R_t* matrix)
 {
-    IFX_CUBE_BRK_VALID(cube);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(cube);
     IFX_MAT_BRK_VALID(matrix);
     IFX_ERR_BRK_ARGUMENT(column_index >= cCols(cube));
 
-    for (uint32_t r = 0; r < cRows(cube); r++)
-    {
-        for (uint32_t c = 0; c < cSlices(cube); c++)
-        {
-            mAt(matrix, r, c) = ifx_complex_abs(cAt(cube, r, column_index, c));
-        }
-    }
+    // the rows of the column view are contiguous, so the abs kernel is used
+    ifx_Matrix_C_t col;
+    ifx_cube_get_col_c(cube, column_index, &col);
+    ifx_mat_abs_c(&col, matrix);
 }
 
 //----------------------------------------------------------------------------
@@ -203,6 +210,6 @@ void ifx_cube_clear_r(ifx_Cube_R_t* cube)
 
 void ifx_cube_clear_c(ifx_Cube_C_t* cube)
 {
-    IFX_CUBE_BRK_VALID(cube);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(cube);
     ifx_mda_clear_c(cube);
 }
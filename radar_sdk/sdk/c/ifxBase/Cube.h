@@ -70,21 +70,33 @@ extern "C"
 #define IFX_CUBE_SIZE(c)              (IFX_CUBE_SLICE_SIZE(c) * (size_t)IFX_CUBE_SLICES(c))
 #define IFX_CUBE_OFFSET(cub, r, c, s) IFX_MDA_OFFSET(cub, r, c, s)
 
-#define IFX_CUBE_BRK_VALID(c)                                                       \
+#define IFX_CUBE_BRK_VALID_ANY_LAYOUT(c)                                            \
     do                                                                              \
     {                                                                               \
         IFX_ERR_BRK_NULL(c);                                                        \
         IFX_ERR_BRK_COND(IFX_MDA_DIMENSIONS(c) != 3, IFX_ERROR_DIMENSION_MISMATCH); \
         IFX_ERR_BRK_ARGUMENT(IFX_MDA_DATA(c) == NULL);                              \
     } while (0)
+#define IFX_CUBE_BRK_VALID(c)                                           \
+    do                                                                  \
+    {                                                                   \
+        IFX_CUBE_BRK_VALID_ANY_LAYOUT(c);                               \
+        IFX_ERR_BRK_COND(IFX_MDA_IS_SPLIT(c), IFX_ERROR_NOT_SUPPORTED); \
+    } while (0)
 
-#define IFX_CUBE_BRV_VALID(c, r)                                                       \
+#define IFX_CUBE_BRV_VALID_ANY_LAYOUT(c, r)                                            \
     do                                                                                 \
     {                                                                                  \
         IFX_ERR_BRV_NULL(c, r);                                                        \
         IFX_ERR_BRV_COND(IFX_MDA_DIMENSIONS(c) != 3, IFX_ERROR_DIMENSION_MISMATCH, r); \
         IFX_ERR_BRV_ARGUMENT(IFX_MDA_DATA(c) == NULL, r);                              \
     } while (0)
+#define IFX_CUBE_BRV_VALID(c, r)                                           \
+    do                                                                     \
+    {                                                                      \
+        IFX_CUBE_BRV_VALID_ANY_LAYOUT(c, r);                               \
+        IFX_ERR_BRV_COND(IFX_MDA_IS_SPLIT(c), IFX_ERROR_NOT_SUPPORTED, r); \
+    } while (0)
 
 /** @brief Access cube element
  *
@@ -170,6 +182,26 @@ ifx_Cube_C_t* ifx_cube_create_c(uint32_t rows,
                                 uint32_t columns,
                                 uint32_t slices);
 
+/**
+ * @brief Allocates memory for a complex cube in split layout with a specified
+ *        number of rows, columns and slices and initializes it to zero.
+ *
+ * Real and imaginary parts are stored in separate blocks, see
+ * \ref IFX_MDA_FLAG_SPLIT_COMPLEX. Only functions documented to support the
+ * split layout accept such a cube.
+ *
+ * @param [in]     rows      Number of rows in the cube.
+ * @param [in]     columns   Number of columns in the cube.
+ * @param [in]     slices    Number of slices in the cube.
+ *
+ * @return Pointer to allocated and initialized complex cube structure or NULL if allocation failed.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_Cube_C_t* ifx_cube_create_split_c(uint32_t rows,
+                                      uint32_t columns,
+                                      uint32_t slices);
+
 /**
  * @brief Frees memory for a real cube defined by \ref ifx_cube_create_r
  *        and sets the cube elements to zero.
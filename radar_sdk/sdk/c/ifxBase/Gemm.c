@@ -0,0 +1,505 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <string.h>
+
+#include "Complex.h"
+#include "Defines.h"
+#include "Error.h"
+#include "Mem.h"
+#include "internal/Gemm.h"
+#include "internal/Kernels.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+#define MR   IFX_KERNELS_GEMM_MR
+#define NR   IFX_KERNELS_GEMM_NR
+#define NR_C IFX_KERNELS_GEMM_NR_C
+
+/* Block sizes: a KC x NR panel of B should stay in L1 cache, an MC x KC
+ * block of A in L2 cache. MC must be a multiple of MR and NC a multiple of NR
+ * and NR_C. The sizes are in elements, i.e., for complex matrices the blocks
+ * are twice as large in bytes. */
+#define GEMM_MC 64
+#define GEMM_KC 128
+#define GEMM_NC 256
+
+/* Packing buffers up to this size (in floats) are placed on the stack; this
+ * covers the small matrices typical for antenna processing without touching
+ * the heap. */
+#define GEMM_STACK_FLOATS 2048
+
+#define GEMM_ALIGNMENT 64
+
+#define ROUND_UP(x, m) ((((x) + (m)-1) / (m)) * (m))
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+/* packing buffers for blocks of A and B */
+typedef struct
+{
+    ifx_Float_t* a;
+    ifx_Float_t* b;
+    void* heap; /* non-NULL if allocated on the heap */
+} gemm_buffer_t;
+
+/*
+==============================================================================
+   5. LOCAL FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+static size_t gemm_buffer_size(size_t m, size_t n, size_t k, size_t nr, size_t floats_per_element);
+static bool gemm_buffer_init(gemm_buffer_t* buffer, ifx_Float_t* stack, size_t m, size_t n, size_t k, size_t nr, size_t floats_per_element);
+static void gemm_buffer_free(gemm_buffer_t* buffer);
+
+static void pack_a_r(size_t mc, size_t kc, const ifx_Float_t* a, size_t rsa, size_t csa, ifx_Float_t* packed);
+static void pack_b_r(size_t kc, size_t nc, const ifx_Float_t* b, size_t rsb, size_t csb, ifx_Float_t* packed);
+static void pack_a_c(size_t mc, size_t kc, const ifx_Complex_t* a, size_t rsa, size_t csa, bool conj, ifx_Float_t* packed);
+static void pack_b_c(size_t kc, size_t nc, const ifx_Complex_t* b, size_t rsb, size_t csb, bool conj, ifx_Float_t* packed);
+
+static void gemm_r_blocked(size_t m, size_t n, size_t k,
+                           const ifx_Float_t* a, size_t rsa, size_t csa,
+                           const ifx_Float_t* b, size_t rsb, size_t csb,
+                           ifx_Float_t* c, size_t rsc, size_t csc,
+                           bool lower, const gemm_buffer_t* buffer);
+static void gemm_c_blocked(size_t m, size_t n, size_t k,
+                           const ifx_Complex_t* a, size_t rsa, size_t csa, bool conj_a,
+                           const ifx_Complex_t* b, size_t rsb, size_t csb, bool conj_b,
+                           ifx_Complex_t* c, size_t rsc, size_t csc,
+                           bool lower, const gemm_buffer_t* buffer);
+
+static void herk_c_mirror(size_t n, ifx_Complex_t* c, size_t rsc, size_t csc);
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+static size_t gemm_buffer_size(size_t m, size_t n, size_t k, size_t nr, size_t floats_per_element)
+{
+    const size_t kc = MIN(k, GEMM_KC);
+    const size_t mc = ROUND_UP(MIN(m, GEMM_MC), MR);
+    const size_t nc = ROUND_UP(MIN(n, GEMM_NC), nr);
+
+    return (mc + nc) * kc * floats_per_element;
+}
+
+static bool gemm_buffer_init(gemm_buffer_t* buffer, ifx_Float_t* stack, size_t m, size_t n, size_t k, size_t nr, size_t floats_per_element)
+{
+    const size_t size = gemm_buffer_size(m, n, k, nr, floats_per_element);
+    const size_t size_a = ROUND_UP(MIN(m, GEMM_MC), MR) * MIN(k, GEMM_KC) * floats_per_element;
+
+    buffer->heap = NULL;
+    if (size <= GEMM_STACK_FLOATS)
+    {
+        buffer->a = stack;
+    }
+    else
+    {
+        buffer->heap = ifx_mem_aligned_alloc(size * sizeof(ifx_Float_t), GEMM_ALIGNMENT);
+        if (!buffer->heap)
+            return false;
+        buffer->a = buffer->heap;
+    }
+
+    buffer->b = buffer->a + size_a;
+    return true;
+}
+
+static void gemm_buffer_free(gemm_buffer_t* buffer)
+{
+    ifx_mem_aligned_free(buffer->heap);
+    buffer->heap = NULL;
+}
+
+//----------------------------------------------------------------------------
+
+/* Pack the mc x kc block of A into panels of MR rows. Within a panel the
+ * MR elements of each column follow each other. Missing rows of the last
+ * panel are zero padded. */
+static void pack_a_r(size_t mc, size_t kc, const ifx_Float_t* a, size_t rsa, size_t csa, ifx_Float_t* packed)
+{
+    for (size_t i0 = 0; i0 < mc; i0 += MR)
+    {
+        const size_t mr = MIN(MR, mc - i0);
+        for (size_t l = 0; l < kc; l++)
+        {
+            size_t i = 0;
+            for (; i < mr; i++)
+                *packed++ = a[(i0 + i) * rsa + l * csa];
+            for (; i < MR; i++)
+                *packed++ = 0;
+        }
+    }
+}
+
+/* Pack the kc x nc block of B into panels of NR columns. Within a panel the
+ * NR elements of each row follow each other. */
+static void pack_b_r(size_t kc, size_t nc, const ifx_Float_t* b, size_t rsb, size_t csb, ifx_Float_t* packed)
+{
+    for (size_t j0 = 0; j0 < nc; j0 += NR)
+    {
+        const size_t nr = MIN(NR, nc - j0);
+        for (size_t l = 0; l < kc; l++)
+        {
+            size_t j = 0;
+            for (; j < nr; j++)
+                *packed++ = b[l * rsb + (j0 + j) * csb];
+            for (; j < NR; j++)
+                *packed++ = 0;
+        }
+    }
+}
+
+/* Same as pack_a_r, but for each column the MR real parts are followed by
+ * the MR imaginary parts. */
+static void pack_a_c(size_t mc, size_t kc, const ifx_Complex_t* a, size_t rsa, size_t csa, bool conj, ifx_Float_t* packed)
+{
+    const ifx_Float_t sign = conj ? -1.0f : 1.0f;
+
+    for (size_t i0 = 0; i0 < mc; i0 += MR)
+    {
+        const size_t mr = MIN(MR, mc - i0);
+        for (size_t l = 0; l < kc; l++, packed += 2 * MR)
+        {
+            size_t i = 0;
+            for (; i < mr; i++)
+            {
+                const ifx_Complex_t z = a[(i0 + i) * rsa + l * csa];
+                packed[i] = IFX_COMPLEX_REAL(z);
+                packed[MR + i] = sign * IFX_COMPLEX_IMAG(z);
+            }
+            for (; i < MR; i++)
+                packed[i] = packed[MR + i] = 0;
+        }
+    }
+}
+
+/* Same as pack_b_r with interleaved complex numbers. */
+static void pack_b_c(size_t kc, size_t nc, const ifx_Complex_t* b, size_t rsb, size_t csb, bool conj, ifx_Float_t* packed)
+{
+    const ifx_Float_t sign = conj ? -1.0f : 1.0f;
+
+    for (size_t j0 = 0; j0 < nc; j0 += NR_C)
+    {
+        const size_t nr = MIN(NR_C, nc - j0);
+        for (size_t l = 0; l < kc; l++)
+        {
+            size_t j = 0;
+            for (; j < nr; j++)
+            {
+                const ifx_Complex_t z = b[l * rsb + (j0 + j) * csb];
+                *packed++ = IFX_COMPLEX_REAL(z);
+                *packed++ = sign * IFX_COMPLEX_IMAG(z);
+            }
+            for (; j < NR_C; j++)
+            {
+                *packed++ = 0;
+                *packed++ = 0;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/* C = A*B; if lower is true only elements on and below the diagonal are
+ * computed (m == n). */
+static void gemm_r_blocked(size_t m, size_t n, size_t k,
+                           const ifx_Float_t* a, size_t rsa, size_t csa,
+                           const ifx_Float_t* b, size_t rsb, size_t csb,
+                           ifx_Float_t* c, size_t rsc, size_t csc,
+                           bool lower, const gemm_buffer_t* buffer)
+{
+    const ifx_Kernels_t* kernels = ifx_kernels_get();
+    ifx_Float_t ab[MR * NR];
+
+    if (k == 0)
+    {
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < n; j++)
+                c[i * rsc + j * csc] = 0;
+        return;
+    }
+
+    for (size_t jc = 0; jc < n; jc += GEMM_NC)
+    {
+        const size_t nc = MIN(GEMM_NC, n - jc);
+
+        for (size_t pc = 0; pc < k; pc += GEMM_KC)
+        {
+            const size_t kc = MIN(GEMM_KC, k - pc);
+            pack_b_r(kc, nc, &b[pc * rsb + jc * csb], rsb, csb, buffer->b);
+
+            for (size_t ic = 0; ic < m; ic += GEMM_MC)
+            {
+                const size_t mc = MIN(GEMM_MC, m - ic);
+                if (lower && ic + mc <= jc)
+                    continue;  // block is completely above the diagonal
+
+                pack_a_r(mc, kc, &a[ic * rsa + pc * csa], rsa, csa, buffer->a);
+
+                for (size_t jr = 0; jr < nc; jr += NR)
+                {
+                    const size_t nr = MIN(NR, nc - jr);
+                    for (size_t ir = 0; ir < mc; ir += MR)
+                    {
+                        const size_t mr = MIN(MR, mc - ir);
+                        const size_t row0 = ic + ir;
+                        const size_t col0 = jc + jr;
+                        if (lower && row0 + mr <= col0)
+                            continue;
+
+                        kernels->gemm_r(kc, &buffer->a[ir * kc], &buffer->b[jr * kc], ab);
+
+                        for (size_t i = 0; i < mr; i++)
+                        {
+                            ifx_Float_t* crow = &c[(row0 + i) * rsc + col0 * csc];
+                            const size_t jmax = lower ? MIN(nr, row0 + i + 1 - MIN(col0, row0 + i + 1)) : nr;
+                            for (size_t j = 0; j < jmax; j++)
+                            {
+                                if (pc == 0)
+                                    crow[j * csc] = ab[i * NR + j];
+                                else
+                                    crow[j * csc] += ab[i * NR + j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* complex version of gemm_r_blocked */
+static void gemm_c_blocked(size_t m, size_t n, size_t k,
+                           const ifx_Complex_t* a, size_t rsa, size_t csa, bool conj_a,
+                           const ifx_Complex_t* b, size_t rsb, size_t csb, bool conj_b,
+                           ifx_Complex_t* c, size_t rsc, size_t csc,
+                           bool lower, const gemm_buffer_t* buffer)
+{
+    const ifx_Kernels_t* kernels = ifx_kernels_get();
+    ifx_Complex_t ab[MR * NR_C];
+
+    if (k == 0)
+    {
+        const ifx_Complex_t zero = IFX_COMPLEX_DEF(0, 0);
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < n; j++)
+                c[i * rsc + j * csc] = zero;
+        return;
+    }
+
+    for (size_t jc = 0; jc < n; jc += GEMM_NC)
+    {
+        const size_t nc = MIN(GEMM_NC, n - jc);
+
+        for (size_t pc = 0; pc < k; pc += GEMM_KC)
+        {
+            const size_t kc = MIN(GEMM_KC, k - pc);
+            pack_b_c(kc, nc, &b[pc * rsb + jc * csb], rsb, csb, conj_b, buffer->b);
+
+            for (size_t ic = 0; ic < m; ic += GEMM_MC)
+            {
+                const size_t mc = MIN(GEMM_MC, m - ic);
+                if (lower && ic + mc <= jc)
+                    continue;  // block is completely above the diagonal
+
+                pack_a_c(mc, kc, &a[ic * rsa + pc * csa], rsa, csa, conj_a, buffer->a);
+
+                for (size_t jr = 0; jr < nc; jr += NR_C)
+                {
+                    const size_t nr = MIN(NR_C, nc - jr);
+                    for (size_t ir = 0; ir < mc; ir += MR)
+                    {
+                        const size_t mr = MIN(MR, mc - ir);
+                        const size_t row0 = ic + ir;
+                        const size_t col0 = jc + jr;
+                        if (lower && row0 + mr <= col0)
+                            continue;
+
+                        kernels->gemm_c(kc, &buffer->a[2 * ir * kc], &buffer->b[2 * jr * kc], ab);
+
+                        for (size_t i = 0; i < mr; i++)
+                        {
+                            ifx_Complex_t* crow = &c[(row0 + i) * rsc + col0 * csc];
+                            const size_t jmax = lower ? MIN(nr, row0 + i + 1 - MIN(col0, row0 + i + 1)) : nr;
+                            for (size_t j = 0; j < jmax; j++)
+                            {
+                                if (pc == 0)
+                                    crow[j * csc] = ab[i * NR_C + j];
+                                else
+                                    crow[j * csc] = ifx_complex_add(crow[j * csc], ab[i * NR_C + j]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/* fill the upper triangle of C from the lower triangle */
+static void herk_c_mirror(size_t n, ifx_Complex_t* c, size_t rsc, size_t csc)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        IFX_COMPLEX_SET_IMAG(c[i * rsc + i * csc], 0);
+        for (size_t j = i + 1; j < n; j++)
+            c[i * rsc + j * csc] = ifx_complex_conj(c[j * rsc + i * csc]);
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_gemm_r(size_t m, size_t n, size_t k,
+                const ifx_Float_t* a, size_t rsa, size_t csa,
+                const ifx_Float_t* b, size_t rsb, size_t csb,
+                ifx_Float_t* c, size_t rsc, size_t csc)
+{
+    ifx_Float_t stack[GEMM_STACK_FLOATS];
+    gemm_buffer_t buffer;
+    IFX_ERR_BRK_MEMALLOC(gemm_buffer_init(&buffer, stack, m, n, k, NR, 1));
+
+    gemm_r_blocked(m, n, k, a, rsa, csa, b, rsb, csb, c, rsc, csc, false, &buffer);
+
+    gemm_buffer_free(&buffer);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_gemm_c(size_t m, size_t n, size_t k,
+                const ifx_Complex_t* a, size_t rsa, size_t csa, bool conj_a,
+                const ifx_Complex_t* b, size_t rsb, size_t csb, bool conj_b,
+                ifx_Complex_t* c, size_t rsc, size_t csc)
+{
+    ifx_Float_t stack[GEMM_STACK_FLOATS];
+    gemm_buffer_t buffer;
+    IFX_ERR_BRK_MEMALLOC(gemm_buffer_init(&buffer, stack, m, n, k, NR_C, 2));
+
+    gemm_c_blocked(m, n, k, a, rsa, csa, conj_a, b, rsb, csb, conj_b, c, rsc, csc, false, &buffer);
+
+    gemm_buffer_free(&buffer);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_syrk_r(size_t n, size_t k,
+                const ifx_Float_t* a, size_t rsa, size_t csa,
+                ifx_Float_t* c, size_t rsc, size_t csc)
+{
+    ifx_Float_t stack[GEMM_STACK_FLOATS];
+    gemm_buffer_t buffer;
+    IFX_ERR_BRK_MEMALLOC(gemm_buffer_init(&buffer, stack, n, n, k, NR, 1));
+
+    // A^T is A with row and column strides swapped
+    gemm_r_blocked(n, n, k, a, rsa, csa, a, csa, rsa, c, rsc, csc, true, &buffer);
+
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = i + 1; j < n; j++)
+            c[i * rsc + j * csc] = c[j * rsc + i * csc];
+
+    gemm_buffer_free(&buffer);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_herk_c(size_t n, size_t k,
+                const ifx_Complex_t* a, size_t rsa, size_t csa,
+                ifx_Complex_t* c, size_t rsc, size_t csc)
+{
+    ifx_Float_t stack[GEMM_STACK_FLOATS];
+    gemm_buffer_t buffer;
+    IFX_ERR_BRK_MEMALLOC(gemm_buffer_init(&buffer, stack, n, n, k, NR_C, 2));
+
+    gemm_c_blocked(n, n, k, a, rsa, csa, false, a, csa, rsa, true, c, rsc, csc, true, &buffer);
+    herk_c_mirror(n, c, rsc, csc);
+
+    gemm_buffer_free(&buffer);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_gemm_batch_c(size_t batch, size_t m, size_t n, size_t k,
+                      const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* c)
+{
+    ifx_Float_t stack[GEMM_STACK_FLOATS];
+    gemm_buffer_t buffer;
+    IFX_ERR_BRK_MEMALLOC(gemm_buffer_init(&buffer, stack, m, n, k, NR_C, 2));
+
+    for (size_t i = 0; i < batch; i++)
+    {
+        gemm_c_blocked(m, n, k, &a[i * m * k], k, 1, false, &b[i * k * n], n, 1, false,
+                       &c[i * m * n], n, 1, false, &buffer);
+    }
+
+    gemm_buffer_free(&buffer);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_herk_batch_c(size_t batch, size_t n, size_t k,
+                      const ifx_Complex_t* a, ifx_Complex_t* c)
+{
+    ifx_Float_t stack[GEMM_STACK_FLOATS];
+    gemm_buffer_t buffer;
+    IFX_ERR_BRK_MEMALLOC(gemm_buffer_init(&buffer, stack, n, n, k, NR_C, 2));
+
+    for (size_t i = 0; i < batch; i++)
+    {
+        const ifx_Complex_t* ai = &a[i * n * k];
+        ifx_Complex_t* ci = &c[i * n * n];
+        gemm_c_blocked(n, n, k, ai, k, 1, false, ai, 1, k, true, ci, n, 1, true, &buffer);
+        herk_c_mirror(n, ci, n, 1);
+    }
+
+    gemm_buffer_free(&buffer);
+}
@@ -0,0 +1,577 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <cmath>
+
+#include "Complex.h"
+#include "internal/Kernels.h"
+
+#if defined(IFX_KERNELS_HAVE_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+#define NUM_ISAS (IFX_KERNEL_ISA_NEON + 1)
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+namespace {
+
+void add_r_scalar(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] + b[i];
+}
+
+void sub_r_scalar(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] - b[i];
+}
+
+void mul_r_scalar(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] * b[i];
+}
+
+void add_rs_scalar(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] + s;
+}
+
+void scale_r_scalar(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] * s;
+}
+
+void mac_r_scalar(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] + s * b[i];
+}
+
+void abs_r_scalar(const ifx_Float_t* a, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = std::fabs(a[i]);
+}
+
+ifx_Float_t sum_r_scalar(const ifx_Float_t* a, size_t n)
+{
+    // Kahan summation, see https://en.wikipedia.org/wiki/Kahan_summation_algorithm
+    ifx_Float_t sum = 0;
+    ifx_Float_t c = 0;  // running compensation for lost low-order bits
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t y = a[i] - c;
+        const ifx_Float_t t = sum + y;
+        c = (t - sum) - y;
+        sum = t;
+    }
+
+    return sum;
+}
+
+ifx_Float_t dot_r_scalar(const ifx_Float_t* a, const ifx_Float_t* b, size_t n)
+{
+    ifx_Float_t s = 0;
+    for (size_t i = 0; i < n; i++)
+        s += a[i] * b[i];
+    return s;
+}
+
+void mul_c_scalar(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t ar = IFX_COMPLEX_REAL(a[i]);
+        const ifx_Float_t ai = IFX_COMPLEX_IMAG(a[i]);
+        const ifx_Float_t br = IFX_COMPLEX_REAL(b[i]);
+        const ifx_Float_t bi = IFX_COMPLEX_IMAG(b[i]);
+        IFX_COMPLEX_SET(out[i], ar * br - ai * bi, ar * bi + ai * br);
+    }
+}
+
+void mul_cr_scalar(const ifx_Complex_t* a, const ifx_Float_t* b, ifx_Complex_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t f = b[i];
+        IFX_COMPLEX_SET(out[i], IFX_COMPLEX_REAL(a[i]) * f, IFX_COMPLEX_IMAG(a[i]) * f);
+    }
+}
+
+void add_cs_scalar(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(s);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(s);
+    for (size_t i = 0; i < n; i++)
+        IFX_COMPLEX_SET(out[i], IFX_COMPLEX_REAL(a[i]) + sr, IFX_COMPLEX_IMAG(a[i]) + si);
+}
+
+void scale_c_scalar(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(s);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(s);
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t ar = IFX_COMPLEX_REAL(a[i]);
+        const ifx_Float_t ai = IFX_COMPLEX_IMAG(a[i]);
+        IFX_COMPLEX_SET(out[i], ar * sr - ai * si, ar * si + ai * sr);
+    }
+}
+
+void mac_c_scalar(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(s);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(s);
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t br = IFX_COMPLEX_REAL(b[i]);
+        const ifx_Float_t bi = IFX_COMPLEX_IMAG(b[i]);
+        IFX_COMPLEX_SET(out[i],
+                        IFX_COMPLEX_REAL(a[i]) + (br * sr - bi * si),
+                        IFX_COMPLEX_IMAG(a[i]) + (br * si + bi * sr));
+    }
+}
+
+void abs_c_scalar(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = std::hypot(IFX_COMPLEX_REAL(a[i]), IFX_COMPLEX_IMAG(a[i]));
+}
+
+void sqnorm_c_scalar(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t re = IFX_COMPLEX_REAL(a[i]);
+        const ifx_Float_t im = IFX_COMPLEX_IMAG(a[i]);
+        out[i] = re * re + im * im;
+    }
+}
+
+ifx_Complex_t sum_c_scalar(const ifx_Complex_t* a, size_t n)
+{
+    ifx_Float_t re = 0;
+    ifx_Float_t im = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        re += IFX_COMPLEX_REAL(a[i]);
+        im += IFX_COMPLEX_IMAG(a[i]);
+    }
+
+    ifx_Complex_t sum;
+    IFX_COMPLEX_SET(sum, re, im);
+    return sum;
+}
+
+void deinterleave_c_scalar(const ifx_Complex_t* a, ifx_Float_t* re, ifx_Float_t* im, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        re[i] = IFX_COMPLEX_REAL(a[i]);
+        im[i] = IFX_COMPLEX_IMAG(a[i]);
+    }
+}
+
+void interleave_c_scalar(const ifx_Float_t* re, const ifx_Float_t* im, ifx_Complex_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        IFX_COMPLEX_SET(out[i], re[i], im[i]);
+}
+
+void abs_s_scalar(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = std::hypot(a_re[i], a_im[i]);
+}
+
+void sqnorm_s_scalar(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = a_re[i] * a_re[i] + a_im[i] * a_im[i];
+}
+
+void scale_s_scalar(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Complex_t s,
+                    ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(s);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(s);
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t ar = a_re[i];
+        const ifx_Float_t ai = a_im[i];
+        out_re[i] = ar * sr - ai * si;
+        out_im[i] = ar * si + ai * sr;
+    }
+}
+
+void mac_s_scalar(const ifx_Float_t* a_re, const ifx_Float_t* a_im,
+                  const ifx_Float_t* b_re, const ifx_Float_t* b_im, ifx_Complex_t s,
+                  ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(s);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(s);
+    for (size_t i = 0; i < n; i++)
+    {
+        const ifx_Float_t br = b_re[i];
+        const ifx_Float_t bi = b_im[i];
+        out_re[i] = a_re[i] + (br * sr - bi * si);
+        out_im[i] = a_im[i] + (br * si + bi * sr);
+    }
+}
+
+void gemm_r_scalar(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* ab)
+{
+    constexpr size_t MR = IFX_KERNELS_GEMM_MR;
+    constexpr size_t NR = IFX_KERNELS_GEMM_NR;
+
+    ifx_Float_t acc[MR * NR] = {};
+    for (size_t l = 0; l < k; l++, a += MR, b += NR)
+    {
+        for (size_t i = 0; i < MR; i++)
+            for (size_t j = 0; j < NR; j++)
+                acc[i * NR + j] += a[i] * b[j];
+    }
+
+    for (size_t i = 0; i < MR * NR; i++)
+        ab[i] = acc[i];
+}
+
+void gemm_c_scalar(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Complex_t* ab)
+{
+    constexpr size_t MR = IFX_KERNELS_GEMM_MR;
+    constexpr size_t NR = IFX_KERNELS_GEMM_NR_C;
+
+    ifx_Float_t acc_re[MR * NR] = {};
+    ifx_Float_t acc_im[MR * NR] = {};
+    for (size_t l = 0; l < k; l++, a += 2 * MR, b += 2 * NR)
+    {
+        for (size_t i = 0; i < MR; i++)
+        {
+            const ifx_Float_t ar = a[i];
+            const ifx_Float_t ai = a[MR + i];
+            for (size_t j = 0; j < NR; j++)
+            {
+                const ifx_Float_t br = b[2 * j];
+                const ifx_Float_t bi = b[2 * j + 1];
+                acc_re[i * NR + j] += ar * br - ai * bi;
+                acc_im[i * NR + j] += ar * bi + ai * br;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < MR * NR; i++)
+        IFX_COMPLEX_SET(ab[i], acc_re[i], acc_im[i]);
+}
+
+template <typename T>
+void transpose_scalar(const T* in, size_t in_stride, T* out, size_t out_stride, size_t rows, size_t cols)
+{
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < cols; j++)
+            out[i * out_stride + j] = in[j * in_stride + i];
+}
+
+/* Unpack pairs of 12 bit samples and write convert(sample) to out */
+template <typename T, typename Convert>
+void unpack12_scalar(const uint8_t* in, T* out, size_t n, ifx_Kernel_Unpack12_t format, Convert convert)
+{
+    for (size_t i = 0; i < n / 2; i++)
+    {
+        const uint8_t b0 = in[3 * i + 0];
+        const uint8_t b1 = in[3 * i + 1];
+        const uint8_t b2 = in[3 * i + 2];
+        uint16_t s0, s1;
+        if (format == IFX_KERNEL_PACKED12)
+        {
+            s0 = static_cast<uint16_t>((b0 << 4) | (b1 >> 4));
+            s1 = static_cast<uint16_t>(((b1 & 0x0f) << 8) | b2);
+        }
+        else
+        {
+            s0 = static_cast<uint16_t>((b0 << 4) | (b2 & 0x0f));
+            s1 = static_cast<uint16_t>((b1 << 4) | (b2 >> 4));
+        }
+        out[2 * i + 0] = convert(s0);
+        out[2 * i + 1] = convert(s1);
+    }
+}
+
+void unpack12_u16_scalar(const uint8_t* in, uint16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    unpack12_scalar(in, out, n, format, [](uint16_t s) { return s; });
+}
+
+void unpack12_s16_scalar(const uint8_t* in, int16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    unpack12_scalar(in, out, n, format, [](uint16_t s) { return static_cast<int16_t>(s - 2048); });
+}
+
+void unpack12_r_scalar(const uint8_t* in, ifx_Float_t* out, size_t n, ifx_Kernel_Unpack12_t format, ifx_Float_t scale, ifx_Float_t offset)
+{
+    unpack12_scalar(in, out, n, format, [=](uint16_t s) { return static_cast<ifx_Float_t>(s) * scale + offset; });
+}
+
+void mask12_r_scalar(const uint16_t* in, ifx_Float_t* out, size_t n, ifx_Float_t scale, ifx_Float_t offset)
+{
+    for (size_t i = 0; i < n; i++)
+        out[i] = static_cast<ifx_Float_t>(in[i] & 0x0fff) * scale + offset;
+}
+
+void gather_iq_c_scalar(const uint16_t* in, size_t stride, ifx_Complex_t* out, size_t n, uint16_t mask, ifx_Float_t scale)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        IFX_COMPLEX_SET(out[i], static_cast<ifx_Float_t>(iq[0] & mask) * scale, static_cast<ifx_Float_t>(iq[1] & mask) * scale);
+    }
+}
+
+void gather_iq_s16_scalar(const uint16_t* in, size_t stride, int16_t* out, size_t n, uint16_t mask, int shift)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        out[2 * i] = static_cast<int16_t>((iq[0] & mask) >> shift);
+        out[2 * i + 1] = static_cast<int16_t>((iq[1] & mask) >> shift);
+    }
+}
+
+ifx_Kernels_t kernels_scalar()
+{
+    ifx_Kernels_t k;
+    k.isa = IFX_KERNEL_ISA_SCALAR;
+    k.add_r = add_r_scalar;
+    k.sub_r = sub_r_scalar;
+    k.mul_r = mul_r_scalar;
+    k.add_rs = add_rs_scalar;
+    k.scale_r = scale_r_scalar;
+    k.mac_r = mac_r_scalar;
+    k.abs_r = abs_r_scalar;
+    k.sum_r = sum_r_scalar;
+    k.dot_r = dot_r_scalar;
+    k.mul_c = mul_c_scalar;
+    k.mul_cr = mul_cr_scalar;
+    k.add_cs = add_cs_scalar;
+    k.scale_c = scale_c_scalar;
+    k.mac_c = mac_c_scalar;
+    k.abs_c = abs_c_scalar;
+    k.sqnorm_c = sqnorm_c_scalar;
+    k.sum_c = sum_c_scalar;
+    k.deinterleave_c = deinterleave_c_scalar;
+    k.interleave_c = interleave_c_scalar;
+    k.abs_s = abs_s_scalar;
+    k.sqnorm_s = sqnorm_s_scalar;
+    k.scale_s = scale_s_scalar;
+    k.mac_s = mac_s_scalar;
+    k.gemm_r = gemm_r_scalar;
+    k.gemm_c = gemm_c_scalar;
+    k.transpose_r = transpose_scalar<ifx_Float_t>;
+    k.transpose_c = transpose_scalar<ifx_Complex_t>;
+    k.unpack12_u16 = unpack12_u16_scalar;
+    k.unpack12_s16 = unpack12_s16_scalar;
+    k.unpack12_r = unpack12_r_scalar;
+    k.mask12_r = mask12_r_scalar;
+    k.gather_iq_c = gather_iq_c_scalar;
+    k.gather_iq_s16 = gather_iq_s16_scalar;
+    return k;
+}
+
+#ifdef IFX_KERNELS_HAVE_X86
+#ifdef _MSC_VER
+// MSVC has no equivalent to __builtin_cpu_supports, so query CPUID directly.
+// AVX registers can only be used if the operating system saves them on
+// context switches, which is checked using XGETBV.
+bool cpu_supports(ifx_Kernel_Isa_t isa)
+{
+    int regs[4];
+
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    const bool sse2 = (regs[3] & (1 << 26)) != 0;
+    const bool ssse3 = (regs[2] & (1 << 9)) != 0;
+    const bool fma = (regs[2] & (1 << 12)) != 0;
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool avx = (regs[2] & (1 << 28)) != 0;
+
+    if (isa == IFX_KERNEL_ISA_SSE2)
+        return sse2;
+    if (isa == IFX_KERNEL_ISA_SSSE3)
+        return ssse3;
+
+    if (!osxsave || !avx || max_leaf < 7)
+        return false;
+
+    const unsigned long long xcr0 = _xgetbv(0);
+    const bool os_avx = (xcr0 & 0x06) == 0x06;      // XMM and YMM state
+    const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;  // additionally opmask and ZMM state
+
+    __cpuidex(regs, 7, 0);
+    const bool avx2 = (regs[1] & (1 << 5)) != 0;
+    const bool avx512f = (regs[1] & (1 << 16)) != 0;
+
+    if (isa == IFX_KERNEL_ISA_AVX2)
+        return os_avx && avx2 && fma;
+    if (isa == IFX_KERNEL_ISA_AVX512)
+        return os_avx512 && avx512f;
+    return false;
+}
+#else
+bool cpu_supports(ifx_Kernel_Isa_t isa)
+{
+    __builtin_cpu_init();
+
+    switch (isa)
+    {
+        case IFX_KERNEL_ISA_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case IFX_KERNEL_ISA_SSSE3:
+            return __builtin_cpu_supports("ssse3");
+        case IFX_KERNEL_ISA_AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case IFX_KERNEL_ISA_AVX512:
+            return __builtin_cpu_supports("avx512f");
+        default:
+            return false;
+    }
+}
+#endif
+#elif defined(IFX_KERNELS_HAVE_NEON)
+bool cpu_supports(ifx_Kernel_Isa_t isa)
+{
+    // Advanced SIMD is mandatory on ARMv8-A
+    return isa == IFX_KERNEL_ISA_NEON;
+}
+#else
+bool cpu_supports(ifx_Kernel_Isa_t /* isa */)
+{
+    return false;
+}
+#endif
+
+/* Build the kernel table for isa. The tables are layered: each instruction
+ * set starts from the table of the next smaller one and only replaces the
+ * kernels it has an own implementation for. */
+ifx_Kernels_t build_kernels(ifx_Kernel_Isa_t isa)
+{
+    ifx_Kernels_t k = kernels_scalar();
+
+#ifdef IFX_KERNELS_HAVE_X86
+    if (isa >= IFX_KERNEL_ISA_SSE2 && isa <= IFX_KERNEL_ISA_AVX512)
+        ifx_kernels_init_sse2(&k);
+    if (isa >= IFX_KERNEL_ISA_SSSE3 && isa <= IFX_KERNEL_ISA_AVX512)
+        ifx_kernels_init_ssse3(&k);
+    if (isa >= IFX_KERNEL_ISA_AVX2 && isa <= IFX_KERNEL_ISA_AVX512)
+        ifx_kernels_init_avx2(&k);
+    if (isa == IFX_KERNEL_ISA_AVX512)
+        ifx_kernels_init_avx512(&k);
+#endif
+#ifdef IFX_KERNELS_HAVE_NEON
+    if (isa == IFX_KERNEL_ISA_NEON)
+        ifx_kernels_init_neon(&k);
+#endif
+
+    return k;
+}
+
+struct KernelTables
+{
+    ifx_Kernels_t table[NUM_ISAS];
+    bool supported[NUM_ISAS];
+    ifx_Kernel_Isa_t best;
+
+    KernelTables() :
+        best(IFX_KERNEL_ISA_SCALAR)
+    {
+        for (int i = 0; i < NUM_ISAS; i++)
+        {
+            const auto isa = static_cast<ifx_Kernel_Isa_t>(i);
+            supported[i] = (isa == IFX_KERNEL_ISA_SCALAR) || cpu_supports(isa);
+            table[i] = build_kernels(supported[i] ? isa : IFX_KERNEL_ISA_SCALAR);
+            if (supported[i])
+                best = isa;
+        }
+    }
+};
+
+const KernelTables& kernel_tables()
+{
+    // initialization of function-local statics is thread-safe
+    static const KernelTables tables;
+    return tables;
+}
+
+}  // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+const ifx_Kernels_t* ifx_kernels_get(void)
+{
+    static const ifx_Kernels_t* kernels = &kernel_tables().table[kernel_tables().best];
+    return kernels;
+}
+
+//----------------------------------------------------------------------------
+
+const ifx_Kernels_t* ifx_kernels_get_isa(ifx_Kernel_Isa_t isa)
+{
+    if (isa < IFX_KERNEL_ISA_SCALAR || isa >= NUM_ISAS)
+        return nullptr;
+
+    const auto& tables = kernel_tables();
+    return tables.supported[isa] ? &tables.table[isa] : nullptr;
+}
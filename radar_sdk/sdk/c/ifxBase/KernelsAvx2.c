@@ -0,0 +1,768 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "Complex.h"
+#include "internal/Kernels.h"
+
+#ifdef IFX_KERNELS_HAVE_X86
+
+#include <immintrin.h>
+#include <math.h>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* Elementwise loop over n floats: body processes 8 floats at index i using
+ * AVX, tail processes the remaining floats one by one. */
+#define AVX2_LOOP(n, body, tail)     \
+    do                               \
+    {                                \
+        size_t i = 0;                \
+        for (; i + 8 <= (n); i += 8) \
+        {                            \
+            body;                    \
+        }                            \
+        for (; i < (n); i++)         \
+        {                            \
+            tail;                    \
+        }                            \
+    } while (0)
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/* Multiply two vectors containing four interleaved complex numbers each. */
+static inline __m256 cmul_avx2(__m256 a, __m256 b)
+{
+    const __m256 b_re = _mm256_moveldup_ps(b);                  // br br ...
+    const __m256 b_im = _mm256_movehdup_ps(b);                  // bi bi ...
+    const __m256 a_swap = _mm256_permute_ps(a, 0xb1);           // ai ar ...
+    return _mm256_fmaddsub_ps(a, b_re, _mm256_mul_ps(a_swap, b_im));  // (ar*br - ai*bi, ai*br + ar*bi)
+}
+
+/* |z|^2 of the 8 complex numbers stored in lo (z0..z3) and hi (z4..z7). */
+static inline __m256 sqnorm8_avx2(__m256 lo, __m256 hi)
+{
+    // hadd works within 128-bit lanes, the result is ordered z0 z1 z4 z5 z2 z3 z6 z7
+    const __m256 sums = _mm256_hadd_ps(_mm256_mul_ps(lo, lo), _mm256_mul_ps(hi, hi));
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sums), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static inline float hsum_avx2(__m256 v)
+{
+    const __m128 lo = _mm256_castps256_ps128(v);
+    const __m128 hi = _mm256_extractf128_ps(v, 1);
+    __m128 s = _mm_add_ps(lo, hi);
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+
+//----------------------------------------------------------------------------
+
+static void add_r_avx2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_add_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i]))),
+              out[i] = a[i] + b[i]);
+}
+
+static void sub_r_avx2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_sub_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i]))),
+              out[i] = a[i] - b[i]);
+}
+
+static void mul_r_avx2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i]))),
+              out[i] = a[i] * b[i]);
+}
+
+static void add_rs_avx2(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m256 vs = _mm256_set1_ps(s);
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_add_ps(_mm256_loadu_ps(&a[i]), vs)),
+              out[i] = a[i] + s);
+}
+
+static void scale_r_avx2(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m256 vs = _mm256_set1_ps(s);
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_mul_ps(_mm256_loadu_ps(&a[i]), vs)),
+              out[i] = a[i] * s);
+}
+
+static void mac_r_avx2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m256 vs = _mm256_set1_ps(s);
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_fmadd_ps(vs, _mm256_loadu_ps(&b[i]), _mm256_loadu_ps(&a[i]))),
+              out[i] = a[i] + s * b[i]);
+}
+
+static void abs_r_avx2(const ifx_Float_t* a, ifx_Float_t* out, size_t n)
+{
+    const __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    AVX2_LOOP(n, _mm256_storeu_ps(&out[i], _mm256_and_ps(_mm256_loadu_ps(&a[i]), mask)),
+              out[i] = fabsf(a[i]));
+}
+
+static ifx_Float_t sum_r_avx2(const ifx_Float_t* a, size_t n)
+{
+    // Kahan summation in each of the 8 lanes
+    __m256 sum = _mm256_setzero_ps();
+    __m256 c = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 y = _mm256_sub_ps(_mm256_loadu_ps(&a[i]), c);
+        const __m256 t = _mm256_add_ps(sum, y);
+        c = _mm256_sub_ps(_mm256_sub_ps(t, sum), y);
+        sum = t;
+    }
+
+    // combine the lanes and the remaining elements with scalar Kahan summation
+    float lanes[8];
+    float comp[8];
+    _mm256_storeu_ps(lanes, sum);
+    _mm256_storeu_ps(comp, c);
+
+    float s = 0;
+    float cs = 0;
+    for (int j = 0; j < 8; j++)
+    {
+        const float y = lanes[j] - (cs + comp[j]);
+        const float t = s + y;
+        cs = (t - s) - y;
+        s = t;
+    }
+    for (; i < n; i++)
+    {
+        const float y = a[i] - cs;
+        const float t = s + y;
+        cs = (t - s) - y;
+        s = t;
+    }
+
+    return s;
+}
+
+static ifx_Float_t dot_r_avx2(const ifx_Float_t* x, const ifx_Float_t* y, size_t len)
+{
+    __m256 vv0 = _mm256_setzero_ps();
+    __m256 vv1 = _mm256_setzero_ps();
+    __m256 vv2 = _mm256_setzero_ps();
+    __m256 vv3 = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32)
+    {
+        vv0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i + 0]), _mm256_loadu_ps(&y[i + 0]), vv0);
+        vv1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i + 8]), _mm256_loadu_ps(&y[i + 8]), vv1);
+        vv2 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i + 16]), _mm256_loadu_ps(&y[i + 16]), vv2);
+        vv3 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i + 24]), _mm256_loadu_ps(&y[i + 24]), vv3);
+    }
+
+    __m256 vv = _mm256_add_ps(_mm256_add_ps(vv0, vv1), _mm256_add_ps(vv2, vv3));
+    for (; i + 8 <= len; i += 8)
+        vv = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i]), _mm256_loadu_ps(&y[i]), vv);
+
+    float v = hsum_avx2(vv);
+    for (; i < len; i++)
+        v += x[i] * y[i];
+
+    return v;
+}
+
+//----------------------------------------------------------------------------
+
+static void mul_c_avx2(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_ps(&po[2 * i], cmul_avx2(_mm256_loadu_ps(&pa[2 * i]), _mm256_loadu_ps(&pb[2 * i])));
+
+    for (; i < n; i++)
+    {
+        const float ar = pa[2 * i], ai = pa[2 * i + 1];
+        const float br = pb[2 * i], bi = pb[2 * i + 1];
+        po[2 * i] = ar * br - ai * bi;
+        po[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+static void mul_cr_avx2(const ifx_Complex_t* a, const ifx_Float_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const __m256i dup_lo = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    const __m256i dup_hi = _mm256_set_epi32(7, 7, 6, 6, 5, 5, 4, 4);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 vb = _mm256_loadu_ps(&b[i]);
+        const __m256 b_lo = _mm256_permutevar8x32_ps(vb, dup_lo);  // b0 b0 b1 b1 b2 b2 b3 b3
+        const __m256 b_hi = _mm256_permutevar8x32_ps(vb, dup_hi);  // b4 b4 ... b7 b7
+        _mm256_storeu_ps(&po[2 * i], _mm256_mul_ps(_mm256_loadu_ps(&pa[2 * i]), b_lo));
+        _mm256_storeu_ps(&po[2 * i + 8], _mm256_mul_ps(_mm256_loadu_ps(&pa[2 * i + 8]), b_hi));
+    }
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = pa[2 * i] * b[i];
+        po[2 * i + 1] = pa[2 * i + 1] * b[i];
+    }
+}
+
+static void add_cs_avx2(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m256 vs = _mm256_set_ps(si, sr, si, sr, si, sr, si, sr);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_ps(&po[2 * i], _mm256_add_ps(_mm256_loadu_ps(&pa[2 * i]), vs));
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = pa[2 * i] + sr;
+        po[2 * i + 1] = pa[2 * i + 1] + si;
+    }
+}
+
+static void scale_c_avx2(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m256 vs = _mm256_set_ps(si, sr, si, sr, si, sr, si, sr);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_ps(&po[2 * i], cmul_avx2(_mm256_loadu_ps(&pa[2 * i]), vs));
+
+    for (; i < n; i++)
+    {
+        const float ar = pa[2 * i], ai = pa[2 * i + 1];
+        po[2 * i] = ar * sr - ai * si;
+        po[2 * i + 1] = ar * si + ai * sr;
+    }
+}
+
+static void mac_c_avx2(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m256 vs = _mm256_set_ps(si, sr, si, sr, si, sr, si, sr);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256 prod = cmul_avx2(_mm256_loadu_ps(&pb[2 * i]), vs);
+        _mm256_storeu_ps(&po[2 * i], _mm256_add_ps(_mm256_loadu_ps(&pa[2 * i]), prod));
+    }
+
+    for (; i < n; i++)
+    {
+        const float br = pb[2 * i], bi = pb[2 * i + 1];
+        po[2 * i] = pa[2 * i] + (br * sr - bi * si);
+        po[2 * i + 1] = pa[2 * i + 1] + (br * si + bi * sr);
+    }
+}
+
+static void abs_c_avx2(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 sq = sqnorm8_avx2(_mm256_loadu_ps(&pa[2 * i]), _mm256_loadu_ps(&pa[2 * i + 8]));
+        _mm256_storeu_ps(&out[i], _mm256_sqrt_ps(sq));
+    }
+
+    for (; i < n; i++)
+        out[i] = hypotf(pa[2 * i], pa[2 * i + 1]);
+}
+
+static void sqnorm_c_avx2(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(&out[i], sqnorm8_avx2(_mm256_loadu_ps(&pa[2 * i]), _mm256_loadu_ps(&pa[2 * i + 8])));
+
+    for (; i < n; i++)
+        out[i] = pa[2 * i] * pa[2 * i] + pa[2 * i + 1] * pa[2 * i + 1];
+}
+
+static ifx_Complex_t sum_c_avx2(const ifx_Complex_t* a, size_t n)
+{
+    const float* pa = (const float*)a;
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(&pa[2 * i]));
+        acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(&pa[2 * i + 8]));
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps(lanes, _mm256_add_ps(acc0, acc1));
+    float re = (lanes[0] + lanes[2]) + (lanes[4] + lanes[6]);
+    float im = (lanes[1] + lanes[3]) + (lanes[5] + lanes[7]);
+
+    for (; i < n; i++)
+    {
+        re += pa[2 * i];
+        im += pa[2 * i + 1];
+    }
+
+    ifx_Complex_t sum;
+    IFX_COMPLEX_SET(sum, re, im);
+    return sum;
+}
+
+static void deinterleave_c_avx2(const ifx_Complex_t* a, ifx_Float_t* re, ifx_Float_t* im, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 lo = _mm256_loadu_ps(&pa[2 * i]);
+        const __m256 hi = _mm256_loadu_ps(&pa[2 * i + 8]);
+        // shuffle works per 128 bit lane, permute restores the element order
+        const __m256 vre = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 vim = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm256_storeu_ps(&re[i], _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(vre), _MM_SHUFFLE(3, 1, 2, 0))));
+        _mm256_storeu_ps(&im[i], _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(vim), _MM_SHUFFLE(3, 1, 2, 0))));
+    }
+
+    for (; i < n; i++)
+    {
+        re[i] = pa[2 * i];
+        im[i] = pa[2 * i + 1];
+    }
+}
+
+static void interleave_c_avx2(const ifx_Float_t* re, const ifx_Float_t* im, ifx_Complex_t* out, size_t n)
+{
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 vre = _mm256_loadu_ps(&re[i]);
+        const __m256 vim = _mm256_loadu_ps(&im[i]);
+        const __m256 lo = _mm256_unpacklo_ps(vre, vim);  // z0 z1 | z4 z5
+        const __m256 hi = _mm256_unpackhi_ps(vre, vim);  // z2 z3 | z6 z7
+        _mm256_storeu_ps(&po[2 * i], _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(&po[2 * i + 8], _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = re[i];
+        po[2 * i + 1] = im[i];
+    }
+}
+
+static void abs_s_avx2(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    AVX2_LOOP(n,
+              {
+                  const __m256 vre = _mm256_loadu_ps(&a_re[i]);
+                  const __m256 vim = _mm256_loadu_ps(&a_im[i]);
+                  _mm256_storeu_ps(&out[i], _mm256_sqrt_ps(_mm256_fmadd_ps(vre, vre, _mm256_mul_ps(vim, vim))));
+              },
+              out[i] = hypotf(a_re[i], a_im[i]));
+}
+
+static void sqnorm_s_avx2(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    AVX2_LOOP(n,
+              {
+                  const __m256 vre = _mm256_loadu_ps(&a_re[i]);
+                  const __m256 vim = _mm256_loadu_ps(&a_im[i]);
+                  _mm256_storeu_ps(&out[i], _mm256_fmadd_ps(vre, vre, _mm256_mul_ps(vim, vim)));
+              },
+              out[i] = a_re[i] * a_re[i] + a_im[i] * a_im[i]);
+}
+
+static void scale_s_avx2(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Complex_t s,
+                         ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m256 vsr = _mm256_set1_ps(sr);
+    const __m256 vsi = _mm256_set1_ps(si);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 ar = _mm256_loadu_ps(&a_re[i]);
+        const __m256 ai = _mm256_loadu_ps(&a_im[i]);
+        _mm256_storeu_ps(&out_re[i], _mm256_fmsub_ps(ar, vsr, _mm256_mul_ps(ai, vsi)));
+        _mm256_storeu_ps(&out_im[i], _mm256_fmadd_ps(ar, vsi, _mm256_mul_ps(ai, vsr)));
+    }
+
+    for (; i < n; i++)
+    {
+        const float ar = a_re[i], ai = a_im[i];
+        out_re[i] = ar * sr - ai * si;
+        out_im[i] = ar * si + ai * sr;
+    }
+}
+
+static void mac_s_avx2(const ifx_Float_t* a_re, const ifx_Float_t* a_im,
+                       const ifx_Float_t* b_re, const ifx_Float_t* b_im, ifx_Complex_t s,
+                       ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m256 vsr = _mm256_set1_ps(sr);
+    const __m256 vsi = _mm256_set1_ps(si);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 br = _mm256_loadu_ps(&b_re[i]);
+        const __m256 bi = _mm256_loadu_ps(&b_im[i]);
+        // a + b*s = (ar + br*sr - bi*si) + j(ai + br*si + bi*sr)
+        const __m256 re = _mm256_fnmadd_ps(bi, vsi, _mm256_fmadd_ps(br, vsr, _mm256_loadu_ps(&a_re[i])));
+        const __m256 im = _mm256_fmadd_ps(bi, vsr, _mm256_fmadd_ps(br, vsi, _mm256_loadu_ps(&a_im[i])));
+        _mm256_storeu_ps(&out_re[i], re);
+        _mm256_storeu_ps(&out_im[i], im);
+    }
+
+    for (; i < n; i++)
+    {
+        const float br = b_re[i], bi = b_im[i];
+        out_re[i] = a_re[i] + (br * sr - bi * si);
+        out_im[i] = a_im[i] + (br * si + bi * sr);
+    }
+}
+
+
+static void gemm_r_avx2(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* ab)
+{
+    __m256 acc[IFX_KERNELS_GEMM_MR];
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        acc[i] = _mm256_setzero_ps();
+
+    for (size_t l = 0; l < k; l++, a += IFX_KERNELS_GEMM_MR, b += IFX_KERNELS_GEMM_NR)
+    {
+        const __m256 bv = _mm256_loadu_ps(b);
+        for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+            acc[i] = _mm256_fmadd_ps(_mm256_broadcast_ss(&a[i]), bv, acc[i]);
+    }
+
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        _mm256_storeu_ps(&ab[i * IFX_KERNELS_GEMM_NR], acc[i]);
+}
+
+static void gemm_c_avx2(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Complex_t* ab)
+{
+    /* acc_re accumulates real(a)*b, acc_im accumulates imag(a)*b; both are
+     * combined to the complex product after the loop over k */
+    __m256 acc_re[IFX_KERNELS_GEMM_MR];
+    __m256 acc_im[IFX_KERNELS_GEMM_MR];
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        acc_re[i] = acc_im[i] = _mm256_setzero_ps();
+
+    for (size_t l = 0; l < k; l++, a += 2 * IFX_KERNELS_GEMM_MR, b += 2 * IFX_KERNELS_GEMM_NR_C)
+    {
+        const __m256 bv = _mm256_loadu_ps(b);
+        for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        {
+            acc_re[i] = _mm256_fmadd_ps(_mm256_broadcast_ss(&a[i]), bv, acc_re[i]);
+            acc_im[i] = _mm256_fmadd_ps(_mm256_broadcast_ss(&a[IFX_KERNELS_GEMM_MR + i]), bv, acc_im[i]);
+        }
+    }
+
+    // (re, im) = acc_re + (-acc_im.im, acc_im.re)
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+    {
+        const __m256 swapped = _mm256_permute_ps(acc_im[i], 0xb1);
+        _mm256_storeu_ps((ifx_Float_t*)&ab[i * IFX_KERNELS_GEMM_NR_C], _mm256_addsub_ps(acc_re[i], swapped));
+    }
+}
+
+
+//----------------------------------------------------------------------------
+
+/* Unpack one pair of 12 bit samples (used for the tails) */
+static inline void unpack12_pair(const uint8_t* in, ifx_Kernel_Unpack12_t format, uint16_t* s0, uint16_t* s1)
+{
+    if (format == IFX_KERNEL_PACKED12)
+    {
+        *s0 = (uint16_t)((in[0] << 4) | (in[1] >> 4));
+        *s1 = (uint16_t)(((in[1] & 0x0f) << 8) | in[2]);
+    }
+    else
+    {
+        *s0 = (uint16_t)((in[0] << 4) | (in[2] & 0x0f));
+        *s1 = (uint16_t)((in[1] << 4) | (in[2] >> 4));
+    }
+}
+
+/* Shuffle and masks for unpacking 8 samples from 12 bytes
+ *
+ * The shuffle moves the two bytes containing each sample into its 16 bit
+ * lane, the sample is then (v >> 4) & mask_shift | v & mask. */
+typedef struct
+{
+    __m256i shuffle;
+    __m256i mask_shift;
+    __m256i mask;
+} unpack12_avx2_t;
+
+static inline unpack12_avx2_t unpack12_setup_avx2(ifx_Kernel_Unpack12_t format)
+{
+    unpack12_avx2_t u;
+    if (format == IFX_KERNEL_PACKED12)
+    {
+        // even lanes: b0 << 8 | b1, shifted; odd lanes: b1 << 8 | b2, masked
+        u.shuffle = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        u.mask_shift = _mm256_set1_epi32(0x0000ffff);
+        u.mask = _mm256_set1_epi32(0x0fff0000);
+    }
+    else
+    {
+        // even lanes: b0 << 8 | b2, shifted and masked; odd lanes: b1 << 8 | b2, shifted
+        u.shuffle = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 0, 2, 1, 5, 3, 5, 4, 8, 6, 8, 7, 11, 9, 11, 10));
+        u.mask_shift = _mm256_set1_epi32((int)0xffff0ff0);
+        u.mask = _mm256_set1_epi32(0x0000000f);
+    }
+    return u;
+}
+
+/* Unpack 16 samples from in[0..24); reads 28 bytes */
+static inline __m256i unpack12_16_avx2(const uint8_t* in, const unpack12_avx2_t* u)
+{
+    const __m128i lo = _mm_loadu_si128((const __m128i*)in);
+    const __m128i hi = _mm_loadu_si128((const __m128i*)(in + 12));
+    const __m256i v = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), u->shuffle);
+    return _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(v, 4), u->mask_shift), _mm256_and_si256(v, u->mask));
+}
+
+/* Unpack 8 samples from in[0..12); reads 16 bytes */
+static inline __m128i unpack12_8_avx2(const uint8_t* in, const unpack12_avx2_t* u)
+{
+    const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)in), _mm256_castsi256_si128(u->shuffle));
+    return _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 4), _mm256_castsi256_si128(u->mask_shift)),
+                        _mm_and_si128(v, _mm256_castsi256_si128(u->mask)));
+}
+
+/* Convert 8 unsigned 16 bit samples to float: s * scale + offset */
+static inline __m256 unpack12_to_float_avx2(__m128i s, __m256 scale, __m256 offset)
+{
+    const __m256 f = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(s));
+    return _mm256_add_ps(_mm256_mul_ps(f, scale), offset);
+}
+
+/* The vector loops stop early enough that no byte behind the input is read:
+ * 16 samples need 28 readable bytes (20 samples), 8 samples need 16 bytes
+ * (12 samples). */
+static void unpack12_u16_avx2(const uint8_t* in, uint16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    const unpack12_avx2_t u = unpack12_setup_avx2(format);
+
+    size_t i = 0;
+    for (; i + 20 <= n; i += 16)
+        _mm256_storeu_si256((__m256i*)&out[i], unpack12_16_avx2(&in[i / 2 * 3], &u));
+    for (; i + 12 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)&out[i], unpack12_8_avx2(&in[i / 2 * 3], &u));
+    for (; i + 2 <= n; i += 2)
+        unpack12_pair(&in[i / 2 * 3], format, &out[i], &out[i + 1]);
+}
+
+static void unpack12_s16_avx2(const uint8_t* in, int16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    const unpack12_avx2_t u = unpack12_setup_avx2(format);
+    const __m256i zero = _mm256_set1_epi16(2048);
+
+    size_t i = 0;
+    for (; i + 20 <= n; i += 16)
+        _mm256_storeu_si256((__m256i*)&out[i], _mm256_sub_epi16(unpack12_16_avx2(&in[i / 2 * 3], &u), zero));
+    for (; i + 12 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)&out[i], _mm_sub_epi16(unpack12_8_avx2(&in[i / 2 * 3], &u), _mm256_castsi256_si128(zero)));
+    for (; i + 2 <= n; i += 2)
+    {
+        uint16_t s0, s1;
+        unpack12_pair(&in[i / 2 * 3], format, &s0, &s1);
+        out[i] = (int16_t)(s0 - 2048);
+        out[i + 1] = (int16_t)(s1 - 2048);
+    }
+}
+
+static void unpack12_r_avx2(const uint8_t* in, ifx_Float_t* out, size_t n, ifx_Kernel_Unpack12_t format, ifx_Float_t scale, ifx_Float_t offset)
+{
+    const unpack12_avx2_t u = unpack12_setup_avx2(format);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 voffset = _mm256_set1_ps(offset);
+
+    size_t i = 0;
+    for (; i + 20 <= n; i += 16)
+    {
+        const __m256i s = unpack12_16_avx2(&in[i / 2 * 3], &u);
+        _mm256_storeu_ps(&out[i], unpack12_to_float_avx2(_mm256_castsi256_si128(s), vscale, voffset));
+        _mm256_storeu_ps(&out[i + 8], unpack12_to_float_avx2(_mm256_extracti128_si256(s, 1), vscale, voffset));
+    }
+    for (; i + 12 <= n; i += 8)
+        _mm256_storeu_ps(&out[i], unpack12_to_float_avx2(unpack12_8_avx2(&in[i / 2 * 3], &u), vscale, voffset));
+    for (; i + 2 <= n; i += 2)
+    {
+        uint16_t s0, s1;
+        unpack12_pair(&in[i / 2 * 3], format, &s0, &s1);
+        out[i] = (ifx_Float_t)s0 * scale + offset;
+        out[i + 1] = (ifx_Float_t)s1 * scale + offset;
+    }
+}
+
+static void mask12_r_avx2(const uint16_t* in, ifx_Float_t* out, size_t n, ifx_Float_t scale, ifx_Float_t offset)
+{
+    const __m256i mask = _mm256_set1_epi16(0x0fff);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 voffset = _mm256_set1_ps(offset);
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m256i s = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&in[i]), mask);
+        _mm256_storeu_ps(&out[i], unpack12_to_float_avx2(_mm256_castsi256_si128(s), vscale, voffset));
+        _mm256_storeu_ps(&out[i + 8], unpack12_to_float_avx2(_mm256_extracti128_si256(s, 1), vscale, voffset));
+    }
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m128i s = _mm_and_si128(_mm_loadu_si128((const __m128i*)&in[i]), _mm256_castsi256_si128(mask));
+        _mm256_storeu_ps(&out[i], unpack12_to_float_avx2(s, vscale, voffset));
+    }
+    for (; i < n; i++)
+        out[i] = (ifx_Float_t)(in[i] & 0x0fff) * scale + offset;
+}
+
+/* Convert 16 I/Q values from eight pairs stored stride uint16_t's apart.
+ * With an even stride all pairs are 32 bit aligned relative to each other
+ * and can be fetched with a single gather. */
+static void gather_iq_c_avx2(const uint16_t* in, size_t stride, ifx_Complex_t* out, size_t n, uint16_t mask, ifx_Float_t scale)
+{
+    const __m256i vmask = _mm256_set1_epi16((short)mask);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const int step = (int)(stride / 2);
+    const __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+    ifx_Float_t* dst = (ifx_Float_t*)out;
+
+    size_t i = 0;
+    if ((stride % 2) == 0 && stride <= 0x10000000)
+    {
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256i s = _mm256_and_si256(_mm256_i32gather_epi32((const int*)&in[i * stride], index, 4), vmask);
+            _mm256_storeu_ps(&dst[2 * i], _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(s))), vscale));
+            _mm256_storeu_ps(&dst[2 * i + 8], _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(s, 1))), vscale));
+        }
+    }
+    for (; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        IFX_COMPLEX_SET(out[i], (ifx_Float_t)(iq[0] & mask) * scale, (ifx_Float_t)(iq[1] & mask) * scale);
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_kernels_init_avx2(ifx_Kernels_t* kernels)
+{
+    kernels->isa = IFX_KERNEL_ISA_AVX2;
+    kernels->add_r = add_r_avx2;
+    kernels->sub_r = sub_r_avx2;
+    kernels->mul_r = mul_r_avx2;
+    kernels->add_rs = add_rs_avx2;
+    kernels->scale_r = scale_r_avx2;
+    kernels->mac_r = mac_r_avx2;
+    kernels->abs_r = abs_r_avx2;
+    kernels->sum_r = sum_r_avx2;
+    kernels->dot_r = dot_r_avx2;
+    kernels->mul_c = mul_c_avx2;
+    kernels->mul_cr = mul_cr_avx2;
+    kernels->add_cs = add_cs_avx2;
+    kernels->scale_c = scale_c_avx2;
+    kernels->mac_c = mac_c_avx2;
+    kernels->abs_c = abs_c_avx2;
+    kernels->sqnorm_c = sqnorm_c_avx2;
+    kernels->sum_c = sum_c_avx2;
+    kernels->deinterleave_c = deinterleave_c_avx2;
+    kernels->interleave_c = interleave_c_avx2;
+    kernels->abs_s = abs_s_avx2;
+    kernels->sqnorm_s = sqnorm_s_avx2;
+    kernels->scale_s = scale_s_avx2;
+    kernels->mac_s = mac_s_avx2;
+    kernels->gemm_r = gemm_r_avx2;
+    kernels->gemm_c = gemm_c_avx2;
+    kernels->unpack12_u16 = unpack12_u16_avx2;
+    kernels->unpack12_s16 = unpack12_s16_avx2;
+    kernels->unpack12_r = unpack12_r_avx2;
+    kernels->mask12_r = mask12_r_avx2;
+    kernels->gather_iq_c = gather_iq_c_avx2;
+}
+
+#endif /* IFX_KERNELS_HAVE_X86 */
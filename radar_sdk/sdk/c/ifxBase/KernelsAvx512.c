@@ -0,0 +1,247 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "Complex.h"
+#include "internal/Kernels.h"
+
+#ifdef IFX_KERNELS_HAVE_X86
+
+#include <immintrin.h>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* Elementwise loop over n floats processing 16 floats per iteration. The
+ * remaining floats are processed with a masked operation, so the body is
+ * written in terms of the mask m (all ones except for the last iteration). */
+#define AVX512_LOOP(n, body)                                           \
+    do                                                                 \
+    {                                                                  \
+        for (size_t i = 0; i < (n); i += 16)                           \
+        {                                                              \
+            const __mmask16 m = tail_mask((n) - i);                    \
+            body;                                                      \
+        }                                                              \
+    } while (0)
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+static inline __mmask16 tail_mask(size_t remaining)
+{
+    return remaining >= 16 ? (__mmask16)0xffff : (__mmask16)((1u << remaining) - 1);
+}
+
+/* Multiply two vectors containing eight interleaved complex numbers each. */
+static inline __m512 cmul_avx512(__m512 a, __m512 b)
+{
+    const __m512 b_re = _mm512_moveldup_ps(b);
+    const __m512 b_im = _mm512_movehdup_ps(b);
+    const __m512 a_swap = _mm512_permute_ps(a, 0xb1);
+    return _mm512_fmaddsub_ps(a, b_re, _mm512_mul_ps(a_swap, b_im));
+}
+
+/* |z|^2 of the 16 complex numbers stored in lo (z0..z7) and hi (z8..z15). */
+static inline __m512 sqnorm16_avx512(__m512 lo, __m512 hi)
+{
+    const __m512i even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    const __m512 sq_lo = _mm512_mul_ps(lo, lo);
+    const __m512 sq_hi = _mm512_mul_ps(hi, hi);
+    const __m512 re2 = _mm512_permutex2var_ps(sq_lo, even, sq_hi);
+    const __m512 im2 = _mm512_permutex2var_ps(sq_lo, odd, sq_hi);
+    return _mm512_add_ps(re2, im2);
+}
+
+//----------------------------------------------------------------------------
+
+static void add_r_avx512(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_add_ps(_mm512_maskz_loadu_ps(m, &a[i]), _mm512_maskz_loadu_ps(m, &b[i]))));
+}
+
+static void sub_r_avx512(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_sub_ps(_mm512_maskz_loadu_ps(m, &a[i]), _mm512_maskz_loadu_ps(m, &b[i]))));
+}
+
+static void mul_r_avx512(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_mul_ps(_mm512_maskz_loadu_ps(m, &a[i]), _mm512_maskz_loadu_ps(m, &b[i]))));
+}
+
+static void add_rs_avx512(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m512 vs = _mm512_set1_ps(s);
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_add_ps(_mm512_maskz_loadu_ps(m, &a[i]), vs)));
+}
+
+static void scale_r_avx512(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m512 vs = _mm512_set1_ps(s);
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_mul_ps(_mm512_maskz_loadu_ps(m, &a[i]), vs)));
+}
+
+static void mac_r_avx512(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m512 vs = _mm512_set1_ps(s);
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_fmadd_ps(vs, _mm512_maskz_loadu_ps(m, &b[i]), _mm512_maskz_loadu_ps(m, &a[i]))));
+}
+
+static void abs_r_avx512(const ifx_Float_t* a, ifx_Float_t* out, size_t n)
+{
+    AVX512_LOOP(n, _mm512_mask_storeu_ps(&out[i], m, _mm512_abs_ps(_mm512_maskz_loadu_ps(m, &a[i]))));
+}
+
+static ifx_Float_t dot_r_avx512(const ifx_Float_t* x, const ifx_Float_t* y, size_t len)
+{
+    __m512 vv0 = _mm512_setzero_ps();
+    __m512 vv1 = _mm512_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32)
+    {
+        vv0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i]), _mm512_loadu_ps(&y[i]), vv0);
+        vv1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i + 16]), _mm512_loadu_ps(&y[i + 16]), vv1);
+    }
+    for (; i < len; i += 16)
+    {
+        const __mmask16 m = tail_mask(len - i);
+        vv0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x[i]), _mm512_maskz_loadu_ps(m, &y[i]), vv0);
+    }
+
+    return _mm512_reduce_add_ps(_mm512_add_ps(vv0, vv1));
+}
+
+//----------------------------------------------------------------------------
+
+static void mul_c_avx512(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+    const size_t nf = 2 * n;
+
+    AVX512_LOOP(nf, _mm512_mask_storeu_ps(&po[i], m, cmul_avx512(_mm512_maskz_loadu_ps(m, &pa[i]), _mm512_maskz_loadu_ps(m, &pb[i]))));
+}
+
+static void scale_c_avx512(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const size_t nf = 2 * n;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m512 vs = _mm512_set4_ps(si, sr, si, sr);
+
+    AVX512_LOOP(nf, _mm512_mask_storeu_ps(&po[i], m, cmul_avx512(_mm512_maskz_loadu_ps(m, &pa[i]), vs)));
+}
+
+static void mac_c_avx512(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+    const size_t nf = 2 * n;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m512 vs = _mm512_set4_ps(si, sr, si, sr);
+
+    AVX512_LOOP(nf, _mm512_mask_storeu_ps(&po[i], m, _mm512_add_ps(_mm512_maskz_loadu_ps(m, &pa[i]), cmul_avx512(_mm512_maskz_loadu_ps(m, &pb[i]), vs))));
+}
+
+static void sqnorm_c_avx512(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    for (size_t i = 0; i < n; i += 16)
+    {
+        const size_t remaining = 2 * (n - i);
+        const __mmask16 m_lo = tail_mask(remaining);
+        const __mmask16 m_hi = tail_mask(remaining > 16 ? remaining - 16 : 0);
+        const __m512 lo = _mm512_maskz_loadu_ps(m_lo, &pa[2 * i]);
+        const __m512 hi = _mm512_maskz_loadu_ps(m_hi, &pa[2 * i + 16]);
+        _mm512_mask_storeu_ps(&out[i], tail_mask(n - i), sqnorm16_avx512(lo, hi));
+    }
+}
+
+static void abs_c_avx512(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    for (size_t i = 0; i < n; i += 16)
+    {
+        const size_t remaining = 2 * (n - i);
+        const __mmask16 m_lo = tail_mask(remaining);
+        const __mmask16 m_hi = tail_mask(remaining > 16 ? remaining - 16 : 0);
+        const __m512 lo = _mm512_maskz_loadu_ps(m_lo, &pa[2 * i]);
+        const __m512 hi = _mm512_maskz_loadu_ps(m_hi, &pa[2 * i + 16]);
+        _mm512_mask_storeu_ps(&out[i], tail_mask(n - i), _mm512_sqrt_ps(sqnorm16_avx512(lo, hi)));
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_kernels_init_avx512(ifx_Kernels_t* kernels)
+{
+    // sum_r, mul_cr, add_cs and sum_c are memory bound, so the AVX2
+    // versions are kept.
+    kernels->isa = IFX_KERNEL_ISA_AVX512;
+    kernels->add_r = add_r_avx512;
+    kernels->sub_r = sub_r_avx512;
+    kernels->mul_r = mul_r_avx512;
+    kernels->add_rs = add_rs_avx512;
+    kernels->scale_r = scale_r_avx512;
+    kernels->mac_r = mac_r_avx512;
+    kernels->abs_r = abs_r_avx512;
+    kernels->dot_r = dot_r_avx512;
+    kernels->mul_c = mul_c_avx512;
+    kernels->scale_c = scale_c_avx512;
+    kernels->mac_c = mac_c_avx512;
+    kernels->abs_c = abs_c_avx512;
+    kernels->sqnorm_c = sqnorm_c_avx512;
+}
+
+#endif /* IFX_KERNELS_HAVE_X86 */
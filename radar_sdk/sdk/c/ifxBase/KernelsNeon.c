@@ -0,0 +1,808 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "Complex.h"
+#include "internal/Kernels.h"
+
+#ifdef IFX_KERNELS_HAVE_NEON
+
+#include <arm_neon.h>
+#include <math.h>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* Elementwise loop over n floats: body processes 4 floats at index i using
+ * NEON, tail processes the remaining floats one by one. */
+#define NEON_LOOP(n, body, tail)     \
+    do                               \
+    {                                \
+        size_t i = 0;                \
+        for (; i + 4 <= (n); i += 4) \
+        {                            \
+            body;                    \
+        }                            \
+        for (; i < (n); i++)         \
+        {                            \
+            tail;                    \
+        }                            \
+    } while (0)
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+static void add_r_neon(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n, vst1q_f32(&out[i], vaddq_f32(vld1q_f32(&a[i]), vld1q_f32(&b[i]))),
+              out[i] = a[i] + b[i]);
+}
+
+static void sub_r_neon(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n, vst1q_f32(&out[i], vsubq_f32(vld1q_f32(&a[i]), vld1q_f32(&b[i]))),
+              out[i] = a[i] - b[i]);
+}
+
+static void mul_r_neon(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n, vst1q_f32(&out[i], vmulq_f32(vld1q_f32(&a[i]), vld1q_f32(&b[i]))),
+              out[i] = a[i] * b[i]);
+}
+
+static void add_rs_neon(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const float32x4_t vs = vdupq_n_f32(s);
+    NEON_LOOP(n, vst1q_f32(&out[i], vaddq_f32(vld1q_f32(&a[i]), vs)),
+              out[i] = a[i] + s);
+}
+
+static void scale_r_neon(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n, vst1q_f32(&out[i], vmulq_n_f32(vld1q_f32(&a[i]), s)),
+              out[i] = a[i] * s);
+}
+
+static void mac_r_neon(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n, vst1q_f32(&out[i], vfmaq_n_f32(vld1q_f32(&a[i]), vld1q_f32(&b[i]), s)),
+              out[i] = a[i] + s * b[i]);
+}
+
+static void abs_r_neon(const ifx_Float_t* a, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n, vst1q_f32(&out[i], vabsq_f32(vld1q_f32(&a[i]))),
+              out[i] = fabsf(a[i]));
+}
+
+static ifx_Float_t sum_r_neon(const ifx_Float_t* a, size_t n)
+{
+    // Kahan summation in each of the 4 lanes
+    float32x4_t sum = vdupq_n_f32(0);
+    float32x4_t c = vdupq_n_f32(0);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4_t y = vsubq_f32(vld1q_f32(&a[i]), c);
+        const float32x4_t t = vaddq_f32(sum, y);
+        c = vsubq_f32(vsubq_f32(t, sum), y);
+        sum = t;
+    }
+
+    float lanes[4];
+    float comp[4];
+    vst1q_f32(lanes, sum);
+    vst1q_f32(comp, c);
+
+    float s = 0;
+    float cs = 0;
+    for (int j = 0; j < 4; j++)
+    {
+        const float y = lanes[j] - (cs + comp[j]);
+        const float t = s + y;
+        cs = (t - s) - y;
+        s = t;
+    }
+    for (; i < n; i++)
+    {
+        const float y = a[i] - cs;
+        const float t = s + y;
+        cs = (t - s) - y;
+        s = t;
+    }
+
+    return s;
+}
+
+static ifx_Float_t dot_r_neon(const ifx_Float_t* x, const ifx_Float_t* y, size_t len)
+{
+    float32x4_t vv0 = vdupq_n_f32(0);
+    float32x4_t vv1 = vdupq_n_f32(0);
+
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        vv0 = vfmaq_f32(vv0, vld1q_f32(&x[i]), vld1q_f32(&y[i]));
+        vv1 = vfmaq_f32(vv1, vld1q_f32(&x[i + 4]), vld1q_f32(&y[i + 4]));
+    }
+
+    float v = vaddvq_f32(vaddq_f32(vv0, vv1));
+    for (; i < len; i++)
+        v += x[i] * y[i];
+
+    return v;
+}
+
+//----------------------------------------------------------------------------
+
+/* vld2q/vst2q deinterleave complex numbers into real and imaginary parts, so
+ * the complex kernels can work on split registers without shuffles. */
+
+static void mul_c_neon(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t va = vld2q_f32(&pa[2 * i]);
+        const float32x4x2_t vb = vld2q_f32(&pb[2 * i]);
+        float32x4x2_t r;
+        r.val[0] = vfmsq_f32(vmulq_f32(va.val[0], vb.val[0]), va.val[1], vb.val[1]);
+        r.val[1] = vfmaq_f32(vmulq_f32(va.val[0], vb.val[1]), va.val[1], vb.val[0]);
+        vst2q_f32(&po[2 * i], r);
+    }
+
+    for (; i < n; i++)
+    {
+        const float ar = pa[2 * i], ai = pa[2 * i + 1];
+        const float br = pb[2 * i], bi = pb[2 * i + 1];
+        po[2 * i] = ar * br - ai * bi;
+        po[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+static void mul_cr_neon(const ifx_Complex_t* a, const ifx_Float_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t va = vld2q_f32(&pa[2 * i]);
+        const float32x4_t vb = vld1q_f32(&b[i]);
+        float32x4x2_t r;
+        r.val[0] = vmulq_f32(va.val[0], vb);
+        r.val[1] = vmulq_f32(va.val[1], vb);
+        vst2q_f32(&po[2 * i], r);
+    }
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = pa[2 * i] * b[i];
+        po[2 * i + 1] = pa[2 * i + 1] * b[i];
+    }
+}
+
+static void scale_c_neon(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const float32x4_t vsi = vdupq_n_f32(si);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t va = vld2q_f32(&pa[2 * i]);
+        float32x4x2_t r;
+        r.val[0] = vfmsq_f32(vmulq_n_f32(va.val[0], sr), va.val[1], vsi);
+        r.val[1] = vfmaq_n_f32(vmulq_n_f32(va.val[0], si), va.val[1], sr);
+        vst2q_f32(&po[2 * i], r);
+    }
+
+    for (; i < n; i++)
+    {
+        const float ar = pa[2 * i], ai = pa[2 * i + 1];
+        po[2 * i] = ar * sr - ai * si;
+        po[2 * i + 1] = ar * si + ai * sr;
+    }
+}
+
+static void mac_c_neon(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const float32x4_t vsi = vdupq_n_f32(si);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t va = vld2q_f32(&pa[2 * i]);
+        const float32x4x2_t vb = vld2q_f32(&pb[2 * i]);
+        float32x4x2_t r;
+        r.val[0] = vfmsq_f32(vfmaq_n_f32(va.val[0], vb.val[0], sr), vb.val[1], vsi);
+        r.val[1] = vfmaq_n_f32(vfmaq_n_f32(va.val[1], vb.val[0], si), vb.val[1], sr);
+        vst2q_f32(&po[2 * i], r);
+    }
+
+    for (; i < n; i++)
+    {
+        const float br = pb[2 * i], bi = pb[2 * i + 1];
+        po[2 * i] = pa[2 * i] + (br * sr - bi * si);
+        po[2 * i + 1] = pa[2 * i + 1] + (br * si + bi * sr);
+    }
+}
+
+static void abs_c_neon(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t va = vld2q_f32(&pa[2 * i]);
+        const float32x4_t sq = vfmaq_f32(vmulq_f32(va.val[0], va.val[0]), va.val[1], va.val[1]);
+        vst1q_f32(&out[i], vsqrtq_f32(sq));
+    }
+
+    for (; i < n; i++)
+        out[i] = hypotf(pa[2 * i], pa[2 * i + 1]);
+}
+
+static void sqnorm_c_neon(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t va = vld2q_f32(&pa[2 * i]);
+        vst1q_f32(&out[i], vfmaq_f32(vmulq_f32(va.val[0], va.val[0]), va.val[1], va.val[1]));
+    }
+
+    for (; i < n; i++)
+        out[i] = pa[2 * i] * pa[2 * i] + pa[2 * i + 1] * pa[2 * i + 1];
+}
+
+static void deinterleave_c_neon(const ifx_Complex_t* a, ifx_Float_t* re, ifx_Float_t* im, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4x2_t z = vld2q_f32(&pa[2 * i]);
+        vst1q_f32(&re[i], z.val[0]);
+        vst1q_f32(&im[i], z.val[1]);
+    }
+
+    for (; i < n; i++)
+    {
+        re[i] = pa[2 * i];
+        im[i] = pa[2 * i + 1];
+    }
+}
+
+static void interleave_c_neon(const ifx_Float_t* re, const ifx_Float_t* im, ifx_Complex_t* out, size_t n)
+{
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        float32x4x2_t z;
+        z.val[0] = vld1q_f32(&re[i]);
+        z.val[1] = vld1q_f32(&im[i]);
+        vst2q_f32(&po[2 * i], z);
+    }
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = re[i];
+        po[2 * i + 1] = im[i];
+    }
+}
+
+static void abs_s_neon(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n,
+              {
+                  const float32x4_t vre = vld1q_f32(&a_re[i]);
+                  const float32x4_t vim = vld1q_f32(&a_im[i]);
+                  vst1q_f32(&out[i], vsqrtq_f32(vfmaq_f32(vmulq_f32(vim, vim), vre, vre)));
+              },
+              out[i] = hypotf(a_re[i], a_im[i]));
+}
+
+static void sqnorm_s_neon(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    NEON_LOOP(n,
+              {
+                  const float32x4_t vre = vld1q_f32(&a_re[i]);
+                  const float32x4_t vim = vld1q_f32(&a_im[i]);
+                  vst1q_f32(&out[i], vfmaq_f32(vmulq_f32(vim, vim), vre, vre));
+              },
+              out[i] = a_re[i] * a_re[i] + a_im[i] * a_im[i]);
+}
+
+static void scale_s_neon(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Complex_t s,
+                         ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const float32x4_t vsr = vdupq_n_f32(sr);
+    const float32x4_t vsi = vdupq_n_f32(si);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4_t ar = vld1q_f32(&a_re[i]);
+        const float32x4_t ai = vld1q_f32(&a_im[i]);
+        vst1q_f32(&out_re[i], vfmsq_f32(vmulq_f32(ar, vsr), ai, vsi));
+        vst1q_f32(&out_im[i], vfmaq_f32(vmulq_f32(ar, vsi), ai, vsr));
+    }
+
+    for (; i < n; i++)
+    {
+        const float ar = a_re[i], ai = a_im[i];
+        out_re[i] = ar * sr - ai * si;
+        out_im[i] = ar * si + ai * sr;
+    }
+}
+
+static void mac_s_neon(const ifx_Float_t* a_re, const ifx_Float_t* a_im,
+                       const ifx_Float_t* b_re, const ifx_Float_t* b_im, ifx_Complex_t s,
+                       ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const float32x4_t vsr = vdupq_n_f32(sr);
+    const float32x4_t vsi = vdupq_n_f32(si);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const float32x4_t br = vld1q_f32(&b_re[i]);
+        const float32x4_t bi = vld1q_f32(&b_im[i]);
+        const float32x4_t re = vfmsq_f32(vfmaq_f32(vld1q_f32(&a_re[i]), br, vsr), bi, vsi);
+        const float32x4_t im = vfmaq_f32(vfmaq_f32(vld1q_f32(&a_im[i]), br, vsi), bi, vsr);
+        vst1q_f32(&out_re[i], re);
+        vst1q_f32(&out_im[i], im);
+    }
+
+    for (; i < n; i++)
+    {
+        const float br = b_re[i], bi = b_im[i];
+        out_re[i] = a_re[i] + (br * sr - bi * si);
+        out_im[i] = a_im[i] + (br * si + bi * sr);
+    }
+}
+
+
+static void gemm_r_neon(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* ab)
+{
+    float32x4_t acc[IFX_KERNELS_GEMM_MR][2];
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        acc[i][0] = acc[i][1] = vdupq_n_f32(0);
+
+    for (size_t l = 0; l < k; l++, a += IFX_KERNELS_GEMM_MR, b += IFX_KERNELS_GEMM_NR)
+    {
+        const float32x4_t b0 = vld1q_f32(&b[0]);
+        const float32x4_t b1 = vld1q_f32(&b[4]);
+        for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        {
+            acc[i][0] = vfmaq_n_f32(acc[i][0], b0, a[i]);
+            acc[i][1] = vfmaq_n_f32(acc[i][1], b1, a[i]);
+        }
+    }
+
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+    {
+        vst1q_f32(&ab[i * IFX_KERNELS_GEMM_NR], acc[i][0]);
+        vst1q_f32(&ab[i * IFX_KERNELS_GEMM_NR + 4], acc[i][1]);
+    }
+}
+
+static void gemm_c_neon(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Complex_t* ab)
+{
+    /* acc_re accumulates real(a)*b, acc_im accumulates imag(a)*b; both are
+     * combined to the complex product after the loop over k */
+    float32x4_t acc_re[IFX_KERNELS_GEMM_MR][2];
+    float32x4_t acc_im[IFX_KERNELS_GEMM_MR][2];
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        acc_re[i][0] = acc_re[i][1] = acc_im[i][0] = acc_im[i][1] = vdupq_n_f32(0);
+
+    for (size_t l = 0; l < k; l++, a += 2 * IFX_KERNELS_GEMM_MR, b += 2 * IFX_KERNELS_GEMM_NR_C)
+    {
+        const float32x4_t b0 = vld1q_f32(&b[0]);
+        const float32x4_t b1 = vld1q_f32(&b[4]);
+        for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        {
+            const ifx_Float_t ar = a[i];
+            const ifx_Float_t ai = a[IFX_KERNELS_GEMM_MR + i];
+            acc_re[i][0] = vfmaq_n_f32(acc_re[i][0], b0, ar);
+            acc_re[i][1] = vfmaq_n_f32(acc_re[i][1], b1, ar);
+            acc_im[i][0] = vfmaq_n_f32(acc_im[i][0], b0, ai);
+            acc_im[i][1] = vfmaq_n_f32(acc_im[i][1], b1, ai);
+        }
+    }
+
+    // (re, im) = acc_re + (-acc_im.im, acc_im.re)
+    const float32_t sign_values[4] = {-1.0f, 1.0f, -1.0f, 1.0f};
+    const float32x4_t sign = vld1q_f32(sign_values);
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+    {
+        ifx_Float_t* out = (ifx_Float_t*)&ab[i * IFX_KERNELS_GEMM_NR_C];
+        for (size_t h = 0; h < 2; h++)
+            vst1q_f32(&out[4 * h], vfmaq_f32(acc_re[i][h], vrev64q_f32(acc_im[i][h]), sign));
+    }
+}
+
+
+/* Transpose in blocks of 4x4 floats; rows and columns not filling a complete
+ * block are handled one by one. */
+static void transpose_r_neon(const ifx_Float_t* in, size_t in_stride, ifx_Float_t* out, size_t out_stride, size_t rows, size_t cols)
+{
+    const size_t rows4 = rows & ~(size_t)3;
+    const size_t cols4 = cols & ~(size_t)3;
+
+    for (size_t j = 0; j < cols4; j += 4)
+    {
+        for (size_t i = 0; i < rows4; i += 4)
+        {
+            const float32x4_t r0 = vld1q_f32(&in[(j + 0) * in_stride + i]);
+            const float32x4_t r1 = vld1q_f32(&in[(j + 1) * in_stride + i]);
+            const float32x4_t r2 = vld1q_f32(&in[(j + 2) * in_stride + i]);
+            const float32x4_t r3 = vld1q_f32(&in[(j + 3) * in_stride + i]);
+
+            // transpose 2x2 blocks of floats, then 2x2 blocks of 64 bit pairs
+            const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+            const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+            const float64x2_t a0 = vreinterpretq_f64_f32(t01.val[0]);
+            const float64x2_t a1 = vreinterpretq_f64_f32(t01.val[1]);
+            const float64x2_t b0 = vreinterpretq_f64_f32(t23.val[0]);
+            const float64x2_t b1 = vreinterpretq_f64_f32(t23.val[1]);
+
+            vst1q_f32(&out[(i + 0) * out_stride + j], vreinterpretq_f32_f64(vzip1q_f64(a0, b0)));
+            vst1q_f32(&out[(i + 1) * out_stride + j], vreinterpretq_f32_f64(vzip1q_f64(a1, b1)));
+            vst1q_f32(&out[(i + 2) * out_stride + j], vreinterpretq_f32_f64(vzip2q_f64(a0, b0)));
+            vst1q_f32(&out[(i + 3) * out_stride + j], vreinterpretq_f32_f64(vzip2q_f64(a1, b1)));
+        }
+        for (size_t i = rows4; i < rows; i++)
+            for (size_t jj = j; jj < j + 4; jj++)
+                out[i * out_stride + jj] = in[jj * in_stride + i];
+    }
+
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = cols4; j < cols; j++)
+            out[i * out_stride + j] = in[j * in_stride + i];
+}
+
+/* Transpose in blocks of 2x2 complex numbers, each complex number is moved
+ * as one 64 bit value. */
+static void transpose_c_neon(const ifx_Complex_t* in, size_t in_stride, ifx_Complex_t* out, size_t out_stride, size_t rows, size_t cols)
+{
+    const size_t rows2 = rows & ~(size_t)1;
+    const size_t cols2 = cols & ~(size_t)1;
+
+    for (size_t j = 0; j < cols2; j += 2)
+    {
+        for (size_t i = 0; i < rows2; i += 2)
+        {
+            const float64x2_t r0 = vreinterpretq_f64_f32(vld1q_f32((const float*)&in[j * in_stride + i]));
+            const float64x2_t r1 = vreinterpretq_f64_f32(vld1q_f32((const float*)&in[(j + 1) * in_stride + i]));
+            vst1q_f32((float*)&out[i * out_stride + j], vreinterpretq_f32_f64(vzip1q_f64(r0, r1)));
+            vst1q_f32((float*)&out[(i + 1) * out_stride + j], vreinterpretq_f32_f64(vzip2q_f64(r0, r1)));
+        }
+        if (rows2 < rows)
+        {
+            out[rows2 * out_stride + j] = in[j * in_stride + rows2];
+            out[rows2 * out_stride + j + 1] = in[(j + 1) * in_stride + rows2];
+        }
+    }
+
+    if (cols2 < cols)
+    {
+        for (size_t i = 0; i < rows; i++)
+            out[i * out_stride + cols2] = in[cols2 * in_stride + i];
+    }
+}
+
+
+//----------------------------------------------------------------------------
+
+/* Unpack one pair of 12 bit samples (used for the tails) */
+static inline void unpack12_pair(const uint8_t* in, ifx_Kernel_Unpack12_t format, uint16_t* s0, uint16_t* s1)
+{
+    if (format == IFX_KERNEL_PACKED12)
+    {
+        *s0 = (uint16_t)((in[0] << 4) | (in[1] >> 4));
+        *s1 = (uint16_t)(((in[1] & 0x0f) << 8) | in[2]);
+    }
+    else
+    {
+        *s0 = (uint16_t)((in[0] << 4) | (in[2] & 0x0f));
+        *s1 = (uint16_t)((in[1] << 4) | (in[2] >> 4));
+    }
+}
+
+/* Table lookup and masks for unpacking 8 samples from 12 bytes
+ *
+ * The lookup moves the two bytes containing each sample into its 16 bit
+ * lane, the sample is then (v >> 4) & mask_shift | v & mask. */
+typedef struct
+{
+    uint8x16_t index;
+    uint16x8_t mask_shift;
+    uint16x8_t mask;
+} unpack12_neon_t;
+
+static inline unpack12_neon_t unpack12_setup_neon(ifx_Kernel_Unpack12_t format)
+{
+    static const uint8_t index_packed[16] = {1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10};
+    static const uint8_t index_raw[16] = {2, 0, 2, 1, 5, 3, 5, 4, 8, 6, 8, 7, 11, 9, 11, 10};
+
+    unpack12_neon_t u;
+    if (format == IFX_KERNEL_PACKED12)
+    {
+        u.index = vld1q_u8(index_packed);
+        u.mask_shift = vreinterpretq_u16_u32(vdupq_n_u32(0x0000ffff));
+        u.mask = vreinterpretq_u16_u32(vdupq_n_u32(0x0fff0000));
+    }
+    else
+    {
+        u.index = vld1q_u8(index_raw);
+        u.mask_shift = vreinterpretq_u16_u32(vdupq_n_u32(0xffff0ff0));
+        u.mask = vreinterpretq_u16_u32(vdupq_n_u32(0x0000000f));
+    }
+    return u;
+}
+
+/* Unpack 8 samples from in[0..12); reads 16 bytes */
+static inline uint16x8_t unpack12_8_neon(const uint8_t* in, const unpack12_neon_t* u)
+{
+    const uint16x8_t v = vreinterpretq_u16_u8(vqtbl1q_u8(vld1q_u8(in), u->index));
+    return vorrq_u16(vandq_u16(vshrq_n_u16(v, 4), u->mask_shift), vandq_u16(v, u->mask));
+}
+
+/* The vector loops stop early enough that no byte behind the input is read:
+ * 8 samples need 16 readable bytes (12 samples). */
+static void unpack12_u16_neon(const uint8_t* in, uint16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    const unpack12_neon_t u = unpack12_setup_neon(format);
+
+    size_t i = 0;
+    for (; i + 12 <= n; i += 8)
+        vst1q_u16(&out[i], unpack12_8_neon(&in[i / 2 * 3], &u));
+    for (; i + 2 <= n; i += 2)
+        unpack12_pair(&in[i / 2 * 3], format, &out[i], &out[i + 1]);
+}
+
+static void unpack12_s16_neon(const uint8_t* in, int16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    const unpack12_neon_t u = unpack12_setup_neon(format);
+    const uint16x8_t zero = vdupq_n_u16(2048);
+
+    size_t i = 0;
+    for (; i + 12 <= n; i += 8)
+        vst1q_s16(&out[i], vreinterpretq_s16_u16(vsubq_u16(unpack12_8_neon(&in[i / 2 * 3], &u), zero)));
+    for (; i + 2 <= n; i += 2)
+    {
+        uint16_t s0, s1;
+        unpack12_pair(&in[i / 2 * 3], format, &s0, &s1);
+        out[i] = (int16_t)(s0 - 2048);
+        out[i + 1] = (int16_t)(s1 - 2048);
+    }
+}
+
+static void unpack12_r_neon(const uint8_t* in, ifx_Float_t* out, size_t n, ifx_Kernel_Unpack12_t format, ifx_Float_t scale, ifx_Float_t offset)
+{
+    const unpack12_neon_t u = unpack12_setup_neon(format);
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t voffset = vdupq_n_f32(offset);
+
+    size_t i = 0;
+    for (; i + 12 <= n; i += 8)
+    {
+        const uint16x8_t s = unpack12_8_neon(&in[i / 2 * 3], &u);
+        const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(s)));
+        const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(s)));
+        vst1q_f32(&out[i], vaddq_f32(vmulq_f32(lo, vscale), voffset));
+        vst1q_f32(&out[i + 4], vaddq_f32(vmulq_f32(hi, vscale), voffset));
+    }
+    for (; i + 2 <= n; i += 2)
+    {
+        uint16_t s0, s1;
+        unpack12_pair(&in[i / 2 * 3], format, &s0, &s1);
+        out[i] = (ifx_Float_t)s0 * scale + offset;
+        out[i + 1] = (ifx_Float_t)s1 * scale + offset;
+    }
+}
+
+static void mask12_r_neon(const uint16_t* in, ifx_Float_t* out, size_t n, ifx_Float_t scale, ifx_Float_t offset)
+{
+    const uint16x8_t mask = vdupq_n_u16(0x0fff);
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t voffset = vdupq_n_f32(offset);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const uint16x8_t s = vandq_u16(vld1q_u16(&in[i]), mask);
+        const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(s)));
+        const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(s)));
+        vst1q_f32(&out[i], vaddq_f32(vmulq_f32(lo, vscale), voffset));
+        vst1q_f32(&out[i + 4], vaddq_f32(vmulq_f32(hi, vscale), voffset));
+    }
+    for (; i < n; i++)
+        out[i] = (ifx_Float_t)(in[i] & 0x0fff) * scale + offset;
+}
+
+/* The common layouts with two (only I/Q) or four values per sample are
+ * deinterleaved by the structure loads, other strides use the scalar loop. */
+static void gather_iq_c_neon(const uint16_t* in, size_t stride, ifx_Complex_t* out, size_t n, uint16_t mask, ifx_Float_t scale)
+{
+    const uint16x8_t vmask = vdupq_n_u16(mask);
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    ifx_Float_t* dst = (ifx_Float_t*)out;
+
+    size_t i = 0;
+    if (stride == 2 || stride == 4)
+    {
+        for (; i + 8 <= n; i += 8)
+        {
+            uint16x8_t s_i, s_q;
+            if (stride == 4)
+            {
+                const uint16x8x4_t v = vld4q_u16(&in[i * 4]);
+                s_i = vandq_u16(v.val[0], vmask);
+                s_q = vandq_u16(v.val[1], vmask);
+            }
+            else
+            {
+                const uint16x8x2_t v = vld2q_u16(&in[i * 2]);
+                s_i = vandq_u16(v.val[0], vmask);
+                s_q = vandq_u16(v.val[1], vmask);
+            }
+            float32x4x2_t lo, hi;
+            lo.val[0] = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(s_i))), vscale);
+            lo.val[1] = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(s_q))), vscale);
+            hi.val[0] = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(s_i))), vscale);
+            hi.val[1] = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(s_q))), vscale);
+            vst2q_f32(&dst[2 * i], lo);
+            vst2q_f32(&dst[2 * i + 8], hi);
+        }
+    }
+    for (; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        IFX_COMPLEX_SET(out[i], (ifx_Float_t)(iq[0] & mask) * scale, (ifx_Float_t)(iq[1] & mask) * scale);
+    }
+}
+
+static void gather_iq_s16_neon(const uint16_t* in, size_t stride, int16_t* out, size_t n, uint16_t mask, int shift)
+{
+    const uint16x8_t vmask = vdupq_n_u16(mask);
+    const int16x8_t vshift = vdupq_n_s16((int16_t)-shift);
+
+    size_t i = 0;
+    if (stride == 2 || stride == 4)
+    {
+        for (; i + 8 <= n; i += 8)
+        {
+            uint16x8_t s_i, s_q;
+            if (stride == 4)
+            {
+                const uint16x8x4_t v = vld4q_u16(&in[i * 4]);
+                s_i = v.val[0];
+                s_q = v.val[1];
+            }
+            else
+            {
+                const uint16x8x2_t v = vld2q_u16(&in[i * 2]);
+                s_i = v.val[0];
+                s_q = v.val[1];
+            }
+            int16x8x2_t s;
+            s.val[0] = vreinterpretq_s16_u16(vshlq_u16(vandq_u16(s_i, vmask), vshift));
+            s.val[1] = vreinterpretq_s16_u16(vshlq_u16(vandq_u16(s_q, vmask), vshift));
+            vst2q_s16(&out[2 * i], s);
+        }
+    }
+    for (; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        out[2 * i] = (int16_t)((iq[0] & mask) >> shift);
+        out[2 * i + 1] = (int16_t)((iq[1] & mask) >> shift);
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_kernels_init_neon(ifx_Kernels_t* kernels)
+{
+    kernels->isa = IFX_KERNEL_ISA_NEON;
+    kernels->add_r = add_r_neon;
+    kernels->sub_r = sub_r_neon;
+    kernels->mul_r = mul_r_neon;
+    kernels->add_rs = add_rs_neon;
+    kernels->scale_r = scale_r_neon;
+    kernels->mac_r = mac_r_neon;
+    kernels->abs_r = abs_r_neon;
+    kernels->sum_r = sum_r_neon;
+    kernels->dot_r = dot_r_neon;
+    kernels->mul_c = mul_c_neon;
+    kernels->mul_cr = mul_cr_neon;
+    kernels->scale_c = scale_c_neon;
+    kernels->mac_c = mac_c_neon;
+    kernels->abs_c = abs_c_neon;
+    kernels->sqnorm_c = sqnorm_c_neon;
+    kernels->deinterleave_c = deinterleave_c_neon;
+    kernels->interleave_c = interleave_c_neon;
+    kernels->abs_s = abs_s_neon;
+    kernels->sqnorm_s = sqnorm_s_neon;
+    kernels->scale_s = scale_s_neon;
+    kernels->mac_s = mac_s_neon;
+    kernels->gemm_r = gemm_r_neon;
+    kernels->gemm_c = gemm_c_neon;
+    kernels->transpose_r = transpose_r_neon;
+    kernels->transpose_c = transpose_c_neon;
+    kernels->unpack12_u16 = unpack12_u16_neon;
+    kernels->unpack12_s16 = unpack12_s16_neon;
+    kernels->unpack12_r = unpack12_r_neon;
+    kernels->mask12_r = mask12_r_neon;
+    kernels->gather_iq_c = gather_iq_c_neon;
+    kernels->gather_iq_s16 = gather_iq_s16_neon;
+}
+
+#endif /* IFX_KERNELS_HAVE_NEON */
@@ -0,0 +1,787 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "Complex.h"
+#include "internal/Kernels.h"
+#include "internal/Simd.h"
+
+#ifdef IFX_KERNELS_HAVE_X86
+
+#include <emmintrin.h>
+#include <math.h>
+#include <string.h>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* Elementwise loop over n floats: body processes 4 floats at index i using
+ * SSE2, tail processes the remaining floats one by one. */
+#define SSE2_LOOP(n, body, tail)           \
+    do                                     \
+    {                                      \
+        size_t i = 0;                      \
+        for (; i + 4 <= (n); i += 4)       \
+        {                                  \
+            body;                          \
+        }                                  \
+        for (; i < (n); i++)               \
+        {                                  \
+            tail;                          \
+        }                                  \
+    } while (0)
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/* Multiply two vectors containing two interleaved complex numbers each. */
+static inline __m128 cmul_sse2(__m128 a, __m128 b)
+{
+    const __m128 sign = _mm_castsi128_ps(_mm_set_epi32(0, (int)0x80000000, 0, (int)0x80000000));
+    const __m128 b_re = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128 b_im = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1));
+    const __m128 a_swap = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+
+    // (ar*br - ai*bi, ai*br + ar*bi)
+    return _mm_add_ps(_mm_mul_ps(a, b_re), _mm_xor_ps(_mm_mul_ps(a_swap, b_im), sign));
+}
+
+/* Horizontal sum of the squares of pairs: returns |z0|^2..|z3|^2 for the 4
+ * complex numbers stored in lo (z0, z1) and hi (z2, z3). */
+static inline __m128 sqnorm4_sse2(__m128 lo, __m128 hi)
+{
+    const __m128 sq_lo = _mm_mul_ps(lo, lo);
+    const __m128 sq_hi = _mm_mul_ps(hi, hi);
+    const __m128 even = _mm_shuffle_ps(sq_lo, sq_hi, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 odd = _mm_shuffle_ps(sq_lo, sq_hi, _MM_SHUFFLE(3, 1, 3, 1));
+    return _mm_add_ps(even, odd);
+}
+
+//----------------------------------------------------------------------------
+
+static void add_r_sse2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_add_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i]))),
+              out[i] = a[i] + b[i]);
+}
+
+static void sub_r_sse2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_sub_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i]))),
+              out[i] = a[i] - b[i]);
+}
+
+static void mul_r_sse2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n)
+{
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i]))),
+              out[i] = a[i] * b[i]);
+}
+
+static void add_rs_sse2(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m128 vs = _mm_set1_ps(s);
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_add_ps(_mm_loadu_ps(&a[i]), vs)),
+              out[i] = a[i] + s);
+}
+
+static void scale_r_sse2(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m128 vs = _mm_set1_ps(s);
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_mul_ps(_mm_loadu_ps(&a[i]), vs)),
+              out[i] = a[i] * s);
+}
+
+static void mac_r_sse2(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t s, ifx_Float_t* out, size_t n)
+{
+    const __m128 vs = _mm_set1_ps(s);
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_add_ps(_mm_loadu_ps(&a[i]), _mm_mul_ps(vs, _mm_loadu_ps(&b[i])))),
+              out[i] = a[i] + s * b[i]);
+}
+
+static void abs_r_sse2(const ifx_Float_t* a, ifx_Float_t* out, size_t n)
+{
+    const __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    SSE2_LOOP(n, _mm_storeu_ps(&out[i], _mm_and_ps(_mm_loadu_ps(&a[i]), mask)),
+              out[i] = fabsf(a[i]));
+}
+
+static ifx_Float_t sum_r_sse2(const ifx_Float_t* a, size_t n)
+{
+    // Kahan summation in each of the 4 lanes
+    __m128 sum = _mm_setzero_ps();
+    __m128 c = _mm_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 y = _mm_sub_ps(_mm_loadu_ps(&a[i]), c);
+        const __m128 t = _mm_add_ps(sum, y);
+        c = _mm_sub_ps(_mm_sub_ps(t, sum), y);
+        sum = t;
+    }
+
+    // combine the lanes and the remaining elements with scalar Kahan summation
+    float lanes[4];
+    float comp[4];
+    _mm_storeu_ps(lanes, sum);
+    _mm_storeu_ps(comp, c);
+
+    float s = 0;
+    float cs = 0;
+    for (int j = 0; j < 4; j++)
+    {
+        const float y = lanes[j] - (cs + comp[j]);
+        const float t = s + y;
+        cs = (t - s) - y;
+        s = t;
+    }
+    for (; i < n; i++)
+    {
+        const float y = a[i] - cs;
+        const float t = s + y;
+        cs = (t - s) - y;
+        s = t;
+    }
+
+    return s;
+}
+
+/**
+ * @brief Compute dot product between x and y
+ *
+ * Compute the dot product between the vectors x and y of length len. Use SSE2
+ * to speed up the computation as much as possible.
+ *
+ * @param [in]  x       array of len elements
+ * @param [in]  y       array of len elements
+ * @param [in]  len     length of arrays x and y
+ * @retval dot product between x and y
+ */
+static ifx_Float_t dot_r_sse2(const ifx_Float_t* x, const ifx_Float_t* y, size_t len)
+{
+    vf32x4 vv;
+
+    // len rounded down to the next integer divisable by 4
+    const size_t len_truncated4 = len & ~3;
+
+    // len rounded down to the next integer divisable by 16
+    const size_t len_truncated16 = len & ~15;
+
+    // Compute the dot product of the first len_truncated16 elements
+    {
+        vf32x4 vv0 = vf32x4_setzero();  // vv0 = 0
+        vf32x4 vv1 = vf32x4_setzero();  // vv1 = 0
+        vf32x4 vv2 = vf32x4_setzero();  // vv2 = 0
+        vf32x4 vv3 = vf32x4_setzero();  // vv3 = 0
+
+        // Compute the dot product using SSE2 instructions. Use four SSE2
+        // vectors with 4 elements each to utilize the CPU pipeline as much as
+        // possible.
+        for (size_t i = 0; i < len_truncated16; i += 16)
+        {
+            vf32x4 x0 = vf32x4_loadu(&x[i + 0]);
+            vf32x4 y0 = vf32x4_loadu(&y[i + 0]);
+
+            vf32x4 x1 = vf32x4_loadu(&x[i + 4]);
+            vf32x4 y1 = vf32x4_loadu(&y[i + 4]);
+
+            vf32x4 x2 = vf32x4_loadu(&x[i + 8]);
+            vf32x4 y2 = vf32x4_loadu(&y[i + 8]);
+
+            vf32x4 x3 = vf32x4_loadu(&x[i + 12]);
+            vf32x4 y3 = vf32x4_loadu(&y[i + 12]);
+
+            vf32x4 m0 = vf32x4_mul(x0, y0);  // x0*y0
+            vf32x4 m1 = vf32x4_mul(x1, y1);  // x1*y1
+            vf32x4 m2 = vf32x4_mul(x2, y2);  // x2*y2
+            vf32x4 m3 = vf32x4_mul(x3, y3);  // x3*y3
+
+            vv0 = vf32x4_add(vv0, m0);       // vv0 += x0*y0
+            vv1 = vf32x4_add(vv1, m1);       // vv1 += x1*y1
+            vv2 = vf32x4_add(vv2, m2);       // vv2 += x2*y2
+            vv3 = vf32x4_add(vv3, m3);       // vv3 += x3*y3
+        }
+
+        vf32x4 vv01 = vf32x4_add(vv0, vv1);  // vv01 = vv0 + vv1
+        vf32x4 vv23 = vf32x4_add(vv2, vv3);  // vv23 = vv2 + vv3
+
+        vv = vf32x4_add(vv01, vv23);         // vv = vv01 + vv23
+    }
+
+    for (size_t i = len_truncated16; i < len_truncated4; i += 4)
+    {
+        vf32x4 x0 = vf32x4_loadu(&x[i]);
+        vf32x4 y0 = vf32x4_loadu(&y[i]);
+
+        vv = vf32x4_mla(vv, x0, y0);  // vv += x0 + y0
+    }
+
+    // compute the sum of the vector vv
+    float v = vf32x4_extract1(vv, 0);
+    v += vf32x4_extract1(vv, 1);
+    v += vf32x4_extract1(vv, 2);
+    v += vf32x4_extract1(vv, 3);
+
+    // compute the dot element for the remaining elements
+    for (size_t i = len_truncated4; i < len; i++)
+    {
+        v += x[i] * y[i];
+    }
+
+    return v;
+}
+
+//----------------------------------------------------------------------------
+
+static void mul_c_sse2(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_ps(&po[2 * i], cmul_sse2(_mm_loadu_ps(&pa[2 * i]), _mm_loadu_ps(&pb[2 * i])));
+
+    for (; i < n; i++)
+    {
+        const float ar = pa[2 * i], ai = pa[2 * i + 1];
+        const float br = pb[2 * i], bi = pb[2 * i + 1];
+        po[2 * i] = ar * br - ai * bi;
+        po[2 * i + 1] = ar * bi + ai * br;
+    }
+}
+
+static void mul_cr_sse2(const ifx_Complex_t* a, const ifx_Float_t* b, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 vb = _mm_loadu_ps(&b[i]);
+        const __m128 b_lo = _mm_unpacklo_ps(vb, vb);  // b0 b0 b1 b1
+        const __m128 b_hi = _mm_unpackhi_ps(vb, vb);  // b2 b2 b3 b3
+        _mm_storeu_ps(&po[2 * i], _mm_mul_ps(_mm_loadu_ps(&pa[2 * i]), b_lo));
+        _mm_storeu_ps(&po[2 * i + 4], _mm_mul_ps(_mm_loadu_ps(&pa[2 * i + 4]), b_hi));
+    }
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = pa[2 * i] * b[i];
+        po[2 * i + 1] = pa[2 * i + 1] * b[i];
+    }
+}
+
+static void add_cs_sse2(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m128 vs = _mm_set_ps(si, sr, si, sr);
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_ps(&po[2 * i], _mm_add_ps(_mm_loadu_ps(&pa[2 * i]), vs));
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = pa[2 * i] + sr;
+        po[2 * i + 1] = pa[2 * i + 1] + si;
+    }
+}
+
+static void scale_c_sse2(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m128 vs = _mm_set_ps(si, sr, si, sr);
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_ps(&po[2 * i], cmul_sse2(_mm_loadu_ps(&pa[2 * i]), vs));
+
+    for (; i < n; i++)
+    {
+        const float ar = pa[2 * i], ai = pa[2 * i + 1];
+        po[2 * i] = ar * sr - ai * si;
+        po[2 * i + 1] = ar * si + ai * sr;
+    }
+}
+
+static void mac_c_sse2(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t s, ifx_Complex_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+    const float* pb = (const float*)b;
+    float* po = (float*)out;
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m128 vs = _mm_set_ps(si, sr, si, sr);
+
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        const __m128 prod = cmul_sse2(_mm_loadu_ps(&pb[2 * i]), vs);
+        _mm_storeu_ps(&po[2 * i], _mm_add_ps(_mm_loadu_ps(&pa[2 * i]), prod));
+    }
+
+    for (; i < n; i++)
+    {
+        const float br = pb[2 * i], bi = pb[2 * i + 1];
+        po[2 * i] = pa[2 * i] + (br * sr - bi * si);
+        po[2 * i + 1] = pa[2 * i + 1] + (br * si + bi * sr);
+    }
+}
+
+static void abs_c_sse2(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 sq = sqnorm4_sse2(_mm_loadu_ps(&pa[2 * i]), _mm_loadu_ps(&pa[2 * i + 4]));
+        _mm_storeu_ps(&out[i], _mm_sqrt_ps(sq));
+    }
+
+    for (; i < n; i++)
+        out[i] = hypotf(pa[2 * i], pa[2 * i + 1]);
+}
+
+static void sqnorm_c_sse2(const ifx_Complex_t* a, ifx_Float_t* out, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(&out[i], sqnorm4_sse2(_mm_loadu_ps(&pa[2 * i]), _mm_loadu_ps(&pa[2 * i + 4])));
+
+    for (; i < n; i++)
+        out[i] = pa[2 * i] * pa[2 * i] + pa[2 * i + 1] * pa[2 * i + 1];
+}
+
+static ifx_Complex_t sum_c_sse2(const ifx_Complex_t* a, size_t n)
+{
+    const float* pa = (const float*)a;
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_loadu_ps(&pa[2 * i]));
+        acc1 = _mm_add_ps(acc1, _mm_loadu_ps(&pa[2 * i + 4]));
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, _mm_add_ps(acc0, acc1));
+    float re = lanes[0] + lanes[2];
+    float im = lanes[1] + lanes[3];
+
+    for (; i < n; i++)
+    {
+        re += pa[2 * i];
+        im += pa[2 * i + 1];
+    }
+
+    ifx_Complex_t sum;
+    IFX_COMPLEX_SET(sum, re, im);
+    return sum;
+}
+
+static void deinterleave_c_sse2(const ifx_Complex_t* a, ifx_Float_t* re, ifx_Float_t* im, size_t n)
+{
+    const float* pa = (const float*)a;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 lo = _mm_loadu_ps(&pa[2 * i]);
+        const __m128 hi = _mm_loadu_ps(&pa[2 * i + 4]);
+        _mm_storeu_ps(&re[i], _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(&im[i], _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+
+    for (; i < n; i++)
+    {
+        re[i] = pa[2 * i];
+        im[i] = pa[2 * i + 1];
+    }
+}
+
+static void interleave_c_sse2(const ifx_Float_t* re, const ifx_Float_t* im, ifx_Complex_t* out, size_t n)
+{
+    float* po = (float*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 vre = _mm_loadu_ps(&re[i]);
+        const __m128 vim = _mm_loadu_ps(&im[i]);
+        _mm_storeu_ps(&po[2 * i], _mm_unpacklo_ps(vre, vim));
+        _mm_storeu_ps(&po[2 * i + 4], _mm_unpackhi_ps(vre, vim));
+    }
+
+    for (; i < n; i++)
+    {
+        po[2 * i] = re[i];
+        po[2 * i + 1] = im[i];
+    }
+}
+
+static void abs_s_sse2(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    SSE2_LOOP(n,
+              {
+                  const __m128 vre = _mm_loadu_ps(&a_re[i]);
+                  const __m128 vim = _mm_loadu_ps(&a_im[i]);
+                  _mm_storeu_ps(&out[i], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vre, vre), _mm_mul_ps(vim, vim))));
+              },
+              out[i] = hypotf(a_re[i], a_im[i]));
+}
+
+static void sqnorm_s_sse2(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n)
+{
+    SSE2_LOOP(n,
+              {
+                  const __m128 vre = _mm_loadu_ps(&a_re[i]);
+                  const __m128 vim = _mm_loadu_ps(&a_im[i]);
+                  _mm_storeu_ps(&out[i], _mm_add_ps(_mm_mul_ps(vre, vre), _mm_mul_ps(vim, vim)));
+              },
+              out[i] = a_re[i] * a_re[i] + a_im[i] * a_im[i]);
+}
+
+static void scale_s_sse2(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Complex_t s,
+                         ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m128 vsr = _mm_set1_ps(sr);
+    const __m128 vsi = _mm_set1_ps(si);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 ar = _mm_loadu_ps(&a_re[i]);
+        const __m128 ai = _mm_loadu_ps(&a_im[i]);
+        _mm_storeu_ps(&out_re[i], _mm_sub_ps(_mm_mul_ps(ar, vsr), _mm_mul_ps(ai, vsi)));
+        _mm_storeu_ps(&out_im[i], _mm_add_ps(_mm_mul_ps(ar, vsi), _mm_mul_ps(ai, vsr)));
+    }
+
+    for (; i < n; i++)
+    {
+        const float ar = a_re[i], ai = a_im[i];
+        out_re[i] = ar * sr - ai * si;
+        out_im[i] = ar * si + ai * sr;
+    }
+}
+
+static void mac_s_sse2(const ifx_Float_t* a_re, const ifx_Float_t* a_im,
+                       const ifx_Float_t* b_re, const ifx_Float_t* b_im, ifx_Complex_t s,
+                       ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n)
+{
+    const float sr = IFX_COMPLEX_REAL(s);
+    const float si = IFX_COMPLEX_IMAG(s);
+    const __m128 vsr = _mm_set1_ps(sr);
+    const __m128 vsi = _mm_set1_ps(si);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128 br = _mm_loadu_ps(&b_re[i]);
+        const __m128 bi = _mm_loadu_ps(&b_im[i]);
+        const __m128 re = _mm_sub_ps(_mm_mul_ps(br, vsr), _mm_mul_ps(bi, vsi));
+        const __m128 im = _mm_add_ps(_mm_mul_ps(br, vsi), _mm_mul_ps(bi, vsr));
+        _mm_storeu_ps(&out_re[i], _mm_add_ps(_mm_loadu_ps(&a_re[i]), re));
+        _mm_storeu_ps(&out_im[i], _mm_add_ps(_mm_loadu_ps(&a_im[i]), im));
+    }
+
+    for (; i < n; i++)
+    {
+        const float br = b_re[i], bi = b_im[i];
+        out_re[i] = a_re[i] + (br * sr - bi * si);
+        out_im[i] = a_im[i] + (br * si + bi * sr);
+    }
+}
+
+
+static void gemm_r_sse2(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* ab)
+{
+    __m128 acc[IFX_KERNELS_GEMM_MR][2];
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        acc[i][0] = acc[i][1] = _mm_setzero_ps();
+
+    for (size_t l = 0; l < k; l++, a += IFX_KERNELS_GEMM_MR, b += IFX_KERNELS_GEMM_NR)
+    {
+        const __m128 b0 = _mm_loadu_ps(&b[0]);
+        const __m128 b1 = _mm_loadu_ps(&b[4]);
+        for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        {
+            const __m128 ai = _mm_set1_ps(a[i]);
+            acc[i][0] = _mm_add_ps(acc[i][0], _mm_mul_ps(ai, b0));
+            acc[i][1] = _mm_add_ps(acc[i][1], _mm_mul_ps(ai, b1));
+        }
+    }
+
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+    {
+        _mm_storeu_ps(&ab[i * IFX_KERNELS_GEMM_NR], acc[i][0]);
+        _mm_storeu_ps(&ab[i * IFX_KERNELS_GEMM_NR + 4], acc[i][1]);
+    }
+}
+
+static void gemm_c_sse2(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Complex_t* ab)
+{
+    /* acc_re accumulates real(a)*b, acc_im accumulates imag(a)*b; both are
+     * combined to the complex product after the loop over k */
+    __m128 acc_re[IFX_KERNELS_GEMM_MR][2];
+    __m128 acc_im[IFX_KERNELS_GEMM_MR][2];
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        acc_re[i][0] = acc_re[i][1] = acc_im[i][0] = acc_im[i][1] = _mm_setzero_ps();
+
+    for (size_t l = 0; l < k; l++, a += 2 * IFX_KERNELS_GEMM_MR, b += 2 * IFX_KERNELS_GEMM_NR_C)
+    {
+        const __m128 b0 = _mm_loadu_ps(&b[0]);
+        const __m128 b1 = _mm_loadu_ps(&b[4]);
+        for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+        {
+            const __m128 ar = _mm_set1_ps(a[i]);
+            const __m128 ai = _mm_set1_ps(a[IFX_KERNELS_GEMM_MR + i]);
+            acc_re[i][0] = _mm_add_ps(acc_re[i][0], _mm_mul_ps(ar, b0));
+            acc_re[i][1] = _mm_add_ps(acc_re[i][1], _mm_mul_ps(ar, b1));
+            acc_im[i][0] = _mm_add_ps(acc_im[i][0], _mm_mul_ps(ai, b0));
+            acc_im[i][1] = _mm_add_ps(acc_im[i][1], _mm_mul_ps(ai, b1));
+        }
+    }
+
+    // (re, im) = acc_re + (-acc_im.im, acc_im.re)
+    const __m128 sign = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    for (size_t i = 0; i < IFX_KERNELS_GEMM_MR; i++)
+    {
+        ifx_Float_t* out = (ifx_Float_t*)&ab[i * IFX_KERNELS_GEMM_NR_C];
+        for (size_t h = 0; h < 2; h++)
+        {
+            const __m128 swapped = _mm_shuffle_ps(acc_im[i][h], acc_im[i][h], _MM_SHUFFLE(2, 3, 0, 1));
+            _mm_storeu_ps(&out[4 * h], _mm_add_ps(acc_re[i][h], _mm_xor_ps(swapped, sign)));
+        }
+    }
+}
+
+
+/* Transpose in blocks of 4x4 floats; rows and columns not filling a complete
+ * block are handled one by one. */
+static void transpose_r_sse2(const ifx_Float_t* in, size_t in_stride, ifx_Float_t* out, size_t out_stride, size_t rows, size_t cols)
+{
+    const size_t rows4 = rows & ~(size_t)3;
+    const size_t cols4 = cols & ~(size_t)3;
+
+    for (size_t j = 0; j < cols4; j += 4)
+    {
+        for (size_t i = 0; i < rows4; i += 4)
+        {
+            __m128 r0 = _mm_loadu_ps(&in[(j + 0) * in_stride + i]);
+            __m128 r1 = _mm_loadu_ps(&in[(j + 1) * in_stride + i]);
+            __m128 r2 = _mm_loadu_ps(&in[(j + 2) * in_stride + i]);
+            __m128 r3 = _mm_loadu_ps(&in[(j + 3) * in_stride + i]);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(&out[(i + 0) * out_stride + j], r0);
+            _mm_storeu_ps(&out[(i + 1) * out_stride + j], r1);
+            _mm_storeu_ps(&out[(i + 2) * out_stride + j], r2);
+            _mm_storeu_ps(&out[(i + 3) * out_stride + j], r3);
+        }
+        for (size_t i = rows4; i < rows; i++)
+            for (size_t jj = j; jj < j + 4; jj++)
+                out[i * out_stride + jj] = in[jj * in_stride + i];
+    }
+
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = cols4; j < cols; j++)
+            out[i * out_stride + j] = in[j * in_stride + i];
+}
+
+/* Transpose in blocks of 2x2 complex numbers, each complex number is moved
+ * as one 64 bit value. */
+static void transpose_c_sse2(const ifx_Complex_t* in, size_t in_stride, ifx_Complex_t* out, size_t out_stride, size_t rows, size_t cols)
+{
+    const size_t rows2 = rows & ~(size_t)1;
+    const size_t cols2 = cols & ~(size_t)1;
+
+    for (size_t j = 0; j < cols2; j += 2)
+    {
+        for (size_t i = 0; i < rows2; i += 2)
+        {
+            const __m128d r0 = _mm_loadu_pd((const double*)&in[j * in_stride + i]);
+            const __m128d r1 = _mm_loadu_pd((const double*)&in[(j + 1) * in_stride + i]);
+            _mm_storeu_pd((double*)&out[i * out_stride + j], _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd((double*)&out[(i + 1) * out_stride + j], _mm_unpackhi_pd(r0, r1));
+        }
+        if (rows2 < rows)
+        {
+            out[rows2 * out_stride + j] = in[j * in_stride + rows2];
+            out[rows2 * out_stride + j + 1] = in[(j + 1) * in_stride + rows2];
+        }
+    }
+
+    if (cols2 < cols)
+    {
+        for (size_t i = 0; i < rows; i++)
+            out[i * out_stride + cols2] = in[cols2 * in_stride + i];
+    }
+}
+
+//----------------------------------------------------------------------------
+
+static void mask12_r_sse2(const uint16_t* in, ifx_Float_t* out, size_t n, ifx_Float_t scale, ifx_Float_t offset)
+{
+    const __m128i mask = _mm_set1_epi16(0x0fff);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 voffset = _mm_set1_ps(offset);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m128i s = _mm_and_si128(_mm_loadu_si128((const __m128i*)&in[i]), mask);
+        const __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(s, zero));
+        const __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(s, zero));
+        _mm_storeu_ps(&out[i], _mm_add_ps(_mm_mul_ps(lo, vscale), voffset));
+        _mm_storeu_ps(&out[i + 4], _mm_add_ps(_mm_mul_ps(hi, vscale), voffset));
+    }
+    for (; i < n; i++)
+        out[i] = (ifx_Float_t)(in[i] & 0x0fff) * scale + offset;
+}
+
+/* Load four I/Q pairs stored stride uint16_t's apart */
+static inline __m128i load_iq4_sse2(const uint16_t* in, size_t stride)
+{
+    int32_t iq[4];
+    for (int k = 0; k < 4; k++)
+        memcpy(&iq[k], &in[k * stride], sizeof(int32_t));
+    return _mm_setr_epi32(iq[0], iq[1], iq[2], iq[3]);
+}
+
+static void gather_iq_c_sse2(const uint16_t* in, size_t stride, ifx_Complex_t* out, size_t n, uint16_t mask, ifx_Float_t scale)
+{
+    const __m128i vmask = _mm_set1_epi16((short)mask);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 vscale = _mm_set1_ps(scale);
+    ifx_Float_t* dst = (ifx_Float_t*)out;
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i s = _mm_and_si128(load_iq4_sse2(&in[i * stride], stride), vmask);
+        const __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(s, zero));
+        const __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(s, zero));
+        _mm_storeu_ps(&dst[2 * i], _mm_mul_ps(lo, vscale));
+        _mm_storeu_ps(&dst[2 * i + 4], _mm_mul_ps(hi, vscale));
+    }
+    for (; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        IFX_COMPLEX_SET(out[i], (ifx_Float_t)(iq[0] & mask) * scale, (ifx_Float_t)(iq[1] & mask) * scale);
+    }
+}
+
+static void gather_iq_s16_sse2(const uint16_t* in, size_t stride, int16_t* out, size_t n, uint16_t mask, int shift)
+{
+    const __m128i vmask = _mm_set1_epi16((short)mask);
+    const __m128i vshift = _mm_cvtsi32_si128(shift);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i s = _mm_and_si128(load_iq4_sse2(&in[i * stride], stride), vmask);
+        _mm_storeu_si128((__m128i*)&out[2 * i], _mm_srl_epi16(s, vshift));
+    }
+    for (; i < n; i++)
+    {
+        const uint16_t* iq = &in[i * stride];
+        out[2 * i] = (int16_t)((iq[0] & mask) >> shift);
+        out[2 * i + 1] = (int16_t)((iq[1] & mask) >> shift);
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_kernels_init_sse2(ifx_Kernels_t* kernels)
+{
+    kernels->isa = IFX_KERNEL_ISA_SSE2;
+    kernels->add_r = add_r_sse2;
+    kernels->sub_r = sub_r_sse2;
+    kernels->mul_r = mul_r_sse2;
+    kernels->add_rs = add_rs_sse2;
+    kernels->scale_r = scale_r_sse2;
+    kernels->mac_r = mac_r_sse2;
+    kernels->abs_r = abs_r_sse2;
+    kernels->sum_r = sum_r_sse2;
+    kernels->dot_r = dot_r_sse2;
+    kernels->mul_c = mul_c_sse2;
+    kernels->mul_cr = mul_cr_sse2;
+    kernels->add_cs = add_cs_sse2;
+    kernels->scale_c = scale_c_sse2;
+    kernels->mac_c = mac_c_sse2;
+    kernels->abs_c = abs_c_sse2;
+    kernels->sqnorm_c = sqnorm_c_sse2;
+    kernels->sum_c = sum_c_sse2;
+    kernels->deinterleave_c = deinterleave_c_sse2;
+    kernels->interleave_c = interleave_c_sse2;
+    kernels->abs_s = abs_s_sse2;
+    kernels->sqnorm_s = sqnorm_s_sse2;
+    kernels->scale_s = scale_s_sse2;
+    kernels->mac_s = mac_s_sse2;
+    kernels->gemm_r = gemm_r_sse2;
+    kernels->gemm_c = gemm_c_sse2;
+    kernels->transpose_r = transpose_r_sse2;
+    kernels->transpose_c = transpose_c_sse2;
+    kernels->mask12_r = mask12_r_sse2;
+    kernels->gather_iq_c = gather_iq_c_sse2;
+    kernels->gather_iq_s16 = gather_iq_s16_sse2;
+}
+
+#endif /* IFX_KERNELS_HAVE_X86 */
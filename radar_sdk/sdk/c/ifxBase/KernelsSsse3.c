@@ -0,0 +1,173 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "internal/Kernels.h"
+
+#ifdef IFX_KERNELS_HAVE_X86
+
+#include <tmmintrin.h>
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/* The 12 bit unpack kernels only need a byte shuffle (pshufb), which is the
+ * one instruction SSSE3 adds over SSE2. They follow the AVX2 kernels, but
+ * work on 8 samples at a time. */
+
+/* Unpack one pair of 12 bit samples (used for the tails) */
+static inline void unpack12_pair(const uint8_t* in, ifx_Kernel_Unpack12_t format, uint16_t* s0, uint16_t* s1)
+{
+    if (format == IFX_KERNEL_PACKED12)
+    {
+        *s0 = (uint16_t)((in[0] << 4) | (in[1] >> 4));
+        *s1 = (uint16_t)(((in[1] & 0x0f) << 8) | in[2]);
+    }
+    else
+    {
+        *s0 = (uint16_t)((in[0] << 4) | (in[2] & 0x0f));
+        *s1 = (uint16_t)((in[1] << 4) | (in[2] >> 4));
+    }
+}
+
+/* Shuffle and masks for unpacking 8 samples from 12 bytes, see KernelsAvx2.c */
+typedef struct
+{
+    __m128i shuffle;
+    __m128i mask_shift;
+    __m128i mask;
+} unpack12_ssse3_t;
+
+static inline unpack12_ssse3_t unpack12_setup_ssse3(ifx_Kernel_Unpack12_t format)
+{
+    unpack12_ssse3_t u;
+    if (format == IFX_KERNEL_PACKED12)
+    {
+        u.shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        u.mask_shift = _mm_set1_epi32(0x0000ffff);
+        u.mask = _mm_set1_epi32(0x0fff0000);
+    }
+    else
+    {
+        u.shuffle = _mm_setr_epi8(2, 0, 2, 1, 5, 3, 5, 4, 8, 6, 8, 7, 11, 9, 11, 10);
+        u.mask_shift = _mm_set1_epi32((int)0xffff0ff0);
+        u.mask = _mm_set1_epi32(0x0000000f);
+    }
+    return u;
+}
+
+/* Unpack 8 samples from in[0..12); reads 16 bytes */
+static inline __m128i unpack12_8_ssse3(const uint8_t* in, const unpack12_ssse3_t* u)
+{
+    const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)in), u->shuffle);
+    return _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 4), u->mask_shift), _mm_and_si128(v, u->mask));
+}
+
+/* Convert 4 unsigned 16 bit samples, zero extended to 32 bit, to float: s * scale + offset */
+static inline __m128 unpack12_to_float_ssse3(__m128i s, __m128 scale, __m128 offset)
+{
+    return _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(s), scale), offset);
+}
+
+/* The vector loops stop early enough that no byte behind the input is read:
+ * 8 samples need 16 readable bytes (12 samples). */
+static void unpack12_u16_ssse3(const uint8_t* in, uint16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    const unpack12_ssse3_t u = unpack12_setup_ssse3(format);
+
+    size_t i = 0;
+    for (; i + 12 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)&out[i], unpack12_8_ssse3(&in[i / 2 * 3], &u));
+    for (; i + 2 <= n; i += 2)
+        unpack12_pair(&in[i / 2 * 3], format, &out[i], &out[i + 1]);
+}
+
+static void unpack12_s16_ssse3(const uint8_t* in, int16_t* out, size_t n, ifx_Kernel_Unpack12_t format)
+{
+    const unpack12_ssse3_t u = unpack12_setup_ssse3(format);
+    const __m128i zero = _mm_set1_epi16(2048);
+
+    size_t i = 0;
+    for (; i + 12 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)&out[i], _mm_sub_epi16(unpack12_8_ssse3(&in[i / 2 * 3], &u), zero));
+    for (; i + 2 <= n; i += 2)
+    {
+        uint16_t s0, s1;
+        unpack12_pair(&in[i / 2 * 3], format, &s0, &s1);
+        out[i] = (int16_t)(s0 - 2048);
+        out[i + 1] = (int16_t)(s1 - 2048);
+    }
+}
+
+static void unpack12_r_ssse3(const uint8_t* in, ifx_Float_t* out, size_t n, ifx_Kernel_Unpack12_t format, ifx_Float_t scale, ifx_Float_t offset)
+{
+    const unpack12_ssse3_t u = unpack12_setup_ssse3(format);
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 voffset = _mm_set1_ps(offset);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 12 <= n; i += 8)
+    {
+        const __m128i s = unpack12_8_ssse3(&in[i / 2 * 3], &u);
+        _mm_storeu_ps(&out[i], unpack12_to_float_ssse3(_mm_unpacklo_epi16(s, zero), vscale, voffset));
+        _mm_storeu_ps(&out[i + 4], unpack12_to_float_ssse3(_mm_unpackhi_epi16(s, zero), vscale, voffset));
+    }
+    for (; i + 2 <= n; i += 2)
+    {
+        uint16_t s0, s1;
+        unpack12_pair(&in[i / 2 * 3], format, &s0, &s1);
+        out[i] = (ifx_Float_t)s0 * scale + offset;
+        out[i + 1] = (ifx_Float_t)s1 * scale + offset;
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_kernels_init_ssse3(ifx_Kernels_t* kernels)
+{
+    kernels->isa = IFX_KERNEL_ISA_SSSE3;
+    kernels->unpack12_u16 = unpack12_u16_ssse3;
+    kernels->unpack12_s16 = unpack12_s16_ssse3;
+    kernels->unpack12_r = unpack12_r_ssse3;
+}
+
+#endif /* IFX_KERNELS_HAVE_X86 */
@@ -44,6 +44,7 @@
 ==============================================================================
 */
 
+#include "Cube.h"
 #include "Matrix.h"
 #include "Types.h"
 
@@ -60,6 +61,9 @@ extern "C"
 ==============================================================================
 */
 
+/** Maximum matrix dimension supported by the batched functions */
+#define IFX_LA_BATCH_MAX_SIZE 16
+
 /*
 ==============================================================================
    3. TYPES
@@ -189,6 +193,79 @@ IFX_DLL_PUBLIC
 void ifx_la_determinant_c(const ifx_Matrix_C_t* A,
                           ifx_Complex_t* determinant);
 
+/**
+ * @brief Performs regularized Cholesky decompositions of a batch of matrices
+ *
+ * The cube A holds a batch of hermitian and positive definite N x N matrices
+ * A_s, one per slice, i.e., A has the dimensions N x N x batch (see
+ * \ref ifx_cube_get_slice_c). For each slice the Cholesky decomposition
+ * \f[
+ *      A_s + \lambda I = L_s L_s^\dagger
+ * \f]
+ * is computed and saved in the corresponding slice of L. Only the lower
+ * triangular part of A is read.
+ *
+ * The batch is processed several matrices at a time with kernels specialized
+ * for the matrix dimension. N must not be larger than
+ * \ref IFX_LA_BATCH_MAX_SIZE. A and L may use the split complex layout.
+ *
+ * If one of the regularized matrices is not positive definite,
+ * IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE is set after the complete batch
+ * was processed; the corresponding slice of L is undefined.
+ *
+ * @param [in]     A               cube of matrices (N x N x batch)
+ * @param [in]     regularization  value lambda added to the diagonal of A_s
+ * @param [out]    L               cube of lower triangular matrices (N x N x batch)
+ */
+IFX_DLL_PUBLIC
+void ifx_la_cholesky_batch_c(const ifx_Cube_C_t* A,
+                             ifx_Float_t regularization,
+                             ifx_Cube_C_t* L);
+
+/**
+ * @brief Solves a batch of regularized hermitian linear systems
+ *
+ * For each slice s of the cube A (N x N x batch) the linear system
+ * \f[
+ *      (A_s + \lambda I) x_s = b_s
+ * \f]
+ * is solved using the Cholesky decomposition. The right-hand sides b_s are
+ * the columns of B (N x batch), the solutions x_s are saved in the columns of
+ * X (N x batch). B and X may be the same matrix.
+ *
+ * See \ref ifx_la_cholesky_batch_c for the requirements on A and the error
+ * handling.
+ *
+ * @param [in]     A               cube of matrices (N x N x batch)
+ * @param [in]     regularization  value lambda added to the diagonal of A_s
+ * @param [in]     B               right-hand sides (N x batch)
+ * @param [out]    X               solutions (N x batch)
+ */
+IFX_DLL_PUBLIC
+void ifx_la_cholesky_solve_batch_c(const ifx_Cube_C_t* A,
+                                   ifx_Float_t regularization,
+                                   const ifx_Matrix_C_t* B,
+                                   ifx_Matrix_C_t* X);
+
+/**
+ * @brief Inverts a batch of regularized hermitian matrices
+ *
+ * For each slice s of the cube A (N x N x batch) the inverse
+ * \f$(A_s + \lambda I)^{-1}\f$ is computed using the Cholesky decomposition
+ * and saved in the corresponding slice of Ainv.
+ *
+ * See \ref ifx_la_cholesky_batch_c for the requirements on A and the error
+ * handling.
+ *
+ * @param [in]     A               cube of matrices (N x N x batch)
+ * @param [in]     regularization  value lambda added to the diagonal of A_s
+ * @param [out]    Ainv            cube of inverse matrices (N x N x batch)
+ */
+IFX_DLL_PUBLIC
+void ifx_la_invert_batch_c(const ifx_Cube_C_t* A,
+                           ifx_Float_t regularization,
+                           ifx_Cube_C_t* Ainv);
+
 /**
  * @}
  */
@@ -0,0 +1,538 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+#include "Cube.h"
+#include "Error.h"
+#include "LA.h"
+#include "Matrix.h"
+#include "internal/Macros.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* The batched functions process LANES matrices at a time. All arithmetic is
+ * written as loops over the lanes with a compile time trip count so that the
+ * compiler can vectorize across the batch dimension. */
+#define LANES 8
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+namespace {
+
+/* Element access to complex arrays in interleaved or split layout: the real
+ * part of the element at offset o is re[o * step], the imaginary part
+ * im[o * step]. */
+struct ComplexAccess
+{
+    ifx_Float_t* re;
+    ifx_Float_t* im;
+    size_t step;
+};
+
+/* LANES complex N x N matrices in split layout, lane index innermost */
+template <size_t N>
+struct Block
+{
+    ifx_Float_t re[N][N][LANES];
+    ifx_Float_t im[N][N][LANES];
+};
+
+/* LANES complex vectors of length N in split layout */
+template <size_t N>
+struct VecBlock
+{
+    ifx_Float_t re[N][LANES];
+    ifx_Float_t im[N][LANES];
+};
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+ComplexAccess complex_access(const ifx_Mda_C_t* mda)
+{
+    if (IFX_MDA_IS_SPLIT(mda))
+        return {IFX_MDA_REAL_DATA(mda), IFX_MDA_IMAG_DATA(mda), 1};
+
+    ifx_Float_t* re = IFX_MDA_REAL_DATA(mda);
+    return {re, re + 1, 2};
+}
+
+//----------------------------------------------------------------------------
+
+/* Load the lower triangle of the matrices in the slices s0, ..., s0+count-1
+ * and add lambda to the diagonal. Unused lanes are set to the identity
+ * matrix so that they never fail the decomposition. */
+template <size_t N>
+void load_lower(const ifx_Cube_C_t* A, size_t s0, size_t count, ifx_Float_t lambda, Block<N>& a)
+{
+    const ComplexAccess acc = complex_access(A);
+    const size_t* stride = IFX_MDA_STRIDE(A);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            for (size_t l = 0; l < LANES; l++)
+            {
+                if (l < count)
+                {
+                    const size_t o = (i * stride[0] + j * stride[1] + (s0 + l) * stride[2]) * acc.step;
+                    a.re[i][j][l] = acc.re[o];
+                    a.im[i][j][l] = acc.im[o];
+                }
+                else
+                {
+                    a.re[i][j][l] = (i == j) ? 1.0f : 0.0f;
+                    a.im[i][j][l] = 0;
+                }
+            }
+        }
+
+        for (size_t l = 0; l < LANES; l++)
+            a.re[i][i][l] += lambda;
+    }
+}
+
+/* Store the matrices of the first count lanes to the slices s0, ...; if
+ * lower_only is true the elements above the diagonal are set to 0. */
+template <size_t N>
+void store(const Block<N>& a, bool lower_only, size_t s0, size_t count, ifx_Cube_C_t* C)
+{
+    const ComplexAccess acc = complex_access(C);
+    const size_t* stride = IFX_MDA_STRIDE(C);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t j = 0; j < N; j++)
+        {
+            const bool zero = lower_only && j > i;
+            for (size_t l = 0; l < count; l++)
+            {
+                const size_t o = (i * stride[0] + j * stride[1] + (s0 + l) * stride[2]) * acc.step;
+                acc.re[o] = zero ? 0 : a.re[i][j][l];
+                acc.im[o] = zero ? 0 : a.im[i][j][l];
+            }
+        }
+    }
+}
+
+template <size_t N>
+void load_columns(const ifx_Matrix_C_t* B, size_t s0, size_t count, VecBlock<N>& b)
+{
+    const ComplexAccess acc = complex_access(B);
+    const size_t* stride = IFX_MDA_STRIDE(B);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t l = 0; l < LANES; l++)
+        {
+            const size_t o = (i * stride[0] + (s0 + l) * stride[1]) * acc.step;
+            b.re[i][l] = (l < count) ? acc.re[o] : 0;
+            b.im[i][l] = (l < count) ? acc.im[o] : 0;
+        }
+    }
+}
+
+template <size_t N>
+void store_columns(const VecBlock<N>& x, size_t s0, size_t count, ifx_Matrix_C_t* X)
+{
+    const ComplexAccess acc = complex_access(X);
+    const size_t* stride = IFX_MDA_STRIDE(X);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t l = 0; l < count; l++)
+        {
+            const size_t o = (i * stride[0] + (s0 + l) * stride[1]) * acc.step;
+            acc.re[o] = x.re[i][l];
+            acc.im[o] = x.im[i][l];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/* In-place Cholesky decomposition a = L L^H of the lower triangles. The
+ * reciprocals of the diagonal elements are saved in inv_diag. Returns false
+ * if one of the matrices is not positive definite. */
+template <size_t N>
+bool cholesky(Block<N>& a, ifx_Float_t (&inv_diag)[N][LANES])
+{
+    int ok = 1;
+
+    for (size_t j = 0; j < N; j++)
+    {
+        ifx_Float_t d[LANES];
+        for (size_t l = 0; l < LANES; l++)
+            d[l] = a.re[j][j][l];
+
+        for (size_t k = 0; k < j; k++)
+            for (size_t l = 0; l < LANES; l++)
+                d[l] -= a.re[j][k][l] * a.re[j][k][l] + a.im[j][k][l] * a.im[j][k][l];
+
+        for (size_t l = 0; l < LANES; l++)
+        {
+            ok &= (d[l] > 0);
+            const ifx_Float_t ljj = std::sqrt(d[l]);
+            a.re[j][j][l] = ljj;
+            a.im[j][j][l] = 0;
+            inv_diag[j][l] = 1 / ljj;
+        }
+
+        // L_ij = (A_ij - sum_k L_ik conj(L_jk)) / L_jj
+        for (size_t i = j + 1; i < N; i++)
+        {
+            ifx_Float_t sr[LANES], si[LANES];
+            for (size_t l = 0; l < LANES; l++)
+            {
+                sr[l] = a.re[i][j][l];
+                si[l] = a.im[i][j][l];
+            }
+
+            for (size_t k = 0; k < j; k++)
+            {
+                for (size_t l = 0; l < LANES; l++)
+                {
+                    const ifx_Float_t ar = a.re[i][k][l], ai = a.im[i][k][l];
+                    const ifx_Float_t br = a.re[j][k][l], bi = a.im[j][k][l];
+                    sr[l] -= ar * br + ai * bi;
+                    si[l] -= ai * br - ar * bi;
+                }
+            }
+
+            for (size_t l = 0; l < LANES; l++)
+            {
+                a.re[i][j][l] = sr[l] * inv_diag[j][l];
+                a.im[i][j][l] = si[l] * inv_diag[j][l];
+            }
+        }
+    }
+
+    return ok != 0;
+}
+
+/* Solve L L^H x = b in place */
+template <size_t N>
+void cholesky_solve(const Block<N>& L, const ifx_Float_t (&inv_diag)[N][LANES], VecBlock<N>& x)
+{
+    // forward substitution: L y = b
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t k = 0; k < i; k++)
+        {
+            for (size_t l = 0; l < LANES; l++)
+            {
+                const ifx_Float_t ar = L.re[i][k][l], ai = L.im[i][k][l];
+                const ifx_Float_t yr = x.re[k][l], yi = x.im[k][l];
+                x.re[i][l] -= ar * yr - ai * yi;
+                x.im[i][l] -= ar * yi + ai * yr;
+            }
+        }
+        for (size_t l = 0; l < LANES; l++)
+        {
+            x.re[i][l] *= inv_diag[i][l];
+            x.im[i][l] *= inv_diag[i][l];
+        }
+    }
+
+    // backward substitution: L^H x = y
+    for (size_t i = N; i-- > 0;)
+    {
+        for (size_t k = i + 1; k < N; k++)
+        {
+            for (size_t l = 0; l < LANES; l++)
+            {
+                // conj(L_ki) * x_k
+                const ifx_Float_t ar = L.re[k][i][l], ai = L.im[k][i][l];
+                const ifx_Float_t xr = x.re[k][l], xi = x.im[k][l];
+                x.re[i][l] -= ar * xr + ai * xi;
+                x.im[i][l] -= ar * xi - ai * xr;
+            }
+        }
+        for (size_t l = 0; l < LANES; l++)
+        {
+            x.re[i][l] *= inv_diag[i][l];
+            x.im[i][l] *= inv_diag[i][l];
+        }
+    }
+}
+
+/* Compute (L L^H)^-1 = W^H W with W = L^-1 */
+template <size_t N>
+void cholesky_invert(const Block<N>& L, const ifx_Float_t (&inv_diag)[N][LANES], Block<N>& inv)
+{
+    // W = L^-1 is lower triangular; it is stored in the lower triangle of inv
+    Block<N>& w = inv;
+    for (size_t j = 0; j < N; j++)
+    {
+        for (size_t l = 0; l < LANES; l++)
+        {
+            w.re[j][j][l] = inv_diag[j][l];
+            w.im[j][j][l] = 0;
+        }
+
+        // W_ij = -(sum_{k=j}^{i-1} L_ik W_kj) / L_ii
+        for (size_t i = j + 1; i < N; i++)
+        {
+            ifx_Float_t sr[LANES] = {}, si[LANES] = {};
+            for (size_t k = j; k < i; k++)
+            {
+                for (size_t l = 0; l < LANES; l++)
+                {
+                    const ifx_Float_t ar = L.re[i][k][l], ai = L.im[i][k][l];
+                    const ifx_Float_t br = w.re[k][j][l], bi = w.im[k][j][l];
+                    sr[l] += ar * br - ai * bi;
+                    si[l] += ar * bi + ai * br;
+                }
+            }
+            for (size_t l = 0; l < LANES; l++)
+            {
+                w.re[i][j][l] = -sr[l] * inv_diag[i][l];
+                w.im[i][j][l] = -si[l] * inv_diag[i][l];
+            }
+        }
+    }
+
+    /* inv_ij = sum_{k>=i} conj(W_ki) W_kj for i >= j. Row i of the result
+     * only needs rows k >= i of W, so computing the rows in increasing order
+     * allows overwriting W in place. */
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            ifx_Float_t sr[LANES] = {}, si[LANES] = {};
+            for (size_t k = i; k < N; k++)
+            {
+                for (size_t l = 0; l < LANES; l++)
+                {
+                    const ifx_Float_t ar = w.re[k][i][l], ai = w.im[k][i][l];
+                    const ifx_Float_t br = w.re[k][j][l], bi = w.im[k][j][l];
+                    sr[l] += ar * br + ai * bi;
+                    si[l] += ar * bi - ai * br;
+                }
+            }
+            for (size_t l = 0; l < LANES; l++)
+            {
+                w.re[i][j][l] = sr[l];
+                w.im[i][j][l] = si[l];
+            }
+        }
+    }
+
+    // mirror the lower triangle
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t l = 0; l < LANES; l++)
+            w.im[i][i][l] = 0;
+        for (size_t j = i + 1; j < N; j++)
+        {
+            for (size_t l = 0; l < LANES; l++)
+            {
+                w.re[i][j][l] = w.re[j][i][l];
+                w.im[i][j][l] = -w.im[j][i][l];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <size_t N>
+bool cholesky_batch(const ifx_Cube_C_t* A, ifx_Float_t lambda, ifx_Cube_C_t* L)
+{
+    const size_t batch = IFX_CUBE_SLICES(A);
+    bool ok = true;
+
+    for (size_t s0 = 0; s0 < batch; s0 += LANES)
+    {
+        const size_t count = std::min<size_t>(LANES, batch - s0);
+        Block<N> a;
+        ifx_Float_t inv_diag[N][LANES];
+
+        load_lower(A, s0, count, lambda, a);
+        ok &= cholesky(a, inv_diag);
+        store(a, true, s0, count, L);
+    }
+
+    return ok;
+}
+
+template <size_t N>
+bool solve_batch(const ifx_Cube_C_t* A, ifx_Float_t lambda, const ifx_Matrix_C_t* B, ifx_Matrix_C_t* X)
+{
+    const size_t batch = IFX_CUBE_SLICES(A);
+    bool ok = true;
+
+    for (size_t s0 = 0; s0 < batch; s0 += LANES)
+    {
+        const size_t count = std::min<size_t>(LANES, batch - s0);
+        Block<N> a;
+        VecBlock<N> x;
+        ifx_Float_t inv_diag[N][LANES];
+
+        load_lower(A, s0, count, lambda, a);
+        load_columns(B, s0, count, x);
+        ok &= cholesky(a, inv_diag);
+        cholesky_solve(a, inv_diag, x);
+        store_columns(x, s0, count, X);
+    }
+
+    return ok;
+}
+
+template <size_t N>
+bool invert_batch(const ifx_Cube_C_t* A, ifx_Float_t lambda, ifx_Cube_C_t* Ainv)
+{
+    const size_t batch = IFX_CUBE_SLICES(A);
+    bool ok = true;
+
+    for (size_t s0 = 0; s0 < batch; s0 += LANES)
+    {
+        const size_t count = std::min<size_t>(LANES, batch - s0);
+        Block<N> a;
+        Block<N> inv;
+        ifx_Float_t inv_diag[N][LANES];
+
+        load_lower(A, s0, count, lambda, a);
+        ok &= cholesky(a, inv_diag);
+        cholesky_invert(a, inv_diag, inv);
+        store(inv, false, s0, count, Ainv);
+    }
+
+    return ok;
+}
+
+//----------------------------------------------------------------------------
+
+/* Tables of the specializations for N = 1, ..., IFX_LA_BATCH_MAX_SIZE */
+using CholeskyFn = bool (*)(const ifx_Cube_C_t*, ifx_Float_t, ifx_Cube_C_t*);
+using SolveFn = bool (*)(const ifx_Cube_C_t*, ifx_Float_t, const ifx_Matrix_C_t*, ifx_Matrix_C_t*);
+
+template <size_t... I>
+constexpr std::array<CholeskyFn, sizeof...(I)> cholesky_table(std::index_sequence<I...>)
+{
+    return {{&cholesky_batch<I + 1>...}};
+}
+
+template <size_t... I>
+constexpr std::array<SolveFn, sizeof...(I)> solve_table(std::index_sequence<I...>)
+{
+    return {{&solve_batch<I + 1>...}};
+}
+
+template <size_t... I>
+constexpr std::array<CholeskyFn, sizeof...(I)> invert_table(std::index_sequence<I...>)
+{
+    return {{&invert_batch<I + 1>...}};
+}
+
+constexpr auto cholesky_fns = cholesky_table(std::make_index_sequence<IFX_LA_BATCH_MAX_SIZE>());
+constexpr auto solve_fns = solve_table(std::make_index_sequence<IFX_LA_BATCH_MAX_SIZE>());
+constexpr auto invert_fns = invert_table(std::make_index_sequence<IFX_LA_BATCH_MAX_SIZE>());
+
+}  // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_la_cholesky_batch_c(const ifx_Cube_C_t* A,
+                             ifx_Float_t regularization,
+                             ifx_Cube_C_t* L)
+{
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(A);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(L);
+    IFX_ERR_BRK_COND(IFX_CUBE_ROWS(A) != IFX_CUBE_COLS(A), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_CUBE_BRK_DIM(A, L);
+    IFX_ERR_BRK_ARGUMENT(IFX_CUBE_ROWS(A) == 0);
+    IFX_ERR_BRK_COND(IFX_CUBE_ROWS(A) > IFX_LA_BATCH_MAX_SIZE, IFX_ERROR_NOT_SUPPORTED);
+
+    if (!cholesky_fns[IFX_CUBE_ROWS(A) - 1](A, regularization, L))
+        ifx_error_set(IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_la_cholesky_solve_batch_c(const ifx_Cube_C_t* A,
+                                   ifx_Float_t regularization,
+                                   const ifx_Matrix_C_t* B,
+                                   ifx_Matrix_C_t* X)
+{
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(A);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(B);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(X);
+    IFX_ERR_BRK_COND(IFX_CUBE_ROWS(A) != IFX_CUBE_COLS(A), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(IFX_MAT_ROWS(B) != IFX_CUBE_ROWS(A) || IFX_MAT_COLS(B) != IFX_CUBE_SLICES(A), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_MAT_BRK_DIM(B, X);
+    IFX_ERR_BRK_ARGUMENT(IFX_CUBE_ROWS(A) == 0);
+    IFX_ERR_BRK_COND(IFX_CUBE_ROWS(A) > IFX_LA_BATCH_MAX_SIZE, IFX_ERROR_NOT_SUPPORTED);
+
+    if (!solve_fns[IFX_CUBE_ROWS(A) - 1](A, regularization, B, X))
+        ifx_error_set(IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_la_invert_batch_c(const ifx_Cube_C_t* A,
+                           ifx_Float_t regularization,
+                           ifx_Cube_C_t* Ainv)
+{
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(A);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(Ainv);
+    IFX_ERR_BRK_COND(IFX_CUBE_ROWS(A) != IFX_CUBE_COLS(A), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_CUBE_BRK_DIM(A, Ainv);
+    IFX_ERR_BRK_ARGUMENT(IFX_CUBE_ROWS(A) == 0);
+    IFX_ERR_BRK_COND(IFX_CUBE_ROWS(A) > IFX_LA_BATCH_MAX_SIZE, IFX_ERROR_NOT_SUPPORTED);
+
+    if (!invert_fns[IFX_CUBE_ROWS(A) - 1](A, regularization, Ainv))
+        ifx_error_set(IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE);
+}
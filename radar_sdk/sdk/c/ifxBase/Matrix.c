@@ -37,6 +37,8 @@
 #include "Complex.h"
 #include "Defines.h"
 #include "Error.h"
+#include "internal/Gemm.h"
+#include "internal/Kernels.h"
 #include "internal/Macros.h"
 #include "internal/Util.h"
 #include "Mda.h"
@@ -64,49 +66,202 @@
 #define MAT_CLONE(from, to) \
     MAT_COPY(from, to, 0, mRows(from), 0, mCols(from))
 
-#define MAT_TRANSPOSE(m, t)                     \
-    for (uint32_t i = 0; i < mRows(m); i++)     \
-    {                                           \
-        for (uint32_t j = 0; j < mCols(m); j++) \
-        {                                       \
-            mAt(t, j, i) = mAt(m, i, j);        \
-        }                                       \
-    }
-
-/* apply unary operator to all elements from mat and store in result */
-#define MAT_APPLY_UNOP(mat, op, result)                 \
-    do                                                  \
-    {                                                   \
-        IFX_MAT_BRK_VALID(mat);                         \
-        IFX_MAT_BRK_VALID(result);                      \
-        IFX_MAT_BRK_DIM(mat, result);                   \
-        for (uint32_t r = 0; r < mRows(mat); r++)       \
-        {                                               \
-            for (uint32_t c = 0; c < mCols(mat); c++)   \
-            {                                           \
-                mAt(result, r, c) = op(mAt(mat, r, c)); \
-            }                                           \
-        }                                               \
+/* true if the elements within each row of m are adjacent in memory */
+#define MAT_ROWS_CONTIGUOUS(m) (mStride(m, 1) == 1)
+
+/* true if all elements of m are adjacent in memory */
+#define MAT_CONTIGUOUS(m) (MAT_ROWS_CONTIGUOUS(m) && mStride(m, 0) == mCols(m))
+
+/* apply unary operator to all elements from mat and store in result
+ *
+ * If the rows of mat and result are contiguous the kernel is used instead of
+ * op. The kernel is called with (input, output, number of elements) and can
+ * access the kernel table through the local variable kernels.
+ */
+#define MAT_APPLY_UNOP(mat, op, kernel, result)                                          \
+    do                                                                                   \
+    {                                                                                    \
+        IFX_MAT_BRK_VALID(mat);                                                          \
+        IFX_MAT_BRK_VALID(result);                                                       \
+        IFX_MAT_BRK_DIM(mat, result);                                                    \
+        if (MAT_ROWS_CONTIGUOUS(mat) && MAT_ROWS_CONTIGUOUS(result))                     \
+        {                                                                                \
+            const ifx_Kernels_t* kernels = ifx_kernels_get();                            \
+            if (MAT_CONTIGUOUS(mat) && MAT_CONTIGUOUS(result))                           \
+            {                                                                            \
+                kernel(mDat(mat), mDat(result), mSize(mat));                             \
+                break;                                                                   \
+            }                                                                            \
+            for (uint32_t r = 0; r < mRows(mat); r++)                                    \
+            {                                                                            \
+                kernel(&mAt(mat, r, 0), &mAt(result, r, 0), mCols(mat));                 \
+            }                                                                            \
+            break;                                                                       \
+        }                                                                                \
+        for (uint32_t r = 0; r < mRows(mat); r++)                                        \
+        {                                                                                \
+            for (uint32_t c = 0; c < mCols(mat); c++)                                    \
+            {                                                                            \
+                mAt(result, r, c) = op(mAt(mat, r, c));                                  \
+            }                                                                            \
+        }                                                                                \
     } while (0)
 
-/* apply binary operator to all pairs of elements from lhs and rhs and store in result */
-#define MAT_APPLY_BINOP(lhs, op, rhs, result)                           \
-    do                                                                  \
-    {                                                                   \
-        IFX_MAT_BRK_VALID(lhs);                                         \
-        IFX_MAT_BRK_VALID(rhs);                                         \
-        IFX_MAT_BRK_VALID(result);                                      \
-        IFX_MAT_BRK_DIM(lhs, result);                                   \
-        IFX_MAT_BRK_DIM(lhs, rhs);                                      \
-        for (uint32_t r = 0; r < mRows(lhs); r++)                       \
-        {                                                               \
-            for (uint32_t c = 0; c < mCols(lhs); c++)                   \
-            {                                                           \
-                mAt(result, r, c) = op(mAt(lhs, r, c), mAt(rhs, r, c)); \
-            }                                                           \
-        }                                                               \
+/* apply binary operator to all pairs of elements from lhs and rhs and store in result
+ *
+ * If the rows of all matrices are contiguous the kernel is used instead of op.
+ * The kernel is called with (lhs, rhs, output, number of elements) and can
+ * access the kernel table through the local variable kernels.
+ */
+#define MAT_APPLY_BINOP(lhs, op, kernel, rhs, result)                                            \
+    do                                                                                           \
+    {                                                                                            \
+        IFX_MAT_BRK_VALID(lhs);                                                                  \
+        IFX_MAT_BRK_VALID(rhs);                                                                  \
+        IFX_MAT_BRK_VALID(result);                                                               \
+        IFX_MAT_BRK_DIM(lhs, result);                                                            \
+        IFX_MAT_BRK_DIM(lhs, rhs);                                                               \
+        if (MAT_ROWS_CONTIGUOUS(lhs) && MAT_ROWS_CONTIGUOUS(rhs) && MAT_ROWS_CONTIGUOUS(result)) \
+        {                                                                                        \
+            const ifx_Kernels_t* kernels = ifx_kernels_get();                                    \
+            if (MAT_CONTIGUOUS(lhs) && MAT_CONTIGUOUS(rhs) && MAT_CONTIGUOUS(result))            \
+            {                                                                                    \
+                kernel(mDat(lhs), mDat(rhs), mDat(result), mSize(lhs));                          \
+                break;                                                                           \
+            }                                                                                    \
+            for (uint32_t r = 0; r < mRows(lhs); r++)                                            \
+            {                                                                                    \
+                kernel(&mAt(lhs, r, 0), &mAt(rhs, r, 0), &mAt(result, r, 0), mCols(lhs));        \
+            }                                                                                    \
+            break;                                                                               \
+        }                                                                                        \
+        for (uint32_t r = 0; r < mRows(lhs); r++)                                                \
+        {                                                                                        \
+            for (uint32_t c = 0; c < mCols(lhs); c++)                                            \
+            {                                                                                    \
+                mAt(result, r, c) = op(mAt(lhs, r, c), mAt(rhs, r, c));                          \
+            }                                                                                    \
+        }                                                                                        \
     } while (0)
 
+/* reinterpret an array of complex numbers as array of floats */
+#define AS_FLOAT(ptr) ((ifx_Float_t*)(ptr))
+
+/* matrix m (or its transpose) as arguments for the functions in internal/Gemm.h */
+#define GEMM(m)   mDat(m), mStride(m, 0), mStride(m, 1)
+#define GEMM_T(m) mDat(m), mStride(m, 1), mStride(m, 0)
+
+/* real (part=0) or imaginary part (part=1) of the complex matrix m as
+ * arguments for the real functions in internal/Gemm.h */
+#define GEMM_PART(m, part)   AS_FLOAT(mDat(m)) + (part), 2 * mStride(m, 0), 2 * mStride(m, 1)
+#define GEMM_PART_T(m, part) AS_FLOAT(mDat(m)) + (part), 2 * mStride(m, 1), 2 * mStride(m, 0)
+
+/* true if a and b describe the same matrix (possibly different views) */
+#define SAME_MATRIX(a, b) (mDat(a) == mDat(b) && mRows(a) == mRows(b) && mCols(a) == mCols(b) \
+                           && mStride(a, 0) == mStride(b, 0) && mStride(a, 1) == mStride(b, 1))
+
+/* Matrices used by the split complex functions need to have the rows stored
+ * contiguously in both blocks to use the kernels. The helpers below loop
+ * over the rows, or process everything in one go if the matrices are fully
+ * contiguous, and fall back to element-wise loops otherwise. */
+
+static void mat_abs_split(const ifx_Matrix_C_t* input, ifx_Matrix_R_t* output)
+{
+    const ifx_Kernels_t* kernels = ifx_kernels_get();
+
+    if (MAT_CONTIGUOUS(input) && MAT_CONTIGUOUS(output))
+    {
+        kernels->abs_s(IFX_MDA_REAL_DATA(input), IFX_MDA_IMAG_DATA(input), mDat(output), mSize(input));
+        return;
+    }
+
+    for (uint32_t r = 0; r < mRows(input); r++)
+    {
+        if (MAT_ROWS_CONTIGUOUS(input) && MAT_ROWS_CONTIGUOUS(output))
+        {
+            kernels->abs_s(&mReAt(input, r, 0), &mImAt(input, r, 0), &mAt(output, r, 0), mCols(input));
+            continue;
+        }
+
+        for (uint32_t c = 0; c < mCols(input); c++)
+        {
+            const ifx_Complex_t z = IFX_COMPLEX_DEF(mReAt(input, r, c), mImAt(input, r, c));
+            mAt(output, r, c) = ifx_complex_abs(z);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+static void mat_scale_split(const ifx_Matrix_C_t* input, ifx_Complex_t scale, ifx_Matrix_C_t* output)
+{
+    const ifx_Kernels_t* kernels = ifx_kernels_get();
+
+    if (MAT_CONTIGUOUS(input) && MAT_CONTIGUOUS(output))
+    {
+        kernels->scale_s(IFX_MDA_REAL_DATA(input), IFX_MDA_IMAG_DATA(input), scale,
+                         IFX_MDA_REAL_DATA(output), IFX_MDA_IMAG_DATA(output), mSize(input));
+        return;
+    }
+
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(scale);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(scale);
+
+    for (uint32_t r = 0; r < mRows(input); r++)
+    {
+        if (MAT_ROWS_CONTIGUOUS(input) && MAT_ROWS_CONTIGUOUS(output))
+        {
+            kernels->scale_s(&mReAt(input, r, 0), &mImAt(input, r, 0), scale,
+                             &mReAt(output, r, 0), &mImAt(output, r, 0), mCols(input));
+            continue;
+        }
+
+        for (uint32_t c = 0; c < mCols(input); c++)
+        {
+            const ifx_Float_t re = mReAt(input, r, c);
+            const ifx_Float_t im = mImAt(input, r, c);
+            mReAt(output, r, c) = re * sr - im * si;
+            mImAt(output, r, c) = re * si + im * sr;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+static void mat_mac_split(const ifx_Matrix_C_t* m1, const ifx_Matrix_C_t* m2, ifx_Complex_t scale, ifx_Matrix_C_t* output)
+{
+    const ifx_Kernels_t* kernels = ifx_kernels_get();
+
+    if (MAT_CONTIGUOUS(m1) && MAT_CONTIGUOUS(m2) && MAT_CONTIGUOUS(output))
+    {
+        kernels->mac_s(IFX_MDA_REAL_DATA(m1), IFX_MDA_IMAG_DATA(m1),
+                       IFX_MDA_REAL_DATA(m2), IFX_MDA_IMAG_DATA(m2), scale,
+                       IFX_MDA_REAL_DATA(output), IFX_MDA_IMAG_DATA(output), mSize(m1));
+        return;
+    }
+
+    const ifx_Float_t sr = IFX_COMPLEX_REAL(scale);
+    const ifx_Float_t si = IFX_COMPLEX_IMAG(scale);
+
+    for (uint32_t r = 0; r < mRows(m1); r++)
+    {
+        if (MAT_ROWS_CONTIGUOUS(m1) && MAT_ROWS_CONTIGUOUS(m2) && MAT_ROWS_CONTIGUOUS(output))
+        {
+            kernels->mac_s(&mReAt(m1, r, 0), &mImAt(m1, r, 0),
+                           &mReAt(m2, r, 0), &mImAt(m2, r, 0), scale,
+                           &mReAt(output, r, 0), &mImAt(output, r, 0), mCols(m1));
+            continue;
+        }
+
+        for (uint32_t c = 0; c < mCols(m1); c++)
+        {
+            const ifx_Float_t re = mReAt(m2, r, c);
+            const ifx_Float_t im = mImAt(m2, r, c);
+            mReAt(output, r, c) = mReAt(m1, r, c) + (re * sr - im * si);
+            mImAt(output, r, c) = mImAt(m1, r, c) + (re * si + im * sr);
+        }
+    }
+}
 
 /*
 ==============================================================================
@@ -171,7 +326,7 @@ void ifx_mat_view_c(ifx_Matrix_C_t* matrix,
                     uint32_t columns)
 {
     IFX_ERR_BRK_NULL(matrix);
-    IFX_MAT_BRK_VALID(source);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(source);
 
     IFX_MDA_VIEW_C(matrix, source, IFX_MDA_SLICE(row_offset, row_offset + rows, 1), IFX_MDA_SLICE(column_offset, column_offset + columns, 1));
 }
@@ -220,6 +375,17 @@ ifx_Matrix_C_t* ifx_mat_create_c(uint32_t rows,
 
 //----------------------------------------------------------------------------
 
+ifx_Matrix_C_t* ifx_mat_create_split_c(uint32_t rows,
+                                       uint32_t columns)
+{
+    ifx_Matrix_C_t* mat = IFX_MDA_CREATE_SPLIT_C(rows, columns);
+    if (mat)
+        ifx_mda_clear_c(mat);
+    return mat;
+}
+
+//----------------------------------------------------------------------------
+
 void ifx_mat_destroy_r(ifx_Matrix_R_t* matrix)
 {
     ifx_mda_destroy_r(matrix);
@@ -282,8 +448,16 @@ void ifx_mat_copy_r(const ifx_Matrix_R_t* from,
 void ifx_mat_copy_c(const ifx_Matrix_C_t* from,
                     ifx_Matrix_C_t* to)
 {
-    IFX_MAT_BRK_VALID(from);
-    IFX_MAT_BRK_VALID(to);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(from);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(to);
+
+    if (IFX_MDA_IS_SPLIT(from) || IFX_MDA_IS_SPLIT(to))
+    {
+        // ifx_mda_copy_c converts between the layouts
+        IFX_MAT_BRK_DIM(from, to);
+        ifx_mda_copy_c(from, to);
+        return;
+    }
 
     ifx_mat_blit_c(from, 0, mRows(from), 0, mCols(from), to);
 }
@@ -380,9 +554,17 @@ void ifx_mat_get_rowview_c(const ifx_Matrix_C_t* matrix,
                            uint32_t row_index,
                            ifx_Vector_C_t* row_view)
 {
-    IFX_MAT_BRK_VALID(matrix);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(matrix);
     IFX_ERR_BRK_NULL(row_view);
 
+    if (IFX_MDA_IS_SPLIT(matrix))
+    {
+        const size_t stride = mStride(matrix, 1);
+        ifx_mda_rawview_split_c(row_view, &IFX_MDA_REAL_AT(matrix, row_index, 0), &IFX_MDA_IMAG_AT(matrix, row_index, 0),
+                                1, &mCols(matrix), &stride);
+        return;
+    }
+
     ifx_vec_rawview_c(row_view, &mAt(matrix, row_index, 0), mCols(matrix), (uint32_t)mStride(matrix, 1));
 }
 
@@ -404,9 +586,17 @@ void ifx_mat_get_colview_c(const ifx_Matrix_C_t* matrix,
                            uint32_t col_index,
                            ifx_Vector_C_t* col_view)
 {
-    IFX_MAT_BRK_VALID(matrix);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(matrix);
     IFX_ERR_BRK_NULL(col_view);
 
+    if (IFX_MDA_IS_SPLIT(matrix))
+    {
+        const size_t stride = mStride(matrix, 0);
+        ifx_mda_rawview_split_c(col_view, &IFX_MDA_REAL_AT(matrix, 0, col_index), &IFX_MDA_IMAG_AT(matrix, 0, col_index),
+                                1, &mRows(matrix), &stride);
+        return;
+    }
+
     ifx_vec_rawview_c(col_view, &mAt(matrix, 0, col_index), mRows(matrix), (uint32_t)mStride(matrix, 0));
 }
 
@@ -421,7 +611,10 @@ void ifx_mat_transpose_r(const ifx_Matrix_R_t* matrix,
     IFX_ERR_BRK_COND(mRows(matrix) != mCols(transposed), IFX_ERROR_DIMENSION_MISMATCH);
     IFX_ERR_BRK_COND(mCols(matrix) != mRows(transposed), IFX_ERROR_DIMENSION_MISMATCH);
 
-    MAT_TRANSPOSE(matrix, transposed);
+    // copying the transposed view uses the tiled transpose kernels
+    ifx_Matrix_R_t view;
+    ifx_mda_transpose_r(&view, matrix);
+    ifx_mda_copy_r(&view, transposed);
 }
 
 //----------------------------------------------------------------------------
@@ -435,7 +628,9 @@ void ifx_mat_transpose_c(const ifx_Matrix_C_t* matrix,
     IFX_ERR_BRK_COND(mRows(matrix) != mCols(transposed), IFX_ERROR_DIMENSION_MISMATCH);
     IFX_ERR_BRK_COND(mCols(matrix) != mRows(transposed), IFX_ERROR_DIMENSION_MISMATCH);
 
-    MAT_TRANSPOSE(matrix, transposed);
+    ifx_Matrix_C_t view;
+    ifx_mda_transpose_c(&view, matrix);
+    ifx_mda_copy_c(&view, transposed);
 }
 
 //----------------------------------------------------------------------------
@@ -445,7 +640,9 @@ void ifx_mat_add_r(const ifx_Matrix_R_t* matrix_l,
                    ifx_Matrix_R_t* result)
 {
 #define OP(a, b) ((a) + (b))
-    MAT_APPLY_BINOP(matrix_l, OP, matrix_r, result);
+#define KERNEL(a, b, out, n) kernels->add_r(a, b, out, n)
+    MAT_APPLY_BINOP(matrix_l, OP, KERNEL, matrix_r, result);
+#undef KERNEL
 #undef OP
 }
 
@@ -456,7 +653,9 @@ void ifx_mat_add_rs(const ifx_Matrix_R_t* input,
                     ifx_Matrix_R_t* output)
 {
 #define OP(elem) ((elem) + scalar)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->add_rs(a, scalar, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -467,7 +666,9 @@ void ifx_mat_add_c(const ifx_Matrix_C_t* matrix_l,
                    ifx_Matrix_C_t* result)
 {
 #define OP(a, b) ifx_complex_add((a), (b))
-    MAT_APPLY_BINOP(matrix_l, OP, matrix_r, result);
+#define KERNEL(a, b, out, n) kernels->add_r(AS_FLOAT(a), AS_FLOAT(b), AS_FLOAT(out), 2 * (n))
+    MAT_APPLY_BINOP(matrix_l, OP, KERNEL, matrix_r, result);
+#undef KERNEL
 #undef OP
 }
 
@@ -478,7 +679,9 @@ void ifx_mat_add_cs(const ifx_Matrix_C_t* input,
                     ifx_Matrix_C_t* output)
 {
 #define OP(elem) ifx_complex_add(elem, scalar)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->add_cs(a, scalar, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -489,7 +692,9 @@ void ifx_mat_sub_r(const ifx_Matrix_R_t* matrix_l,
                    ifx_Matrix_R_t* result)
 {
 #define OP(a, b) ((a) - (b))
-    MAT_APPLY_BINOP(matrix_l, OP, matrix_r, result);
+#define KERNEL(a, b, out, n) kernels->sub_r(a, b, out, n)
+    MAT_APPLY_BINOP(matrix_l, OP, KERNEL, matrix_r, result);
+#undef KERNEL
 #undef OP
 }
 
@@ -500,7 +705,9 @@ void ifx_mat_sub_rs(const ifx_Matrix_R_t* input,
                     ifx_Matrix_R_t* output)
 {
 #define OP(elem) ((elem)-scalar)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->add_rs(a, -scalar, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -511,7 +718,9 @@ void ifx_mat_sub_c(const ifx_Matrix_C_t* matrix_l,
                    ifx_Matrix_C_t* result)
 {
 #define OP(a, b) ifx_complex_sub((a), (b))
-    MAT_APPLY_BINOP(matrix_l, OP, matrix_r, result);
+#define KERNEL(a, b, out, n) kernels->sub_r(AS_FLOAT(a), AS_FLOAT(b), AS_FLOAT(out), 2 * (n))
+    MAT_APPLY_BINOP(matrix_l, OP, KERNEL, matrix_r, result);
+#undef KERNEL
 #undef OP
 }
 
@@ -521,8 +730,12 @@ void ifx_mat_sub_cs(const ifx_Matrix_C_t* input,
                     ifx_Complex_t scalar,
                     ifx_Matrix_C_t* output)
 {
+    const ifx_Complex_t neg_scalar = IFX_COMPLEX_DEF(-IFX_COMPLEX_REAL(scalar), -IFX_COMPLEX_IMAG(scalar));
+
 #define OP(elem) ifx_complex_sub(elem, scalar)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->add_cs(a, neg_scalar, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -533,7 +746,9 @@ void ifx_mat_scale_r(const ifx_Matrix_R_t* input,
                      ifx_Matrix_R_t* output)
 {
 #define OP(elem) elem* scale
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->scale_r(a, scale, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -563,8 +778,21 @@ void ifx_mat_scale_c(const ifx_Matrix_C_t* input,
                      ifx_Complex_t scale,
                      ifx_Matrix_C_t* output)
 {
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(input);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(output);
+
+    if (IFX_MDA_IS_SPLIT(input) || IFX_MDA_IS_SPLIT(output))
+    {
+        IFX_ERR_BRK_COND(!IFX_MDA_IS_SPLIT(input) || !IFX_MDA_IS_SPLIT(output), IFX_ERROR_NOT_SUPPORTED);
+        IFX_MAT_BRK_DIM(input, output);
+        mat_scale_split(input, scale, output);
+        return;
+    }
+
 #define OP(elem) ifx_complex_mul(elem, scale)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->scale_c(a, scale, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -575,7 +803,9 @@ void ifx_mat_scale_cr(const ifx_Matrix_C_t* input,
                       ifx_Matrix_C_t* output)
 {
 #define OP(elem) ifx_complex_mul_real(elem, scale)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->scale_r(AS_FLOAT(a), scale, AS_FLOAT(out), 2 * (n))
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -587,7 +817,9 @@ void ifx_mat_mac_r(const ifx_Matrix_R_t* m1,
                    ifx_Matrix_R_t* result)
 {
 #define OP(m1, m2) ((m1) + (scale * (m2)))
-    MAT_APPLY_BINOP(m1, OP, m2, result);
+#define KERNEL(a, b, out, n) kernels->mac_r(a, b, scale, out, n)
+    MAT_APPLY_BINOP(m1, OP, KERNEL, m2, result);
+#undef KERNEL
 #undef OP
 }
 
@@ -598,8 +830,23 @@ void ifx_mat_mac_c(const ifx_Matrix_C_t* m1,
                    ifx_Complex_t scale,
                    ifx_Matrix_C_t* output)
 {
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(m1);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(m2);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(output);
+
+    if (IFX_MDA_IS_SPLIT(m1) || IFX_MDA_IS_SPLIT(m2) || IFX_MDA_IS_SPLIT(output))
+    {
+        IFX_ERR_BRK_COND(!IFX_MDA_IS_SPLIT(m1) || !IFX_MDA_IS_SPLIT(m2) || !IFX_MDA_IS_SPLIT(output), IFX_ERROR_NOT_SUPPORTED);
+        IFX_MAT_BRK_DIM(m1, m2);
+        IFX_MAT_BRK_DIM(m1, output);
+        mat_mac_split(m1, m2, scale, output);
+        return;
+    }
+
 #define OP(m1, m2) ifx_complex_add((m1), ifx_complex_mul((m2), scale))
-    MAT_APPLY_BINOP(m1, OP, m2, output);
+#define KERNEL(a, b, out, n) kernels->mac_c(a, b, scale, out, n)
+    MAT_APPLY_BINOP(m1, OP, KERNEL, m2, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -609,7 +856,9 @@ void ifx_mat_abs_r(const ifx_Matrix_R_t* input,
                    ifx_Matrix_R_t* output)
 {
 #define OP(elem) FABS(elem)
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->abs_r(a, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -618,8 +867,20 @@ void ifx_mat_abs_r(const ifx_Matrix_R_t* input,
 void ifx_mat_abs_c(const ifx_Matrix_C_t* input,
                    ifx_Matrix_R_t* output)
 {
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(input);
+
+    if (IFX_MDA_IS_SPLIT(input))
+    {
+        IFX_MAT_BRK_VALID(output);
+        IFX_MAT_BRK_DIM(input, output);
+        mat_abs_split(input, output);
+        return;
+    }
+
 #define OP(elem) ifx_complex_abs(elem);
-    MAT_APPLY_UNOP(input, OP, output);
+#define KERNEL(a, out, n) kernels->abs_c(a, out, n)
+    MAT_APPLY_UNOP(input, OP, KERNEL, output);
+#undef KERNEL
 #undef OP
 }
 
@@ -631,6 +892,21 @@ ifx_Float_t ifx_mat_sum_r(const ifx_Matrix_R_t* matrix)
 
     ifx_Float_t result = 0;
 
+    if (MAT_ROWS_CONTIGUOUS(matrix))
+    {
+        const ifx_Kernels_t* kernels = ifx_kernels_get();
+        if (MAT_CONTIGUOUS(matrix))
+        {
+            return kernels->sum_r(mDat(matrix), mSize(matrix));
+        }
+
+        for (uint32_t r = 0; r < mRows(matrix); r++)
+        {
+            result += kernels->sum_r(&mAt(matrix, r, 0), mCols(matrix));
+        }
+        return result;
+    }
+
     for (uint32_t r = 0; r < mRows(matrix); r++)
     {
         for (uint32_t c = 0; c < mCols(matrix); c++)
@@ -653,6 +929,24 @@ ifx_Complex_t ifx_mat_sum_c(const ifx_Matrix_C_t* matrix)
     ifx_Float_t acc_i = 0;
     ifx_Complex_t result;
 
+    if (MAT_ROWS_CONTIGUOUS(matrix))
+    {
+        const ifx_Kernels_t* kernels = ifx_kernels_get();
+        if (MAT_CONTIGUOUS(matrix))
+        {
+            return kernels->sum_c(mDat(matrix), mSize(matrix));
+        }
+
+        for (uint32_t r = 0; r < mRows(matrix); r++)
+        {
+            const ifx_Complex_t row_sum = kernels->sum_c(&mAt(matrix, r, 0), mCols(matrix));
+            acc_r += IFX_COMPLEX_REAL(row_sum);
+            acc_i += IFX_COMPLEX_IMAG(row_sum);
+        }
+        IFX_COMPLEX_SET(result, acc_r, acc_i);
+        return result;
+    }
+
     for (uint32_t r = 0; r < mRows(matrix); r++)
     {
         for (uint32_t c = 0; c < mCols(matrix); c++)
@@ -675,6 +969,17 @@ ifx_Float_t ifx_mat_sqsum_r(const ifx_Matrix_R_t* matrix)
 
     ifx_Float_t result = 0;
 
+    if (MAT_ROWS_CONTIGUOUS(matrix))
+    {
+        const ifx_Kernels_t* kernels = ifx_kernels_get();
+        for (uint32_t r = 0; r < mRows(matrix); r++)
+        {
+            const ifx_Float_t* row = &mAt(matrix, r, 0);
+            result += kernels->dot_r(row, row, mCols(matrix));
+        }
+        return result;
+    }
+
     for (uint32_t r = 0; r < mRows(matrix); r++)
     {
         for (uint32_t c = 0; c < mCols(matrix); c++)
@@ -695,6 +1000,17 @@ ifx_Float_t ifx_mat_sqsum_c(const ifx_Matrix_C_t* matrix)
 
     ifx_Float_t result = 0;
 
+    if (MAT_ROWS_CONTIGUOUS(matrix))
+    {
+        const ifx_Kernels_t* kernels = ifx_kernels_get();
+        for (uint32_t r = 0; r < mRows(matrix); r++)
+        {
+            const ifx_Float_t* row = AS_FLOAT(&mAt(matrix, r, 0));
+            result += kernels->dot_r(row, row, 2 * (size_t)mCols(matrix));
+        }
+        return result;
+    }
+
     for (uint32_t r = 0; r < mRows(matrix); r++)
     {
         for (uint32_t c = 0; c < mCols(matrix); c++)
@@ -844,17 +1160,10 @@ void ifx_mat_abt_r(const ifx_Matrix_R_t* inputA,
                          || (mCols(inputA) != mCols(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_row = 0; i_row < mRows(inputA); ++i_row)
-    {
-        for (uint32_t j_row = 0; j_row < mRows(inputB); ++j_row)
-        {
-            ifx_Float_t sum = 0;
-            for (uint32_t col = 0; col < mCols(inputA); ++col)
-                sum += mAt(inputA, i_row, col) * mAt(inputB, j_row, col);
-
-            mAt(output, i_row, j_row) = sum;
-        }
-    }
+    if (SAME_MATRIX(inputA, inputB))
+        ifx_syrk_r(mRows(inputA), mCols(inputA), GEMM(inputA), GEMM(output));
+    else
+        ifx_gemm_r(mRows(inputA), mRows(inputB), mCols(inputA), GEMM(inputA), GEMM_T(inputB), GEMM(output));
 }
 
 //----------------------------------------------------------------------------
@@ -872,23 +1181,10 @@ void ifx_mat_abct_c(const ifx_Matrix_C_t* inputA,
                          || (mCols(inputA) != mCols(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_row = 0; i_row < mRows(inputA); ++i_row)
-    {
-        for (uint32_t j_row = 0; j_row < mRows(inputB); ++j_row)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t col = 0; col < mCols(inputA); ++col)
-            {
-                ifx_Float_t ra = IFX_COMPLEX_REAL(mAt(inputA, i_row, col));
-                ifx_Float_t ia = IFX_COMPLEX_IMAG(mAt(inputA, i_row, col));
-                ifx_Float_t rb = IFX_COMPLEX_REAL(mAt(inputB, j_row, col));
-                ifx_Float_t ib = IFX_COMPLEX_IMAG(mAt(inputB, j_row, col));
-                ifx_Complex_t tmp = IFX_COMPLEX_DEF(ra * rb + ia * ib, -ra * ib + rb * ia);
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_row, j_row) = sum;
-        }
-    }
+    if (SAME_MATRIX(inputA, inputB))
+        ifx_herk_c(mRows(inputA), mCols(inputA), GEMM(inputA), GEMM(output));
+    else
+        ifx_gemm_c(mRows(inputA), mRows(inputB), mCols(inputA), GEMM(inputA), false, GEMM_T(inputB), true, GEMM(output));
 }
 
 //----------------------------------------------------------------------------
@@ -906,19 +1202,7 @@ void ifx_mat_abt_c(const ifx_Matrix_C_t* inputA,
                          || (mCols(inputA) != mCols(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_row = 0; i_row < mRows(inputA); ++i_row)
-    {
-        for (uint32_t j_row = 0; j_row < mRows(inputB); ++j_row)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t col = 0; col < mCols(inputA); ++col)
-            {
-                ifx_Complex_t tmp = ifx_complex_mul(mAt(inputA, i_row, col), mAt(inputB, j_row, col));
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_row, j_row) = sum;
-        }
-    }
+    ifx_gemm_c(mRows(inputA), mRows(inputB), mCols(inputA), GEMM(inputA), false, GEMM_T(inputB), false, GEMM(output));
 }
 
 //----------------------------------------------------------------------------
@@ -936,19 +1220,8 @@ void ifx_mat_abt_rc(const ifx_Matrix_R_t* inputA,
                          || (mCols(inputA) != mCols(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_row = 0; i_row < mRows(inputA); ++i_row)
-    {
-        for (uint32_t j_row = 0; j_row < mRows(inputB); ++j_row)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t col = 0; col < mCols(inputA); ++col)
-            {
-                ifx_Complex_t tmp = ifx_complex_mul_real(mAt(inputB, j_row, col), mAt(inputA, i_row, col));
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_row, j_row) = sum;
-        }
-    }
+    for (size_t part = 0; part < 2; part++)
+        ifx_gemm_r(mRows(inputA), mRows(inputB), mCols(inputA), GEMM(inputA), GEMM_PART_T(inputB, part), GEMM_PART(output, part));
 }
 
 //----------------------------------------------------------------------------
@@ -966,19 +1239,8 @@ void ifx_mat_abt_cr(const ifx_Matrix_C_t* inputA,
                          || (mCols(inputA) != mCols(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_row = 0; i_row < mRows(inputA); ++i_row)
-    {
-        for (uint32_t j_row = 0; j_row < mRows(inputB); ++j_row)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t col = 0; col < mCols(inputA); ++col)
-            {
-                ifx_Complex_t tmp = ifx_complex_mul_real(mAt(inputA, i_row, col), mAt(inputB, j_row, col));
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_row, j_row) = sum;
-        }
-    }
+    for (size_t part = 0; part < 2; part++)
+        ifx_gemm_r(mRows(inputA), mRows(inputB), mCols(inputA), GEMM_PART(inputA, part), GEMM_T(inputB), GEMM_PART(output, part));
 }
 
 //----------------------------------------------------------------------------
@@ -996,17 +1258,10 @@ void ifx_mat_atb_r(const ifx_Matrix_R_t* inputA,
                          || (mRows(inputA) != mRows(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_col = 0; i_col < mCols(inputA); ++i_col)
-    {
-        for (uint32_t j_col = 0; j_col < mCols(inputB); ++j_col)
-        {
-            ifx_Float_t sum = 0;
-            for (uint32_t row = 0; row < mRows(inputA); ++row)
-                sum += mAt(inputA, row, i_col) * mAt(inputB, row, j_col);
-
-            mAt(output, i_col, j_col) = sum;
-        }
-    }
+    if (SAME_MATRIX(inputA, inputB))
+        ifx_syrk_r(mCols(inputA), mRows(inputA), GEMM_T(inputA), GEMM(output));
+    else
+        ifx_gemm_r(mCols(inputA), mCols(inputB), mRows(inputA), GEMM_T(inputA), GEMM(inputB), GEMM(output));
 }
 
 //----------------------------------------------------------------------------
@@ -1024,19 +1279,7 @@ void ifx_mat_atb_c(const ifx_Matrix_C_t* inputA,
                          || (mRows(inputA) != mRows(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_col = 0; i_col < mCols(inputA); ++i_col)
-    {
-        for (uint32_t j_col = 0; j_col < mCols(inputB); ++j_col)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t row = 0; row < mRows(inputA); ++row)
-            {
-                ifx_Complex_t tmp = ifx_complex_mul(mAt(inputA, row, i_col), mAt(inputB, row, j_col));
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_col, j_col) = sum;
-        }
-    }
+    ifx_gemm_c(mCols(inputA), mCols(inputB), mRows(inputA), GEMM_T(inputA), false, GEMM(inputB), false, GEMM(output));
 }
 
 //----------------------------------------------------------------------------
@@ -1054,19 +1297,8 @@ void ifx_mat_atb_rc(const ifx_Matrix_R_t* inputA,
                          || (mRows(inputA) != mRows(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_col = 0; i_col < mCols(inputA); ++i_col)
-    {
-        for (uint32_t j_col = 0; j_col < mCols(inputB); ++j_col)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t row = 0; row < mRows(inputA); ++row)
-            {
-                ifx_Complex_t tmp = ifx_complex_mul_real(mAt(inputB, row, j_col), mAt(inputA, row, i_col));
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_col, j_col) = sum;
-        }
-    }
+    for (size_t part = 0; part < 2; part++)
+        ifx_gemm_r(mCols(inputA), mCols(inputB), mRows(inputA), GEMM_T(inputA), GEMM_PART(inputB, part), GEMM_PART(output, part));
 }
 
 //----------------------------------------------------------------------------
@@ -1084,19 +1316,8 @@ void ifx_mat_atb_cr(const ifx_Matrix_C_t* inputA,
                          || (mRows(inputA) != mRows(inputB)),
                      IFX_ERROR_DIMENSION_MISMATCH)
 
-    for (uint32_t i_col = 0; i_col < mCols(inputA); ++i_col)
-    {
-        for (uint32_t j_col = 0; j_col < mCols(inputB); ++j_col)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-            for (uint32_t row = 0; row < mRows(inputA); ++row)
-            {
-                ifx_Complex_t tmp = ifx_complex_mul_real(mAt(inputA, row, i_col), mAt(inputB, row, j_col));
-                sum = ifx_complex_add(sum, tmp);
-            }
-            mAt(output, i_col, j_col) = sum;
-        }
-    }
+    for (size_t part = 0; part < 2; part++)
+        ifx_gemm_r(mCols(inputA), mCols(inputB), mRows(inputA), GEMM_PART_T(inputA, part), GEMM(inputB), GEMM_PART(output, part));
 }
 
 //----------------------------------------------------------------------------
@@ -1233,21 +1454,7 @@ void ifx_mat_mul_r(const ifx_Matrix_R_t* matrix_l,
     IFX_MAT_BRK_DIM_COL_ROW(matrix_l, matrix_r);
 
     /* result_{jk} = (matrix_l)_{jl} * (matrix_r)_{lk} */
-
-    for (uint32_t j = 0; j < mRows(matrix_l); j++)
-    {
-        for (uint32_t k = 0; k < mCols(matrix_r); k++)
-        {
-            ifx_Float_t sum = 0;
-
-            for (uint32_t l = 0; l < mCols(matrix_l); l++)
-            {
-                sum += IFX_MAT_AT(matrix_l, j, l) * IFX_MAT_AT(matrix_r, l, k);
-            }
-
-            IFX_MAT_AT(result, j, k) = sum;
-        }
-    }
+    ifx_gemm_r(mRows(matrix_l), mCols(matrix_r), mCols(matrix_l), GEMM(matrix_l), GEMM(matrix_r), GEMM(result));
 }
 
 //----------------------------------------------------------------------------
@@ -1263,24 +1470,10 @@ void ifx_mat_mul_rc(const ifx_Matrix_R_t* matrix_l,
     IFX_MAT_BRK_DIM_COL(matrix_r, result);
     IFX_MAT_BRK_DIM_COL_ROW(matrix_l, matrix_r);
 
-    /* result_{jk} = (matrix_l)_{jl} * (matrix_r)_{lk} */
-
-    for (uint32_t j = 0; j < mRows(matrix_l); j++)
-    {
-        for (uint32_t k = 0; k < mCols(matrix_r); k++)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-
-            for (uint32_t l = 0; l < mCols(matrix_l); l++)
-            {
-                ifx_Float_t a = IFX_MAT_AT(matrix_l, j, l);
-                ifx_Complex_t b = IFX_MAT_AT(matrix_r, l, k);
-                sum = ifx_complex_add(sum, ifx_complex_mul_real(b, a));
-            }
-
-            IFX_MAT_AT(result, j, k) = sum;
-        }
-    }
+    /* result_{jk} = (matrix_l)_{jl} * (matrix_r)_{lk}; real and imaginary
+     * parts of the result are computed separately */
+    for (size_t part = 0; part < 2; part++)
+        ifx_gemm_r(mRows(matrix_l), mCols(matrix_r), mCols(matrix_l), GEMM(matrix_l), GEMM_PART(matrix_r, part), GEMM_PART(result, part));
 }
 
 //----------------------------------------------------------------------------
@@ -1297,23 +1490,7 @@ void ifx_mat_mul_c(const ifx_Matrix_C_t* matrix_l,
     IFX_MAT_BRK_DIM_COL_ROW(matrix_l, matrix_r);
 
     /* result_{jk} = (matrix_l)_{jl} * (matrix_r)_{lk} */
-
-    for (uint32_t j = 0; j < mRows(matrix_l); j++)
-    {
-        for (uint32_t k = 0; k < mCols(matrix_r); k++)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-
-            for (uint32_t l = 0; l < mCols(matrix_l); l++)
-            {
-                ifx_Complex_t a = IFX_MAT_AT(matrix_l, j, l);
-                ifx_Complex_t b = IFX_MAT_AT(matrix_r, l, k);
-                sum = ifx_complex_add(sum, ifx_complex_mul(a, b));
-            }
-
-            IFX_MAT_AT(result, j, k) = sum;
-        }
-    }
+    ifx_gemm_c(mRows(matrix_l), mCols(matrix_r), mCols(matrix_l), GEMM(matrix_l), false, GEMM(matrix_r), false, GEMM(result));
 }
 
 //----------------------------------------------------------------------------
@@ -1329,24 +1506,10 @@ void ifx_mat_mul_cr(const ifx_Matrix_C_t* matrix_l,
     IFX_MAT_BRK_DIM_COL(matrix_r, result);
     IFX_MAT_BRK_DIM_COL_ROW(matrix_l, matrix_r);
 
-    /* result_{jk} = (matrix_l)_{jl} * (matrix_r)_{lk} */
-
-    for (uint32_t j = 0; j < mRows(matrix_l); j++)
-    {
-        for (uint32_t k = 0; k < mCols(matrix_r); k++)
-        {
-            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
-
-            for (uint32_t l = 0; l < mCols(matrix_l); l++)
-            {
-                ifx_Complex_t a = IFX_MAT_AT(matrix_l, j, l);
-                ifx_Float_t b = IFX_MAT_AT(matrix_r, l, k);
-                sum = ifx_complex_add(sum, ifx_complex_mul_real(a, b));
-            }
-
-            IFX_MAT_AT(result, j, k) = sum;
-        }
-    }
+    /* result_{jk} = (matrix_l)_{jl} * (matrix_r)_{lk}; real and imaginary
+     * parts of the result are computed separately */
+    for (size_t part = 0; part < 2; part++)
+        ifx_gemm_r(mRows(matrix_l), mCols(matrix_r), mCols(matrix_l), GEMM_PART(matrix_l, part), GEMM(matrix_r), GEMM_PART(result, part));
 }
 
 //----------------------------------------------------------------------------
@@ -1362,7 +1525,7 @@ void ifx_mat_clear_r(ifx_Matrix_R_t* matrix)
 
 void ifx_mat_clear_c(ifx_Matrix_C_t* matrix)
 {
-    IFX_MAT_BRK_VALID(matrix);
+    IFX_MAT_BRK_VALID_ANY_LAYOUT(matrix);
 
     ifx_mda_clear_c(matrix);
 }
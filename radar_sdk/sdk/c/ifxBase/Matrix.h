@@ -109,20 +109,32 @@ extern "C"
 #define IFX_MAT_BRK_COLS(m, c)    IFX_ERR_BRK_COND((c) > mCols(m), IFX_ERROR_INDEX_OUT_OF_BOUNDS)
 #define IFX_MAT_BRV_COLS(m, c, v) IFX_ERR_BRK_COND((c) > mCols(m), IFX_ERROR_INDEX_OUT_OF_BOUNDS, v)
 
-#define IFX_MAT_BRK_VALID(m)                                                        \
+#define IFX_MAT_BRK_VALID_ANY_LAYOUT(m)                                             \
     do                                                                              \
     {                                                                               \
         IFX_ERR_BRK_NULL(m);                                                        \
         IFX_ERR_BRK_COND(IFX_MDA_DIMENSIONS(m) != 2, IFX_ERROR_DIMENSION_MISMATCH); \
         IFX_ERR_BRK_ARGUMENT(IFX_MDA_DATA(m) == NULL)                               \
     } while (0)
-#define IFX_MAT_BRV_VALID(m, r)                                                        \
+#define IFX_MAT_BRK_VALID(m)                                            \
+    do                                                                  \
+    {                                                                   \
+        IFX_MAT_BRK_VALID_ANY_LAYOUT(m);                                \
+        IFX_ERR_BRK_COND(IFX_MDA_IS_SPLIT(m), IFX_ERROR_NOT_SUPPORTED); \
+    } while (0)
+#define IFX_MAT_BRV_VALID_ANY_LAYOUT(m, r)                                             \
     do                                                                                 \
     {                                                                                  \
         IFX_ERR_BRV_NULL(m, r);                                                        \
         IFX_ERR_BRV_COND(IFX_MDA_DIMENSIONS(m) != 2, IFX_ERROR_DIMENSION_MISMATCH, r); \
         IFX_ERR_BRV_ARGUMENT(IFX_MDA_DATA(m) == NULL, r)                               \
     } while (0)
+#define IFX_MAT_BRV_VALID(m, r)                                            \
+    do                                                                     \
+    {                                                                      \
+        IFX_MAT_BRV_VALID_ANY_LAYOUT(m, r);                                \
+        IFX_ERR_BRV_COND(IFX_MDA_IS_SPLIT(m), IFX_ERROR_NOT_SUPPORTED, r); \
+    } while (0)
 
 /*
 ==============================================================================
@@ -409,6 +421,24 @@ IFX_DLL_PUBLIC
 ifx_Matrix_C_t* ifx_mat_create_c(uint32_t rows,
                                  uint32_t columns);
 
+/**
+ * @brief Allocates memory for a complex matrix in split layout with a
+ *        specified number of rows and columns and initializes it to zero.
+ *
+ * Real and imaginary parts are stored in separate blocks, each arranged
+ * row-wise, see \ref IFX_MDA_FLAG_SPLIT_COMPLEX. Only functions documented to
+ * support the split layout accept such a matrix.
+ *
+ * @param [in]     rows      Number of rows
+ * @param [in]     columns   Number of columns
+ *
+ * @return Pointer to allocated and initialized complex matrix structure or NULL if allocation failed.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_Matrix_C_t* ifx_mat_create_split_c(uint32_t rows,
+                                       uint32_t columns);
+
 /**
  * @brief Frees memory for a real matrix defined by \ref ifx_mat_create_r
  *        and sets the length of the matrix to zero.
@@ -976,6 +1006,9 @@ ifx_Float_t ifx_mat_var_r(const ifx_Matrix_R_t* matrix);
  * @brief Computes matrix multiplication for:
  *          output = inputA * inputB-Transpose
  *
+ * If inputA and inputB are the same matrix, the symmetry of the result is
+ * used and only half of the products are computed.
+ *
  * @param [in]     inputA    ...
  * @param [in]     inputB    ...
  * @param [out]    output    ...
@@ -989,6 +1022,10 @@ void ifx_mat_abt_r(const ifx_Matrix_R_t* inputA,
  * @brief Computes matrix multiplication for:
  *          output = inputA * inputB-conjugate-Transpose
  *
+ * If inputA and inputB are the same matrix (e.g., for covariance
+ * estimation), the Hermitian symmetry of the result is used and only half of
+ * the products are computed.
+ *
  * @param [in]     inputA    ...
  * @param [in]     inputB    ...
  * @param [out]    output    ...
@@ -27,11 +27,13 @@
 ** ===========================================================================
 */
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 
 #include "Complex.h"
 #include "Error.h"
+#include "internal/Kernels.h"
 #include "internal/Mda.hpp"
 #include "Mda.h"
 #include "Mem.h"
@@ -77,6 +79,48 @@ static inline size_t compute_data_size(const uint32_t dimensions, const uint32_t
     return mul_ovf(size, size_element, overflow);
 }
 
+/**
+ * @brief Read element at offset
+ *
+ * For split complex arrays the offset counts ifx_Float_t values within the
+ * blocks of real and imaginary parts.
+ */
+static inline ifx_Float_t load(const ifx_Mda_R_t* mda, size_t offset)
+{
+    return IFX_MDA_DATA(mda)[offset];
+}
+
+static inline ifx_Complex_t load(const ifx_Mda_C_t* mda, size_t offset)
+{
+    if (!IFX_MDA_IS_SPLIT(mda))
+        return IFX_MDA_DATA(mda)[offset];
+
+    ifx_Complex_t value;
+    IFX_COMPLEX_SET(value, IFX_MDA_REAL_DATA(mda)[offset], IFX_MDA_IMAG_DATA(mda)[offset]);
+    return value;
+}
+
+/**
+ * @brief Write element at offset
+ *
+ * See \ref load for the meaning of offset.
+ */
+static inline void store(ifx_Mda_R_t* mda, size_t offset, ifx_Float_t value)
+{
+    IFX_MDA_DATA(mda)[offset] = value;
+}
+
+static inline void store(ifx_Mda_C_t* mda, size_t offset, ifx_Complex_t value)
+{
+    if (IFX_MDA_IS_SPLIT(mda))
+    {
+        IFX_MDA_REAL_DATA(mda)[offset] = IFX_COMPLEX_REAL(value);
+        IFX_MDA_IMAG_DATA(mda)[offset] = IFX_COMPLEX_IMAG(value);
+    }
+    else
+        IFX_MDA_DATA(mda)[offset] = value;
+}
+
 template <class MDA_TYPE>
 static inline MDA_TYPE* mda_create(const uint32_t dimensions, const uint32_t shape[])
 {
@@ -142,6 +186,20 @@ ifx_Mda_C_t* ifx_mda_create_c(const uint32_t dimensions, const uint32_t shape[])
     return mda_create<ifx_Mda_C_t>(dimensions, shape);
 }
 
+ifx_Mda_C_t* ifx_mda_create_split_c(const uint32_t dimensions, const uint32_t shape[])
+{
+    // The buffer of an interleaved array has exactly the size required for
+    // the block of real parts followed by the block of imaginary parts.
+    auto* mda = mda_create<ifx_Mda_C_t>(dimensions, shape);
+    if (!mda)
+        return nullptr;
+
+    IFX_MDA_FLAGS(mda) |= IFX_MDA_FLAG_SPLIT_COMPLEX;
+    mda->imag_offset = static_cast<ptrdiff_t>(mda_elements(mda));
+
+    return mda;
+}
+
 template <class MDA_TYPE>
 static inline void ifx_mda_destroy(MDA_TYPE mda)
 {
@@ -164,6 +222,23 @@ void ifx_mda_destroy_c(ifx_Mda_C_t* mda)
     ifx_mda_destroy(mda);
 }
 
+static inline void set_view_data(ifx_Mda_R_t* view, const ifx_Mda_R_t* orig, size_t offset)
+{
+    IFX_MDA_DATA(view) = IFX_MDA_DATA(orig) + offset;
+}
+
+static inline void set_view_data(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig, size_t offset)
+{
+    if (IFX_MDA_IS_SPLIT(orig))
+    {
+        IFX_MDA_DATA(view) = reinterpret_cast<ifx_Complex_t*>(IFX_MDA_REAL_DATA(orig) + offset);
+        IFX_MDA_FLAGS(view) |= IFX_MDA_FLAG_SPLIT_COMPLEX;
+        view->imag_offset = orig->imag_offset;
+    }
+    else
+        IFX_MDA_DATA(view) = IFX_MDA_DATA(orig) + offset;
+}
+
 template <class MDA_TYPE>
 static inline void mda_view(MDA_TYPE* view, const MDA_TYPE* orig, const size_t num_slices, const ifx_mda_slice_t slices[])
 {
@@ -211,7 +286,7 @@ static inline void mda_view(MDA_TYPE* view, const MDA_TYPE* orig, const size_t n
 
         const auto dimensions = IFX_MDA_DIMENSIONS(orig);
         const auto* stride = IFX_MDA_STRIDE(orig);
-        IFX_MDA_DATA(view) = IFX_MDA_DATA(orig) + ifx_mda_offset(dimensions, stride, indices);
+        set_view_data(view, orig, ifx_mda_offset(dimensions, stride, indices));
     }
 
     IFX_MDA_FLAGS(view) &= ~IFX_MDA_FLAG_OWNS_DATA;
@@ -256,6 +331,69 @@ void ifx_mda_view_c(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig, const size_t num
     mda_view(view, orig, num_slices, slices);
 }
 
+template <class MDA_TYPE>
+static inline void mda_permute(MDA_TYPE* view, const MDA_TYPE* orig, const size_t num_axes, const uint32_t axes[])
+{
+    IFX_ERR_BRK_NULL(view);
+    IFX_ERR_BRK_NULL(orig);
+    IFX_ERR_BRK_NULL(axes);
+
+    const uint32_t dimensions = IFX_MDA_DIMENSIONS(orig);
+    IFX_ERR_BRK_COND(num_axes != dimensions, IFX_ERROR_DIMENSION_MISMATCH);
+
+    // axes must be a permutation of 0,...,dimensions-1
+    bool used[IFX_MDA_MAX_DIM] = {false};
+    for (uint32_t dim = 0; dim < dimensions; dim++)
+    {
+        IFX_ERR_BRK_COND(axes[dim] >= dimensions || used[axes[dim]], IFX_ERROR_ARGUMENT_INVALID);
+        used[axes[dim]] = true;
+    }
+
+    std::memset(view, 0, sizeof(MDA_TYPE));
+    set_view_data(view, orig, 0);
+    IFX_MDA_FLAGS(view) &= ~IFX_MDA_FLAG_OWNS_DATA;
+
+    IFX_MDA_DIMENSIONS(view) = dimensions;
+    for (uint32_t dim = 0; dim < dimensions; dim++)
+    {
+        IFX_MDA_SHAPE(view)[dim] = IFX_MDA_SHAPE(orig)[axes[dim]];
+        IFX_MDA_STRIDE(view)[dim] = IFX_MDA_STRIDE(orig)[axes[dim]];
+    }
+}
+
+template <class MDA_TYPE>
+static inline void mda_transpose(MDA_TYPE* view, const MDA_TYPE* orig)
+{
+    IFX_ERR_BRK_NULL(orig);
+
+    const uint32_t dimensions = IFX_MDA_DIMENSIONS(orig);
+    uint32_t axes[IFX_MDA_MAX_DIM];
+    for (uint32_t dim = 0; dim < dimensions; dim++)
+        axes[dim] = dimensions - 1 - dim;
+
+    mda_permute(view, orig, dimensions, axes);
+}
+
+void ifx_mda_permute_r(ifx_Mda_R_t* view, const ifx_Mda_R_t* orig, const size_t num_axes, const uint32_t axes[])
+{
+    mda_permute(view, orig, num_axes, axes);
+}
+
+void ifx_mda_permute_c(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig, const size_t num_axes, const uint32_t axes[])
+{
+    mda_permute(view, orig, num_axes, axes);
+}
+
+void ifx_mda_transpose_r(ifx_Mda_R_t* view, const ifx_Mda_R_t* orig)
+{
+    mda_transpose(view, orig);
+}
+
+void ifx_mda_transpose_c(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig)
+{
+    mda_transpose(view, orig);
+}
+
 template <class MDA_TYPE>
 static inline bool mda_is_contiguous(const MDA_TYPE* mda)
 {
@@ -302,8 +440,7 @@ static inline void mda_setall(MDA_TYPE* mda, const DTYPE value)
     IFX_ERR_BRK_NULL(mda);
 
     const auto f = [mda, value](size_t offset, const uint32_t* /* indices */) {
-        IFX_MDA_DATA(mda)
-        [offset] = value;
+        store(mda, offset, value);
         return true;
     };
 
@@ -320,21 +457,266 @@ void ifx_mda_setall_c(ifx_Mda_C_t* mda, const ifx_Complex_t value)
     mda_setall(mda, value);
 }
 
+/* Transpose kernel of the kernel table for the element type T */
+template <typename T>
+using TransposeFunc = void (*)(const T*, size_t, T*, size_t, size_t, size_t);
+
+static inline TransposeFunc<ifx_Float_t> transpose_kernel(const ifx_Float_t*)
+{
+    return ifx_kernels_get()->transpose_r;
+}
+
+static inline TransposeFunc<ifx_Complex_t> transpose_kernel(const ifx_Complex_t*)
+{
+    return ifx_kernels_get()->transpose_c;
+}
+
+/* Tile size (in elements per side) for the transpose kernels. A tile of
+ * complex numbers (8KiB for source and destination each) fits into L1. */
+static constexpr size_t TRANSPOSE_TILE = 32;
+
+/* out[i*out_stride + j] = in[j*in_stride + i] for i < rows, j < cols
+ *
+ * Cache-oblivious transpose: the longer side is halved until the block fits
+ * into a tile, which is then transposed by the kernel. */
+template <typename T>
+static void transpose_tiled(const T* in, size_t in_stride, T* out, size_t out_stride, size_t rows, size_t cols, TransposeFunc<T> kernel)
+{
+    while (rows > TRANSPOSE_TILE || cols > TRANSPOSE_TILE)
+    {
+        if (rows >= cols)
+        {
+            // keep the split at a multiple of 4 so that SIMD blocks stay complete
+            const size_t half = ((rows / 2) + 3) & ~size_t(3);
+            transpose_tiled(in, in_stride, out, out_stride, half, cols, kernel);
+            in += half;
+            out += half * out_stride;
+            rows -= half;
+        }
+        else
+        {
+            const size_t half = ((cols / 2) + 3) & ~size_t(3);
+            transpose_tiled(in, in_stride, out, out_stride, rows, half, kernel);
+            in += half * in_stride;
+            out += half;
+            cols -= half;
+        }
+    }
+
+    kernel(in, in_stride, out, out_stride, rows, cols);
+}
+
+/* Call f(src_offset, dest_offset) for all indices of the dimensions dims[0],
+ * ..., dims[num_dims-1]. */
+template <typename F>
+static inline void for_each_offset(uint32_t num_dims, const uint32_t dims[], const size_t len[], const size_t src_stride[], const size_t dest_stride[], F&& f)
+{
+    size_t indices[IFX_MDA_MAX_DIM] = {0};
+    size_t src_offset = 0;
+    size_t dest_offset = 0;
+
+    for (;;)
+    {
+        f(src_offset, dest_offset);
+
+        uint32_t k = num_dims;
+        for (;;)
+        {
+            if (k == 0)
+                return;
+            k--;
+
+            const uint32_t d = dims[k];
+            indices[k]++;
+            src_offset += src_stride[d];
+            dest_offset += dest_stride[d];
+            if (indices[k] < len[d])
+                break;
+
+            src_offset -= len[d] * src_stride[d];
+            dest_offset -= len[d] * dest_stride[d];
+            indices[k] = 0;
+        }
+    }
+}
+
+/* Copy the strided array src to the strided array dest.
+ *
+ * Dimensions of length 1 are dropped and neighboring dimensions that are
+ * contiguous in both arrays are merged. If the innermost dimension is
+ * contiguous in both arrays, the copy is done row by row. If the dimensions
+ * with unit stride differ between src and dest (e.g. src is a transposed or
+ * permuted view), the copy is done as tiled 2D transpose of these two
+ * dimensions. Otherwise the copy is done element by element.
+ */
+template <typename T>
+static void strided_copy(const T* src, const size_t src_stride[], T* dest, const size_t dest_stride[], uint32_t dimensions, const uint32_t shape[])
+{
+    uint32_t n = 0;
+    size_t len[IFX_MDA_MAX_DIM];
+    size_t ss[IFX_MDA_MAX_DIM];
+    size_t ds[IFX_MDA_MAX_DIM];
+
+    for (uint32_t dim = 0; dim < dimensions; dim++)
+    {
+        if (shape[dim] == 0)
+            return;
+        if (shape[dim] == 1)
+            continue;
+
+        if (n > 0 && ss[n - 1] == src_stride[dim] * shape[dim] && ds[n - 1] == dest_stride[dim] * shape[dim])
+        {
+            len[n - 1] *= shape[dim];
+            ss[n - 1] = src_stride[dim];
+            ds[n - 1] = dest_stride[dim];
+        }
+        else
+        {
+            len[n] = shape[dim];
+            ss[n] = src_stride[dim];
+            ds[n] = dest_stride[dim];
+            n++;
+        }
+    }
+
+    if (n == 0)
+    {
+        *dest = *src;
+        return;
+    }
+
+    const uint32_t inner = n - 1;
+    uint32_t outer[IFX_MDA_MAX_DIM];
+
+    if (ss[inner] == 1 && ds[inner] == 1)
+    {
+        const size_t row = len[inner];
+        for (uint32_t k = 0; k < inner; k++)
+            outer[k] = k;
+
+        for_each_offset(inner, outer, len, ss, ds, [&](size_t so, size_t dof) {
+            std::memmove(&dest[dof], &src[so], row * sizeof(T));
+        });
+        return;
+    }
+
+    // p: dimension with unit stride in src, q: dimension with unit stride in dest
+    uint32_t p = n;
+    uint32_t q = n;
+    for (uint32_t k = 0; k < n; k++)
+    {
+        if (ss[k] == 1 && p == n)
+            p = k;
+        if (ds[k] == 1 && q == n)
+            q = k;
+    }
+
+    if (p < n && q < n && p != q)
+    {
+        uint32_t num_outer = 0;
+        for (uint32_t k = 0; k < n; k++)
+        {
+            if (k != p && k != q)
+                outer[num_outer++] = k;
+        }
+
+        const auto kernel = transpose_kernel(src);
+        const size_t rows = len[p];
+        const size_t cols = len[q];
+        const size_t in_stride = ss[q];
+        const size_t out_stride = ds[p];
+
+        for_each_offset(num_outer, outer, len, ss, ds, [&](size_t so, size_t dof) {
+            transpose_tiled(&src[so], in_stride, &dest[dof], out_stride, rows, cols, kernel);
+        });
+        return;
+    }
+
+    const size_t row = len[inner];
+    const size_t src_inc = ss[inner];
+    const size_t dest_inc = ds[inner];
+    for (uint32_t k = 0; k < inner; k++)
+        outer[k] = k;
+
+    for_each_offset(inner, outer, len, ss, ds, [&](size_t so, size_t dof) {
+        for (size_t i = 0; i < row; i++)
+            dest[dof + i * dest_inc] = src[so + i * src_inc];
+    });
+}
+
+/* Generic copy element by element; src and dest can have any strides and layouts */
 template <class MDA_TYPE>
-static inline void mda_copy(const MDA_TYPE* src, MDA_TYPE* dest)
+static inline void mda_copy_elements(const MDA_TYPE* src, MDA_TYPE* dest)
 {
     IFX_ERR_BRK_NULL(src);
     IFX_ERR_BRK_NULL(dest);
     IFX_ERR_BRK_COND(!IFX_MDA_SAME_SHAPE(src, dest), IFX_ERROR_DIMENSION_MISMATCH);
 
-    const IterFunc f = [src, dest](size_t offset, const uint32_t* /* indices */) {
-        IFX_MDA_DATA(dest)[offset] = IFX_MDA_DATA(src)[offset];
+    // src and dest might have different strides (e.g. if one is a view)
+    const IterFunc f = [src, dest](size_t offset, const uint32_t* indices) {
+        const size_t offset_dest = ifx_mda_offset(IFX_MDA_DIMENSIONS(dest), IFX_MDA_STRIDE(dest), indices);
+        store(dest, offset_dest, load(src, offset));
         return true;
     };
 
     iterate(src, f);
 }
 
+static inline void mda_copy(const ifx_Mda_R_t* src, ifx_Mda_R_t* dest)
+{
+    IFX_ERR_BRK_NULL(src);
+    IFX_ERR_BRK_NULL(dest);
+    IFX_ERR_BRK_COND(!IFX_MDA_SAME_SHAPE(src, dest), IFX_ERROR_DIMENSION_MISMATCH);
+
+    strided_copy(IFX_MDA_DATA(src), IFX_MDA_STRIDE(src), IFX_MDA_DATA(dest), IFX_MDA_STRIDE(dest), IFX_MDA_DIMENSIONS(src), IFX_MDA_SHAPE(src));
+}
+
+/* Copy complex array and convert between layouts. Arrays of the same layout
+ * are copied with strided_copy (for split arrays separately for real and
+ * imaginary parts). Between layouts contiguous arrays are converted by the
+ * (de)interleave kernels, otherwise element by element. */
+static inline void mda_copy_complex(const ifx_Mda_C_t* src, ifx_Mda_C_t* dest)
+{
+    IFX_ERR_BRK_NULL(src);
+    IFX_ERR_BRK_NULL(dest);
+    IFX_ERR_BRK_COND(!IFX_MDA_SAME_SHAPE(src, dest), IFX_ERROR_DIMENSION_MISMATCH);
+
+    const bool src_split = IFX_MDA_IS_SPLIT(src);
+    const bool dest_split = IFX_MDA_IS_SPLIT(dest);
+    const uint32_t dimensions = IFX_MDA_DIMENSIONS(src);
+
+    if (!src_split && !dest_split)
+    {
+        strided_copy(IFX_MDA_DATA(src), IFX_MDA_STRIDE(src), IFX_MDA_DATA(dest), IFX_MDA_STRIDE(dest), dimensions, IFX_MDA_SHAPE(src));
+        return;
+    }
+
+    if (src_split && dest_split)
+    {
+        strided_copy<ifx_Float_t>(IFX_MDA_REAL_DATA(src), IFX_MDA_STRIDE(src), IFX_MDA_REAL_DATA(dest), IFX_MDA_STRIDE(dest), dimensions, IFX_MDA_SHAPE(src));
+        strided_copy<ifx_Float_t>(IFX_MDA_IMAG_DATA(src), IFX_MDA_STRIDE(src), IFX_MDA_IMAG_DATA(dest), IFX_MDA_STRIDE(dest), dimensions, IFX_MDA_SHAPE(src));
+        return;
+    }
+
+    if (!mda_is_contiguous(src) || !mda_is_contiguous(dest))
+    {
+        mda_copy_elements(src, dest);
+        return;
+    }
+
+    const size_t n = mda_elements(src);
+
+    if (src_split)
+        ifx_kernels_get()->interleave_c(IFX_MDA_REAL_DATA(src), IFX_MDA_IMAG_DATA(src), IFX_MDA_DATA(dest), n);
+    else
+        ifx_kernels_get()->deinterleave_c(IFX_MDA_DATA(src), IFX_MDA_REAL_DATA(dest), IFX_MDA_IMAG_DATA(dest), n);
+}
+
+static inline void mda_copy(const ifx_Mda_C_t* src, ifx_Mda_C_t* dest)
+{
+    mda_copy_complex(src, dest);
+}
+
 void ifx_mda_copy_r(const ifx_Mda_R_t* src, ifx_Mda_R_t* dest)
 {
     mda_copy(src, dest);
@@ -342,7 +724,33 @@ void ifx_mda_copy_r(const ifx_Mda_R_t* src, ifx_Mda_R_t* dest)
 
 void ifx_mda_copy_c(const ifx_Mda_C_t* src, ifx_Mda_C_t* dest)
 {
-    mda_copy(src, dest);
+    mda_copy_complex(src, dest);
+}
+
+template <class MDA_TYPE>
+static inline const MDA_TYPE* mda_materialize(const MDA_TYPE* mda, MDA_TYPE* buffer)
+{
+    IFX_ERR_BRV_NULL(mda, nullptr);
+
+    if (mda_is_contiguous(mda))
+        return mda;
+
+    IFX_ERR_BRV_NULL(buffer, nullptr);
+    IFX_ERR_BRV_COND(!IFX_MDA_SAME_SHAPE(mda, buffer), IFX_ERROR_DIMENSION_MISMATCH, nullptr);
+    IFX_ERR_BRV_COND(!mda_is_contiguous(buffer), IFX_ERROR_ARGUMENT_INVALID, nullptr);
+
+    mda_copy(mda, buffer);
+    return buffer;
+}
+
+const ifx_Mda_R_t* ifx_mda_materialize_r(const ifx_Mda_R_t* mda, ifx_Mda_R_t* buffer)
+{
+    return mda_materialize(mda, buffer);
+}
+
+const ifx_Mda_C_t* ifx_mda_materialize_c(const ifx_Mda_C_t* mda, ifx_Mda_C_t* buffer)
+{
+    return mda_materialize(mda, buffer);
 }
 
 template <class MDA_TYPE>
@@ -366,7 +774,18 @@ ifx_Mda_R_t* ifx_mda_clone_r(const ifx_Mda_R_t* mda)
 
 ifx_Mda_C_t* ifx_mda_clone_c(const ifx_Mda_C_t* mda)
 {
-    return mda_clone(mda);
+    IFX_ERR_BRV_NULL(mda, nullptr);
+
+    // the clone uses the same layout as the original
+    auto* clone = IFX_MDA_IS_SPLIT(mda)
+                      ? ifx_mda_create_split_c(IFX_MDA_DIMENSIONS(mda), IFX_MDA_SHAPE(mda))
+                      : ifx_mda_create_c(IFX_MDA_DIMENSIONS(mda), IFX_MDA_SHAPE(mda));
+    if (!clone)
+        return nullptr;
+
+    mda_copy_complex(mda, clone);
+
+    return clone;
 }
 
 template <class MDA_TYPE, class DTYPE>
@@ -403,7 +822,22 @@ void ifx_mda_rawview_r(ifx_Mda_R_t* mda, ifx_Float_t* data, uint32_t dimensions,
 
 void ifx_mda_rawview_c(ifx_Mda_C_t* mda, ifx_Complex_t* data, uint32_t dimensions, const uint32_t* shape, const size_t* stride, uint32_t flags)
 {
-    return mda_rawview(mda, data, dimensions, shape, stride, flags);
+    // split views need the location of the imaginary parts
+    IFX_ERR_BRK_ARGUMENT(flags & IFX_MDA_FLAG_SPLIT_COMPLEX);
+
+    mda_rawview(mda, data, dimensions, shape, stride, flags);
+    if (mda)
+        mda->imag_offset = 0;
+}
+
+void ifx_mda_rawview_split_c(ifx_Mda_C_t* mda, ifx_Float_t* real, ifx_Float_t* imag, uint32_t dimensions, const uint32_t* shape, const size_t* stride)
+{
+    IFX_ERR_BRK_NULL(real);
+    IFX_ERR_BRK_NULL(imag);
+
+    mda_rawview(mda, reinterpret_cast<ifx_Complex_t*>(real), dimensions, shape, stride, IFX_MDA_FLAG_SPLIT_COMPLEX);
+    if (mda)
+        mda->imag_offset = imag - real;
 }
 
 template <class MDA_TYPE, class DTYPE>
@@ -430,6 +864,23 @@ void ifx_mda_clear_r(ifx_Mda_R_t* mda)
 
 void ifx_mda_clear_c(ifx_Mda_C_t* mda)
 {
+    IFX_ERR_BRK_NULL(mda);
+
     const ifx_Complex_t zero = IFX_COMPLEX_DEF(0, 0);
+    if (IFX_MDA_IS_SPLIT(mda))
+    {
+        // real and imaginary parts are not adjacent, so memset cannot be used
+        // on the whole array
+        if (mda_is_contiguous(mda))
+        {
+            const size_t elements = mda_elements(mda);
+            std::memset(IFX_MDA_REAL_DATA(mda), 0, elements * sizeof(ifx_Float_t));
+            std::memset(IFX_MDA_IMAG_DATA(mda), 0, elements * sizeof(ifx_Float_t));
+        }
+        else
+            mda_setall(mda, zero);
+        return;
+    }
+
     mda_clear(mda, zero);
 }
@@ -139,11 +139,20 @@ extern "C"
  * ifx_Mda_R_t view2;
  * IFX_MDA_VIEW_R(&view2, arr, IFX_MDA_INDEX(1), IFX_MDA_SLICE_FULL(), IFX_MDA_SLICE_FULL());
  *
+ * // Reorder dimensions, the shape of view3 is 5x9x7;
+ * // corresponds to numpy's: np.transpose(arr, (2,0,1))
+ * ifx_Mda_R_t view3;
+ * IFX_MDA_PERMUTE_R(&view3, arr, 2, 0, 1);
+ *
  * ifx_mda_destroy_r(arr);
  * @endcode
  *
  * As long as a view is still in use the original array must not be destroyed.
  *
+ * Views never copy data, so a view can have arbitrary strides. If an operation
+ * needs contiguous memory, use \ref ifx_mda_materialize_r to copy the view into
+ * a contiguous buffer only when it is not contiguous already.
+ *
  * @section sect_mda_memory_layout Internal memory layout
  *
  * A multi-dimensional array is internally a contiguous one-dimensional array. The
@@ -206,6 +215,24 @@ extern "C"
  */
 #define IFX_MDA_FLAG_OWNS_DATA 1
 
+/**
+ * @brief Mask in member flags for split complex layout
+ *
+ * Only valid for complex arrays. By default complex arrays store real and
+ * imaginary part of each element next to each other (interleaved, the layout
+ * of \ref ifx_Complex_t). If this flag is set, the array uses a split
+ * layout instead: data points to the real parts, stored as ifx_Float_t
+ * with the given strides, and the imaginary parts are stored with the same
+ * strides imag_offset values of type ifx_Float_t further.
+ *
+ * Split arrays are created with \ref ifx_mda_create_split_c or
+ * \ref ifx_mda_rawview_split_c. \ref IFX_MDA_AT cannot be used for split
+ * arrays, use \ref IFX_MDA_REAL_AT and \ref IFX_MDA_IMAG_AT instead.
+ * Functions that do not support the split layout fail with
+ * IFX_ERROR_NOT_SUPPORTED.
+ */
+#define IFX_MDA_FLAG_SPLIT_COMPLEX 2
+
 typedef struct
 {
     /** Number of dimensions */
@@ -240,6 +267,10 @@ typedef struct
 
     /** Flags */
     uint32_t flags;
+
+    /** Offset from real to imaginary parts in units of ifx_Float_t; only
+     *  used if IFX_MDA_FLAG_SPLIT_COMPLEX is set in flags */
+    ptrdiff_t imag_offset;
 } ifx_Mda_C_t;
 
 /**
@@ -304,6 +335,31 @@ typedef struct
  */
 #define IFX_MDA_OWNS_DATA(arr) (((arr)->flags) & IFX_MDA_FLAG_OWNS_DATA)
 
+/**
+ * @brief True if array uses the split complex layout.
+ */
+#define IFX_MDA_IS_SPLIT(arr) ((((arr)->flags) & IFX_MDA_FLAG_SPLIT_COMPLEX) != 0)
+
+/**
+ * @brief Pointer to the real parts of a split complex array.
+ */
+#define IFX_MDA_REAL_DATA(arr) ((ifx_Float_t*)IFX_MDA_DATA(arr))
+
+/**
+ * @brief Pointer to the imaginary parts of a split complex array.
+ */
+#define IFX_MDA_IMAG_DATA(arr) (IFX_MDA_REAL_DATA(arr) + (arr)->imag_offset)
+
+/**
+ * @brief Access real part of element of a split complex array.
+ */
+#define IFX_MDA_REAL_AT(arr, ...) (IFX_MDA_REAL_DATA(arr)[IFX_MDA_OFFSET((arr), __VA_ARGS__)])
+
+/**
+ * @brief Access imaginary part of element of a split complex array.
+ */
+#define IFX_MDA_IMAG_AT(arr, ...) (IFX_MDA_IMAG_DATA(arr)[IFX_MDA_OFFSET((arr), __VA_ARGS__)])
+
 /**
  * @brief Compute offset for array with given indices.
  *
@@ -363,6 +419,16 @@ static inline size_t ifx_mda_offset(const uint32_t dimensions, const size_t* str
  */
 #define IFX_MDA_CREATE_C(...) ifx_mda_create_c(IFX_MDA_NUMARGS(__VA_ARGS__), IFX_MDA_TO_ARRAY(uint32_t, __VA_ARGS__))
 
+/**
+ * @brief Create multi-dimensional array with complex values in split layout.
+ *
+ * Same as \ref IFX_MDA_CREATE_C but the array uses the split layout, see
+ * \ref IFX_MDA_FLAG_SPLIT_COMPLEX.
+ *
+ * On failure the returned pointer is NULL.
+ */
+#define IFX_MDA_CREATE_SPLIT_C(...) ifx_mda_create_split_c(IFX_MDA_NUMARGS(__VA_ARGS__), IFX_MDA_TO_ARRAY(uint32_t, __VA_ARGS__))
+
 /**
  * @brief Use full dimension.
  *
@@ -430,6 +496,34 @@ static inline size_t ifx_mda_offset(const uint32_t dimensions, const size_t* str
         ifx_mda_view_c((view), (orig), num_slices_, slices_);            \
     } while (0)
 
+/**
+ * @brief Create real view with permuted dimensions.
+ *
+ * The arguments are the axes of orig in the order of the view, e.g.
+ * IFX_MDA_PERMUTE_R(&view, cube, 2, 0, 1) corresponds to numpy's
+ * np.transpose(cube, (2, 0, 1)). See \ref ifx_mda_permute_r.
+ */
+#define IFX_MDA_PERMUTE_R(view, orig, ...)                         \
+    do                                                             \
+    {                                                              \
+        const uint32_t axes_[] = {__VA_ARGS__};                    \
+        const size_t num_axes_ = sizeof(axes_) / sizeof(axes_[0]); \
+        ifx_mda_permute_r((view), (orig), num_axes_, axes_);       \
+    } while (0)
+
+/**
+ * @brief Create complex view with permuted dimensions.
+ *
+ * See \ref IFX_MDA_PERMUTE_R and \ref ifx_mda_permute_c.
+ */
+#define IFX_MDA_PERMUTE_C(view, orig, ...)                         \
+    do                                                             \
+    {                                                              \
+        const uint32_t axes_[] = {__VA_ARGS__};                    \
+        const size_t num_axes_ = sizeof(axes_) / sizeof(axes_[0]); \
+        ifx_mda_permute_c((view), (orig), num_axes_, axes_);       \
+    } while (0)
+
 /**
  * @brief Create real multi-dimensional array.
  *
@@ -452,6 +546,20 @@ IFX_DLL_PUBLIC ifx_Mda_R_t* ifx_mda_create_r(uint32_t dimensions, const uint32_t
  */
 IFX_DLL_PUBLIC ifx_Mda_C_t* ifx_mda_create_c(uint32_t dimensions, const uint32_t shape[]);
 
+/**
+ * @brief Create complex multi-dimensional array in split layout.
+ *
+ * The real parts of all elements are stored in one contiguous block followed
+ * by the imaginary parts, see \ref IFX_MDA_FLAG_SPLIT_COMPLEX.
+ *
+ * Typically it is more convenient to use the macro \ref IFX_MDA_CREATE_SPLIT_C.
+ *
+ * @param dimensions Number of dimensions.
+ * @param shape Array with shape; must have at least dimensions of elements.
+ * @return array    Newly created array.
+ */
+IFX_DLL_PUBLIC ifx_Mda_C_t* ifx_mda_create_split_c(uint32_t dimensions, const uint32_t shape[]);
+
 /**
  * @brief Destroy real array.
  *
@@ -494,6 +602,54 @@ IFX_DLL_PUBLIC void ifx_mda_view_r(ifx_Mda_R_t* view, const ifx_Mda_R_t* orig, s
  */
 IFX_DLL_PUBLIC void ifx_mda_view_c(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig, size_t num_slices, const ifx_mda_slice_t slices[]);
 
+/**
+ * @brief Create real view with permuted dimensions.
+ *
+ * Dimension i of the view is dimension axes[i] of orig. Only shape and
+ * stride of the view are reordered, no data is copied. Use
+ * \ref ifx_mda_copy_r or \ref ifx_mda_materialize_r if the data is needed
+ * in the permuted order in memory.
+ *
+ * @param view Pointer to view.
+ * @param orig Original multi-dimensional array.
+ * @param num_axes Number of elements of axes; must match the dimensions of orig.
+ * @param axes Permutation of 0, 1, ..., num_axes-1.
+ */
+IFX_DLL_PUBLIC void ifx_mda_permute_r(ifx_Mda_R_t* view, const ifx_Mda_R_t* orig, size_t num_axes, const uint32_t axes[]);
+
+/**
+ * @brief Create complex view with permuted dimensions.
+ *
+ * See \ref ifx_mda_permute_r. The view keeps the layout of orig.
+ *
+ * @param view Pointer to view.
+ * @param orig Original multi-dimensional array.
+ * @param num_axes Number of elements of axes; must match the dimensions of orig.
+ * @param axes Permutation of 0, 1, ..., num_axes-1.
+ */
+IFX_DLL_PUBLIC void ifx_mda_permute_c(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig, size_t num_axes, const uint32_t axes[]);
+
+/**
+ * @brief Create transposed real view.
+ *
+ * Reverse the order of the dimensions of orig without copying data. For a
+ * matrix this is the transpose.
+ *
+ * @param view Pointer to view.
+ * @param orig Original multi-dimensional array.
+ */
+IFX_DLL_PUBLIC void ifx_mda_transpose_r(ifx_Mda_R_t* view, const ifx_Mda_R_t* orig);
+
+/**
+ * @brief Create transposed complex view.
+ *
+ * See \ref ifx_mda_transpose_r. Note that the elements are not conjugated.
+ *
+ * @param view Pointer to view.
+ * @param orig Original multi-dimensional array.
+ */
+IFX_DLL_PUBLIC void ifx_mda_transpose_c(ifx_Mda_C_t* view, const ifx_Mda_C_t* orig);
+
 /**
  * @brief Return true if memory is contiguous.
  *
@@ -557,13 +713,44 @@ IFX_DLL_PUBLIC void ifx_mda_copy_r(const ifx_Mda_R_t* src, ifx_Mda_R_t* dest);
 /**
  * @brief Copy array src to dest.
  *
- * src and dest must have the same shapes.
+ * src and dest must have the same shapes. The arrays may use different
+ * layouts, so this function also converts between the interleaved and the
+ * split complex layout (see \ref IFX_MDA_FLAG_SPLIT_COMPLEX).
  *
  * @param src  source array
  * @param dest destination array
  */
 IFX_DLL_PUBLIC void ifx_mda_copy_c(const ifx_Mda_C_t* src, ifx_Mda_C_t* dest);
 
+/**
+ * @brief Return array with contiguous memory.
+ *
+ * If mda is contiguous, mda is returned and buffer is not touched. Otherwise
+ * mda is copied to buffer, which must be contiguous and have the same shape
+ * as mda, and buffer is returned. Typical use is to make a (permuted) view
+ * contiguous right before an operation that needs contiguous memory.
+ *
+ * Copies from strided views are done row by row if possible, and as tiled
+ * transpose if the innermost dimension of buffer is strided in mda.
+ *
+ * @param mda    array
+ * @param buffer contiguous array with the same shape as mda (may be NULL if mda is contiguous)
+ * @return mda or buffer; NULL on error
+ */
+IFX_DLL_PUBLIC const ifx_Mda_R_t* ifx_mda_materialize_r(const ifx_Mda_R_t* mda, ifx_Mda_R_t* buffer);
+
+/**
+ * @brief Return array with contiguous memory.
+ *
+ * See \ref ifx_mda_materialize_r. If mda has to be copied, it is
+ * converted to the layout of buffer.
+ *
+ * @param mda    array
+ * @param buffer contiguous array with the same shape as mda (may be NULL if mda is contiguous)
+ * @return mda or buffer; NULL on error
+ */
+IFX_DLL_PUBLIC const ifx_Mda_C_t* ifx_mda_materialize_c(const ifx_Mda_C_t* mda, ifx_Mda_C_t* buffer);
+
 /**
  * @brief Create copy of array.
  *
@@ -578,8 +765,8 @@ IFX_DLL_PUBLIC ifx_Mda_R_t* ifx_mda_clone_r(const ifx_Mda_R_t* mda);
 /**
  * @brief Create copy of array.
  *
- * Return a copy of the array mda. The caller is responsible to free the
- * returned array by calling \ref ifx_mda_destroy_c.
+ * Return a copy of the array mda with the same layout. The caller is
+ * responsible to free the returned array by calling \ref ifx_mda_destroy_c.
  *
  * @param mda array
  * @return copy copy of array mda
@@ -614,6 +801,22 @@ IFX_DLL_PUBLIC void ifx_mda_rawview_r(ifx_Mda_R_t* mda, ifx_Float_t* data, uint3
  */
 IFX_DLL_PUBLIC void ifx_mda_rawview_c(ifx_Mda_C_t* mda, ifx_Complex_t* data, uint32_t dimensions, const uint32_t* shape, const size_t* stride, uint32_t flags);
 
+/**
+ * @brief Create a raw view of a complex muti-dimensional array in split layout.
+ *
+ * Initialize the multi-dimensional array mda with the given parameters. The
+ * real and imaginary parts are taken from the separate buffers real and imag,
+ * both accessed with the same stride. The view does not own the data.
+ *
+ * @param [out] mda         multi-dimensional array
+ * @param [in] real         pointer to real parts
+ * @param [in] imag         pointer to imaginary parts
+ * @param [in] dimensions   number of dimensions
+ * @param [in] shape        array with shape (must have at least dimensions of elements)
+ * @param [in] stride       array with stride (must have at least dimensions of elements)
+ */
+IFX_DLL_PUBLIC void ifx_mda_rawview_split_c(ifx_Mda_C_t* mda, ifx_Float_t* real, ifx_Float_t* imag, uint32_t dimensions, const uint32_t* shape, const size_t* stride);
+
 /**
  * @brief Clear multi-dimensional array.
  *
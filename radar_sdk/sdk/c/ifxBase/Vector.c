@@ -40,7 +40,7 @@
 #include "Defines.h"
 #include "Error.h"
 #include "internal/Macros.h"
-#include "internal/Simd.h"
+#include "internal/Kernels.h"
 #include "internal/Util.h"
 #include "Math.h"
 #include "Mem.h"
@@ -54,6 +54,9 @@
 
 const ifx_Float_t clipping_value_for_db = 1e-6f;
 
+/* Vectors with unit stride are passed directly to the kernels. */
+#define CONTIGUOUS(v) (vStride(v) == 1)
+
 /*
 ==============================================================================
    5. LOCAL FUNCTION PROTOTYPES
@@ -99,93 +102,6 @@ static int median_rank(
 ==============================================================================
 */
 
-#ifdef IFX_SSE2
-/**
- * @brief Compute dot product between x and y
- *
- * Compute the dot product between the vectors x and y of length len. Use SSE2
- * to speed up the computation as much as possible.
- *
- * @param [in]  x       array of len elements
- * @param [in]  y       array of len elements
- * @param [in]  len     length of arrays x and y
- * @retval dot product between x and y
- */
-static float dot_sse2(const float* x, const float* y, size_t len)
-{
-    vf32x4 vv;
-
-    // len rounded down to the next integer divisable by 4
-    const size_t len_truncated4 = len & ~3;
-
-    // len rounded down to the next integer divisable by 16
-    const size_t len_truncated16 = len & ~15;
-
-    // Compute the dot product of the first len_truncated16 elements
-    {
-        vf32x4 vv0 = vf32x4_setzero();  // vv0 = 0
-        vf32x4 vv1 = vf32x4_setzero();  // vv1 = 0
-        vf32x4 vv2 = vf32x4_setzero();  // vv2 = 0
-        vf32x4 vv3 = vf32x4_setzero();  // vv3 = 0
-
-        // Compute the dot product using SSE2 instructions. Use four SSE2
-        // vectors with 4 elements each to utilize the CPU pipeline as much as
-        // possible.
-        for (size_t i = 0; i < len_truncated16; i += 16)
-        {
-            vf32x4 x0 = vf32x4_loadu(&x[i + 0]);
-            vf32x4 y0 = vf32x4_loadu(&y[i + 0]);
-
-            vf32x4 x1 = vf32x4_loadu(&x[i + 4]);
-            vf32x4 y1 = vf32x4_loadu(&y[i + 4]);
-
-            vf32x4 x2 = vf32x4_loadu(&x[i + 8]);
-            vf32x4 y2 = vf32x4_loadu(&y[i + 8]);
-
-            vf32x4 x3 = vf32x4_loadu(&x[i + 12]);
-            vf32x4 y3 = vf32x4_loadu(&y[i + 12]);
-
-            vf32x4 m0 = vf32x4_mul(x0, y0);  // x0*y0
-            vf32x4 m1 = vf32x4_mul(x1, y1);  // x1*y1
-            vf32x4 m2 = vf32x4_mul(x2, y2);  // x2*y2
-            vf32x4 m3 = vf32x4_mul(x3, y3);  // x3*y3
-
-            vv0 = vf32x4_add(vv0, m0);       // vv0 += x0*y0
-            vv1 = vf32x4_add(vv1, m1);       // vv1 += x1*y1
-            vv2 = vf32x4_add(vv2, m2);       // vv2 += x2*y2
-            vv3 = vf32x4_add(vv3, m3);       // vv3 += x3*y3
-        }
-
-        vf32x4 vv01 = vf32x4_add(vv0, vv1);  // vv01 = vv0 + vv1
-        vf32x4 vv23 = vf32x4_add(vv2, vv3);  // vv23 = vv2 + vv3
-
-        vv = vf32x4_add(vv01, vv23);         // vv = vv01 + vv23
-    }
-
-    for (size_t i = len_truncated16; i < len_truncated4; i += 4)
-    {
-        vf32x4 x0 = vf32x4_loadu(&x[i]);
-        vf32x4 y0 = vf32x4_loadu(&y[i]);
-
-        vv = vf32x4_mla(vv, x0, y0);  // vv += x0 + y0
-    }
-
-    // compute the sum of the vector vv
-    float v = vf32x4_extract1(vv, 0);
-    v += vf32x4_extract1(vv, 1);
-    v += vf32x4_extract1(vv, 2);
-    v += vf32x4_extract1(vv, 3);
-
-    // compute the dot element for the remaining elements
-    for (size_t i = len_truncated4; i < len; i++)
-    {
-        v += x[i] * y[i];
-    }
-
-    return v;
-}
-#endif
-
 //----------------------------------------------------------------------------
 
 /*
@@ -286,6 +202,16 @@ ifx_Vector_C_t* ifx_vec_create_c(uint32_t length)
 
 //----------------------------------------------------------------------------
 
+ifx_Vector_C_t* ifx_vec_create_split_c(uint32_t length)
+{
+    ifx_Vector_C_t* v = IFX_MDA_CREATE_SPLIT_C(length);
+    if (v)
+        ifx_mda_clear_c(v);
+    return v;
+}
+
+//----------------------------------------------------------------------------
+
 ifx_Vector_R_t* ifx_vec_clone_r(const ifx_Vector_R_t* vector)
 {
     IFX_VEC_BRV_VALID(vector, NULL);
@@ -297,7 +223,7 @@ ifx_Vector_R_t* ifx_vec_clone_r(const ifx_Vector_R_t* vector)
 
 ifx_Vector_C_t* ifx_vec_clone_c(const ifx_Vector_C_t* vector)
 {
-    IFX_VEC_BRV_VALID(vector, NULL);
+    IFX_VEC_BRV_VALID_ANY_LAYOUT(vector, NULL);
 
     return ifx_mda_clone_c(vector);
 }
@@ -384,7 +310,7 @@ void ifx_vec_copy_r(const ifx_Vector_R_t* vector,
 void ifx_vec_copy_c(const ifx_Vector_C_t* vector,
                     ifx_Vector_C_t* target)
 {
-    IFX_VEC_BRK_VALID(vector);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(vector);
 
     ifx_mda_copy_c(vector, target);
 }
@@ -610,6 +536,11 @@ ifx_Float_t ifx_vec_sum_r(const ifx_Vector_R_t* vector)
 {
     IFX_VEC_BRV_VALID(vector, 0);
 
+    if (CONTIGUOUS(vector))
+    {
+        return ifx_kernels_get()->sum_r(vDat(vector), vLen(vector));
+    }
+
     /* Use the Kahan summation algorithm to reduce numerical error.
      *
      * The algorithm is taken from Wikipedia, see
@@ -638,6 +569,11 @@ ifx_Complex_t ifx_vec_sum_c(const ifx_Vector_C_t* vector)
 
     IFX_VEC_BRV_VALID(vector, sum);
 
+    if (CONTIGUOUS(vector))
+    {
+        return ifx_kernels_get()->sum_c(vDat(vector), vLen(vector));
+    }
+
     const uint32_t length = vLen(vector);
 
     for (uint32_t i = 0; i < length; i++)
@@ -654,6 +590,11 @@ ifx_Float_t ifx_vec_sqsum_r(const ifx_Vector_R_t* vector)
 {
     IFX_VEC_BRV_VALID(vector, 0);
 
+    if (CONTIGUOUS(vector))
+    {
+        return ifx_kernels_get()->dot_r(vDat(vector), vDat(vector), vLen(vector));
+    }
+
     ifx_Float_t result = 0.f;
     const uint32_t length = vLen(vector);
 
@@ -672,6 +613,13 @@ ifx_Float_t ifx_vec_sqsum_c(const ifx_Vector_C_t* vector)
 {
     IFX_VEC_BRV_VALID(vector, 0);
 
+    if (CONTIGUOUS(vector))
+    {
+        const size_t n = 2 * (size_t)vLen(vector);
+        const ifx_Float_t* data = (const ifx_Float_t*)vDat(vector);
+        return ifx_kernels_get()->dot_r(data, data, n);
+    }
+
     ifx_Float_t result = 0.f;
     const uint32_t length = vLen(vector);
 
@@ -833,6 +781,12 @@ void ifx_vec_add_r(const ifx_Vector_R_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->add_r(vDat(v1), vDat(v2), vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = vAt(v1, i) + vAt(v2, i);
@@ -851,6 +805,12 @@ void ifx_vec_add_c(const ifx_Vector_C_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->add_r((const ifx_Float_t*)vDat(v1), (const ifx_Float_t*)vDat(v2), (ifx_Float_t*)vDat(result), 2 * (size_t)vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = ifx_complex_add(vAt(v1, i), vAt(v2, i));
@@ -869,6 +829,12 @@ void ifx_vec_sub_r(const ifx_Vector_R_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->sub_r(vDat(v1), vDat(v2), vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = vAt(v1, i) - vAt(v2, i);
@@ -887,6 +853,12 @@ void ifx_vec_sub_c(const ifx_Vector_C_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->sub_r((const ifx_Float_t*)vDat(v1), (const ifx_Float_t*)vDat(v2), (ifx_Float_t*)vDat(result), 2 * (size_t)vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = ifx_complex_sub(vAt(v1, i), vAt(v2, i));
@@ -905,6 +877,12 @@ void ifx_vec_mul_r(const ifx_Vector_R_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->mul_r(vDat(v1), vDat(v2), vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = vAt(v1, i) * vAt(v2, i);
@@ -923,6 +901,12 @@ void ifx_vec_mul_c(const ifx_Vector_C_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->mul_c(vDat(v1), vDat(v2), vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = ifx_complex_mul(vAt(v1, i), vAt(v2, i));
@@ -941,6 +925,12 @@ void ifx_vec_mul_cr(const ifx_Vector_C_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->mul_cr(vDat(v1), vDat(v2), vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = ifx_complex_mul_real(vAt(v1, i), vAt(v2, i));
@@ -956,6 +946,12 @@ void ifx_vec_abs_r(const ifx_Vector_R_t* input,
     IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->abs_r(vDat(input), vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = FABS(vAt(input, i));
@@ -967,10 +963,32 @@ void ifx_vec_abs_r(const ifx_Vector_R_t* input,
 void ifx_vec_abs_c(const ifx_Vector_C_t* input,
                    ifx_Vector_R_t* output)
 {
-    IFX_VEC_BRK_VALID(input);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(input);
     IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (IFX_MDA_IS_SPLIT(input))
+    {
+        if (CONTIGUOUS(input) && CONTIGUOUS(output))
+        {
+            ifx_kernels_get()->abs_s(IFX_MDA_REAL_DATA(input), IFX_MDA_IMAG_DATA(input), vDat(output), vLen(input));
+            return;
+        }
+
+        for (uint32_t i = 0; i < vLen(input); ++i)
+        {
+            const ifx_Complex_t z = IFX_COMPLEX_DEF(vReAt(input, i), vImAt(input, i));
+            vAt(output, i) = ifx_complex_abs(z);
+        }
+        return;
+    }
+
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->abs_c(vDat(input), vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = ifx_complex_abs(vAt(input, i));
@@ -1002,6 +1020,12 @@ void ifx_vec_sub_rs(const ifx_Vector_R_t* input,
     IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->add_rs(vDat(input), -scalar_value, vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = vAt(input, i) - scalar_value;
@@ -1018,6 +1042,14 @@ void ifx_vec_sub_cs(const ifx_Vector_C_t* input,
     IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_Complex_t neg;
+        IFX_COMPLEX_SET(neg, -IFX_COMPLEX_REAL(scalar_value), -IFX_COMPLEX_IMAG(scalar_value));
+        ifx_kernels_get()->add_cs(vDat(input), neg, vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = ifx_complex_sub(vAt(input, i), scalar_value);
@@ -1034,6 +1066,12 @@ void ifx_vec_scale_r(const ifx_Vector_R_t* input,
     IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->scale_r(vDat(input), scale, vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = vAt(input, i) * scale;
@@ -1062,10 +1100,39 @@ void ifx_vec_scale_c(const ifx_Vector_C_t* input,
                      ifx_Complex_t scale,
                      ifx_Vector_C_t* output)
 {
-    IFX_VEC_BRK_VALID(input);
-    IFX_VEC_BRK_VALID(output);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(input);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (IFX_MDA_IS_SPLIT(input) || IFX_MDA_IS_SPLIT(output))
+    {
+        IFX_ERR_BRK_COND(!IFX_MDA_IS_SPLIT(input) || !IFX_MDA_IS_SPLIT(output), IFX_ERROR_NOT_SUPPORTED);
+
+        if (CONTIGUOUS(input) && CONTIGUOUS(output))
+        {
+            ifx_kernels_get()->scale_s(IFX_MDA_REAL_DATA(input), IFX_MDA_IMAG_DATA(input), scale,
+                                       IFX_MDA_REAL_DATA(output), IFX_MDA_IMAG_DATA(output), vLen(input));
+            return;
+        }
+
+        const ifx_Float_t sr = IFX_COMPLEX_REAL(scale);
+        const ifx_Float_t si = IFX_COMPLEX_IMAG(scale);
+        for (uint32_t i = 0; i < vLen(input); ++i)
+        {
+            const ifx_Float_t re = vReAt(input, i);
+            const ifx_Float_t im = vImAt(input, i);
+            vReAt(output, i) = re * sr - im * si;
+            vImAt(output, i) = re * si + im * sr;
+        }
+        return;
+    }
+
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->scale_c(vDat(input), scale, vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = ifx_complex_mul(vAt(input, i), scale);
@@ -1082,6 +1149,12 @@ void ifx_vec_scale_cr(const ifx_Vector_C_t* input,
     IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->scale_r((const ifx_Float_t*)vDat(input), scale, (ifx_Float_t*)vDat(output), 2 * (size_t)vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); ++i)
     {
         vAt(output, i) = ifx_complex_mul_real(vAt(input, i), scale);
@@ -1123,6 +1196,12 @@ void ifx_vec_mac_r(const ifx_Vector_R_t* v1,
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->mac_r(vDat(v1), vDat(v2), scale, vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = vAt(v1, i) + (scale * vAt(v2, i));
@@ -1136,12 +1215,42 @@ void ifx_vec_mac_c(const ifx_Vector_C_t* v1,
                    ifx_Complex_t scale,
                    ifx_Vector_C_t* result)
 {
-    IFX_VEC_BRK_VALID(v1);
-    IFX_VEC_BRK_VALID(v2);
-    IFX_VEC_BRK_VALID(result);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(v1);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(v2);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(result);
     IFX_VEC_BRK_DIM(v1, v2);
     IFX_VEC_BRK_DIM(v1, result);
 
+    if (IFX_MDA_IS_SPLIT(v1) || IFX_MDA_IS_SPLIT(v2) || IFX_MDA_IS_SPLIT(result))
+    {
+        IFX_ERR_BRK_COND(!IFX_MDA_IS_SPLIT(v1) || !IFX_MDA_IS_SPLIT(v2) || !IFX_MDA_IS_SPLIT(result), IFX_ERROR_NOT_SUPPORTED);
+
+        if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+        {
+            ifx_kernels_get()->mac_s(IFX_MDA_REAL_DATA(v1), IFX_MDA_IMAG_DATA(v1),
+                                     IFX_MDA_REAL_DATA(v2), IFX_MDA_IMAG_DATA(v2), scale,
+                                     IFX_MDA_REAL_DATA(result), IFX_MDA_IMAG_DATA(result), vLen(v1));
+            return;
+        }
+
+        const ifx_Float_t sr = IFX_COMPLEX_REAL(scale);
+        const ifx_Float_t si = IFX_COMPLEX_IMAG(scale);
+        for (uint32_t i = 0; i < vLen(v1); ++i)
+        {
+            const ifx_Float_t re = vReAt(v2, i);
+            const ifx_Float_t im = vImAt(v2, i);
+            vReAt(result, i) = vReAt(v1, i) + (re * sr - im * si);
+            vImAt(result, i) = vImAt(v1, i) + (re * si + im * sr);
+        }
+        return;
+    }
+
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2) && CONTIGUOUS(result))
+    {
+        ifx_kernels_get()->mac_c(vDat(v1), vDat(v2), scale, vDat(result), vLen(v1));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(v1); ++i)
     {
         vAt(result, i) = ifx_complex_add(vAt(v1, i), ifx_complex_mul(vAt(v2, i), scale));
@@ -1254,7 +1363,7 @@ void ifx_vec_clear_r(ifx_Vector_R_t* vector)
 
 void ifx_vec_clear_c(ifx_Vector_C_t* vector)
 {
-    IFX_VEC_BRK_VALID(vector);
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(vector);
 
     ifx_mda_clear_c(vector);
 }
@@ -1385,19 +1494,13 @@ ifx_Float_t ifx_vec_dot2_r(const ifx_Vector_R_t* v1, const ifx_Vector_R_t* v2, u
     IFX_ERR_BRV_COND(offset_v1 + len > vLen(v1), IFX_ERROR_DIMENSION_MISMATCH, IFX_NAN);
     IFX_ERR_BRV_COND(offset_v2 + len > vLen(v2), IFX_ERROR_DIMENSION_MISMATCH, IFX_NAN);
 
-#ifdef IFX_SSE2
-    // We can use the SSE2 version of the dot product if:
-    //  - SSE2 is available
-    //  - the strides of v1 and v2 are 1
-    //  - ifx_Float_t corresponds to float (and not double)
-    if (vStride(v1) == 1 && vStride(v2) == 1 && sizeof(ifx_Float_t) == sizeof(float))
+    if (CONTIGUOUS(v1) && CONTIGUOUS(v2))
     {
-        const ifx_Float_t* x_ptr = IFX_MDA_DATA(v1) + offset_v1;
-        const ifx_Float_t* y_ptr = IFX_MDA_DATA(v2) + offset_v2;
+        const ifx_Float_t* x_ptr = vDat(v1) + offset_v1;
+        const ifx_Float_t* y_ptr = vDat(v2) + offset_v2;
 
-        return dot_sse2(x_ptr, y_ptr, len);
+        return ifx_kernels_get()->dot_r(x_ptr, y_ptr, len);
     }
-#endif
 
     // naive implementation
     ifx_Float_t s = 0;
@@ -1531,8 +1634,33 @@ ifx_Float_t ifx_vec_difference_deviation_r(const ifx_Vector_R_t* v1, const ifx_V
 
 void ifx_vec_squared_norm_c(const ifx_Vector_C_t* input, ifx_Vector_R_t* output)
 {
+    IFX_VEC_BRK_VALID_ANY_LAYOUT(input);
+    IFX_VEC_BRK_VALID(output);
     IFX_VEC_BRK_DIM(input, output);
 
+    if (IFX_MDA_IS_SPLIT(input))
+    {
+        if (CONTIGUOUS(input) && CONTIGUOUS(output))
+        {
+            ifx_kernels_get()->sqnorm_s(IFX_MDA_REAL_DATA(input), IFX_MDA_IMAG_DATA(input), vDat(output), vLen(input));
+            return;
+        }
+
+        for (uint32_t i = 0; i < vLen(input); i++)
+        {
+            const ifx_Float_t real = vReAt(input, i);
+            const ifx_Float_t imag = vImAt(input, i);
+            vAt(output, i) = real * real + imag * imag;
+        }
+        return;
+    }
+
+    if (CONTIGUOUS(input) && CONTIGUOUS(output))
+    {
+        ifx_kernels_get()->sqnorm_c(vDat(input), vDat(output), vLen(input));
+        return;
+    }
+
     for (uint32_t i = 0; i < vLen(input); i++)
     {
         const ifx_Complex_t z = vAt(input, i);
@@ -89,20 +89,32 @@ extern "C"
 #define IFX_VEC_BRK_VEC_BOUNDS(v, idx) IFX_ERR_BRK_COND((idx) >= IFX_VEC_LEN(v), IFX_ERROR_ARGUMENT_OUT_OF_BOUNDS)
 #define IFX_VEC_BRF_VEC_BOUNDS(v, idx) IFX_ERR_BRF_COND((idx) >= IFX_VEC_LEN(v), IFX_ERROR_ARGUMENT_OUT_OF_BOUNDS)
 
-#define IFX_VEC_BRK_VALID(m)                                                        \
+#define IFX_VEC_BRK_VALID_ANY_LAYOUT(m)                                             \
     do                                                                              \
     {                                                                               \
         IFX_ERR_BRK_NULL(m);                                                        \
         IFX_ERR_BRK_COND(IFX_MDA_DIMENSIONS(m) != 1, IFX_ERROR_DIMENSION_MISMATCH); \
         IFX_ERR_BRK_ARGUMENT(vDat(m) == NULL);                                      \
     } while (0)
-#define IFX_VEC_BRV_VALID(m, r)                                                        \
+#define IFX_VEC_BRK_VALID(m)                                            \
+    do                                                                  \
+    {                                                                   \
+        IFX_VEC_BRK_VALID_ANY_LAYOUT(m);                                \
+        IFX_ERR_BRK_COND(IFX_MDA_IS_SPLIT(m), IFX_ERROR_NOT_SUPPORTED); \
+    } while (0)
+#define IFX_VEC_BRV_VALID_ANY_LAYOUT(m, r)                                             \
     do                                                                                 \
     {                                                                                  \
         IFX_ERR_BRV_NULL(m, r);                                                        \
         IFX_ERR_BRV_COND(IFX_MDA_DIMENSIONS(m) != 1, IFX_ERROR_DIMENSION_MISMATCH, r); \
         IFX_ERR_BRV_ARGUMENT(vDat(m) == NULL, r);                                      \
     } while (0)
+#define IFX_VEC_BRV_VALID(m, r)                                            \
+    do                                                                     \
+    {                                                                      \
+        IFX_VEC_BRV_VALID_ANY_LAYOUT(m, r);                                \
+        IFX_ERR_BRV_COND(IFX_MDA_IS_SPLIT(m), IFX_ERROR_NOT_SUPPORTED, r); \
+    } while (0)
 
 /*
 ==============================================================================
@@ -299,6 +311,22 @@ ifx_Vector_R_t* ifx_vec_create_r(uint32_t length);
 IFX_DLL_PUBLIC
 ifx_Vector_C_t* ifx_vec_create_c(uint32_t length);
 
+/**
+ * @brief Allocates memory for a complex vector in split layout for a
+ *        specified number of elements and initializes it to zero.
+ *
+ * Real and imaginary parts are stored in separate blocks, see
+ * \ref IFX_MDA_FLAG_SPLIT_COMPLEX. Only functions documented to support the
+ * split layout accept such a vector.
+ *
+ * @param [in]     length    Number of elements in the array
+ *
+ * @return Pointer to allocated and initialized complex vector structure or NULL if allocation failed.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_Vector_C_t* ifx_vec_create_split_c(uint32_t length);
+
 /**
  * @brief Clones a real vector \ref ifx_Vector_R_t
  *
@@ -0,0 +1,157 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file Gemm.h
+ *
+ * @brief Blocked matrix-matrix products
+ *
+ * The functions compute C = op(A) * op(B) for general strided matrices. The
+ * matrices are described by a pointer to the first element, a row stride and
+ * a column stride (both in elements), so transposed operands are passed by
+ * swapping the strides. Complex operands can additionally be conjugated.
+ *
+ * The products are computed with the usual cache blocking: blocks of A and B
+ * are packed into contiguous panels which are then multiplied by the micro
+ * kernels gemm_r and gemm_c of the kernel table (see internal/Kernels.h).
+ * The Hermitian (symmetric) products A*A^H (A*A^T) compute only the lower
+ * triangle and mirror it.
+ *
+ * C must not overlap with A or B. If the internal buffers cannot be
+ * allocated, the error IFX_ERROR_MEMORY_ALLOCATION_FAILED is set and C is
+ * left unchanged.
+ */
+
+#ifndef IFX_BASE_INTERNAL_GEMM_H
+#define IFX_BASE_INTERNAL_GEMM_H
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "../Types.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Real matrix product C = A * B
+ *
+ * @param [in]     m         number of rows of A and C
+ * @param [in]     n         number of columns of B and C
+ * @param [in]     k         number of columns of A and rows of B
+ * @param [in]     a         first element of A
+ * @param [in]     rsa       row stride of A
+ * @param [in]     csa       column stride of A
+ * @param [in]     b         first element of B
+ * @param [in]     rsb       row stride of B
+ * @param [in]     csb       column stride of B
+ * @param [out]    c         first element of C
+ * @param [in]     rsc       row stride of C
+ * @param [in]     csc       column stride of C
+ */
+IFX_DLL_PUBLIC
+void ifx_gemm_r(size_t m, size_t n, size_t k,
+                const ifx_Float_t* a, size_t rsa, size_t csa,
+                const ifx_Float_t* b, size_t rsb, size_t csb,
+                ifx_Float_t* c, size_t rsc, size_t csc);
+
+/**
+ * @brief Complex matrix product C = op(A) * op(B)
+ *
+ * op(X) is X if the corresponding conj flag is false and the complex
+ * conjugate of X (without transposition) otherwise. The remaining arguments
+ * are the same as for \ref ifx_gemm_r.
+ */
+IFX_DLL_PUBLIC
+void ifx_gemm_c(size_t m, size_t n, size_t k,
+                const ifx_Complex_t* a, size_t rsa, size_t csa, bool conj_a,
+                const ifx_Complex_t* b, size_t rsb, size_t csb, bool conj_b,
+                ifx_Complex_t* c, size_t rsc, size_t csc);
+
+/**
+ * @brief Symmetric product C = A * A^T
+ *
+ * A is a real n x k matrix, C a real n x n matrix. Only half of the products
+ * are computed.
+ */
+IFX_DLL_PUBLIC
+void ifx_syrk_r(size_t n, size_t k,
+                const ifx_Float_t* a, size_t rsa, size_t csa,
+                ifx_Float_t* c, size_t rsc, size_t csc);
+
+/**
+ * @brief Hermitian product C = A * A^H
+ *
+ * A is a complex n x k matrix, C a complex n x n matrix. Only half of the
+ * products are computed; the imaginary parts of the diagonal are exactly 0.
+ */
+IFX_DLL_PUBLIC
+void ifx_herk_c(size_t n, size_t k,
+                const ifx_Complex_t* a, size_t rsa, size_t csa,
+                ifx_Complex_t* c, size_t rsc, size_t csc);
+
+/**
+ * @brief Batched complex matrix product C_i = A_i * B_i
+ *
+ * A, B, and C are stacks of batch contiguous row-major matrices of
+ * dimensions m x k, k x n, and m x n, respectively. The packing buffers are
+ * shared by all products of the batch.
+ */
+IFX_DLL_PUBLIC
+void ifx_gemm_batch_c(size_t batch, size_t m, size_t n, size_t k,
+                      const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* c);
+
+/**
+ * @brief Batched Hermitian product C_i = A_i * A_i^H
+ *
+ * A is a stack of batch contiguous row-major n x k matrices, C a stack of
+ * batch contiguous row-major n x n matrices.
+ */
+IFX_DLL_PUBLIC
+void ifx_herk_batch_c(size_t batch, size_t n, size_t k,
+                      const ifx_Complex_t* a, ifx_Complex_t* c);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif /* IFX_BASE_INTERNAL_GEMM_H */
@@ -0,0 +1,277 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file Kernels.h
+ *
+ * @brief Runtime dispatched compute kernels for contiguous arrays
+ *
+ * The kernels operate on plain contiguous arrays (stride 1). Complex arrays
+ * are interleaved, i.e., real and imaginary part of each element follow each
+ * other in memory (the layout of \ref ifx_Complex_t). Kernels with the suffix
+ * _s work on split complex arrays where real and imaginary parts are stored
+ * in two separate arrays (see \ref IFX_MDA_FLAG_SPLIT_COMPLEX).
+ *
+ * On the first call of \ref ifx_kernels_get the instruction sets supported by
+ * the CPU are determined and the fastest implementation of each kernel is
+ * selected. The vector, matrix and cube functions use the kernels whenever the
+ * involved arrays have a contiguous innermost dimension and fall back to the
+ * strided loops otherwise.
+ */
+
+#ifndef IFX_BASE_INTERNAL_KERNELS_H
+#define IFX_BASE_INTERNAL_KERNELS_H
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "../Types.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+==============================================================================
+   2. DEFINITIONS
+==============================================================================
+*/
+
+/** Number of rows of a GEMM micro tile */
+#define IFX_KERNELS_GEMM_MR 4
+
+/** Number of columns of a real GEMM micro tile */
+#define IFX_KERNELS_GEMM_NR 8
+
+/** Number of columns of a complex GEMM micro tile */
+#define IFX_KERNELS_GEMM_NR_C 4
+
+/*
+==============================================================================
+   3. TYPES
+==============================================================================
+*/
+
+/**
+ * @brief Instruction set used by a kernel table
+ */
+typedef enum
+{
+    IFX_KERNEL_ISA_SCALAR = 0, /**< portable C implementation */
+    IFX_KERNEL_ISA_SSE2 = 1,   /**< x86 SSE2 */
+    IFX_KERNEL_ISA_SSSE3 = 2,  /**< x86 SSSE3 */
+    IFX_KERNEL_ISA_AVX2 = 3,   /**< x86 AVX2 and FMA */
+    IFX_KERNEL_ISA_AVX512 = 4, /**< x86 AVX-512F */
+    IFX_KERNEL_ISA_NEON = 5    /**< ARMv8 Advanced SIMD */
+} ifx_Kernel_Isa_t;
+
+/**
+ * @brief Bit layout of two 12 bit samples s0, s1 packed into three bytes b0, b1, b2
+ */
+typedef enum
+{
+    IFX_KERNEL_PACKED12 = 0, /**< s0 = b0 << 4 | b1 >> 4, s1 = (b1 & 0xf) << 8 | b2 */
+    IFX_KERNEL_RAW12 = 1     /**< s0 = b0 << 4 | (b2 & 0xf), s1 = b1 << 4 | b2 >> 4 */
+} ifx_Kernel_Unpack12_t;
+
+/**
+ * @brief Table of compute kernels
+ *
+ * All kernels allow the output to be identical to one of the inputs (in-place
+ * operation). Other overlaps between inputs and outputs are not allowed.
+ *
+ * The argument n is always the number of elements (complex numbers for
+ * complex arrays), not the number of floats.
+ */
+typedef struct
+{
+    /** Instruction set of the most specialized kernels in this table */
+    ifx_Kernel_Isa_t isa;
+
+    /** out[i] = a[i] + b[i] */
+    void (*add_r)(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n);
+    /** out[i] = a[i] - b[i] */
+    void (*sub_r)(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n);
+    /** out[i] = a[i] * b[i] */
+    void (*mul_r)(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* out, size_t n);
+    /** out[i] = a[i] + s */
+    void (*add_rs)(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n);
+    /** out[i] = a[i] * s */
+    void (*scale_r)(const ifx_Float_t* a, ifx_Float_t s, ifx_Float_t* out, size_t n);
+    /** out[i] = a[i] + s * b[i] */
+    void (*mac_r)(const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t s, ifx_Float_t* out, size_t n);
+    /** out[i] = |a[i]| */
+    void (*abs_r)(const ifx_Float_t* a, ifx_Float_t* out, size_t n);
+    /** sum of a[i] using compensated (Kahan) summation */
+    ifx_Float_t (*sum_r)(const ifx_Float_t* a, size_t n);
+    /** sum of a[i] * b[i] */
+    ifx_Float_t (*dot_r)(const ifx_Float_t* a, const ifx_Float_t* b, size_t n);
+
+    /** out[i] = a[i] * b[i] */
+    void (*mul_c)(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t* out, size_t n);
+    /** out[i] = a[i] * b[i] with real b */
+    void (*mul_cr)(const ifx_Complex_t* a, const ifx_Float_t* b, ifx_Complex_t* out, size_t n);
+    /** out[i] = a[i] + s */
+    void (*add_cs)(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n);
+    /** out[i] = a[i] * s */
+    void (*scale_c)(const ifx_Complex_t* a, ifx_Complex_t s, ifx_Complex_t* out, size_t n);
+    /** out[i] = a[i] + b[i] * s */
+    void (*mac_c)(const ifx_Complex_t* a, const ifx_Complex_t* b, ifx_Complex_t s, ifx_Complex_t* out, size_t n);
+    /** out[i] = |a[i]| */
+    void (*abs_c)(const ifx_Complex_t* a, ifx_Float_t* out, size_t n);
+    /** out[i] = |a[i]|^2 */
+    void (*sqnorm_c)(const ifx_Complex_t* a, ifx_Float_t* out, size_t n);
+    /** sum of a[i] */
+    ifx_Complex_t (*sum_c)(const ifx_Complex_t* a, size_t n);
+
+    /** re[i] = real(a[i]), im[i] = imag(a[i]) */
+    void (*deinterleave_c)(const ifx_Complex_t* a, ifx_Float_t* re, ifx_Float_t* im, size_t n);
+    /** out[i] = re[i] + j*im[i] */
+    void (*interleave_c)(const ifx_Float_t* re, const ifx_Float_t* im, ifx_Complex_t* out, size_t n);
+
+    /** out[i] = |a[i]| with split complex a */
+    void (*abs_s)(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n);
+    /** out[i] = |a[i]|^2 with split complex a */
+    void (*sqnorm_s)(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Float_t* out, size_t n);
+    /** out[i] = a[i] * s with split complex a and out */
+    void (*scale_s)(const ifx_Float_t* a_re, const ifx_Float_t* a_im, ifx_Complex_t s,
+                    ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n);
+    /** out[i] = a[i] + b[i] * s with split complex a, b and out */
+    void (*mac_s)(const ifx_Float_t* a_re, const ifx_Float_t* a_im,
+                  const ifx_Float_t* b_re, const ifx_Float_t* b_im, ifx_Complex_t s,
+                  ifx_Float_t* out_re, ifx_Float_t* out_im, size_t n);
+
+    /** GEMM micro kernel for real matrices
+     *
+     * Computes the MR x NR tile ab (row-major) as the product of the packed
+     * panels a and b, i.e., ab[i*NR+j] = sum of a[l*MR+i] * b[l*NR+j] over
+     * l = 0..k-1. The tile is overwritten.
+     */
+    void (*gemm_r)(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Float_t* ab);
+
+    /** GEMM micro kernel for complex matrices
+     *
+     * Same as gemm_r with the complex panels a and b. For each l the panel a
+     * holds the MR real parts followed by the MR imaginary parts, the panel
+     * b holds NR_C interleaved complex numbers. The MR x NR_C tile ab is
+     * overwritten.
+     */
+    void (*gemm_c)(size_t k, const ifx_Float_t* a, const ifx_Float_t* b, ifx_Complex_t* ab);
+
+    /** out[i*out_stride + j] = in[j*in_stride + i] for i < rows, j < cols
+     *
+     * Strided 2D transpose used to change the memory order of arrays. The
+     * kernels are meant for small tiles (up to about 32 x 32); larger
+     * transposes are split into tiles by the caller. in and out must not
+     * overlap.
+     */
+    void (*transpose_r)(const ifx_Float_t* in, size_t in_stride, ifx_Float_t* out, size_t out_stride, size_t rows, size_t cols);
+    /** complex version of transpose_r */
+    void (*transpose_c)(const ifx_Complex_t* in, size_t in_stride, ifx_Complex_t* out, size_t out_stride, size_t rows, size_t cols);
+
+    /** Unpack n 12 bit samples from the 3*n/2 bytes in into out
+     *
+     * n must be even. The unpack kernels read only the bytes of the n
+     * samples, in and out must not overlap. All implementations give
+     * bit-identical results.
+     */
+    void (*unpack12_u16)(const uint8_t* in, uint16_t* out, size_t n, ifx_Kernel_Unpack12_t format);
+    /** as unpack12_u16 but out[i] = sample - 2048 (12 bit offset binary to two's complement) */
+    void (*unpack12_s16)(const uint8_t* in, int16_t* out, size_t n, ifx_Kernel_Unpack12_t format);
+    /** as unpack12_u16 but out[i] = sample * scale + offset */
+    void (*unpack12_r)(const uint8_t* in, ifx_Float_t* out, size_t n, ifx_Kernel_Unpack12_t format, ifx_Float_t scale, ifx_Float_t offset);
+    /** out[i] = (in[i] & 0xfff) * scale + offset
+     *
+     * Converts 12 bit samples already stored in 16 bit words, the upper four
+     * bits are ignored. in and out must not overlap. All implementations give
+     * bit-identical results.
+     */
+    void (*mask12_r)(const uint16_t* in, ifx_Float_t* out, size_t n, ifx_Float_t scale, ifx_Float_t offset);
+
+    /** out[i] = (in[i*stride] & mask) * scale + j*(in[i*stride+1] & mask) * scale
+     *
+     * Extracts n I/Q pairs stored stride uint16_t's apart, i.e., with other
+     * readouts in between (stride >= 2). in and out must not overlap. All
+     * implementations give bit-identical results.
+     */
+    void (*gather_iq_c)(const uint16_t* in, size_t stride, ifx_Complex_t* out, size_t n, uint16_t mask, ifx_Float_t scale);
+    /** as gather_iq_c but out[2*i] = (in[i*stride] & mask) >> shift and
+     *  out[2*i+1] = (in[i*stride+1] & mask) >> shift; mask must not include bit 15 */
+    void (*gather_iq_s16)(const uint16_t* in, size_t stride, int16_t* out, size_t n, uint16_t mask, int shift);
+} ifx_Kernels_t;
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Return kernel table for the CPU the code is running on
+ *
+ * The returned pointer is valid for the lifetime of the library.
+ *
+ * @retval kernel table
+ */
+IFX_DLL_PUBLIC
+const ifx_Kernels_t* ifx_kernels_get(void);
+
+/**
+ * @brief Return kernel table for a specific instruction set
+ *
+ * Only exported for the tests, which compare the different implementations
+ * against each other. It is not part of the public API.
+ *
+ * @param [in]  isa     requested instruction set
+ * @retval kernel table if the instruction set is supported by the CPU
+ * @retval NULL if the instruction set is not supported
+ */
+IFX_DLL_TEST
+const ifx_Kernels_t* ifx_kernels_get_isa(ifx_Kernel_Isa_t isa);
+
+/* Overwrite entries of kernels with the implementations for a specific
+ * instruction set. Only available if the instruction set was compiled in,
+ * see IFX_KERNELS_HAVE_X86 and IFX_KERNELS_HAVE_NEON. */
+void ifx_kernels_init_sse2(ifx_Kernels_t* kernels);
+void ifx_kernels_init_ssse3(ifx_Kernels_t* kernels);
+void ifx_kernels_init_avx2(ifx_Kernels_t* kernels);
+void ifx_kernels_init_avx512(ifx_Kernels_t* kernels);
+void ifx_kernels_init_neon(ifx_Kernels_t* kernels);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif /* IFX_BASE_INTERNAL_KERNELS_H */
@@ -59,6 +59,8 @@ extern "C"
 #define vLen(v)         IFX_VEC_LEN(v)
 #define vDat(v)         IFX_VEC_DAT(v)
 #define vAt(v, idx)     IFX_VEC_AT(v, idx)
+#define vReAt(v, idx)   IFX_MDA_REAL_AT(v, idx)
+#define vImAt(v, idx)   IFX_MDA_IMAG_AT(v, idx)
 
 #define mDat(m)          IFX_MAT_DAT(m)
 #define mRows(m)         IFX_MAT_ROWS(m)
@@ -67,6 +69,8 @@ extern "C"
 #define mSize(m)         IFX_MAT_SIZE(m)
 #define mOffset(m, r, c) IFX_MAT_OFFSET(m, r, c)
 #define mAt(m, r, c)     IFX_MAT_AT(m, r, c)
+#define mReAt(m, r, c)   IFX_MDA_REAL_AT(m, r, c)
+#define mImAt(m, r, c)   IFX_MDA_IMAG_AT(m, r, c)
 
 #define cRows(c)      IFX_CUBE_ROWS(c)
 #define cCols(c)      IFX_CUBE_COLS(c)
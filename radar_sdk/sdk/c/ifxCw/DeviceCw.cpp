@@ -228,6 +228,11 @@ ifx_Matrix_R_t* ifx_cw_capture_frame(ifx_Device_Cw_t* handle, ifx_Matrix_R_t* fr
     return rdk::call_func(handle, &ifx_Device_Cw_t::capture_frame, frame);
 }
 
+ifx_Matrix_R_t* ifx_cw_capture_frames(ifx_Device_Cw_t* handle, ifx_Matrix_R_t* frames, uint32_t num_frames)
+{
+    return rdk::call_func(handle, &ifx_Device_Cw_t::capture_frames, frames, num_frames);
+}
+
 ifx_Radar_Sensor_t ifx_cw_get_sensor_type(const ifx_Device_Cw_t* handle)
 {
     return rdk::call_func(handle, &ifx_Device_Cw_t::get_sensor_type);
@@ -391,6 +391,35 @@ float ifx_cw_measure_tx_power(ifx_Device_Cw_t* handle, uint32_t antenna);
 IFX_DLL_PUBLIC
 ifx_Matrix_R_t* ifx_cw_capture_frame(ifx_Device_Cw_t* handle, ifx_Matrix_R_t* frame);
 
+/**
+ * @brief This method captures several consecutive frames of raw data.
+ *
+ * The frames are captured back to back, i.e., the acquisition of the next
+ * frame is already triggered while the previous frame is being processed.
+ * The samples are normalized like in \ref ifx_cw_capture_frame and written
+ * into a matrix with dimensions
+ * (num_frames * num_antennas) (rows) x samples_per_antenna (columns), where
+ * the rows i * num_antennas ... (i + 1) * num_antennas - 1 hold frame i.
+ *
+ * Receive buffers and the trigger sequence are kept by the device between
+ * captures, so repeated calls with a preallocated matrix don't allocate any
+ * memory.
+ *
+ * If frames is NULL, memory for the matrix will be allocated and returned.
+ * Otherwise the memory of frames will be used, and its dimensions must match.
+ *
+ * @param [in]     handle		A handle to the CW device
+ * @param [in]     frames		Pointer to the \ref ifx_Matrix_R_t where raw data is stored.
+ *                               If this is NULL, then a new matrix is created. The caller is responsible to
+ *                               deallocate the memory.
+ * @param [in]     num_frames	Number of frames to capture.
+ *
+ * @return	pointer to the \ref ifx_Matrix_R_t *frames* containing the received samples.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_Matrix_R_t* ifx_cw_capture_frames(ifx_Device_Cw_t* handle, ifx_Matrix_R_t* frames, uint32_t num_frames);
+
 /**
  * @brief Get information about the sensor on the connected device.
  *
@@ -72,6 +72,7 @@ struct DeviceCw
     virtual float measure_tx_power(uint32_t antenna) = 0;
 
     virtual ifx_Matrix_R_t* capture_frame(ifx_Matrix_R_t* frame) = 0;
+    virtual ifx_Matrix_R_t* capture_frames(ifx_Matrix_R_t* frames, uint32_t num_frames) = 0;
 
     virtual std::map<uint16_t, uint32_t>& get_register_list() = 0;
     virtual void apply_register_list(const std::map<uint16_t, uint32_t>& register_list) = 0;
@@ -505,19 +505,66 @@ ifx_Matrix_R_t* DeviceCwAvian::capture_frame(ifx_Matrix_R_t* frame)
         return frame;
     }
 
-    std::map<uint32_t, std::vector<ifx_Float_t>> signals;
-    uint8_t num_rx = 0;
-    signals = m_cw_controller->capture_rx_signals();
+    capture_into(frame, 1);
+    return frame;
+}
 
-    for (const auto& keyvalue : signals)
+ifx_Matrix_R_t* DeviceCwAvian::capture_frames(ifx_Matrix_R_t* frames, uint32_t num_frames)
+{
+    const bool allocated = (frames == nullptr);
+    if (allocated)
     {
-        for (uint32_t sample = 0; sample < keyvalue.second.size(); sample++)
+        frames = ifx_mat_create_r(num_frames * get_rx_antenna_enabled_count(),
+                                  m_cw_controller->get_number_of_samples());
+        if (ifx_error_get() != IFX_OK)
         {
-            IFX_MAT_AT(frame, num_rx, sample) = keyvalue.second[sample];
+            return frames;
+        }
+    }
+
+    try
+    {
+        capture_into(frames, num_frames);
+    }
+    catch (...)
+    {
+        if (allocated)
+        {
+            ifx_mat_destroy_r(frames);
+        }
+        throw;
+    }
+    return frames;
+}
+
+void DeviceCwAvian::capture_into(ifx_Matrix_R_t* frames, uint32_t num_frames)
+{
+    const uint32_t num_rx = get_rx_antenna_enabled_count();
+    const uint32_t num_samples = m_cw_controller->get_number_of_samples();
+
+    if (IFX_MAT_ROWS(frames) < num_frames * num_rx || IFX_MAT_COLS(frames) != num_samples)
+    {
+        throw rdk::exception::dimension_mismatch();
+    }
+
+    // The controller writes the signals directly into the rows of the matrix.
+    if (IFX_MAT_STRIDE(frames, 1) == 1)
+    {
+        m_cw_controller->capture_rx_signals(IFX_MAT_DAT(frames), IFX_MAT_STRIDE(frames, 0), num_frames);
+        return;
+    }
+
+    m_capture_buffer.resize(size_t(num_frames) * num_rx * num_samples);
+    m_cw_controller->capture_rx_signals(m_capture_buffer.data(), num_samples, num_frames);
+
+    auto signal = m_capture_buffer.cbegin();
+    for (uint32_t row = 0; row < num_frames * num_rx; row++)
+    {
+        for (uint32_t sample = 0; sample < num_samples; sample++)
+        {
+            IFX_MAT_AT(frames, row, sample) = *signal++;
         }
-        num_rx++;
     }
-    return frame;
 }
 
 ifx_Radar_Sensor_t DeviceCwAvian::get_sensor_type() const
@@ -118,6 +118,7 @@ public:
     float measure_tx_power(uint32_t antenna) override;
 
     ifx_Matrix_R_t* capture_frame(ifx_Matrix_R_t* frame) override;
+    ifx_Matrix_R_t* capture_frames(ifx_Matrix_R_t* frames, uint32_t num_frames) override;
 
     ifx_Radar_Sensor_t get_sensor_type() const override;
 
@@ -148,5 +149,9 @@ private:
 
     void generate_register_list();
 
+    void capture_into(ifx_Matrix_R_t* frames, uint32_t num_frames);
+
+    std::vector<ifx_Float_t> m_capture_buffer;  // only used for matrices with non-contiguous rows
+
     std::map<uint16_t, uint32_t> m_register_map;
 };
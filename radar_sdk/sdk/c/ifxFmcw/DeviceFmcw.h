@@ -67,6 +67,28 @@ extern "C"
 
 typedef struct DeviceFmcw ifx_Device_Fmcw_t;
 
+/**
+ * @brief Callback for frames delivered by @ref ifx_fmcw_start_frame_callback.
+ *
+ * The callback is invoked on a thread owned by the SDK. If a frame was
+ * acquired, *frame* points to a frame owned by the SDK and *error* is
+ * @ref IFX_OK. The frame is borrowed by the application until it is handed
+ * back with @ref ifx_fmcw_release_frame, which may happen from any thread and
+ * at any time after the callback returned. If the acquisition failed, *frame*
+ * is NULL and *error* contains the error code. In this case no more frames
+ * follow.
+ *
+ * @param[in] handle   A handle to the radar device object.
+ * @param[in] frame    The acquired frame or NULL in case of an error.
+ * @param[in] error    @ref IFX_OK or the error that stopped the acquisition.
+ * @param[in] context  The context pointer passed to
+ *                     @ref ifx_fmcw_register_frame_callback.
+ */
+typedef void (*ifx_Fmcw_Frame_Callback_t)(ifx_Device_Fmcw_t* handle,
+                                          ifx_Fmcw_Frame_t* frame,
+                                          ifx_Error_t error,
+                                          void* context);
+
 
 /*
 ==============================================================================
@@ -180,6 +202,90 @@ ifx_Device_Fmcw_t* ifx_fmcw_create_dummy_with_reference_freq(ifx_Radar_Sensor_t
 IFX_DLL_PUBLIC
 ifx_Device_Fmcw_t* ifx_fmcw_create_dummy_from_device(const ifx_Device_Fmcw_t* handle);
 
+/**
+ * @brief Creates a device playing back a recording.
+ *
+ * The recording is a directory containing radar.npy with the frames as
+ * uint16 array of shape (frames, rx, chirps, samples), config.json with the
+ * device configuration ("fmcw_single_shape") and meta.json with the sensor
+ * description. The directory of the recording device (e.g.
+ * RadarIfxAvian_00) or the recording directory containing it can be given.
+ *
+ * The device behaves like a dummy device of the recorded sensor type
+ * configured with the recorded acquisition sequence, which cannot be
+ * changed. Frames are fetched as usual with @ref ifx_fmcw_get_next_frame or
+ * the frame callback. The recording is mapped into memory, so the frames are
+ * converted directly from the file without intermediate copies.
+ *
+ * By default the frames are returned with the frame rate of the recording
+ * and an error IFX_ERROR_END_OF_FILE is set after the last frame, see
+ * @ref ifx_fmcw_playback_set_mode.
+ *
+ * @param[in] path  Path to the recording.
+ *
+ * @return Handle to the newly created instance or NULL in case of failure.
+ */
+IFX_DLL_PUBLIC
+ifx_Device_Fmcw_t* ifx_fmcw_create_playback(const char* path);
+
+/**
+ * @brief Sets the speed and looping of a playback device.
+ *
+ * If loop is true, the playback continues with the first frame after the
+ * last frame of the recording.
+ *
+ * If the device is no playback device, the error IFX_ERROR_NOT_SUPPORTED is
+ * set.
+ *
+ * @param[in] handle  A handle to the playback device object.
+ * @param[in] mode    Frame rate of the playback.
+ * @param[in] loop    Restart at the first frame when the end is reached.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_playback_set_mode(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Playback_Mode_t mode, bool loop);
+
+/**
+ * @brief Sets the index of the next frame returned by a playback device.
+ *
+ * @param[in] handle       A handle to the playback device object.
+ * @param[in] frame_index  Index of the frame in the recording.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_playback_seek(ifx_Device_Fmcw_t* handle, uint32_t frame_index);
+
+/**
+ * @brief Returns the index of the next frame returned by a playback device.
+ *
+ * @param[in] handle  A handle to the playback device object.
+ * @return The frame index.
+ */
+IFX_DLL_PUBLIC
+uint32_t ifx_fmcw_playback_get_position(ifx_Device_Fmcw_t* handle);
+
+/**
+ * @brief Returns the number of frames in the recording of a playback device.
+ *
+ * @param[in] handle  A handle to the playback device object.
+ * @return The number of frames.
+ */
+IFX_DLL_PUBLIC
+uint32_t ifx_fmcw_playback_get_num_frames(ifx_Device_Fmcw_t* handle);
+
+/**
+ * @brief Returns the raw samples of a recorded frame without copying them.
+ *
+ * The samples are returned as stored in the recording: the cubes of the
+ * frame one after the other, each with the dimensions (rx, chirps, samples).
+ * The pointer refers to the memory mapped recording and is valid until the
+ * device is destroyed. The playback position is not changed.
+ *
+ * @param[in] handle       A handle to the playback device object.
+ * @param[in] frame_index  Index of the frame in the recording.
+ * @return Pointer to the samples or NULL in case of failure.
+ */
+IFX_DLL_PUBLIC
+const uint16_t* ifx_fmcw_playback_get_frame_data(ifx_Device_Fmcw_t* handle, uint32_t frame_index);
+
 /**
  * @brief Creates a device handle.
  *
@@ -706,6 +812,148 @@ void ifx_fmcw_destroy_frame(ifx_Fmcw_Frame_t* frame);
 IFX_DLL_PUBLIC
 void ifx_fmcw_destroy_raw_frame(ifx_Fmcw_Raw_Frame_t* frame);
 
+/**
+ * @brief Registers a callback for asynchronous frame delivery.
+ *
+ * Instead of fetching frames with @ref ifx_fmcw_get_next_frame, the
+ * application can let the SDK acquire frames on its own thread and pass each
+ * frame to *callback*. The frames are taken from a pool of *num_frames* frames
+ * owned by the SDK and are never copied. A frame that was passed to the
+ * callback is not reused until the application released it using
+ * @ref ifx_fmcw_release_frame. If all frames are in use, the acquisition
+ * waits for a frame to be released, while the board keeps buffering the
+ * incoming data.
+ *
+ * The acquisition and the callbacks run on different threads, so the
+ * acquisition of the next frame overlaps with the processing of the current
+ * one, even if the callback processes the frame before it returns.
+ *
+ * Here is a typical usage of this function:
+ * @code
+ *   void on_frame(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Frame_t* frame, ifx_Error_t error, void* context)
+ *   {
+ *       if (error != IFX_OK)
+ *           return; // error handling, the acquisition has stopped
+ *
+ *       // process data
+ *       // ...
+ *       ifx_fmcw_release_frame(handle, frame);
+ *   }
+ *
+ *   ifx_fmcw_register_frame_callback(device_handle, on_frame, NULL, 4);
+ *   ifx_fmcw_start_frame_callback(device_handle);
+ *   // ...
+ *   ifx_fmcw_stop_frame_callback(device_handle);
+ * @endcode
+ *
+ * The callback can only be changed while frame delivery is stopped and all
+ * frames have been released, otherwise the error IFX_ERROR_NOT_POSSIBLE is
+ * set. Passing NULL as *callback* removes a previously registered callback.
+ *
+ * @param[in] handle      A handle to the radar device object.
+ * @param[in] callback    The function called for every frame.
+ * @param[in] context     Pointer passed unchanged to the callback.
+ * @param[in] num_frames  Maximum number of frames in flight, i.e. frames
+ *                        being acquired, waiting for delivery or borrowed
+ *                        by the application. Must be at least 1.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_register_frame_callback(ifx_Device_Fmcw_t* handle,
+                                      ifx_Fmcw_Frame_Callback_t callback,
+                                      void* context,
+                                      uint32_t num_frames);
+
+/**
+ * @brief Starts asynchronous frame delivery.
+ *
+ * The frames are allocated for the current acquisition sequence and the
+ * acquisition thread and callback thread are started. The acquisition
+ * sequence must not be changed until frame delivery is stopped. While frame
+ * delivery is running, only @ref ifx_fmcw_release_frame and
+ * @ref ifx_fmcw_stop_frame_callback may be called for the device.
+ *
+ * Timeouts while waiting for data are not reported; the SDK keeps waiting
+ * for the next frame. All other errors are passed to the callback once and
+ * end the acquisition.
+ *
+ * All frames of a previous run must have been released before frame delivery
+ * can be started again.
+ *
+ * @param[in] handle  A handle to the radar device object.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_start_frame_callback(ifx_Device_Fmcw_t* handle);
+
+/**
+ * @brief Stops asynchronous frame delivery.
+ *
+ * The function stops the acquisition, waits until the frame currently being
+ * acquired is complete or timed out, and waits for the callback thread to
+ * finish. Frames not yet passed to the callback are dropped. Frames still
+ * borrowed by the application stay valid until they are released or the
+ * device is destroyed.
+ *
+ * This function must not be called from within the callback.
+ *
+ * @param[in] handle  A handle to the radar device object.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_stop_frame_callback(ifx_Device_Fmcw_t* handle);
+
+/**
+ * @brief Returns a frame borrowed by the frame callback to the SDK.
+ *
+ * @param[in] handle  A handle to the radar device object.
+ * @param[in] frame   A frame passed to the frame callback.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_release_frame(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Frame_t* frame);
+
+/**
+ * @brief Retrieves the counters of the data acquisition.
+ *
+ * The function returns how many slices and frames were received and lost,
+ * the usage of the buffers between board and application, and the latency of
+ * each stage of the acquisition. See @ref ifx_Fmcw_Statistics_t for details.
+ *
+ * The counters are always collected. The function may be called at any
+ * time, also from another thread while frames are acquired.
+ *
+ * @param[in]  handle      A handle to the radar device object.
+ * @param[out] statistics  The structure to be filled.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_get_statistics(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Statistics_t* statistics);
+
+/**
+ * @brief Resets all counters of the data acquisition.
+ *
+ * @param[in] handle  A handle to the radar device object.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_reset_statistics(ifx_Device_Fmcw_t* handle);
+
+/**
+ * @brief Sets the buffering of data between device and application.
+ *
+ * The SDK buffers the data received from the device until the application
+ * fetches the frames. By default the buffer holds data of 10 seconds and
+ * discards the oldest data when it is full. This function changes the
+ * maximum buffered time and the behaviour of a full buffer, see
+ * @ref ifx_Fmcw_Buffer_Policy_t.
+ *
+ * The new settings are applied when the acquisition is started the next
+ * time.
+ *
+ * @param[in] handle                 A handle to the radar device object.
+ * @param[in] policy                 The behaviour of a full buffer.
+ * @param[in] max_seconds_to_buffer  Maximum time of data to be buffered in
+ *                                   seconds. If 0, the default of 10
+ *                                   seconds is used.
+ */
+IFX_DLL_PUBLIC
+void ifx_fmcw_set_buffer_policy(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Buffer_Policy_t policy, float max_seconds_to_buffer);
+
 /**
  * @brief Retrieves the unique id (UUID) of the connected board.
  *
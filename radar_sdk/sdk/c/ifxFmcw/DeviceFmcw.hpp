@@ -36,6 +36,7 @@
 
 #pragma once
 
+#include "ifxFmcw/DeviceFmcw.h"
 #include "ifxFmcw/DeviceFmcwTypes.h"
 #include <map>
 #include <memory>
@@ -59,6 +60,13 @@ struct DeviceFmcw
     virtual void view_deinterleaved_frame(ifx_Float_t* converted_frame, ifx_Fmcw_Frame_t* deinterleaved_frame_view) = 0;
     virtual float get_element_duration(const ifx_Fmcw_Sequence_Element_t* element) const = 0;
     virtual float get_sequence_duration(const ifx_Fmcw_Sequence_Element_t* sequence) const = 0;
+    virtual void register_frame_callback(ifx_Fmcw_Frame_Callback_t callback, void* context, uint32_t num_frames) = 0;
+    virtual void start_frame_callback() = 0;
+    virtual void stop_frame_callback() = 0;
+    virtual void release_frame(ifx_Fmcw_Frame_t* frame) = 0;
+    virtual void get_statistics(ifx_Fmcw_Statistics_t* statistics) const = 0;
+    virtual void reset_statistics() = 0;
+    virtual void set_buffer_policy(ifx_Fmcw_Buffer_Policy_t policy, float max_seconds_to_buffer) = 0;
 
     /* These abstract virtual members must be implemented by the derived class */
     virtual float get_temperature() = 0;
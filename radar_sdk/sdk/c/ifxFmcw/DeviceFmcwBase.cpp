@@ -34,15 +34,21 @@
 */
 
 #include "DeviceFmcwBase.hpp"
+#include "FrameScatter.hpp"
+#include "ifxBase/internal/Kernels.h"
 #include "ifxBase/internal/Util.h"  // for ifx_util_popcount
 
 // Universal
 #include <universal/error_definitions.h>
 #include <universal/types/DataSettingsBgtRadar.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <common/Buffer.hpp>
 #include <stack>
+#include <vector>
 
 
 /*
@@ -58,6 +64,30 @@ constexpr float slice_rate_threshold = 20.0f;  // 20 slices per second
 
 constexpr float seconds_to_buffer = 10.0f;
 
+// With IFX_FMCW_BUFFER_GROW the frame queue starts with this fraction of the
+// maximum size, which is also the chunk size for growing and shrinking.
+constexpr float grow_chunk_fraction = 0.1f;
+
+// Number of asynchronous transfers kept queued by USB bridges while streaming.
+// Each transfer takes about one slice, so the board can keep sending for
+// several slices while the receiving thread is delayed.
+constexpr uint16_t usb_transfer_count = 8;
+
+// Number of samples unpacked at once when converting slices to float. The
+// buffer lives on the stack and stays in L1 cache. The corresponding number
+// of bytes is a multiple of 6 and never splits a pair of packed 12-bit samples.
+constexpr uint32_t unpack_chunk_samples = 1024;
+
+static_assert(IFX_FMCW_LATENCY_BUCKETS == LatencyHistogram::bucketCount, "histogram size of C API and strata differ");
+
+void copy_histogram(const LatencyHistogram::Snapshot& snapshot, ifx_Fmcw_Latency_Histogram_t& histogram)
+{
+    histogram.count = snapshot.count;
+    histogram.sum_us = snapshot.sumUs;
+    histogram.max_us = snapshot.maxUs;
+    std::copy(std::begin(snapshot.buckets), std::end(snapshot.buckets), histogram.buckets);
+}
+
 }  // namespace
 
 /*
@@ -227,12 +257,55 @@ void DeviceFmcwBase::configure_data(uint16_t slice_size, uint16_t readout_addres
     m_frame_length = get_buffer_length(m_num_samples);
 
     m_bridge_data->setFrameBufferSize(get_buffer_length(slice_size));
+    m_bridge_data->setTransferRing(usb_transfer_count, get_buffer_length(slice_size));
 
     /* The size of the frame queue is derived from the config, allowing to hold
      * samples for a defined seconds_to_buffer time.
      */
-    const auto pool_size = static_cast<uint16_t>(seconds_to_buffer / m_frame_repetition_time_s);
-    m_bridge_data->setFrameQueueSize(pool_size);
+    const auto max_seconds = (m_max_seconds_to_buffer > 0.0f) ? m_max_seconds_to_buffer : seconds_to_buffer;
+    const auto max_pool_size = static_cast<uint16_t>(std::min(std::max(max_seconds / m_frame_repetition_time_s, 1.0f), 65534.0f));
+
+    switch (m_buffer_policy)
+    {
+        case IFX_FMCW_BUFFER_DROP_NEWEST:
+            m_bridge_data->setBackPressurePolicy(BackPressurePolicy::DropNewest);
+            m_bridge_data->setFrameQueueSize(max_pool_size);
+            break;
+        case IFX_FMCW_BUFFER_BLOCK_PRODUCER:
+            m_bridge_data->setBackPressurePolicy(BackPressurePolicy::BlockProducer);
+            m_bridge_data->setFrameQueueSize(max_pool_size);
+            break;
+        case IFX_FMCW_BUFFER_GROW:
+            m_bridge_data->setBackPressurePolicy(BackPressurePolicy::Grow, max_pool_size);
+            m_bridge_data->setFrameQueueSize(static_cast<uint16_t>(std::max(max_pool_size * grow_chunk_fraction, 1.0f)));
+            break;
+        default:
+            m_bridge_data->setBackPressurePolicy(BackPressurePolicy::DropOldest);
+            m_bridge_data->setFrameQueueSize(max_pool_size);
+            break;
+    }
+}
+
+void DeviceFmcwBase::set_buffer_policy(ifx_Fmcw_Buffer_Policy_t policy, float max_seconds_to_buffer)
+{
+    switch (policy)
+    {
+        case IFX_FMCW_BUFFER_DROP_OLDEST:
+        case IFX_FMCW_BUFFER_DROP_NEWEST:
+        case IFX_FMCW_BUFFER_BLOCK_PRODUCER:
+        case IFX_FMCW_BUFFER_GROW:
+            break;
+        default:
+            throw rdk::exception::argument_invalid();
+    }
+
+    if (!(max_seconds_to_buffer >= 0.0f))
+    {
+        throw rdk::exception::argument_invalid();
+    }
+
+    m_buffer_policy = policy;
+    m_max_seconds_to_buffer = max_seconds_to_buffer;
 }
 
 uint32_t DeviceFmcwBase::copy_slice_data(uint8_t data_format, const uint8_t* buffer, uint32_t buffer_length, uint16_t* output)
@@ -243,11 +316,7 @@ uint32_t DeviceFmcwBase::copy_slice_data(uint8_t data_format, const uint8_t* buf
         case DataFormat_Packed12:
             num_samples = buffer_length / 3 * 2;
             // unpack each 12-bit sample into a 16-bit word
-            for (size_t i = 0; i < num_samples / 2; i++)
-            {
-                *output++ = (buffer[3 * i + 0] << 4) | (buffer[3 * i + 1] >> 4);
-                *output++ = ((buffer[3 * i + 1] & 0x0f) << 8) | buffer[3 * i + 2];
-            }
+            ifx_kernels_get()->unpack12_u16(buffer, output, num_samples, IFX_KERNEL_PACKED12);
             break;
         case DataFormat_Raw16:
             num_samples = buffer_length / 2;
@@ -264,7 +333,7 @@ uint32_t DeviceFmcwBase::copy_slice_data(uint8_t data_format, const uint8_t* buf
     return num_samples;
 }
 
-void DeviceFmcwBase::get_next_frame(ifx_Fmcw_Frame_t* frame, uint16_t timeout_ms)
+void DeviceFmcwBase::check_frame_dimensions(const ifx_Fmcw_Frame_t* frame) const
 {
     if (frame == nullptr)
     {
@@ -276,58 +345,45 @@ void DeviceFmcwBase::get_next_frame(ifx_Fmcw_Frame_t* frame, uint16_t timeout_ms
         throw rdk::exception::dimension_mismatch();
     }
 
-    start_acquisition();
-
-    SmartFmcwRawFrame raw_frame(allocate_raw_frame());
-    get_next_raw_frame(raw_frame.get(), timeout_ms);
-
-    const auto* raw_data = raw_frame->samples;
     auto** cubes = frame->cubes;
-    const auto cube_offset = frame->num_cubes - 1;
     for (const auto& d : m_frame_dimensions)
     {
-        const auto num_rx = d[0];
-        const auto num_chirps = d[1];
-        const auto num_samples_per_chirp = d[2];
         const auto* cube = *cubes++;
         const auto* shape = IFX_MDA_SHAPE(cube);
         // check if dimensions of given and expected cube are the same
         if ((IFX_MDA_DIMENSIONS(cube) != 3)
-            || (shape[0] != num_rx)
-            || (shape[1] != num_chirps)
-            || (shape[2] != num_samples_per_chirp))
+            || (shape[0] != d[0])
+            || (shape[1] != d[1])
+            || (shape[2] != d[2]))
         {
             throw rdk::exception::dimension_mismatch();
         }
+    }
+}
 
-        // the outer loop assumes a flat (non-nested) chirp structure,
-        // where all chirps have the same settings.
-        // However, this is only guaranteed when using the legacy API
-        const auto chirp_offset = num_rx * num_samples_per_chirp;
-        const auto* cube_data = raw_data;
-        for (uint32_t chirp = 0; chirp < num_chirps; chirp++)                    // slices
-        {
-            for (uint32_t sample = 0; sample < num_samples_per_chirp; sample++)  // rows
-            {
-                for (uint32_t rx = 0; rx < num_rx; rx++)                         // columns
-                {
-                    IFX_MDA_AT(cube, rx, chirp, sample) = static_cast<ifx_Float_t>(*cube_data++ * 2) / m_max_adc_value - 1.0f;
-                }
-            }
-            if (m_mimo)
-            {
-                cube_data += cube_offset * chirp_offset;
-            }
-        }
-        if (m_mimo)
-        {
-            raw_data += chirp_offset;
-        }
-        else
+void DeviceFmcwBase::get_next_frame(ifx_Fmcw_Frame_t* frame, uint16_t timeout_ms)
+{
+    check_frame_dimensions(frame);
+
+    // The slices are unpacked in small chunks and directly converted into the
+    // cubes of frame, so no intermediate raw frame is needed. The scatter
+    // assumes a flat (non-nested) chirp structure, where all chirps have the
+    // same settings. However, this is only guaranteed when using the legacy API
+    FrameScatter scatter(frame->cubes, m_frame_dimensions, m_mimo, m_max_adc_value);
+    uint16_t chunk[unpack_chunk_samples];
+
+    read_frame_data(timeout_ms, [&](const uint8_t* buffer, uint32_t buffer_length) {
+        // the data format is only known once the acquisition has been started
+        const uint32_t chunk_length = get_buffer_length(unpack_chunk_samples);
+        while (buffer_length > 0)
         {
-            raw_data = cube_data;
+            const auto length = std::min(buffer_length, chunk_length);
+            const auto num_samples = copy_slice_data(m_data_format, buffer, length, chunk);
+            scatter.write(chunk, num_samples);
+            buffer += length;
+            buffer_length -= length;
         }
-    }
+    });
 }
 
 void DeviceFmcwBase::get_next_raw_frame(ifx_Fmcw_Raw_Frame_t* frame, uint16_t timeout_ms)
@@ -342,73 +398,219 @@ void DeviceFmcwBase::get_next_raw_frame(ifx_Fmcw_Raw_Frame_t* frame, uint16_t ti
         throw rdk::exception::dimension_mismatch();
     }
 
-    start_acquisition();
-
     uint16_t* frame_ptr = frame->samples;
-    auto remaining_bytes = m_frame_length;
-    const auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
-    while (remaining_bytes)
+    read_frame_data(timeout_ms, [&](const uint8_t* buffer, uint32_t buffer_length) {
+        frame_ptr += copy_slice_data(m_data_format, buffer, buffer_length, frame_ptr);
+    });
+}
+
+void DeviceFmcwBase::register_frame_callback(ifx_Fmcw_Frame_Callback_t callback, void* context, uint32_t num_frames)
+{
+    // the dispatcher owns the frames borrowed by the application
+    if (m_frame_dispatcher && (m_frame_dispatcher->is_running() || m_frame_dispatcher->has_borrowed_frames()))
+    {
+        throw rdk::exception::not_possible();
+    }
+
+    m_frame_dispatcher.reset();
+    if (callback)
+    {
+        m_frame_dispatcher = std::make_unique<FrameDispatcher>(this, callback, context, num_frames, m_statistics.dispatcher);
+    }
+}
+
+void DeviceFmcwBase::start_frame_callback()
+{
+    if (!m_frame_dispatcher)
+    {
+        throw rdk::exception::not_configured();
+    }
+
+    m_frame_dispatcher->start();
+}
+
+void DeviceFmcwBase::stop_frame_callback()
+{
+    if (m_frame_dispatcher)
+    {
+        m_frame_dispatcher->stop();
+    }
+}
+
+void DeviceFmcwBase::release_frame(ifx_Fmcw_Frame_t* frame)
+{
+    if (!m_frame_dispatcher)
+    {
+        throw rdk::exception::argument_invalid();
+    }
+
+    m_frame_dispatcher->release(frame);
+}
+
+void DeviceFmcwBase::get_statistics(ifx_Fmcw_Statistics_t* statistics) const
+{
+    if (!statistics)
+    {
+        throw rdk::exception::argument_null();
+    }
+
+    *statistics = {};
+
+    // dummy devices have no bridge
+    if (m_bridge_data)
+    {
+        BridgeDataStatistics bridge;
+        m_bridge_data->getStatistics(bridge);
+
+        statistics->slices_received = bridge.framesReceived;
+        statistics->slices_dropped = bridge.framesDropped;
+        statistics->slices_pool_depleted = bridge.framePoolDepleted;
+        statistics->slices_size_exceeded = bridge.frameSizeExceeded;
+        statistics->slices_queue_trimmed = bridge.framesTrimmed;
+        statistics->slices_other_errors = bridge.otherErrors;
+        statistics->queue_depth = bridge.queueDepth;
+        statistics->queue_high_water_mark = bridge.queueHighWaterMark;
+        statistics->pool_size = bridge.framePoolSize;
+        statistics->pool_high_water_mark = bridge.framePoolHighWaterMark;
+        copy_histogram(bridge.receiveLatency, statistics->receive_latency);
+        copy_histogram(bridge.queueLatency, statistics->queue_latency);
+    }
+
+    statistics->frames_received = m_statistics.frames_received;
+    statistics->frames_timeout = m_statistics.frames_timeout;
+    statistics->frames_fifo_overflow = m_statistics.frames_fifo_overflow;
+    statistics->frames_failed = m_statistics.frames_failed;
+
+    LatencyHistogram::Snapshot snapshot;
+    m_statistics.deinterleave_latency.getSnapshot(snapshot);
+    copy_histogram(snapshot, statistics->deinterleave_latency);
+    m_statistics.dispatcher.delivery_latency.getSnapshot(snapshot);
+    copy_histogram(snapshot, statistics->delivery_latency);
+    m_statistics.dispatcher.user_latency.getSnapshot(snapshot);
+    copy_histogram(snapshot, statistics->user_latency);
+}
+
+void DeviceFmcwBase::reset_statistics()
+{
+    if (m_bridge_data)
+    {
+        m_bridge_data->resetStatistics();
+    }
+
+    m_statistics.frames_received = 0;
+    m_statistics.frames_timeout = 0;
+    m_statistics.frames_fifo_overflow = 0;
+    m_statistics.frames_failed = 0;
+    m_statistics.deinterleave_latency.reset();
+    m_statistics.dispatcher.delivery_latency.reset();
+    m_statistics.dispatcher.user_latency.reset();
+}
+
+/* Collect the data of one frame from the slices sent by the board.
+ *
+ * consume(buffer, length) is called with consecutive parts of the frame data
+ * until m_frame_length bytes have been passed. The data is in the format
+ * m_data_format. If a slice contains data of the next frame, the remaining
+ * part is kept for the next call.
+ */
+template <typename Consumer>
+void DeviceFmcwBase::read_frame_data(uint16_t timeout_ms, Consumer&& consume)
+{
+    try
     {
-        // get next slice if no previous slice has been saved
-        if (!m_slice)
+        start_acquisition();
+
+        auto remaining_bytes = m_frame_length;
+        const auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        std::chrono::steady_clock::time_point first_slice_time;
+        bool frame_started = false;
+        while (remaining_bytes)
         {
-            const auto remaining_timeout_ms = std::chrono::duration_cast<std::chrono::milliseconds>(expiry - std::chrono::steady_clock::now()).count();
-            if (remaining_timeout_ms <= 0)
+            // get next slice if no previous slice has been saved
+            if (!m_slice)
             {
-                throw rdk::exception::timeout();
+                const auto remaining_timeout_ms = std::chrono::duration_cast<std::chrono::milliseconds>(expiry - std::chrono::steady_clock::now()).count();
+                if (remaining_timeout_ms <= 0)
+                {
+                    throw rdk::exception::timeout();
+                }
+
+                m_slice.reset(m_bridge_data->getFrame(static_cast<uint16_t>(remaining_timeout_ms)));
+                if (!m_slice)
+                {
+                    throw rdk::exception::timeout();
+                }
+
+                const auto status = m_slice->getStatusCode();
+                if (status != DataError_NoError)
+                {
+                    m_slice.reset();
+                    switch (status)
+                    {
+                        case DataError_FrameDropped:
+                        case DataError_FramePoolDepleted:
+                        case DataError_FrameQueueTrimmed:
+                            throw rdk::exception::frame_acquisition_failed();
+                            break;
+                        case DataError_FrameSizeExceeded:
+                            throw rdk::exception::frame_size_not_supported();
+                        case E_OVERFLOW:
+                            throw rdk::exception::fifo_overflow();
+                            break;
+                        default:
+                            throw rdk::exception::error();
+                            break;
+                    }
+                }
             }
 
-            m_slice.reset(m_bridge_data->getFrame(static_cast<uint16_t>(remaining_timeout_ms)));
-            if (!m_slice)
+            if (!frame_started)
             {
-                throw rdk::exception::timeout();
+                first_slice_time = std::chrono::steady_clock::now();
+                frame_started = true;
             }
 
-            const auto status = m_slice->getStatusCode();
-            if (status != DataError_NoError)
+            const auto slice_size = m_slice->getDataSize();
+            if (remaining_bytes < slice_size)
             {
+                // frame is finished, and there is data from the next frame in the slice to keep for the next call
+                consume(m_slice->getData(), remaining_bytes);
+                m_slice->setDataOffsetAndSize(m_slice->getDataOffset() + remaining_bytes, slice_size - remaining_bytes);
+                remaining_bytes = 0;
+            }
+            else
+            {
+                // the slice is completely used and can be released
+                consume(m_slice->getData(), slice_size);
                 m_slice.reset();
-                switch (status)
-                {
-                    case DataError_FrameDropped:
-                    case DataError_FramePoolDepleted:
-                    case DataError_FrameQueueTrimmed:
-                        throw rdk::exception::frame_acquisition_failed();
-                        break;
-                    case DataError_FrameSizeExceeded:
-                        throw rdk::exception::frame_size_not_supported();
-                    case E_OVERFLOW:
-                        throw rdk::exception::fifo_overflow();
-                        break;
-                    default:
-                        throw rdk::exception::error();
-                        break;
-                }
+                remaining_bytes -= slice_size;
             }
         }
 
-        const auto slice_size = m_slice->getDataSize();
-        if (remaining_bytes < slice_size)
-        {
-            // frame is finished, and there is data from the next frame in the slice to keep for the next call
-            copy_slice_data(m_data_format, m_slice->getData(), remaining_bytes, frame_ptr);
-            m_slice->setDataOffsetAndSize(m_slice->getDataOffset() + remaining_bytes, slice_size - remaining_bytes);
-            return;
-        }
-        else
-        {
-            // the slice is completely used and can be released
-            const auto samples = copy_slice_data(m_data_format, m_slice->getData(), slice_size, frame_ptr);
-            m_slice.reset();
-            frame_ptr += samples;
-            remaining_bytes -= slice_size;
-        }
+        m_statistics.deinterleave_latency.recordSince(first_slice_time);
+        m_statistics.frames_received++;
+    }
+    catch (const rdk::exception::timeout&)
+    {
+        m_statistics.frames_timeout++;
+        throw;
+    }
+    catch (const rdk::exception::fifo_overflow&)
+    {
+        m_statistics.frames_fifo_overflow++;
+        throw;
+    }
+    catch (...)
+    {
+        m_statistics.frames_failed++;
+        throw;
     }
 }
 
 void DeviceFmcwBase::update_frame_settings()
 {
     get_frame_dimensions();
+    compile_deinterleave_plan();
 
     m_num_samples = 0;
     for (auto& frame_dimension : m_frame_dimensions)
@@ -448,17 +650,45 @@ void DeviceFmcwBase::convert_raw_data_to_float_array(uint32_t num_samples, const
 
 void DeviceFmcwBase::deinterleave_raw_frame(const ifx_Fmcw_Raw_Frame_t* raw_frame, ifx_Fmcw_Raw_Frame_t* deinterleaved_frame)
 {
-    if (!raw_frame)
+    if (!raw_frame || !deinterleaved_frame)
     {
         throw rdk::exception::argument_null();
     }
-    const uint16_t* raw_data_ptr = raw_frame->samples;
+
+    update_defaults_if_not_configured();
+
+    if ((raw_frame->num_samples < m_num_samples) || (deinterleaved_frame->num_samples < m_num_samples))
+    {
+        throw rdk::exception::dimension_mismatch();
+    }
+
+    const uint16_t* src = raw_frame->samples;
+    uint16_t* dst = deinterleaved_frame->samples;
+    for (const auto& run : m_deinterleave_plan)
+    {
+        std::memcpy(dst + run.dst_offset, src + run.src_offset, run.length * sizeof(uint16_t));
+    }
+}
+
+/* This function compiles the sequence into the list of copies needed to
+ * deinterleave a raw frame. The raw frame holds the chirps in the order they
+ * are acquired, while the deinterleaved frame holds all repetitions of the
+ * first chirp, followed by all repetitions of the second chirp and so on.
+ * The sequence is traversed like in get_frame_dimensions(), but instead of
+ * copying samples the source and destination of each chirp are recorded.
+ * Neighboring chirps are merged into a single run, so without MIMO the whole
+ * frame ends up as one copy.
+ */
+void DeviceFmcwBase::compile_deinterleave_plan()
+{
+    m_deinterleave_plan.clear();
 
     std::stack<const ifx_Fmcw_Sequence_Element_t*> loops_stack;
     std::stack<const ifx_Fmcw_Sequence_Element_t*> chirps_stack;
     const size_t num_cubes = m_frame_dimensions.size();
     uint32_t num_of_chirps_in_loop = 0;
     uint32_t chirp_index;
+    uint32_t src_offset = 0;
     std::vector<uint32_t> remaining_chirp_repetitions;
     remaining_chirp_repetitions.reserve(num_cubes);
     for (const auto& d : m_frame_dimensions)
@@ -499,12 +729,21 @@ void DeviceFmcwBase::deinterleave_raw_frame(const ifx_Fmcw_Raw_Frame_t* raw_fram
                         }
                     }
 
-                    // de-interleave
-                    for (size_t i = 0; i < num_rx; i++)
+                    // The rx blocks of one chirp are adjacent in both frames. If
+                    // the chirp continues where the previous run ended, the run
+                    // is extended instead of starting a new one.
+                    const uint32_t length = num_rx * num_samples_per_chirp;
+                    if (!m_deinterleave_plan.empty()
+                        && (m_deinterleave_plan.back().src_offset + m_deinterleave_plan.back().length == src_offset)
+                        && (m_deinterleave_plan.back().dst_offset + m_deinterleave_plan.back().length == offset))
+                    {
+                        m_deinterleave_plan.back().length += length;
+                    }
+                    else if (length > 0)
                     {
-                        std::copy(raw_data_ptr, raw_data_ptr + num_samples_per_chirp, deinterleaved_frame->samples + offset + i * num_samples_per_chirp);
-                        raw_data_ptr += num_samples_per_chirp;
+                        m_deinterleave_plan.push_back({src_offset, offset, length});
                     }
+                    src_offset += length;
 
                     // Update remaining chirp repetitions
                     remaining_chirp_repetitions[chirp_index] -= 1;
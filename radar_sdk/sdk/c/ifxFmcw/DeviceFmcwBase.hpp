@@ -38,8 +38,10 @@
 
 #include "ifxBase/internal/NonCopyable.hpp"
 #include "ifxFmcw/DeviceFmcw.hpp"
+#include "ifxFmcw/FrameDispatcher.hpp"
 #include "ifxRadarDeviceCommon/internal/RadarDeviceCommon.hpp"
 
+#include <atomic>
 #include <string>
 
 
@@ -60,6 +62,13 @@ struct DeviceFmcwBase : public DeviceFmcw
     void deinterleave_raw_frame(const ifx_Fmcw_Raw_Frame_t* raw_frame, ifx_Fmcw_Raw_Frame_t* deinterleaved_frame) override;
     void view_deinterleaved_frame(ifx_Float_t* converted_frame, ifx_Fmcw_Frame_t* deinterleaved_frame_view) override;
     float get_sequence_duration(const ifx_Fmcw_Sequence_Element_t* sequence) const override;
+    void register_frame_callback(ifx_Fmcw_Frame_Callback_t callback, void* context, uint32_t num_frames) override;
+    void start_frame_callback() override;
+    void stop_frame_callback() override;
+    void release_frame(ifx_Fmcw_Frame_t* frame) override;
+    void get_statistics(ifx_Fmcw_Statistics_t* statistics) const override;
+    void reset_statistics() override;
+    void set_buffer_policy(ifx_Fmcw_Buffer_Policy_t policy, float max_seconds_to_buffer) override;
     IFX_DLL_TEST float get_element_duration(const ifx_Fmcw_Sequence_Element_t* element) const override;
 
     double get_chirp_sampling_center_frequency(const ifx_Fmcw_Sequence_Chirp_t* chirp) const override;
@@ -77,7 +86,9 @@ protected:
     void update_frame_settings();
     void update_defaults_if_not_configured();
     void get_frame_dimensions();
+    void compile_deinterleave_plan();
     uint32_t get_buffer_length(uint32_t num_samples) const;
+    void check_frame_dimensions(const ifx_Fmcw_Frame_t* frame) const;
     uint32_t copy_slice_data(uint8_t data_format, const uint8_t* buffer, uint32_t buffer_length, uint16_t* output);
 
     double get_chirp_sampling_bandwidth(const ifx_Fmcw_Sequence_Chirp_t* chirp) const override;
@@ -87,19 +98,47 @@ protected:
     ifx_Radar_Sensor_Info_t m_sensor_info;
     std::unique_ptr<BoardInstance> m_board;
 
-    IBridgeData* m_bridge_data;
+    IBridgeData* m_bridge_data = nullptr;
     uint8_t m_data_index;
     uint8_t m_data_format;
     IData* m_data;
 
     uint32_t m_num_samples = 0;
 
-private:
     float m_frame_repetition_time_s;
     std::vector<std::array<uint32_t, 3>> m_frame_dimensions;
 
+    bool m_mimo;  // temporary helper to unblock simple use cases
+
+    struct Statistics
+    {
+        std::atomic<uint64_t> frames_received {0};
+        std::atomic<uint64_t> frames_timeout {0};
+        std::atomic<uint64_t> frames_fifo_overflow {0};
+        std::atomic<uint64_t> frames_failed {0};
+        LatencyHistogram deinterleave_latency;
+        FrameDispatcher::Statistics dispatcher;
+    } m_statistics;
+
+private:
+    template <typename Consumer>
+    void read_frame_data(uint16_t timeout_ms, Consumer&& consume);
+
+    // contiguous block of samples moved from the raw frame to the deinterleaved frame
+    struct CopyRun
+    {
+        uint32_t src_offset;
+        uint32_t dst_offset;
+        uint32_t length;
+    };
+
+    std::vector<CopyRun> m_deinterleave_plan;
+
     uint32_t m_frame_length;
     SmartIFrame m_slice;
 
-    bool m_mimo;  // temporary helper to unblock simple use cases
+    ifx_Fmcw_Buffer_Policy_t m_buffer_policy = IFX_FMCW_BUFFER_DROP_OLDEST;
+    float m_max_seconds_to_buffer = 0.0f;  // 0 means default
+
+    std::unique_ptr<FrameDispatcher> m_frame_dispatcher;
 };
@@ -34,6 +34,7 @@
 */
 
 #include "avian/DeviceFmcwAvian.hpp"
+#include "playback/DeviceFmcwPlayback.hpp"
 #include "DeviceFmcw.h"
 
 #include "ifxBase/FunctionWrapper.hpp"
@@ -134,6 +135,18 @@ void print_sequence_element(const ifx_Fmcw_Sequence_Element_t* element, uint8_t
     }
 }
 
+DeviceFmcwPlayback* get_playback(ifx_Device_Fmcw_t* handle)
+{
+    rdk::check_handle(handle);
+
+    auto* playback = dynamic_cast<DeviceFmcwPlayback*>(handle);
+    if (!playback)
+    {
+        throw rdk::exception::not_supported();
+    }
+    return playback;
+}
+
 // NOLINTNEXTLINE(misc-no-recursion)
 void print_sequence_recursive(const ifx_Fmcw_Sequence_Element_t* element, uint8_t level)
 {
@@ -239,6 +252,58 @@ ifx_Device_Fmcw_t* ifx_fmcw_create_dummy_from_device(const ifx_Device_Fmcw_t* ha
     return nullptr;
 }
 
+ifx_Device_Fmcw_t* ifx_fmcw_create_playback(const char* path)
+{
+    return rdk::RadarDeviceCommon::open_device<DeviceFmcwPlayback>(path);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_playback_set_mode(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Playback_Mode_t mode, bool loop)
+{
+    rdk::call_func([=]() {
+        get_playback(handle)->set_playback_mode(mode, loop);
+    });
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_playback_seek(ifx_Device_Fmcw_t* handle, uint32_t frame_index)
+{
+    rdk::call_func([=]() {
+        get_playback(handle)->seek(frame_index);
+    });
+}
+
+//----------------------------------------------------------------------------
+
+uint32_t ifx_fmcw_playback_get_position(ifx_Device_Fmcw_t* handle)
+{
+    return rdk::call_func([=]() {
+        return get_playback(handle)->get_position();
+    });
+}
+
+//----------------------------------------------------------------------------
+
+uint32_t ifx_fmcw_playback_get_num_frames(ifx_Device_Fmcw_t* handle)
+{
+    return rdk::call_func([=]() {
+        return get_playback(handle)->get_num_frames();
+    });
+}
+
+//----------------------------------------------------------------------------
+
+const uint16_t* ifx_fmcw_playback_get_frame_data(ifx_Device_Fmcw_t* handle, uint32_t frame_index)
+{
+    return rdk::call_func([=]() {
+        return get_playback(handle)->get_frame_data(frame_index);
+    });
+}
+
+//----------------------------------------------------------------------------
+
 ifx_Device_Fmcw_t* ifx_fmcw_create()
 {
     auto selector = [](const ifx_Radar_Sensor_List_Entry_t& entry) {
@@ -391,6 +456,55 @@ void ifx_fmcw_destroy_raw_frame(ifx_Fmcw_Raw_Frame_t* frame)
 
 //----------------------------------------------------------------------------
 
+void ifx_fmcw_register_frame_callback(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Frame_Callback_t callback, void* context, uint32_t num_frames)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::register_frame_callback, callback, context, num_frames);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_start_frame_callback(ifx_Device_Fmcw_t* handle)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::start_frame_callback);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_stop_frame_callback(ifx_Device_Fmcw_t* handle)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::stop_frame_callback);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_release_frame(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Frame_t* frame)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::release_frame, frame);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_get_statistics(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Statistics_t* statistics)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::get_statistics, statistics);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_reset_statistics(ifx_Device_Fmcw_t* handle)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::reset_statistics);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fmcw_set_buffer_policy(ifx_Device_Fmcw_t* handle, ifx_Fmcw_Buffer_Policy_t policy, float max_seconds_to_buffer)
+{
+    rdk::call_func(handle, &ifx_Device_Fmcw_t::set_buffer_policy, policy, max_seconds_to_buffer);
+}
+
+//----------------------------------------------------------------------------
+
 void ifx_fmcw_set_acquisition_sequence(ifx_Device_Fmcw_t* handle, const ifx_Fmcw_Sequence_Element_t* sequence)
 {
     rdk::call_func(handle, &ifx_Device_Fmcw_t::set_acquisition_sequence, sequence);
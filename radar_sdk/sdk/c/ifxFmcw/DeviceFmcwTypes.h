@@ -64,6 +64,11 @@ extern "C"
 ==============================================================================
 */
 
+/**
+ * @brief Number of buckets of @ref ifx_Fmcw_Latency_Histogram_t
+ */
+#define IFX_FMCW_LATENCY_BUCKETS 24
+
 /*
 ==============================================================================
    3. TYPES
@@ -349,6 +354,106 @@ typedef struct ifx_Fmcw_Simple_Sequence_Config
 
 } ifx_Fmcw_Simple_Sequence_Config_t;
 
+// ---------------------------------------------------------------------------- ifx_Fmcw_Latency_Histogram_t
+/**
+ * @brief Histogram of the latencies of one stage of the data acquisition.
+ *
+ * The buckets have a logarithmic scale. Bucket 0 counts latencies below 1us,
+ * bucket i counts latencies from 2^(i-1)us up to 2^i us. The last bucket
+ * also counts all larger latencies.
+ */
+typedef struct ifx_Fmcw_Latency_Histogram
+{
+    uint64_t count;                              /**< Number of recorded latencies */
+    uint64_t sum_us;                             /**< Sum of all latencies in microseconds */
+    uint64_t max_us;                             /**< Maximum latency in microseconds */
+    uint64_t buckets[IFX_FMCW_LATENCY_BUCKETS];  /**< Number of latencies per bucket */
+} ifx_Fmcw_Latency_Histogram_t;
+
+// ---------------------------------------------------------------------------- ifx_Fmcw_Statistics_t
+/**
+ * @brief Counters of the data acquisition of a device.
+ *
+ * The board sends the data of a frame in one or more slices. The counters
+ * of the transport between board and host are given in slices, the counters
+ * of the SDK in frames. All values are counted since the device was created
+ * or since the last call to @ref ifx_fmcw_reset_statistics.
+ *
+ * The latency histograms follow a frame through the stages of the
+ * acquisition:
+ * - receive: from the first packet of a slice until the slice is queued by
+ *   the bridge. Only recorded if the slice carries a timestamp of the host
+ *   clock.
+ * - queue: from queueing a slice until the SDK fetches it.
+ * - deinterleave: from fetching the first slice of a frame until the frame
+ *   is complete and converted.
+ * - delivery: from a complete frame until it is passed to the callback
+ *   registered with @ref ifx_fmcw_register_frame_callback.
+ * - user: from passing a frame to the callback until the application
+ *   releases it with @ref ifx_fmcw_release_frame.
+ */
+typedef struct ifx_Fmcw_Statistics
+{
+    uint64_t slices_received;         /**< Slices received from the board */
+    uint64_t slices_dropped;          /**< Slices lost in the transport */
+    uint64_t slices_pool_depleted;    /**< Slices lost because no buffer was free */
+    uint64_t slices_size_exceeded;    /**< Slices lost because they did not fit into a buffer */
+    uint64_t slices_queue_trimmed;    /**< Slices discarded because the queue was full */
+    uint64_t slices_other_errors;     /**< Other errors reported by the board, e.g. FIFO overflows */
+
+    uint64_t frames_received;         /**< Complete frames returned to the application */
+    uint64_t frames_timeout;          /**< Frames not received within the timeout */
+    uint64_t frames_fifo_overflow;    /**< Frames lost because of a FIFO overflow */
+    uint64_t frames_failed;           /**< Frames lost because of other errors */
+
+    uint32_t queue_depth;             /**< Slices currently waiting in the queue */
+    uint32_t queue_high_water_mark;   /**< Maximum number of slices waiting in the queue */
+    uint32_t pool_size;               /**< Number of slice buffers */
+    uint32_t pool_high_water_mark;    /**< Maximum number of slice buffers in use */
+
+    ifx_Fmcw_Latency_Histogram_t receive_latency;       /**< Receive latency of slices */
+    ifx_Fmcw_Latency_Histogram_t queue_latency;         /**< Queue latency of slices */
+    ifx_Fmcw_Latency_Histogram_t deinterleave_latency;  /**< Time to assemble a frame */
+    ifx_Fmcw_Latency_Histogram_t delivery_latency;      /**< Delay until the frame callback */
+    ifx_Fmcw_Latency_Histogram_t user_latency;          /**< Time a frame is held by the application */
+} ifx_Fmcw_Statistics_t;
+
+// ---------------------------------------------------------------------------- ifx_Fmcw_Buffer_Policy_t
+/**
+ * @brief Defines what happens when the application fetches frames slower
+ * than the device acquires them.
+ *
+ * The data received from the board is buffered in the SDK until the
+ * application fetches it. The policy defines the behaviour when this buffer
+ * is full.
+ */
+typedef enum
+{
+    IFX_FMCW_BUFFER_DROP_OLDEST = 0,    /**< Discard the oldest buffered data (default). */
+    IFX_FMCW_BUFFER_DROP_NEWEST = 1,    /**< Discard newly received data. */
+    IFX_FMCW_BUFFER_BLOCK_PRODUCER = 2, /**< Stop reading data from the board until
+                                             the application fetched a frame. If
+                                             the application is too slow, the FIFO
+                                             of the device overflows. */
+    IFX_FMCW_BUFFER_GROW = 3            /**< Start with a small buffer and grow it
+                                             on demand up to the maximum size. The
+                                             buffer shrinks again when it is not
+                                             needed. When the maximum size is
+                                             reached, the oldest data is discarded. */
+} ifx_Fmcw_Buffer_Policy_t;
+
+// ---------------------------------------------------------------------------- ifx_Fmcw_Playback_Mode_t
+/**
+ * @brief Defines how fast a playback device returns the recorded frames.
+ */
+typedef enum
+{
+    IFX_FMCW_PLAYBACK_REAL_TIME = 0,          /**< Return the frames with the frame
+                                                   rate of the recording (default). */
+    IFX_FMCW_PLAYBACK_AS_FAST_AS_POSSIBLE = 1 /**< Return each frame as soon as it
+                                                   is requested. */
+} ifx_Fmcw_Playback_Mode_t;
+
 /*
 ==============================================================================
    4. FUNCTION PROTOTYPES
@@ -0,0 +1,275 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file FrameDispatcher.cpp
+ *
+ * @brief Asynchronous delivery of FMCW frames to a user callback.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "FrameDispatcher.hpp"
+
+#include "ifxBase/Exception.hpp"
+#include "ifxBase/FunctionWrapper.hpp"
+
+#include <algorithm>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+// Timeout for a single frame. A timeout is not an error for the frame
+// callback, the acquisition simply waits for the next frame. The value bounds
+// how long stop() waits for the acquisition thread if no data arrives.
+constexpr uint16_t acquisition_timeout_ms = 1000;
+
+}  // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+FrameDispatcher::FrameDispatcher(DeviceFmcw* device, ifx_Fmcw_Frame_Callback_t callback, void* context, uint32_t num_frames, Statistics& statistics) :
+    m_device {device},
+    m_callback {callback},
+    m_context {context},
+    m_num_frames {num_frames},
+    m_statistics {statistics}
+{
+    if (!m_callback)
+        throw rdk::exception::argument_null();
+
+    if (m_num_frames == 0)
+        throw rdk::exception::argument_invalid();
+}
+
+//----------------------------------------------------------------------------
+
+FrameDispatcher::~FrameDispatcher()
+{
+    stop();
+}
+
+//----------------------------------------------------------------------------
+
+void FrameDispatcher::start()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running && m_acquiring)
+            return;
+    }
+
+    // join the threads of a previous run that ended with an error
+    stop();
+
+    // the pool is only replaced if the application returned all frames
+    if (has_borrowed_frames())
+        throw rdk::exception::not_possible();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pool.clear();
+    m_borrowed.assign(m_num_frames, false);
+    m_borrowed_since.assign(m_num_frames, {});
+    m_free.clear();
+    m_ready.clear();
+    for (uint32_t i = 0; i < m_num_frames; i++)
+    {
+        m_pool.emplace_back(m_device->allocate_frame());
+        if (!m_pool.back())
+            throw rdk::exception::memory_allocation_failed();
+
+        m_free.push_back(m_pool.back().get());
+    }
+
+    m_running = true;
+    m_acquiring = true;
+    m_acquisition_thread = std::thread(&FrameDispatcher::acquisition_loop, this);
+    m_delivery_thread = std::thread(&FrameDispatcher::delivery_loop, this);
+}
+
+//----------------------------------------------------------------------------
+
+void FrameDispatcher::stop()
+{
+    if (std::this_thread::get_id() == m_delivery_thread.get_id())
+        throw rdk::exception::not_possible();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_frame_released.notify_all();
+    m_frame_ready.notify_all();
+
+    if (m_acquisition_thread.joinable())
+        m_acquisition_thread.join();
+    if (m_delivery_thread.joinable())
+        m_delivery_thread.join();
+
+    // frames that were acquired but not delivered go back to the pool
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& delivery : m_ready)
+    {
+        if (delivery.frame)
+            m_free.push_back(delivery.frame);
+    }
+    m_ready.clear();
+}
+
+//----------------------------------------------------------------------------
+
+void FrameDispatcher::release(ifx_Fmcw_Frame_t* frame)
+{
+    if (!frame)
+        throw rdk::exception::argument_null();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto index = pool_index(frame);
+    if (index == m_pool.size() || !m_borrowed[index])
+        throw rdk::exception::argument_invalid();
+
+    m_statistics.user_latency.recordSince(m_borrowed_since[index]);
+    m_borrowed[index] = false;
+    m_free.push_back(frame);
+    m_frame_released.notify_one();
+}
+
+//----------------------------------------------------------------------------
+
+bool FrameDispatcher::is_running() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_running;
+}
+
+//----------------------------------------------------------------------------
+
+bool FrameDispatcher::has_borrowed_frames() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::find(m_borrowed.begin(), m_borrowed.end(), true) != m_borrowed.end();
+}
+
+//----------------------------------------------------------------------------
+
+void FrameDispatcher::acquisition_loop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running)
+    {
+        m_frame_released.wait(lock, [this] { return !m_running || !m_free.empty(); });
+        if (!m_running)
+            break;
+
+        auto* frame = m_free.front();
+        m_free.pop_front();
+        lock.unlock();
+
+        rdk::call_func(m_device, &DeviceFmcw::get_next_frame, frame, acquisition_timeout_ms);
+        const auto error = ifx_error_get_and_clear();
+
+        lock.lock();
+        if (error == IFX_OK)
+        {
+            m_ready.push_back({frame, IFX_OK, std::chrono::steady_clock::now()});
+        }
+        else
+        {
+            m_free.push_front(frame);
+            if (error == IFX_ERROR_TIMEOUT)
+                continue;
+
+            m_ready.push_back({nullptr, error, std::chrono::steady_clock::now()});
+            m_frame_ready.notify_one();
+            break;
+        }
+        m_frame_ready.notify_one();
+    }
+
+    m_acquiring = false;
+    m_frame_ready.notify_one();
+    lock.unlock();
+
+    rdk::call_func(m_device, &DeviceFmcw::stop_acquisition);
+    ifx_error_clear();
+}
+
+//----------------------------------------------------------------------------
+
+void FrameDispatcher::delivery_loop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_frame_ready.wait(lock, [this] { return !m_running || !m_ready.empty() || !m_acquiring; });
+        if (!m_running || m_ready.empty())
+            break;
+
+        const auto delivery = m_ready.front();
+        m_ready.pop_front();
+        m_statistics.delivery_latency.recordSince(delivery.ready);
+        if (delivery.frame)
+        {
+            const auto index = pool_index(delivery.frame);
+            m_borrowed[index] = true;
+            m_borrowed_since[index] = std::chrono::steady_clock::now();
+        }
+        lock.unlock();
+
+        m_callback(m_device, delivery.frame, delivery.error, m_context);
+
+        lock.lock();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+size_t FrameDispatcher::pool_index(const ifx_Fmcw_Frame_t* frame) const
+{
+    const auto it = std::find_if(m_pool.begin(), m_pool.end(), [frame](const SmartFmcwFrame& f) {
+        return f.get() == frame;
+    });
+    return static_cast<size_t>(it - m_pool.begin());
+}
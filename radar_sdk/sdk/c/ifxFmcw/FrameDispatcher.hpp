@@ -0,0 +1,113 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file FrameDispatcher.hpp
+ *
+ * @brief Asynchronous delivery of FMCW frames to a user callback.
+ */
+
+#pragma once
+
+#include "ifxFmcw/DeviceFmcw.h"
+#include "ifxFmcw/DeviceFmcw.hpp"
+
+#include <common/LatencyHistogram.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/* Acquires frames of a device on an own thread and passes them to a callback
+ * on a second thread.
+ *
+ * All frames come from a fixed pool. A frame is either free, being acquired,
+ * queued for delivery or borrowed by the application. The acquisition only
+ * continues if a free frame is available, which bounds the number of frames
+ * in flight to the size of the pool.
+ */
+class FrameDispatcher
+{
+public:
+    // latencies recorded by the dispatcher, owned by the device so they survive the dispatcher
+    struct Statistics
+    {
+        LatencyHistogram delivery_latency;  // frame complete until callback
+        LatencyHistogram user_latency;      // callback until frame released
+    };
+
+    FrameDispatcher(DeviceFmcw* device, ifx_Fmcw_Frame_Callback_t callback, void* context, uint32_t num_frames, Statistics& statistics);
+    ~FrameDispatcher();
+
+    void start();
+    void stop();
+    void release(ifx_Fmcw_Frame_t* frame);
+
+    bool is_running() const;
+    bool has_borrowed_frames() const;
+
+private:
+    void acquisition_loop();
+    void delivery_loop();
+
+    struct Delivery
+    {
+        ifx_Fmcw_Frame_t* frame;
+        ifx_Error_t error;
+        std::chrono::steady_clock::time_point ready;
+    };
+
+    size_t pool_index(const ifx_Fmcw_Frame_t* frame) const;
+
+    DeviceFmcw* m_device;
+    ifx_Fmcw_Frame_Callback_t m_callback;
+    void* m_context;
+    uint32_t m_num_frames;
+    Statistics& m_statistics;
+
+    std::vector<SmartFmcwFrame> m_pool;
+    std::vector<bool> m_borrowed;
+    std::vector<std::chrono::steady_clock::time_point> m_borrowed_since;
+    std::deque<ifx_Fmcw_Frame_t*> m_free;
+    std::deque<Delivery> m_ready;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_frame_released;
+    std::condition_variable m_frame_ready;
+    bool m_running = false;
+    bool m_acquiring = false;
+
+    std::thread m_acquisition_thread;
+    std::thread m_delivery_thread;
+};
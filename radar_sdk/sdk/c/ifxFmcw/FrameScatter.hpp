@@ -0,0 +1,153 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file FrameScatter.hpp
+ *
+ * @brief Conversion of raw samples into the cubes of an FMCW frame.
+ */
+
+#pragma once
+
+#include "ifxBase/Mda.h"
+#include "ifxBase/Types.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+/* Write samples in the order they arrive from the sensor into the cubes of a
+ * frame.
+ *
+ * Within a chirp the samples of all rx antennas are interleaved, i.e. for
+ * each sample index there is one sample per antenna. Without MIMO all chirps
+ * of a cube are sent before the next cube starts. With MIMO the chirps of the
+ * cubes alternate: chirp 0 of all cubes, then chirp 1 of all cubes and so on.
+ * The samples are converted to float while they are written, so every sample
+ * is touched once.
+ */
+class FrameScatter
+{
+public:
+    FrameScatter(ifx_Mda_R_t** cubes, const std::vector<std::array<uint32_t, 3>>& dimensions, bool mimo, ifx_Float_t max_adc_value) :
+        m_cubes {cubes},
+        m_dimensions {dimensions},
+        m_mimo {mimo},
+        m_scale {2.0f / max_adc_value}
+    {}
+
+    void write(const uint16_t* samples, uint32_t num_samples)
+    {
+        while (num_samples > 0 && !done())
+        {
+            const auto& d = m_dimensions[m_cube];
+            const uint32_t num_rx = d[0];
+            const uint32_t num_samples_per_chirp = d[2];
+            const ifx_Mda_R_t* cube = m_cubes[m_cube];
+            const size_t* stride = IFX_MDA_STRIDE(cube);
+            ifx_Float_t* chirp_data = IFX_MDA_DATA(cube) + m_chirp * stride[1];
+
+            if (m_rx == 0 && num_samples >= num_rx)
+            {
+                // complete sample rows: deinterleave antenna by antenna
+                const uint32_t rows = std::min(num_samples / num_rx, num_samples_per_chirp - m_sample);
+                for (uint32_t rx = 0; rx < num_rx; rx++)
+                {
+                    const uint16_t* src = samples + rx;
+                    ifx_Float_t* dst = chirp_data + rx * stride[0] + m_sample * stride[2];
+                    for (uint32_t i = 0; i < rows; i++)
+                        dst[i * stride[2]] = convert(src[i * num_rx]);
+                }
+                samples += rows * num_rx;
+                num_samples -= rows * num_rx;
+                m_sample += rows;
+            }
+            else
+            {
+                // partial sample row at the border of a slice
+                chirp_data[m_rx * stride[0] + m_sample * stride[2]] = convert(*samples++);
+                num_samples--;
+                if (++m_rx == num_rx)
+                {
+                    m_rx = 0;
+                    m_sample++;
+                }
+            }
+
+            if (m_sample == num_samples_per_chirp)
+            {
+                m_sample = 0;
+                next_chirp();
+            }
+        }
+    }
+
+private:
+    ifx_Float_t convert(uint16_t sample) const
+    {
+        return static_cast<ifx_Float_t>(sample) * m_scale - 1.0f;
+    }
+
+    bool done() const
+    {
+        if (m_mimo)
+            return m_chirp == m_dimensions[0][1];
+        return m_cube == m_dimensions.size();
+    }
+
+    void next_chirp()
+    {
+        if (m_mimo)
+        {
+            if (++m_cube == m_dimensions.size())
+            {
+                m_cube = 0;
+                m_chirp++;
+            }
+        }
+        else if (++m_chirp == m_dimensions[m_cube][1])
+        {
+            m_chirp = 0;
+            m_cube++;
+        }
+    }
+
+    ifx_Mda_R_t** m_cubes;
+    const std::vector<std::array<uint32_t, 3>>& m_dimensions;
+    bool m_mimo;
+    ifx_Float_t m_scale;
+
+    size_t m_cube = 0;
+    uint32_t m_chirp = 0;
+    uint32_t m_sample = 0;
+    uint32_t m_rx = 0;
+};
@@ -258,7 +258,7 @@ DeviceFmcwAvian::DeviceFmcwAvian(std::unique_ptr<BoardInstance>&& board) :
     DeviceFmcwBase(MAX_ADC_VALUE, std::move(board))
 {
     // Checks internally that we are really connected to a board with an Avian sensor
-    m_port = std::make_unique<StrataControlPort>(m_board.get());
+    m_port = std::make_unique<ShadowControlPort>(std::make_unique<StrataControlPort>(m_board.get()));
 
     m_driver = Driver::create_driver(*m_port);
     if (!m_driver)
@@ -286,7 +286,7 @@ DeviceFmcwAvian::DeviceFmcwAvian(std::unique_ptr<BoardInstance>&& board) :
 DeviceFmcwAvian::DeviceFmcwAvian(ifx_Radar_Sensor_t device_type, float reference_clock) :
     DeviceFmcwBase(MAX_ADC_VALUE)
 {
-    m_port = std::make_unique<DummyPort>();
+    m_port = std::make_unique<ShadowControlPort>(std::make_unique<DummyPort>());
     m_driver = std::make_unique<Driver>(*m_port, static_cast<Device_Type>(device_type));
     if (reference_clock != 80e6f)
     {
@@ -311,7 +311,7 @@ DeviceFmcwAvian::DeviceFmcwAvian(ifx_Radar_Sensor_t device_type, float reference
 DeviceFmcwAvian::DeviceFmcwAvian(const DeviceFmcwAvian& other) :
     DeviceFmcwBase(MAX_ADC_VALUE)  // NOLINT(readability-redundant-member-init)
 {
-    m_port = std::make_unique<DummyPort>();
+    m_port = std::make_unique<ShadowControlPort>(std::make_unique<DummyPort>());
     m_driver = std::make_unique<Driver>(*m_port, *other.m_driver);
 
     DeviceFmcwAvian::initialize_sensor_info();
@@ -322,6 +322,8 @@ DeviceFmcwAvian::~DeviceFmcwAvian()
 {
     try
     {
+        // the frame callback threads use the device, so they are stopped first
+        stop_frame_callback();
         DeviceFmcwAvian::stop_acquisition();
     }
     catch (...)
@@ -486,9 +488,19 @@ void DeviceFmcwAvian::start_acquisition()
     configure_data(slice_size, readout_address, data_format);
     start_data();
 
-    // Data reading is active now, but the Avian device must be triggered, too.
-    initialize_reference_clock(*m_port, m_driver->get_clock_config_command());
-    m_driver->get_device_configuration().send_to_device(*m_port, true);
+    /*
+     * Data reading is active now, but the Avian device must be triggered, too.
+     * Only registers that differ from what has been programmed before are sent,
+     * so restarting with the same or a similar configuration costs just a few
+     * SPI words. The reference clock startup sequence is needed only if the
+     * clock configuration has changed.
+     */
+    const auto clock_config_command = m_driver->get_clock_config_command();
+    if (!m_port->is_programmed(clock_config_command))
+    {
+        initialize_reference_clock(*m_port, clock_config_command);
+    }
+    m_port->program(m_driver->get_device_configuration(), true);
     m_driver->notify_trigger();
 
     m_data_started = true;
@@ -950,9 +962,9 @@ void DeviceFmcwAvian::set_acquisition_sequence(const ifx_Fmcw_Sequence_Element_t
              */
             auto rc = local_driver->set_frame_definition(&frame_definition);
             check_libavian_return(rc);
-            TimingModel::StateSequence timing_model(*local_driver);
-            auto num_cycles = timing_model.getChirpToChirpTime(next_shape_index);
-            auto prelim_rep_time = timing_model.toSeconds(num_cycles);
+            auto timing_model = TimingModel::StateSequence::create(*local_driver);
+            auto num_cycles = timing_model->getChirpToChirpTime(next_shape_index);
+            auto prelim_rep_time = timing_model->toSeconds(num_cycles);
 
             /*
              * The additional delay to stretch the loop repetition time is
@@ -1018,9 +1030,9 @@ void DeviceFmcwAvian::set_acquisition_sequence(const ifx_Fmcw_Sequence_Element_t
     {
         auto rc = local_driver->set_frame_definition(&frame_definition);
         check_libavian_return(rc);
-        TimingModel::StateSequence timing_model(*local_driver);
-        auto num_cycles = timing_model.getSetToSetTime() - 1;
-        auto prelim_rep_time = timing_model.toSeconds(num_cycles);
+        auto timing_model = TimingModel::StateSequence::create(*local_driver);
+        auto num_cycles = timing_model->getSetToSetTime() - 1;
+        auto prelim_rep_time = timing_model->toSeconds(num_cycles);
 
         auto additional_delay = shape_set_repetition_time - prelim_rep_time;
         if (additional_delay < 0.0f)
@@ -1047,9 +1059,9 @@ void DeviceFmcwAvian::set_acquisition_sequence(const ifx_Fmcw_Sequence_Element_t
      */
     auto rc = local_driver->set_frame_definition(&frame_definition);
     check_libavian_return(rc);
-    TimingModel::StateSequence timing_model(*local_driver);
-    auto num_cycles = timing_model.getFrameDuration() - 1;
-    auto prelim_rep_time = timing_model.toSeconds(num_cycles);
+    auto timing_model = TimingModel::StateSequence::create(*local_driver);
+    auto num_cycles = timing_model->getFrameDuration() - 1;
+    auto prelim_rep_time = timing_model->toSeconds(num_cycles);
 
     auto additional_delay = frame_repetition_time - prelim_rep_time;
     if (additional_delay < 0.0f)
@@ -1625,7 +1637,8 @@ std::unique_ptr<TimingModel::StateSequence> DeviceFmcwAvian::create_timing_model
     for (const auto& entry : m_register_map)
         avian_registers.set(static_cast<uint8_t>(entry.first), entry.second);
 
-    return std::make_unique<StateSequence>(avian_registers, device_type);
+    // the cached model is shared, so the caller gets its own copy
+    return std::make_unique<StateSequence>(*StateSequence::create(avian_registers, device_type));
 }
 
 float DeviceFmcwAvian::get_chirp_duration(const ifx_Fmcw_Sequence_Chirp_t& chirp) const
@@ -1759,8 +1772,8 @@ float DeviceFmcwAvian::get_minimum_chirp_repetition_time(uint32_t num_samples, f
      * Now, with all settings made, the timing model can tell the chirp
      * repetition time.
      */
-    Avian::TimingModel::StateSequence timing_model(local_driver);
-    return float(timing_model.toSeconds(timing_model.getChirpToChirpTime(0)));
+    auto timing_model = Avian::TimingModel::StateSequence::create(local_driver);
+    return float(timing_model->toSeconds(timing_model->getChirpToChirpTime(0)));
 }
 
 double DeviceFmcwAvian::get_chirp_sampling_range(const ifx_Fmcw_Sequence_Chirp_t* chirp) const
@@ -53,6 +53,7 @@
 #include <ifxAvian_RegisterSet.hpp>
 #include <ifxAvian_TimingModel.hpp>
 #include <ifxAvian_Types.hpp>
+#include <ports/ifxAvian_ShadowControlPort.hpp>
 
 #include <atomic>
 #include <chrono>
@@ -136,7 +137,7 @@ private:
 
     void generate_register_list();
 
-    std::unique_ptr<Infineon::Avian::HW::IControlPort> m_port;
+    std::unique_ptr<Infineon::Avian::ShadowControlPort> m_port;  // keeps track of the registers programmed into the device
     std::unique_ptr<Infineon::Avian::Driver> m_driver;
     std::atomic<bool> m_data_started = false;
     std::chrono::steady_clock::time_point m_temperature_expiration_time = {};  // timestamp until the cached temperature value is valid
@@ -0,0 +1,467 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file DeviceFmcwPlayback.cpp
+ *
+ * @brief FMCW device replaying a recording instead of a connected sensor.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "DeviceFmcwPlayback.hpp"
+
+#include "ifxBase/Exception.hpp"
+
+// libAvian
+#include "ifxAvian_DeviceTraits.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+// ifxdaq stores each device of a recording in its own sub directory
+const char* const recording_directories[] = {"", "RadarIfxAvian_00/"};
+
+std::string join_path(const std::string& directory, const char* filename)
+{
+    if (directory.empty() || directory.back() == '/' || directory.back() == '\\')
+        return directory + filename;
+    return directory + "/" + filename;
+}
+
+bool file_exists(const std::string& filename)
+{
+    return std::ifstream(filename).good();
+}
+
+nlohmann::json load_json(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file)
+        throw rdk::exception::opening_file();
+
+    try
+    {
+        return nlohmann::json::parse(file);
+    }
+    catch (const nlohmann::json::exception&)
+    {
+        throw rdk::exception::invalid_json();
+    }
+}
+
+const nlohmann::json& get_value(const nlohmann::json& object, const char* key)
+{
+    const auto it = object.find(key);
+    if (it == object.end())
+        throw rdk::exception::invalid_json_key();
+    return *it;
+}
+
+template <typename T>
+T get_number(const nlohmann::json& object, const char* key)
+{
+    const auto& value = get_value(object, key);
+    if (!value.is_number())
+        throw rdk::exception::invalid_json_value();
+    return value.get<T>();
+}
+
+// antennas are numbered from 1 in the configuration
+uint32_t get_antenna_mask(const nlohmann::json& object, const char* key)
+{
+    const auto& value = get_value(object, key);
+    if (!value.is_array())
+        throw rdk::exception::invalid_json_value();
+
+    uint32_t mask = 0;
+    for (const auto& antenna : value)
+    {
+        if (!antenna.is_number_unsigned() || antenna.get<uint32_t>() < 1 || antenna.get<uint32_t>() > 32)
+            throw rdk::exception::invalid_json_value();
+        mask |= 1u << (antenna.get<uint32_t>() - 1);
+    }
+    return mask;
+}
+
+ifx_Radar_Sensor_t get_sensor_type_by_description(const std::string& description)
+{
+    using Infineon::Avian::Device_Traits;
+    using Infineon::Avian::Device_Type;
+
+    for (int type = 0; type < static_cast<int>(Device_Type::Unknown); type++)
+    {
+        if (description == Device_Traits::get(static_cast<Device_Type>(type)).description)
+            return static_cast<ifx_Radar_Sensor_t>(type);
+    }
+
+    throw rdk::exception::device_not_supported();
+}
+
+}  // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+struct DeviceFmcwPlayback::Recording
+{
+    ifx_Radar_Sensor_t sensor_type;
+    std::string uuid;
+    ifx_Fmcw_Simple_Sequence_Config_t config;
+    std::unique_ptr<NpyFile> npy;
+};
+
+std::unique_ptr<DeviceFmcwPlayback::Recording> DeviceFmcwPlayback::open_recording(const char* path)
+{
+    if (path == nullptr)
+        throw rdk::exception::argument_null();
+
+    std::string directory;
+    for (const auto* sub_directory : recording_directories)
+    {
+        directory = join_path(path, sub_directory);
+        if (file_exists(join_path(directory, "radar.npy")))
+            break;
+    }
+
+    auto recording = std::make_unique<Recording>();
+
+    const auto meta = load_json(join_path(directory, "meta.json"));
+    const auto& description = get_value(meta, "description");
+    if (!description.is_string())
+        throw rdk::exception::invalid_json_value();
+    recording->sensor_type = get_sensor_type_by_description(description.get<std::string>());
+    if (meta.contains("uuid") && meta["uuid"].is_string())
+        recording->uuid = meta["uuid"].get<std::string>();
+
+    const auto config = load_json(join_path(directory, "config.json"));
+    const auto& shape = get_value(get_value(config, "device_config"), "fmcw_single_shape");
+
+    auto& sequence_config = recording->config;
+    sequence_config = {};
+    sequence_config.frame_repetition_time_s = get_number<float>(shape, "frame_repetition_time_s");
+    sequence_config.chirp_repetition_time_s = get_number<float>(shape, "chirp_repetition_time_s");
+    sequence_config.num_chirps = get_number<uint32_t>(shape, "num_chirps_per_frame");
+    sequence_config.tdm_mimo = shape.contains("mimo_mode") && (shape["mimo_mode"] == "tdm");
+
+    auto& chirp = sequence_config.chirp;
+    chirp.start_frequency_Hz = get_number<double>(shape, "start_frequency_Hz");
+    chirp.end_frequency_Hz = get_number<double>(shape, "end_frequency_Hz");
+    chirp.sample_rate_Hz = get_number<float>(shape, "sample_rate_Hz");
+    chirp.num_samples = get_number<uint32_t>(shape, "num_samples_per_chirp");
+    chirp.rx_mask = get_antenna_mask(shape, "rx_antennas");
+    chirp.tx_mask = get_antenna_mask(shape, "tx_antennas");
+    chirp.tx_power_level = get_number<uint32_t>(shape, "tx_power_level");
+    chirp.lp_cutoff_Hz = get_number<int32_t>(shape, "aaf_cutoff_Hz");
+    chirp.hp_cutoff_Hz = get_number<int32_t>(shape, "hp_cutoff_Hz");
+    chirp.if_gain_dB = get_number<int8_t>(shape, "if_gain_dB");
+
+    recording->npy = std::make_unique<NpyFile>(join_path(directory, "radar.npy"));
+    return recording;
+}
+
+DeviceFmcwPlayback::DeviceFmcwPlayback(const char* path) :
+    DeviceFmcwPlayback(open_recording(path))
+{}
+
+DeviceFmcwPlayback::DeviceFmcwPlayback(std::unique_ptr<Recording>&& recording) :
+    DeviceFmcwAvian(recording->sensor_type),
+    m_npy {std::move(recording->npy)},
+    m_uuid {recording->uuid}
+{
+    auto* sequence = ifx_fmcw_create_simple_sequence(&recording->config);
+    if (sequence == nullptr)
+        throw rdk::exception::memory_allocation_failed();
+
+    try
+    {
+        DeviceFmcwAvian::set_acquisition_sequence(sequence);
+    }
+    catch (...)
+    {
+        ifx_fmcw_destroy_sequence(sequence);
+        throw;
+    }
+    ifx_fmcw_destroy_sequence(sequence);
+
+    update_frame_settings();
+
+    // The recording holds the frames with the virtual antennas of all cubes
+    // in the second dimension: (frames, rx, chirps, samples)
+    const auto& shape = m_npy->get_shape();
+    if ((shape.size() != 4)
+        || (shape[2] != m_frame_dimensions[0][1])
+        || (shape[3] != m_frame_dimensions[0][2])
+        || (static_cast<size_t>(shape[1]) * shape[2] * shape[3] != m_num_samples))
+    {
+        throw rdk::exception::dimension_mismatch();
+    }
+
+    m_num_frames = shape[0];
+    m_frame_size = m_num_samples;
+    m_frame_period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(m_frame_repetition_time_s));
+}
+
+DeviceFmcwPlayback::~DeviceFmcwPlayback()
+{
+    try
+    {
+        // the frame callback reads from the recording, which is closed before
+        // the base class stops the callback
+        stop_frame_callback();
+    }
+    catch (...)
+    {
+    }
+}
+
+const char* DeviceFmcwPlayback::get_board_uuid() const
+{
+    if (m_uuid.empty())
+        return DeviceFmcwAvian::get_board_uuid();
+
+    return m_uuid.c_str();
+}
+
+float DeviceFmcwPlayback::get_temperature()
+{
+    // the temperature is not part of the recording
+    throw rdk::exception::not_supported();
+}
+
+void DeviceFmcwPlayback::start_acquisition()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_playing)
+        return;
+
+    m_next_frame_time = std::chrono::steady_clock::now() + m_frame_period;
+    m_playing = true;
+}
+
+void DeviceFmcwPlayback::stop_acquisition()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_playing = false;
+}
+
+void DeviceFmcwPlayback::set_acquisition_sequence(const ifx_Fmcw_Sequence_Element_t* /*sequence*/)
+{
+    // the sequence is defined by the recording
+    throw rdk::exception::not_supported();
+}
+
+void DeviceFmcwPlayback::apply_register_list(const std::map<uint16_t, uint32_t>& /*register_list*/)
+{
+    throw rdk::exception::not_supported();
+}
+
+void DeviceFmcwPlayback::load_register_file(const char* /*filename*/)
+{
+    throw rdk::exception::not_supported();
+}
+
+void DeviceFmcwPlayback::set_playback_mode(ifx_Fmcw_Playback_Mode_t mode, bool loop)
+{
+    if ((mode != IFX_FMCW_PLAYBACK_REAL_TIME) && (mode != IFX_FMCW_PLAYBACK_AS_FAST_AS_POSSIBLE))
+        throw rdk::exception::argument_invalid();
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_mode = mode;
+    m_loop = loop;
+}
+
+void DeviceFmcwPlayback::seek(uint32_t frame_index)
+{
+    if (frame_index >= m_num_frames)
+        throw rdk::exception::index_out_of_bounds();
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_position = frame_index;
+}
+
+uint32_t DeviceFmcwPlayback::get_position() const
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_position;
+}
+
+uint32_t DeviceFmcwPlayback::get_num_frames() const
+{
+    return m_num_frames;
+}
+
+const uint16_t* DeviceFmcwPlayback::get_frame_data(uint32_t frame_index) const
+{
+    if (frame_index >= m_num_frames)
+        throw rdk::exception::index_out_of_bounds();
+
+    return m_npy->get_data() + static_cast<size_t>(frame_index) * m_frame_size;
+}
+
+/* Return the frame at the current position and advance the position.
+ *
+ * In real time mode the frame is returned at the time it was acquired
+ * relative to the start of the acquisition, with the frame repetition time
+ * of the recorded sequence. No frames are dropped: if the application is
+ * late, the following frames are returned without waiting until it caught up.
+ */
+const uint16_t* DeviceFmcwPlayback::next_frame_data(uint16_t timeout_ms)
+{
+    start_acquisition();
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    if (m_mode == IFX_FMCW_PLAYBACK_REAL_TIME)
+    {
+        const auto frame_time = m_next_frame_time;
+        const auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+        lock.unlock();
+        if (frame_time > expiry)
+        {
+            std::this_thread::sleep_until(expiry);
+            m_statistics.frames_timeout++;
+            throw rdk::exception::timeout();
+        }
+        std::this_thread::sleep_until(frame_time);
+        lock.lock();
+
+        m_next_frame_time += m_frame_period;
+    }
+
+    if (m_position >= m_num_frames)
+    {
+        if (!m_loop)
+            throw rdk::exception::end_of_file();
+        m_position = 0;
+    }
+
+    m_statistics.frames_received++;
+    return get_frame_data(m_position++);
+}
+
+void DeviceFmcwPlayback::get_next_frame(ifx_Fmcw_Frame_t* frame, uint16_t timeout_ms)
+{
+    check_frame_dimensions(frame);
+
+    // The recording holds the cubes one after the other, each in the layout
+    // (rx, chirps, samples) of the cube. So the samples are converted straight
+    // from the mapped file into the cubes without any intermediate buffer.
+    const uint16_t* samples = next_frame_data(timeout_ms);
+    const ifx_Float_t scale = 2.0f / m_max_adc_value;
+
+    for (uint32_t i = 0; i < frame->num_cubes; i++)
+    {
+        const auto& d = m_frame_dimensions[i];
+        ifx_Mda_R_t* cube = frame->cubes[i];
+        const size_t* stride = IFX_MDA_STRIDE(cube);
+
+        for (uint32_t rx = 0; rx < d[0]; rx++)
+        {
+            for (uint32_t chirp = 0; chirp < d[1]; chirp++)
+            {
+                ifx_Float_t* dst = IFX_MDA_DATA(cube) + rx * stride[0] + chirp * stride[1];
+                for (uint32_t sample = 0; sample < d[2]; sample++)
+                    dst[sample * stride[2]] = static_cast<ifx_Float_t>(samples[sample]) * scale - 1.0f;
+                samples += d[2];
+            }
+        }
+    }
+}
+
+/* A raw frame holds the samples in the order the sensor acquires them. Within
+ * a chirp the samples of the rx antennas are interleaved. Without MIMO all
+ * chirps of a cube are acquired before the next cube, with MIMO the chirps of
+ * the cubes alternate.
+ */
+void DeviceFmcwPlayback::get_next_raw_frame(ifx_Fmcw_Raw_Frame_t* frame, uint16_t timeout_ms)
+{
+    if (frame == nullptr)
+        throw rdk::exception::argument_null();
+
+    if (frame->num_samples != m_num_samples)
+        throw rdk::exception::dimension_mismatch();
+
+    const uint16_t* samples = next_frame_data(timeout_ms);
+
+    std::vector<const uint16_t*> cubes;
+    for (const auto& d : m_frame_dimensions)
+    {
+        cubes.push_back(samples);
+        samples += d[0] * d[1] * d[2];
+    }
+
+    uint16_t* dst = frame->samples;
+    auto interleave_chirp = [&](size_t cube, uint32_t chirp) {
+        const auto& d = m_frame_dimensions[cube];
+        const uint16_t* src = cubes[cube] + chirp * d[2];
+        for (uint32_t sample = 0; sample < d[2]; sample++)
+        {
+            for (uint32_t rx = 0; rx < d[0]; rx++)
+                *dst++ = src[rx * d[1] * d[2] + sample];
+        }
+    };
+
+    if (m_mimo)
+    {
+        for (uint32_t chirp = 0; chirp < m_frame_dimensions[0][1]; chirp++)
+        {
+            for (size_t cube = 0; cube < cubes.size(); cube++)
+                interleave_chirp(cube, chirp);
+        }
+    }
+    else
+    {
+        for (size_t cube = 0; cube < cubes.size(); cube++)
+        {
+            for (uint32_t chirp = 0; chirp < m_frame_dimensions[cube][1]; chirp++)
+                interleave_chirp(cube, chirp);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file DeviceFmcwPlayback.hpp
+ *
+ * @brief FMCW device replaying a recording instead of a connected sensor.
+ */
+
+#pragma once
+
+#include "../avian/DeviceFmcwAvian.hpp"
+#include "NpyFile.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+
+/* Plays back a recording made with the Radar Development Kit.
+ *
+ * A recording is a directory with the files
+ * - radar.npy: the frames as uint16 array of shape (frames, rx, chirps, samples)
+ * - config.json: the device configuration ("fmcw_single_shape")
+ * - meta.json: the sensor description and board uuid
+ *
+ * The device behaves like a dummy Avian device configured with the recorded
+ * sequence, so the sequence, the timing and the register list can be queried
+ * as usual, but the sequence cannot be changed. Instead of reading slices from
+ * a board, the frames are taken from the memory mapped radar.npy.
+ */
+struct DeviceFmcwPlayback : public DeviceFmcwAvian
+{
+    NONCOPYABLE(DeviceFmcwPlayback);
+
+    explicit DeviceFmcwPlayback(const char* path);
+    ~DeviceFmcwPlayback() override;
+
+    const char* get_board_uuid() const override;
+    float get_temperature() override;
+
+    void start_acquisition() override;
+    void stop_acquisition() override;
+
+    void get_next_frame(ifx_Fmcw_Frame_t* frame, uint16_t timeout_ms) override;
+    void get_next_raw_frame(ifx_Fmcw_Raw_Frame_t* frame, uint16_t timeout_ms) override;
+
+    void set_acquisition_sequence(const ifx_Fmcw_Sequence_Element_t* sequence) override;
+    void apply_register_list(const std::map<uint16_t, uint32_t>& register_list) override;
+    void load_register_file(const char* filename) override;
+
+    void set_playback_mode(ifx_Fmcw_Playback_Mode_t mode, bool loop);
+    void seek(uint32_t frame_index);
+    uint32_t get_position() const;
+    uint32_t get_num_frames() const;
+    const uint16_t* get_frame_data(uint32_t frame_index) const;
+
+private:
+    struct Recording;
+
+    explicit DeviceFmcwPlayback(std::unique_ptr<Recording>&& recording);
+    static std::unique_ptr<Recording> open_recording(const char* path);
+
+    const uint16_t* next_frame_data(uint16_t timeout_ms);
+
+    std::unique_ptr<NpyFile> m_npy;
+    std::string m_uuid;
+    uint32_t m_num_frames;
+    uint32_t m_frame_size;  // samples per frame
+    std::chrono::steady_clock::duration m_frame_period;
+
+    mutable std::mutex m_lock;  // protects the playback state below
+    ifx_Fmcw_Playback_Mode_t m_mode = IFX_FMCW_PLAYBACK_REAL_TIME;
+    bool m_loop = false;
+    bool m_playing = false;
+    uint32_t m_position = 0;
+    std::chrono::steady_clock::time_point m_next_frame_time;
+};
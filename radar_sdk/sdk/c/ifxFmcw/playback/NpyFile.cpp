@@ -0,0 +1,267 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file NpyFile.cpp
+ *
+ * @brief Read-only memory mapping of a NumPy .npy file.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "NpyFile.hpp"
+
+#include "ifxBase/Exception.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+constexpr char magic[] = "\x93NUMPY";
+constexpr size_t magic_length = sizeof(magic) - 1;
+
+/* Return the text following "'key':" in the header dictionary, with leading
+ * spaces removed. The header is a Python dict literal written by numpy, e.g.
+ * {'descr': '<u2', 'fortran_order': False, 'shape': (256, 3, 8, 64), }
+ */
+std::string get_header_value(const std::string& header, const char* key)
+{
+    const auto key_pos = header.find(std::string("'") + key + "'");
+    if (key_pos == std::string::npos)
+        throw rdk::exception::file_invalid();
+
+    auto pos = header.find(':', key_pos);
+    if (pos == std::string::npos)
+        throw rdk::exception::file_invalid();
+
+    pos = header.find_first_not_of(' ', pos + 1);
+    if (pos == std::string::npos)
+        throw rdk::exception::file_invalid();
+
+    return header.substr(pos);
+}
+
+}  // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+NpyFile::NpyFile(const std::string& filename)
+{
+    map(filename);
+
+    try
+    {
+        parse_header();
+    }
+    catch (...)
+    {
+        unmap();
+        throw;
+    }
+}
+
+NpyFile::~NpyFile()
+{
+    unmap();
+}
+
+#ifdef _WIN32
+
+void NpyFile::map(const std::string& filename)
+{
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw rdk::exception::opening_file();
+    m_file = file;
+
+    LARGE_INTEGER size;
+    HANDLE file_mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+        file_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (file_mapping == nullptr)
+    {
+        unmap();
+        throw rdk::exception::opening_file();
+    }
+    m_file_mapping = file_mapping;
+
+    m_mapping = static_cast<const uint8_t*>(MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_mapping == nullptr)
+    {
+        unmap();
+        throw rdk::exception::opening_file();
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+}
+
+void NpyFile::unmap()
+{
+    if (m_mapping)
+        UnmapViewOfFile(m_mapping);
+    if (m_file_mapping)
+        CloseHandle(m_file_mapping);
+    if (m_file)
+        CloseHandle(m_file);
+
+    m_mapping = nullptr;
+    m_file_mapping = nullptr;
+    m_file = nullptr;
+    m_size = 0;
+}
+
+#else
+
+void NpyFile::map(const std::string& filename)
+{
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw rdk::exception::opening_file();
+
+    struct stat st;
+    void* mapping = MAP_FAILED;
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0))
+        mapping = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // the mapping keeps its own reference to the file
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+        throw rdk::exception::opening_file();
+
+    m_mapping = static_cast<const uint8_t*>(mapping);
+    m_size = static_cast<size_t>(st.st_size);
+
+    // frames are usually played back in order
+    posix_madvise(mapping, m_size, POSIX_MADV_SEQUENTIAL);
+}
+
+void NpyFile::unmap()
+{
+    if (m_mapping)
+        munmap(const_cast<uint8_t*>(m_mapping), m_size);
+
+    m_mapping = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+void NpyFile::parse_header()
+{
+    if ((m_size < magic_length + 4) || (std::memcmp(m_mapping, magic, magic_length) != 0))
+        throw rdk::exception::file_invalid();
+
+    // version 1.0 has a 16 bit header length, later versions a 32 bit length
+    const uint8_t major_version = m_mapping[magic_length];
+    size_t header_offset;
+    size_t header_length;
+    if (major_version == 1)
+    {
+        header_offset = magic_length + 4;
+        header_length = m_mapping[8] | (m_mapping[9] << 8);
+    }
+    else if ((major_version == 2 || major_version == 3) && (m_size >= magic_length + 6))
+    {
+        header_offset = magic_length + 6;
+        header_length = m_mapping[8] | (m_mapping[9] << 8) | (m_mapping[10] << 16) | (static_cast<size_t>(m_mapping[11]) << 24);
+    }
+    else
+    {
+        throw rdk::exception::file_invalid();
+    }
+
+    const size_t data_offset = header_offset + header_length;
+    if ((data_offset > m_size) || (data_offset % sizeof(uint16_t) != 0))
+        throw rdk::exception::file_invalid();
+
+    const std::string header(reinterpret_cast<const char*>(m_mapping + header_offset), header_length);
+
+    if (get_header_value(header, "descr").compare(0, 5, "'<u2'") != 0)
+        throw rdk::exception::file_invalid();
+
+    if (get_header_value(header, "fortran_order").compare(0, 5, "False") != 0)
+        throw rdk::exception::file_invalid();
+
+    const auto shape = get_header_value(header, "shape");
+    if (shape.empty() || shape[0] != '(')
+        throw rdk::exception::file_invalid();
+
+    m_shape.clear();
+    m_num_elements = 1;
+    const char* pos = shape.c_str() + 1;
+    while (true)
+    {
+        while (*pos == ' ' || *pos == ',')
+            pos++;
+        if (*pos == ')')
+            break;
+
+        char* end;
+        const auto dimension = std::strtoul(pos, &end, 10);
+        if ((end == pos) || (dimension > UINT32_MAX))
+            throw rdk::exception::file_invalid();
+
+        m_shape.push_back(static_cast<uint32_t>(dimension));
+        m_num_elements *= dimension;
+        pos = end;
+    }
+
+    if (m_num_elements > (m_size - data_offset) / sizeof(uint16_t))
+        throw rdk::exception::file_invalid();
+
+    m_data = reinterpret_cast<const uint16_t*>(m_mapping + data_offset);
+}
@@ -0,0 +1,97 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file NpyFile.hpp
+ *
+ * @brief Read-only memory mapping of a NumPy .npy file.
+ */
+
+#pragma once
+
+#include "ifxBase/internal/NonCopyable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/* Maps a .npy file holding a C-ordered array of little endian uint16 values.
+ *
+ * The file is mapped into memory instead of being read, so opening a large
+ * recording is cheap and the data is only paged in when it is accessed. The
+ * pointer returned by get_data() stays valid as long as the object exists.
+ */
+class NpyFile
+{
+public:
+    NONCOPYABLE(NpyFile);
+
+    /* Map the file and parse its header.
+     *
+     * Throws rdk::exception::opening_file if the file cannot be opened or
+     * mapped, and rdk::exception::file_invalid if it is no .npy file or the
+     * array is not of type '<u2' in C order.
+     */
+    explicit NpyFile(const std::string& filename);
+    ~NpyFile();
+
+    const std::vector<uint32_t>& get_shape() const
+    {
+        return m_shape;
+    }
+
+    size_t get_num_elements() const
+    {
+        return m_num_elements;
+    }
+
+    const uint16_t* get_data() const
+    {
+        return m_data;
+    }
+
+private:
+    void map(const std::string& filename);
+    void unmap();
+    void parse_header();
+
+    const uint8_t* m_mapping = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_file_mapping = nullptr;
+#endif
+
+    std::vector<uint32_t> m_shape;
+    size_t m_num_elements = 0;
+    const uint16_t* m_data = nullptr;
+};
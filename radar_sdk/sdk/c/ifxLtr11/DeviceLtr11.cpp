@@ -118,6 +118,16 @@ ifx_Vector_C_t* ifx_ltr11_get_next_frame_timeout(ifx_Ltr11_Device_t* handle, ifx
     return rdk::call_func(handle, &ifx_Ltr11_Device_t::getNextFrame, nullptr, frame_data, metadata, timeout_ms);
 }
 
+ifx_Matrix_C_t* ifx_ltr11_get_next_frames(ifx_Ltr11_Device_t* handle, ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t num_frames, uint16_t timeout_ms)
+{
+    return rdk::call_func(handle, &ifx_Ltr11_Device_t::getNextFrames, nullptr, frames, metadata, num_frames, timeout_ms);
+}
+
+void ifx_ltr11_get_next_frames_int16(ifx_Ltr11_Device_t* handle, int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t num_frames, uint16_t timeout_ms)
+{
+    rdk::call_func(handle, &ifx_Ltr11_Device_t::getNextFramesInt16, samples, metadata, num_frames, timeout_ms);
+}
+
 void ifx_ltr11_register_dump_to_file(ifx_Ltr11_Device_t* handle, const char* filename)
 {
     rdk::call_func(handle, &ifx_Ltr11_Device_t::dumpRegisters, filename);
@@ -49,6 +49,7 @@
 #include "DeviceLtr11Types.h"
 #include "ifxBase/Error.h"
 #include "ifxBase/List.h"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Types.h"
 #include "ifxBase/Vector.h"
 
@@ -380,6 +381,49 @@ ifx_Vector_C_t* ifx_ltr11_get_next_frame(ifx_Ltr11_Device_t* handle, ifx_Vector_
 IFX_DLL_PUBLIC
 ifx_Vector_C_t* ifx_ltr11_get_next_frame_timeout(ifx_Ltr11_Device_t* handle, ifx_Vector_C_t* frame_data, ifx_Ltr11_Metadata_t* metadata, uint16_t timeout_ms);
 
+/**
+ * \brief Retrieves the next num_frames frames of time domain data from the LTR11 device.
+ *
+ * This function works like \ref ifx_ltr11_get_next_frame_timeout, but retrieves num_frames consecutive
+ * frames in one call. With short pulse repetition times and few samples per frame, this avoids the
+ * overhead of one call per frame, e.g., when the device is used from Python.
+ *
+ * Row i of *frames* holds the samples of frame i, and metadata[i] holds the metadata of frame i.
+ * If *frames* is NULL, the function allocates a matrix with num_frames rows and num_samples columns,
+ * and the caller is responsible to free it.
+ *
+ * The timeout applies to each frame. If an error occurs, the content of the frames read so far is
+ * undefined and the acquisition is stopped.
+ *
+ * \param [in]   handle         Device handle for BGT60LTR11 device.
+ * \param [out]  frames         Matrix with num_frames rows and num_samples columns, or NULL.
+ * \param [out]  metadata       Array of num_frames metadata structures.
+ * \param [in]   num_frames     Number of frames to retrieve.
+ * \param [in]   timeout_ms     Timeout in milliseconds for each frame.
+ *
+ * @return \ref ifx_Matrix_C_t  Pointer to the matrix with the time domain data. This is *frames*
+ *                              if the latter is not NULL, otherwise a newly allocated matrix.
+ */
+IFX_DLL_PUBLIC
+ifx_Matrix_C_t* ifx_ltr11_get_next_frames(ifx_Ltr11_Device_t* handle, ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t num_frames, uint16_t timeout_ms);
+
+/**
+ * \brief Retrieves the next num_frames frames as 16 bit integers from the LTR11 device.
+ *
+ * Same as \ref ifx_ltr11_get_next_frames, but the samples are not normalized. The buffer *samples*
+ * receives num_frames x num_samples interleaved I/Q pairs, i.e., I of sample k of frame i is at
+ * index 2 * (i * num_samples + k), and Q follows. The values are the 8 significant bits of the
+ * ADC (0 to 255).
+ *
+ * \param [in]   handle         Device handle for BGT60LTR11 device.
+ * \param [out]  samples        Buffer for 2 * num_frames * num_samples values.
+ * \param [out]  metadata       Array of num_frames metadata structures.
+ * \param [in]   num_frames     Number of frames to retrieve.
+ * \param [in]   timeout_ms     Timeout in milliseconds for each frame.
+ */
+IFX_DLL_PUBLIC
+void ifx_ltr11_get_next_frames_int16(ifx_Ltr11_Device_t* handle, int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t num_frames, uint16_t timeout_ms);
+
 /**
  * \brief Return the limiting values for the LTR11 configuration.
  *
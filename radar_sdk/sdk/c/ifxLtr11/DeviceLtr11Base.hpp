@@ -40,6 +40,7 @@
 
 #include "DeviceLtr11Types.h"
 #include "ifxBase/internal/NonCopyable.hpp"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Vector.h"
 #include "ifxRadarDeviceCommon/RadarDeviceCommon.h"
 
@@ -60,6 +61,8 @@ public:
     virtual void stopAcquisition() = 0;
 
     virtual ifx_Vector_C_t* getNextFrame(ifx_Vector_C_t* frame, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs) = 0;
+    virtual ifx_Matrix_C_t* getNextFrames(ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs) = 0;
+    virtual void getNextFramesInt16(int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs) = 0;
 
     const ifx_Radar_Sensor_Info_t* get_sensor_info();
     const ifx_Firmware_Info_t* get_firmware_info() const;
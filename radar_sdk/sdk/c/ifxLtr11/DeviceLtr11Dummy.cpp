@@ -42,6 +42,15 @@ ifx_Vector_C_t* DeviceLtr11Dummy::getNextFrame(ifx_Vector_C_t* frame, ifx_Ltr11_
     return nullptr;
 }
 
+ifx_Matrix_C_t* DeviceLtr11Dummy::getNextFrames(ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs)
+{
+    return nullptr;
+}
+
+void DeviceLtr11Dummy::getNextFramesInt16(int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs)
+{
+}
+
 void DeviceLtr11Dummy::dumpRegisters(const char* filename)
 {
 }
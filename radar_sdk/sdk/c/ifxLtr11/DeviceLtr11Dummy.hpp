@@ -52,4 +52,6 @@ public:
     void dumpRegisters(const char* filename) override;
 
     ifx_Vector_C_t* getNextFrame(ifx_Vector_C_t* frame, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs) override;
+    ifx_Matrix_C_t* getNextFrames(ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs) override;
+    void getNextFramesInt16(int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs) override;
 };
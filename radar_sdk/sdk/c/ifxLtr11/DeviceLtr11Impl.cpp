@@ -30,13 +30,14 @@
 #include "DeviceLtr11Impl.hpp"
 
 #include <common/exception/EException.hpp>
-#include <common/Finally.hpp>
 #include <components/interfaces/IRadarLtr11.hpp>
 #include <platform/interfaces/IBridgeControl.hpp>
 #include <platform/interfaces/IBridgeData.hpp>
 
 #include "ifxBase/Complex.h"
 #include "ifxBase/Exception.hpp"
+#include "ifxBase/internal/Kernels.h"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Vector.h"
 #include "ifxRadarDeviceCommon/internal/RadarDeviceCommon.hpp"
 
@@ -75,14 +76,34 @@ uint32_t getFrameSize()
     return (frameSize * sizeof(uint16_t));
 }
 
-float normalize(uint16_t fvalue)
+/* For LTR11, internal ADC, which is physically an 8bit ADC,
+ * is used. The result is 10 bit wide, but only bit9-bit2 are
+ * significant, hence bit1-bit0 and bit15-bit10 are discarded.
+ */
+constexpr uint16_t ADC_SIGNIFICANT_BITS_MASK = 0x3FC;
+constexpr int ADC_SIGNIFICANT_BITS_SHIFT = 2;
+
+// normalizes the 8 bit value to [0, 1], the shift is included in the scale
+constexpr ifx_Float_t ADC_SCALE = 1.0f / (0xFF << ADC_SIGNIFICANT_BITS_SHIFT);
+
+constexpr uint32_t DETECTOR_OUTPUT_INDEX = 3;  // detector output index in data readout
+
+/* Extract the I/Q values of numSamples readouts of stepping uint16_t's each */
+void extractSamples(const uint16_t* data, size_t stepping, ifx_Complex_t* out, size_t stride, uint32_t numSamples)
 {
-    /* For LTR11, internal ADC, which is physically an 8bit ADC,
-     * is used. The result is 10 bit wide, but only bit9-bit2 are
-     * significant, hence bit1-bit0 and bit15-bit10 are discarded.
-     */
-    auto value = (fvalue & 0x3FC) >> 2;
-    return (1.0f * value) / 0xFF;
+    if (stride == 1)
+    {
+        ifx_kernels_get()->gather_iq_c(data, stepping, out, numSamples, ADC_SIGNIFICANT_BITS_MASK, ADC_SCALE);
+        return;
+    }
+
+    for (uint32_t i = 0; i < numSamples; ++i)
+    {
+        const auto* iq = &data[i * stepping];
+        const ifx_Float_t I = static_cast<ifx_Float_t>(iq[0] & ADC_SIGNIFICANT_BITS_MASK) * ADC_SCALE;
+        const ifx_Float_t Q = static_cast<ifx_Float_t>(iq[1] & ADC_SIGNIFICANT_BITS_MASK) * ADC_SCALE;
+        out[i * stride] = IFX_COMPLEX_DEF(I, Q);
+    }
 }
 
 }  // end of anonymous namespace
@@ -218,9 +239,21 @@ void DeviceLtr11::stopAcquisition()
     m_acquisitionStarted = false;
 }
 
-ifx_Vector_C_t* DeviceLtr11::getNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs)
+/* Read numFrames consecutive frames. For each frame the metadata is updated and
+ * extractSamples(frameIdx, data) copies the samples while the frame is still held. */
+template <typename ExtractSamples>
+void DeviceLtr11::readNextFrames(ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs, ExtractSamples extractSamples)
 {
+    FrameWrapper<> deviceFrame;
+    for (uint32_t frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+    {
+        const auto* data = readNextFrame(deviceFrame, &metadata[frameIdx], timeoutMs);
+        extractSamples(frameIdx, data);
+    }
+}
 
+void DeviceLtr11::checkAcquisitionArguments(const ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs) const
+{
     if (!m_frameConfigValid)
     {
         throw ::rdk::exception::error();
@@ -233,6 +266,11 @@ ifx_Vector_C_t* DeviceLtr11::getNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_M
     {
         throw ::rdk::exception::argument_invalid();
     }
+}
+
+ifx_Vector_C_t* DeviceLtr11::getNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs)
+{
+    checkAcquisitionArguments(metadata, timeoutMs);
 
     bool frameDataMemoryAllocated;  // Flag indicating when true: frame memory allocated in getNextFrame method
     if (!frameData)
@@ -257,7 +295,9 @@ ifx_Vector_C_t* DeviceLtr11::getNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_M
 
     try
     {
-        readNextFrame(frameData, metadata, timeoutMs);
+        readNextFrames(metadata, 1, timeoutMs, [this, frameData](uint32_t /*frameIdx*/, const uint16_t* data) {
+            extractSamples(data, m_frameSize / sizeof(uint16_t), IFX_VEC_DAT(frameData), IFX_VEC_STRIDE(frameData), getNumberOfSamples());
+        });
     }
     catch (const rdk::exception::exception& e)
     {
@@ -270,6 +310,87 @@ ifx_Vector_C_t* DeviceLtr11::getNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_M
     return frameData;
 }
 
+ifx_Matrix_C_t* DeviceLtr11::getNextFrames(ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs)
+{
+    checkAcquisitionArguments(metadata, timeoutMs);
+    if (!numFrames)
+    {
+        throw ::rdk::exception::argument_invalid();
+    }
+
+    const auto numberOfSamples = getNumberOfSamples();
+    bool framesMemoryAllocated;
+    if (!frames)
+    {
+        frames = ifx_mat_create_c(numFrames, numberOfSamples);
+        if (!frames)
+            throw rdk::exception::memory_allocation_failed();
+        framesMemoryAllocated = true;
+    }
+    else
+    {
+        if (IFX_MDA_DIMENSIONS(frames) != 2 || IFX_MAT_ROWS(frames) != numFrames || IFX_MAT_COLS(frames) != numberOfSamples)
+            throw rdk::exception::dimension_mismatch();
+        framesMemoryAllocated = false;
+    }
+
+    if (!m_acquisitionStarted)
+    {
+        startAcquisition();
+    }
+
+    try
+    {
+        const auto frameStepping = (m_frameSize / sizeof(uint16_t));
+        readNextFrames(metadata, numFrames, timeoutMs, [=](uint32_t frameIdx, const uint16_t* data) {
+            extractSamples(data, frameStepping, &IFX_MAT_AT(frames, frameIdx, 0), IFX_MAT_STRIDE(frames, 1), numberOfSamples);
+        });
+    }
+    catch (const rdk::exception::exception& e)
+    {
+        stopAcquisition();
+        if (framesMemoryAllocated)
+            ifx_mat_destroy_c(frames);
+        throw e;
+    }
+
+    return frames;
+}
+
+void DeviceLtr11::getNextFramesInt16(int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs)
+{
+    checkAcquisitionArguments(metadata, timeoutMs);
+    if (!samples)
+    {
+        throw ::rdk::exception::argument_null();
+    }
+    if (!numFrames)
+    {
+        throw ::rdk::exception::argument_invalid();
+    }
+
+    if (!m_acquisitionStarted)
+    {
+        startAcquisition();
+    }
+
+    try
+    {
+        const auto* kernels = ifx_kernels_get();
+        const auto frameStepping = (m_frameSize / sizeof(uint16_t));
+        const auto numberOfSamples = getNumberOfSamples();
+        readNextFrames(metadata, numFrames, timeoutMs, [=](uint32_t frameIdx, const uint16_t* data) {
+            int16_t* out = samples + (static_cast<size_t>(frameIdx) * numberOfSamples * 2);
+            kernels->gather_iq_s16(data, frameStepping, out, numberOfSamples, ADC_SIGNIFICANT_BITS_MASK, ADC_SIGNIFICANT_BITS_SHIFT);
+        });
+    }
+    catch (const rdk::exception::exception& e)
+    {
+        stopAcquisition();
+        throw e;
+    }
+}
+
 void DeviceLtr11::softReset()
 {
     m_radarLtr11->getIPinsLtr11()->reset();
@@ -320,22 +441,16 @@ uint16_t DeviceLtr11::getNumberOfSamples() const
     return m_config.num_samples;
 }
 
-void DeviceLtr11::readNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs)
+const uint16_t* DeviceLtr11::readNextFrame(FrameWrapper<>& deviceFrame, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs)
 {
-    const auto frameBufferSize = determineBufferSize();
-
-    auto* deviceFrame = m_board->getFrame(timeoutMs);
-
-    if (deviceFrame == nullptr)
+    // give the previous frame back to the pool before waiting for the next one
+    deviceFrame.reset();
+    deviceFrame.reset(m_board->getFrame(timeoutMs));
+    if (!deviceFrame)
     {
         throw rdk::exception::timeout();
     }
 
-    auto cleanup = stdext::finally(
-        [&deviceFrame]() {
-            deviceFrame->release();
-        });
-
     const auto statusCode = deviceFrame->getStatusCode();
     switch (statusCode)
     {
@@ -348,10 +463,9 @@ void DeviceLtr11::readNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_Metadata_t*
             break;
         default:
             throw rdk::exception::error();
-            return;
     }
 
-    if (deviceFrame->getDataSize() != frameBufferSize)
+    if (deviceFrame->getDataSize() != determineBufferSize())
     {
         throw rdk::exception::dimension_mismatch();
     }
@@ -383,26 +497,14 @@ void DeviceLtr11::readNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_Metadata_t*
     m_averagePower += (currentPower - m_averagePower) / ++m_frameCounter;
 
     const auto frameStepping = (m_frameSize / sizeof(uint16_t));
-    const auto detectorOutputIndex = 3;  // detector output index in data readout
-
     const auto* dataAsUint = reinterpret_cast<const uint16_t*>(deviceFrame->getData());
 
-    const auto numberOfSamples = getNumberOfSamples();
-    for (uint32_t i = 0; i < numberOfSamples; ++i)
-    {
-
-        const auto ifiIdx = (i * frameStepping);
-        // ifqIdx  = ifiIdx + 1
-
-        const ifx_Float_t I = ::normalize(dataAsUint[ifiIdx]);
-        const ifx_Float_t Q = ::normalize(dataAsUint[ifiIdx + 1]);
-
-        IFX_VEC_AT(frameData, i) = IFX_COMPLEX_DEF(I, Q);
-    }
-
-    metadata->motion = (dataAsUint[(numberOfSamples - 1) * frameStepping + detectorOutputIndex] & IFX_LTR11_DETECTOR_OUTPUT_MOTION_MASK) == IFX_LTR11_DETECTOR_OUTPUT_MOTION_MASK;
-    metadata->direction = (dataAsUint[(numberOfSamples - 1) * frameStepping + detectorOutputIndex] & IFX_LTR11_DETECTOR_OUTPUT_DIRECTION_MASK) == IFX_LTR11_DETECTOR_OUTPUT_DIRECTION_MASK;
+    const auto detectorOutput = dataAsUint[(getNumberOfSamples() - 1) * frameStepping + DETECTOR_OUTPUT_INDEX];
+    metadata->motion = (detectorOutput & IFX_LTR11_DETECTOR_OUTPUT_MOTION_MASK) == IFX_LTR11_DETECTOR_OUTPUT_MOTION_MASK;
+    metadata->direction = (detectorOutput & IFX_LTR11_DETECTOR_OUTPUT_DIRECTION_MASK) == IFX_LTR11_DETECTOR_OUTPUT_DIRECTION_MASK;
     metadata->avg_power = m_averagePower;
+
+    return dataAsUint;
 }
 
 void DeviceLtr11::dumpRegisters(const char* filename)
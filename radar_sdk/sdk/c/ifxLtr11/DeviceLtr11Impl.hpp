@@ -44,6 +44,7 @@
 // strata
 #include <components/interfaces/IRegisters.hpp>
 #include <platform/BoardInstance.hpp>
+#include <platform/frames/FrameWrapper.hpp>
 #include <universal/types/DataSettingsBgtRadar.h>
 
 #include <atomic>
@@ -71,6 +72,8 @@ public:
     void dumpRegisters(const char* filename) override;
 
     ifx_Vector_C_t* getNextFrame(ifx_Vector_C_t* frame, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs) override;
+    ifx_Matrix_C_t* getNextFrames(ifx_Matrix_C_t* frames, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs) override;
+    void getNextFramesInt16(int16_t* samples, ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs) override;
 
 private:
     void softReset();
@@ -87,7 +90,11 @@ private:
 
     uint16_t getNumberOfSamples() const;
 
-    void readNextFrame(ifx_Vector_C_t* frameData, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs);
+    void checkAcquisitionArguments(const ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs) const;
+    const uint16_t* readNextFrame(FrameWrapper<>& deviceFrame, ifx_Ltr11_Metadata_t* metadata, uint16_t timeoutMs);
+
+    template <typename ExtractSamples>
+    void readNextFrames(ifx_Ltr11_Metadata_t* metadata, uint32_t numFrames, uint16_t timeoutMs, ExtractSamples extractSamples);
 
     std::unique_ptr<BoardInstance> m_board;
 
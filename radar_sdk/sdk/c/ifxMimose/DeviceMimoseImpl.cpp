@@ -34,6 +34,7 @@
 
 #include "ifxBase/Cube.h"
 #include "ifxBase/Exception.hpp"
+#include "ifxBase/internal/Kernels.h"
 #include "ifxRadarDeviceCommon/internal/RadarDeviceCommon.hpp"
 
 // strata
@@ -69,13 +70,42 @@ void checkFrameDimensions(const ifx_Cube_C_t* frame, const ifx_Mimose_Frame_Conf
     }
 }
 
-using MemoryRegion = std::pair<const uint16_t*, const uint16_t*>;
-using MemoryRegions = std::vector<MemoryRegion>;
+// the I and Q values are 12 bit, normalized to [0, 1]
+constexpr ifx_Float_t IQ_SCALE = 1.0f / 0xFFF;
 
-inline float toFloat(uint16_t fvalue)
+/* Convert the interleaved I/Q values of one pulse into the row pulseIdx of the frame.
+ * The values may be split in two parts which are stored one after the other. */
+void decodePulse(ifx_Cube_C_t* frame, uint32_t pulseIdx,
+                 const uint16_t* part0, uint32_t size0,
+                 const uint16_t* part1, uint32_t size1)
 {
-    auto value = (fvalue & 0x0FFF);
-    return (1.0f * value) / 0xFFF;
+    if ((IFX_CUBE_STRIDE(frame, 2) == 1) && !IFX_MDA_IS_SPLIT(frame))
+    {
+        const auto* kernels = ifx_kernels_get();
+        auto* row = reinterpret_cast<ifx_Float_t*>(&IFX_CUBE_AT(frame, 0, pulseIdx, 0));
+        kernels->mask12_r(part0, row, size0, IQ_SCALE, 0);
+        kernels->mask12_r(part1, row + size0, size1, IQ_SCALE, 0);
+    }
+    else if (IFX_MDA_IS_SPLIT(frame))
+    {
+        // the I values go to the real parts, the Q values to the imaginary parts
+        for (uint32_t i = 0; i < size0 + size1; ++i)
+        {
+            const uint16_t value = (i < size0) ? part0[i] : part1[i - size0];
+            auto& element = (i % 2 == 0) ? IFX_MDA_REAL_AT(frame, 0, pulseIdx, i / 2)
+                                          : IFX_MDA_IMAG_AT(frame, 0, pulseIdx, i / 2);
+            element = static_cast<ifx_Float_t>(value & 0x0FFF) * IQ_SCALE;
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < size0 + size1; ++i)
+        {
+            const uint16_t value = (i < size0) ? part0[i] : part1[i - size0];
+            auto* element = reinterpret_cast<ifx_Float_t*>(&IFX_CUBE_AT(frame, 0, pulseIdx, i / 2));
+            element[i % 2] = static_cast<ifx_Float_t>(value & 0x0FFF) * IQ_SCALE;
+        }
+    }
 }
 
 union PackedAFC
@@ -147,33 +177,6 @@ void fillMetaData(ifx_Mimose_Metadata_t* metadata,
     }
 }
 
-enum RawDataSubType
-{
-    FirstHalf,
-    SecondHalf
-};
-
-void fillBuffer(std::vector<uint16_t>& toFill, const uint16_t* rawData, const size_t numSamples, const size_t numPulses, RawDataSubType rawDataSubType)
-{
-    const auto* begin = rawData;
-    const auto* end = begin;
-
-    for (size_t i = 0; i < numPulses; ++i)
-    {
-
-        begin = end;
-        end += numSamples;
-
-        // the destination buffer offset is the offset at which position the half pulse need to be stored
-        size_t destBuffOffset = (rawDataSubType == RawDataSubType::FirstHalf) ? 0 : numSamples;
-        destBuffOffset += (i * (numSamples * 2));
-
-        auto* dest = (toFill.data() + destBuffOffset);
-
-        std::copy(begin, end, dest);
-    }
-}
-
 // Constants
 constexpr uint16_t IQ_SAMPLE_SIZE = 2;  // 2 x uint16_t
 constexpr uint16_t DEFAULT_QUEUE_SIZE = 10000;
@@ -215,7 +218,8 @@ DeviceMimose::DeviceMimose(std::unique_ptr<BoardInstance>&& board) :
     m_currentAfc(0),
     m_switchingConf(false),
     m_samplingMode(SamplingMode::FramePausedSampling),
-    m_equidistantSamplingTraits {}
+    m_equidistantSamplingTraits {},
+    m_frameLayout {}
 {
     if (!m_board)
     {
@@ -386,6 +390,7 @@ void DeviceMimose::setConfig(const ifx_Mimose_Config_t* config)
     {
         m_frameBufferSize = getFrameBufferSize(m_frameSpecificReadoutConfiguration);
     }
+    setupFrameLayout(numActivePulses);
 
     // setup trigger configuration
     //
@@ -461,11 +466,6 @@ void DeviceMimose::startAcquisition()
     // reset the stored afc
     m_currentAfc = 0;
 
-    if (m_samplingMode == SamplingMode::EquidistantSampling)
-    {
-        const auto rawDataBufferSize = (m_frameBufferSize / IQ_SAMPLE_SIZE);
-        m_equidistantSamplingTraits.m_rawDataBuffer.resize(rawDataBufferSize);  // frame buffer size is expressed in bytes while the raw buffer in uint16's
-    }
     m_acquisitionStarted = true;
 }
 
@@ -479,6 +479,7 @@ void DeviceMimose::stopAcquisition()
     stopSequencer();
     stopDataStreaming();
     m_regConfig->flushEnqRegisters();
+    m_equidistantSamplingTraits.m_firstHalfFrame.reset();
 
     m_acquisitionStarted = false;
 }
@@ -909,184 +910,146 @@ uint32_t DeviceMimose::getFrameBufferSize(const ReadoutDataConfiguration& readou
     return (bufferSize * sizeof(uint16_t));
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
-void DeviceMimose::readRawFrame(ifx_Cube_C_t* frame, ifx_Mimose_Metadata_t* metadata, uint16_t timeoutMillis)
+void DeviceMimose::setupFrameLayout(uint16_t numActivePulses)
 {
-    IFrame* deviceFrame = m_board->getFrame(timeoutMillis);
+    // the raw data is followed by the frame counter, VCO, AOC and AGC readouts (see setConfig)
+    const auto& readouts = m_frameSpecificReadoutConfiguration;
+    const auto equidistantSampling = (m_samplingMode == SamplingMode::EquidistantSampling);
+
+    const uint32_t pulseSize = (m_numSamplesForNextPulseInMem * IQ_SAMPLE_SIZE);
+    m_frameLayout.pulseSize = equidistantSampling ? (pulseSize / 2) : pulseSize;
+
+    uint32_t offset = (m_frameLayout.pulseSize * numActivePulses) + readouts[1].count;
+    m_frameLayout.vcoOffset = offset;
+    offset += readouts[2].count;
+    m_frameLayout.aocOffset = offset;
+    offset += readouts[3].count;
+    m_frameLayout.agcOffset = offset;
+    offset += readouts[4].count;
+    m_frameLayout.size = offset;
+
+    const auto frameSize = equidistantSampling ? m_equidistantSamplingTraits.m_frameBufferSecondHalfSize : m_frameBufferSize;
+    if ((m_frameLayout.size * sizeof(uint16_t)) != frameSize)
+    {
+        throw rdk::exception::internal();
+    }
+}
+
+FrameWrapper<> DeviceMimose::getFrame(uint16_t timeoutMillis)
+{
+    FrameWrapper<> deviceFrame(m_board->getFrame(timeoutMillis));
     if (!deviceFrame)
     {
         throw rdk::exception::timeout();
     }
 
-    const auto statusCode = deviceFrame->getStatusCode();
-    if (statusCode != 0)
+    switch (deviceFrame->getStatusCode())
     {
-        deviceFrame->release();
-        switch (statusCode)
-        {
-            case DataError_FramePoolDepleted:
-                throw rdk::exception::insufficient_memory_allocated();
-                break;
-            case DataError_FrameDropped:
-                throw rdk::exception::communication_error();
-                break;
-            case DataError_LowLevelError:
-                throw rdk::exception::frame_acquisition_failed();
-                break;
-            default:
-                throw rdk::exception::error();
-                break;
-        }
+        case 0:
+            break;
+        case DataError_FramePoolDepleted:
+            throw rdk::exception::insufficient_memory_allocated();
+        case DataError_FrameDropped:
+            throw rdk::exception::communication_error();
+        case DataError_LowLevelError:
+            throw rdk::exception::frame_acquisition_failed();
+        default:
+            throw rdk::exception::error();
     }
 
-    const auto equidistantSampling = (m_samplingMode == SamplingMode::EquidistantSampling);
     const auto frameChannel = deviceFrame->getVirtualChannel();
+    uint32_t expectedFrameSize;
+    if (m_samplingMode == SamplingMode::EquidistantSampling)
     {
-        uint32_t expectedFrameSize;
-        if (equidistantSampling)
+        if (frameChannel == m_dataIndex)
         {
-            if (frameChannel == m_dataIndex)
-            {
-                expectedFrameSize = m_equidistantSamplingTraits.m_frameBufferFirstHalfSize;
-            }
-            else if (frameChannel == m_dataIndex2)
-            {
-                expectedFrameSize = m_equidistantSamplingTraits.m_frameBufferSecondHalfSize;
-            }
-            else
-            {
-                expectedFrameSize = m_statusBufferSize;
-            }
+            expectedFrameSize = m_equidistantSamplingTraits.m_frameBufferFirstHalfSize;
         }
-        else
+        else if (frameChannel == m_dataIndex2)
         {
-            expectedFrameSize = (frameChannel == m_dataIndex) ? m_frameBufferSize : m_statusBufferSize;
+            expectedFrameSize = m_equidistantSamplingTraits.m_frameBufferSecondHalfSize;
         }
-        if (deviceFrame->getDataSize() != expectedFrameSize)
+        else
         {
-            deviceFrame->release();
-            throw rdk::exception::frame_size_not_supported();
+            expectedFrameSize = m_statusBufferSize;
         }
     }
+    else
+    {
+        expectedFrameSize = (frameChannel == m_dataIndex) ? m_frameBufferSize : m_statusBufferSize;
+    }
+    if (deviceFrame->getDataSize() != expectedFrameSize)
+    {
+        throw rdk::exception::frame_size_not_supported();
+    }
 
+    return deviceFrame;
+}
+
+void DeviceMimose::readRawFrame(ifx_Cube_C_t* frame, ifx_Mimose_Metadata_t* metadata, uint16_t timeoutMillis)
+{
     const uint16_t pulsesToRead = DeviceMimoseBase::getNumActivePulseConfigurations(
         m_config.frame_config[m_activeFrameIndex].selected_pulse_configs);
-    const auto* samples = reinterpret_cast<const uint16_t*>(deviceFrame->getData());
 
-    if (equidistantSampling)
+    // Frames of the status channel are skipped. In equidistant sampling mode the
+    // first halves of the pulses arrive in a frame of their own, which is kept
+    // until the frame with the second halves has arrived. Both are decoded in place.
+    const auto equidistantSampling = (m_samplingMode == SamplingMode::EquidistantSampling);
+    const auto dataChannel = equidistantSampling ? m_dataIndex2 : m_dataIndex;
+    auto& pendingFrame = m_equidistantSamplingTraits.m_firstHalfFrame;
+
+    auto deviceFrame = getFrame(timeoutMillis);
+    while (deviceFrame->getVirtualChannel() != dataChannel)
     {
-        if (frameChannel == m_dataIndex)
+        if (equidistantSampling && (deviceFrame->getVirtualChannel() == m_dataIndex))
         {
-            ::fillBuffer(m_equidistantSamplingTraits.m_rawDataBuffer, samples, m_numSamplesForNextPulseInMem, pulsesToRead, RawDataSubType::FirstHalf);
-            deviceFrame->release();
-            return readRawFrame(frame, metadata, timeoutMillis);
-        }
-        else if (frameChannel == m_dataIndex2)
-        {
-            ::fillBuffer(m_equidistantSamplingTraits.m_rawDataBuffer, samples, m_numSamplesForNextPulseInMem, pulsesToRead, RawDataSubType::SecondHalf);
-
-            const auto rem = (deviceFrame->getDataSize() / sizeof(uint16_t)) - (static_cast<size_t>(m_numSamplesForNextPulseInMem) * pulsesToRead);
-            if (rem > 0)
-            {
-                const auto fromOffset = (m_numSamplesForNextPulseInMem * pulsesToRead);
-                const auto toOffset = (fromOffset + rem);
-                std::copy((samples + fromOffset), (samples + toOffset), (m_equidistantSamplingTraits.m_rawDataBuffer.data() + (static_cast<size_t>(m_numSamplesForNextPulseInMem) * pulsesToRead * IQ_SAMPLE_SIZE)));
-            }
+            pendingFrame = std::move(deviceFrame);
         }
+        deviceFrame = getFrame(timeoutMillis);
     }
 
-    const auto totalSampleCount = (m_frameBufferSize / sizeof(uint16_t));
-
+    FrameWrapper<> firstHalfFrame;
     if (equidistantSampling)
     {
-        samples = m_equidistantSamplingTraits.m_rawDataBuffer.data();
-        if (totalSampleCount != m_equidistantSamplingTraits.m_rawDataBuffer.size())
+        if (!pendingFrame)
         {
-            deviceFrame->release();
-            throw rdk::exception::internal();
+            // the first halves got lost
+            throw rdk::exception::communication_error();
         }
+        firstHalfFrame = std::move(pendingFrame);
     }
 
-    const auto iqNumSamplesPerPulseMemSize = (m_numSamplesForNextPulseInMem * IQ_SAMPLE_SIZE);  // expressed in uint16_t's as pairs of IQ's (x2)
-
-    constexpr auto RAW_MEM_REGION_INDEX = 0;
-    // constexpr auto FRAME_COUNTER_REGION_INDEX = 1;
-    constexpr auto VCO_REGION_INDEX = 2;
-    constexpr auto AOC_REGION_INDEX = 3;
-    constexpr auto AGC_REGION_INDEX = 4;
-
-    // create MemoryRegions
-    MemoryRegions dataMemoryRegions;
-    try
-    {
-        dataMemoryRegions.reserve(m_frameSpecificReadoutConfiguration.size());
-
-        const uint16_t* memBegin = samples;
-        const uint16_t* memEnd = memBegin;
-
-        uint32_t mapped = 0;
-
-        for (const auto& readoutConf : m_frameSpecificReadoutConfiguration)
-        {
-            memEnd += readoutConf.count;
-            mapped += readoutConf.count;
-
-            if (totalSampleCount >= mapped)
-            {
-                dataMemoryRegions.emplace_back(std::make_pair(memBegin, memEnd));
-            }
-            else
-            {
-                deviceFrame->release();
-                throw rdk::exception::insufficient_memory_allocated();
-            }
-            memBegin = memEnd;
-        }
-    }
-    catch (const std::out_of_range&)
-    {
-        deviceFrame->release();
-        throw rdk::exception::internal();
-    }
+    const auto* samples = reinterpret_cast<const uint16_t*>(deviceFrame->getData());
 
     // determine the current AFC
     {
-        const auto& vcoMemory = dataMemoryRegions[VCO_REGION_INDEX];
+        const auto* vcoMemory = samples + m_frameLayout.vcoOffset;
 
-        const auto afcValue = vcoMemory.first[2];
-        const auto afcCounterLow = vcoMemory.first[3];
-        const auto afcCounterHigh = vcoMemory.first[4];
+        const auto afcValue = vcoMemory[2];
+        const auto afcCounterLow = vcoMemory[3];
+        const auto afcCounterHigh = vcoMemory[4];
 
         m_currentAfc = ::packAfc(afcValue, afcCounterLow, afcCounterHigh, true);
     }
 
-    const auto& aocMemory = dataMemoryRegions[AOC_REGION_INDEX];
-    const auto& agcMemory = dataMemoryRegions[AGC_REGION_INDEX];
-    ::fillMetaData(metadata, aocMemory.first, agcMemory.first, pulsesToRead);
+    ::fillMetaData(metadata, samples + m_frameLayout.aocOffset, samples + m_frameLayout.agcOffset, pulsesToRead);
 
-    const auto* pulseMemory = dataMemoryRegions[RAW_MEM_REGION_INDEX].first;
-
-    // perform n reads according to the number of expected pulses
-    for (uint16_t pulseIdx = 0; pulseIdx < pulsesToRead; ++pulseIdx)
+    const auto pulseSize = m_frameLayout.pulseSize;
+    if (firstHalfFrame)
     {
-        for (uint32_t i = 0; i < m_numSamplesReturned; ++i)
+        const auto* firstHalves = reinterpret_cast<const uint16_t*>(firstHalfFrame->getData());
+        for (uint16_t pulseIdx = 0; pulseIdx < pulsesToRead; ++pulseIdx)
         {
-
-            const auto ifiIdx = (i * 2);
-            // ifqIdx  = ifiIdx + 1
-
-            const ifx_Float_t I = ::toFloat(pulseMemory[ifiIdx]);
-            const ifx_Float_t Q = ::toFloat(pulseMemory[ifiIdx + 1]);
-
-            IFX_CUBE_AT(frame, 0, pulseIdx, i) = ifx_Complex_t {I, Q};
+            const auto offset = (pulseIdx * pulseSize);
+            ::decodePulse(frame, pulseIdx, firstHalves + offset, pulseSize, samples + offset, pulseSize);
         }
-        pulseMemory += iqNumSamplesPerPulseMemSize;
     }
-    deviceFrame->release();
-
-    if (pulseMemory != dataMemoryRegions[RAW_MEM_REGION_INDEX].second)
+    else
     {
-        throw rdk::exception::internal();
+        for (uint16_t pulseIdx = 0; pulseIdx < pulsesToRead; ++pulseIdx)
+        {
+            ::decodePulse(frame, pulseIdx, samples + (pulseIdx * pulseSize), pulseSize, nullptr, 0);
+        }
     }
 }
 
@@ -45,6 +45,7 @@
 // strata
 #include <components/interfaces/IRegisters.hpp>
 #include <platform/BoardInstance.hpp>
+#include <platform/frames/FrameWrapper.hpp>
 #include <universal/types/DataSettingsBgtRadar.h>
 
 #include <atomic>
@@ -62,7 +63,23 @@ struct EquidistantSamplingTraits
     uint16_t m_triggerCount;
     uint32_t m_frameBufferFirstHalfSize;
     uint32_t m_frameBufferSecondHalfSize;
-    std::vector<uint16_t> m_rawDataBuffer;
+    FrameWrapper<> m_firstHalfFrame;  // kept until the frame with the second halves has arrived
+};
+
+/*
+ * @brief Position of the readouts within a data frame, in uint16_t's.
+ *
+ * The layout is computed once per configuration. In equidistant sampling mode
+ * the raw data of each pulse is split in two halves which arrive in two frames,
+ * the other readouts follow the second halves.
+ */
+struct FrameLayout
+{
+    uint32_t pulseSize;  // raw data of a pulse within one frame
+    uint32_t vcoOffset;
+    uint32_t aocOffset;
+    uint32_t agcOffset;
+    uint32_t size;  // number of uint16_t's in the frame
 };
 
 
@@ -129,6 +146,7 @@ private:
 
     SamplingMode m_samplingMode;
     EquidistantSamplingTraits m_equidistantSamplingTraits;
+    FrameLayout m_frameLayout;
 
     ifx_Radar_Sensor_t getShieldType() const;
 
@@ -169,7 +187,9 @@ private:
     float calculateFrameReadoutTime();
     uint16_t calculateTriggerCount();
 
-    IFrame* getFrame(uint16_t timeoutMillis);
+    void setupFrameLayout(uint16_t numActivePulses);
+
+    FrameWrapper<> getFrame(uint16_t timeoutMillis);
     static uint32_t getFrameBufferSize(const ReadoutDataConfiguration& readoutConfiguration);
 
     void readRawFrame(ifx_Cube_C_t* frame, ifx_Mimose_Metadata_t* metadata, uint16_t timeoutMillis);
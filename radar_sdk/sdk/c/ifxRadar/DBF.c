@@ -38,6 +38,7 @@
 #include "ifxBase/Defines.h"
 #include "ifxBase/Error.h"
 #include "ifxBase/Matrix.h"
+#include "ifxBase/Mda.h"
 #include "ifxBase/Mem.h"
 #include "ifxBase/Vector.h"
 
@@ -62,6 +63,8 @@
 struct ifx_DBF_s
 {
     ifx_Matrix_C_t* weights; /**< Weights.*/
+    ifx_Cube_C_t* spectrum;  /**< Range Doppler spectrum reordered to (antenna, range, Doppler).*/
+    ifx_Cube_C_t* beams;     /**< Beam images in the order (beam, range, Doppler).*/
 };
 
 /*
@@ -79,6 +82,11 @@ struct ifx_DBF_s
 static void init_weights(ifx_DBF_t* handle,
                          const ifx_DBF_Config_t* config);
 
+static bool ensure_cube(ifx_Cube_C_t** cube,
+                        uint32_t rows,
+                        uint32_t cols,
+                        uint32_t slices);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
@@ -121,6 +129,21 @@ static void init_weights(ifx_DBF_t* handle,
     }
 }
 
+//----------------------------------------------------------------------------
+
+static bool ensure_cube(ifx_Cube_C_t** cube,
+                        uint32_t rows,
+                        uint32_t cols,
+                        uint32_t slices)
+{
+    if (*cube && IFX_CUBE_ROWS(*cube) == rows && IFX_CUBE_COLS(*cube) == cols && IFX_CUBE_SLICES(*cube) == slices)
+        return true;
+
+    ifx_cube_destroy_c(*cube);
+    *cube = ifx_cube_create_c(rows, cols, slices);
+    return *cube != NULL;
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -131,7 +154,7 @@ ifx_DBF_t* ifx_dbf_create(const ifx_DBF_Config_t* config)
 {
     IFX_ERR_BRN_NULL(config);
 
-    ifx_DBF_t* h = ifx_mem_alloc(sizeof(struct ifx_DBF_s));
+    ifx_DBF_t* h = ifx_mem_calloc(1, sizeof(struct ifx_DBF_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
     h->weights = ifx_mat_create_c(config->num_antennas, config->num_beams);
@@ -149,7 +172,7 @@ void ifx_dbf_run_c(ifx_DBF_t* handle,
                    ifx_Cube_C_t* rng_dopp_image_beam)
 {
     IFX_ERR_BRK_NULL(handle);
-    IFX_CUBE_BRK_VALID(rng_dopp_spectrum);
+    IFX_CUBE_BRK_VALID_ANY_LAYOUT(rng_dopp_spectrum);
     IFX_ERR_BRK_NULL(rng_dopp_image_beam);
 
     IFX_ERR_BRK_ARGUMENT(IFX_CUBE_ROWS(rng_dopp_spectrum) != IFX_CUBE_ROWS(rng_dopp_image_beam));
@@ -162,6 +185,51 @@ void ifx_dbf_run_c(ifx_DBF_t* handle,
     int num_antennas = IFX_MAT_ROWS(handle->weights);
     int num_beams = IFX_MAT_COLS(handle->weights);
 
+    if (!IFX_MDA_IS_SPLIT(rng_dopp_spectrum) || !IFX_MDA_IS_SPLIT(rng_dopp_image_beam))
+    {
+        // The slices of a cube are strided in memory, which prevents the use
+        // of the vector kernels. The spectrum is therefore reordered to
+        // (antenna, range, Doppler), where the matrix of each antenna is
+        // contiguous, and the beams are computed in the same order before
+        // being written to the output by a tiled transpose.
+        // The intermediate cubes are interleaved, so mixed layouts of input
+        // and output are converted by these two copies.
+        const uint32_t rows = IFX_CUBE_ROWS(rng_dopp_spectrum);
+        const uint32_t cols = IFX_CUBE_COLS(rng_dopp_spectrum);
+
+        IFX_ERR_BRK_MEMALLOC(ensure_cube(&handle->spectrum, IFX_CUBE_SLICES(rng_dopp_spectrum), rows, cols));
+        IFX_ERR_BRK_MEMALLOC(ensure_cube(&handle->beams, num_beams, rows, cols));
+
+        ifx_Cube_C_t view;
+        IFX_MDA_PERMUTE_C(&view, rng_dopp_spectrum, 2, 0, 1);
+        const ifx_Cube_C_t* spectrum = handle->spectrum;
+        if (IFX_MDA_IS_SPLIT(rng_dopp_spectrum))
+            ifx_mda_copy_c(&view, handle->spectrum);
+        else
+            spectrum = ifx_mda_materialize_c(&view, handle->spectrum);
+        IFX_ERR_BRK_NULL(spectrum);
+
+        for (int beam = 0; beam < num_beams; beam++)
+        {
+            IFX_MDA_VIEW_C(&rdi_beam_view, handle->beams, IFX_MDA_INDEX(beam), IFX_MDA_SLICE_FULL(), IFX_MDA_SLICE_FULL());
+
+            IFX_MDA_VIEW_C(&rd_spec_view, spectrum, IFX_MDA_INDEX(0), IFX_MDA_SLICE_FULL(), IFX_MDA_SLICE_FULL());
+
+            ifx_mat_scale_c(&rd_spec_view, IFX_MAT_AT(handle->weights, (size_t)num_antennas - 1, beam), &rdi_beam_view);
+
+            for (int ant = 1; ant < num_antennas; ant++)
+            {
+                IFX_MDA_VIEW_C(&rd_spec_view, spectrum, IFX_MDA_INDEX(ant), IFX_MDA_SLICE_FULL(), IFX_MDA_SLICE_FULL());
+
+                ifx_mat_mac_c(&rdi_beam_view, &rd_spec_view, IFX_MAT_AT(handle->weights, (size_t)ant - 1, beam), &rdi_beam_view);
+            }
+        }
+
+        IFX_MDA_PERMUTE_C(&view, handle->beams, 1, 2, 0);
+        ifx_mda_copy_c(&view, rng_dopp_image_beam);
+        return;
+    }
+
     for (int beam = 0; beam < num_beams; beam++)
     {
         ifx_cube_get_slice_c(rng_dopp_image_beam, beam, &rdi_beam_view);  // set view to the output
@@ -189,6 +257,8 @@ void ifx_dbf_destroy(ifx_DBF_t* handle)
     }
 
     ifx_mat_destroy_c(handle->weights);
+    ifx_cube_destroy_c(handle->spectrum);
+    ifx_cube_destroy_c(handle->beams);
     ifx_mem_free(handle);
 }
 
@@ -141,6 +141,10 @@ ifx_DBF_t* ifx_dbf_create(const ifx_DBF_Config_t* config);
  * @param [out]    rng_dopp_image_beam A complex Cube (3D) containing range Doppler image beams i.e.
  *                                     (Nsamples x NumChirps x NumberofBeams)
  *
+ * Both cubes may use the split complex layout (see \ref IFX_MDA_FLAG_SPLIT_COMPLEX).
+ * If only one of them is split, it is converted through an interleaved
+ * intermediate buffer.
+ *
  */
 IFX_DLL_PUBLIC
 void ifx_dbf_run_c(ifx_DBF_t* handle,
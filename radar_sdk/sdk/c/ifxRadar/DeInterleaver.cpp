@@ -61,11 +61,20 @@ static size_t get_samples_per_shape(const ifx_DeInterleaver_Frame_Definition_t::
 void DeInterleaver::set_frame_definition(const ifx_DeInterleaver_Frame_Definition_t& frame_definition)
 {
     m_frame_definition = frame_definition;
+    m_samples_per_frame = compute_samples_per_frame();
+    compile_plan();
+
     m_input.clear();
-    m_input.reserve(get_samples_per_frame() * 2);
+    m_input_offset = 0;
+    m_input.reserve(m_samples_per_frame * 2);
 }
 
 size_t DeInterleaver::get_samples_per_frame() const
+{
+    return m_samples_per_frame;
+}
+
+size_t DeInterleaver::compute_samples_per_frame() const
 {
     size_t shape_set_size = 0;
 
@@ -83,12 +92,23 @@ size_t DeInterleaver::get_samples_per_frame() const
 
 void DeInterleaver::add_input_data(const ifx_Float_t* first, const ifx_Float_t* last)
 {
+    // Drop the samples of frames that were already fetched. The remaining
+    // samples are only moved if they are fewer than the dropped ones, so every
+    // sample is moved at most once on average.
+    const size_t remaining = m_input.size() - m_input_offset;
+    if (m_input_offset >= remaining)
+    {
+        std::copy(m_input.begin() + m_input_offset, m_input.end(), m_input.begin());
+        m_input.resize(remaining);
+        m_input_offset = 0;
+    }
+
     m_input.insert(m_input.end(),
                    first,
                    last);
 }
 
-void DeInterleaver::direction_to_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out, bool downwards)
+void DeInterleaver::compile_direction(bool downwards)
 {
     struct
     {
@@ -136,6 +156,9 @@ void DeInterleaver::direction_to_antenna_set_shape_samples(std::vector<ifx_Float
                 if (i_ant >= antennas)
                     break;  // early escape if the antenna isn't active
 
+                if (chirp.samples_per_chirp == 0)
+                    continue;
+
                 for (size_t i_chirp = 0; i_chirp < shape.repeat; i_chirp++)
                 {
                     const size_t base =
@@ -144,42 +167,64 @@ void DeInterleaver::direction_to_antenna_set_shape_samples(std::vector<ifx_Float
                         + indexing[i_shape].shape_offset
                         + indexing[i_shape].size_chirp * i_chirp;
 
-                    for (size_t i_sample = 0; i_sample < chirp.samples_per_chirp; i_sample++)
+                    // extend the previous run if this chirp continues its pattern
+                    if (!m_plan.empty())
                     {
-                        *out++ = m_input[base + i_sample * antennas];
+                        auto& last = m_plan.back();
+                        if ((last.src_stride == antennas) && (last.src_offset + last.length * antennas == base))
+                        {
+                            last.length += chirp.samples_per_chirp;
+                            continue;
+                        }
                     }
+
+                    m_plan.push_back({base, antennas, chirp.samples_per_chirp});
                 }
             }
         }
     }
 }
 
-void DeInterleaver::to_direction_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out)
+void DeInterleaver::compile_plan()
 {
-    direction_to_antenna_set_shape_samples(out, false);
-    direction_to_antenna_set_shape_samples(out, true);
+    m_plan.clear();
+    compile_direction(false);
+    compile_direction(true);
 }
 
 bool DeInterleaver::is_frame_complete() const
 {
-    return m_input.size() >= get_samples_per_frame();
+    return m_input.size() - m_input_offset >= m_samples_per_frame;
 }
 
-std::vector<ifx_Float_t> DeInterleaver::get_deinterleaved_frame()
+void DeInterleaver::get_deinterleaved_frame(ifx_Float_t* output)
 {
     if (!is_frame_complete())
         throw rdk::exception::dimension_mismatch();
 
-    const auto samples_per_frame = get_samples_per_frame();
-
-    std::vector<ifx_Float_t> output;
-    output.resize(samples_per_frame);
-
-    auto it_out = output.begin();
-    to_direction_antenna_set_shape_samples(it_out);
+    const ifx_Float_t* input = m_input.data() + m_input_offset;
+    for (const auto& run : m_plan)
+    {
+        const ifx_Float_t* src = input + run.src_offset;
+        if (run.src_stride == 1)
+        {
+            std::memcpy(output, src, run.length * sizeof(ifx_Float_t));
+        }
+        else
+        {
+            for (size_t i = 0; i < run.length; i++)
+                output[i] = src[i * run.src_stride];
+        }
+        output += run.length;
+    }
 
-    m_input.erase(m_input.begin(), m_input.begin() + samples_per_frame);
+    m_input_offset += m_samples_per_frame;
+}
 
+std::vector<ifx_Float_t> DeInterleaver::get_deinterleaved_frame()
+{
+    std::vector<ifx_Float_t> output(m_samples_per_frame);
+    get_deinterleaved_frame(output.data());
     return output;
 }
 
@@ -263,9 +308,15 @@ void ifx_di_get_frame(ifx_DeInterleaver_t* handle, ifx_Float_t* data, size_t len
 {
     try
     {
+        if (length >= handle->get_samples_per_frame())
+        {
+            // deinterleave directly into the buffer of the caller
+            handle->get_deinterleaved_frame(data);
+            return;
+        }
+
         const auto frame = handle->get_deinterleaved_frame();
-        const auto sample_count = std::min(frame.size(), length);
-        std::copy(frame.begin(), frame.begin() + sample_count,
+        std::copy(frame.begin(), frame.begin() + length,
                   data);
     }
     catch (const rdk::exception::exception& e)
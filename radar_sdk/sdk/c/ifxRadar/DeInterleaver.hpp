@@ -48,8 +48,19 @@
 
 class DeInterleaver
 {
+    // strided gather of samples from the input buffer into consecutive output samples
+    struct GatherRun
+    {
+        size_t src_offset;
+        size_t src_stride;
+        size_t length;
+    };
+
     std::vector<ifx_Float_t> m_input;
+    size_t m_input_offset = 0;  // start of the oldest unprocessed frame in m_input
     ifx_DeInterleaver_Frame_Definition_t m_frame_definition {};
+    size_t m_samples_per_frame = 0;
+    std::vector<GatherRun> m_plan;
 
 public:
     void set_frame_definition(const ifx_DeInterleaver_Frame_Definition_t& frame_definition);
@@ -57,10 +68,12 @@ public:
     void add_input_data(const ifx_Float_t* first, const ifx_Float_t* last);
     bool is_frame_complete() const;
     std::vector<ifx_Float_t> get_deinterleaved_frame();
+    void get_deinterleaved_frame(ifx_Float_t* output);
 
 private:
-    void direction_to_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out, bool downwards);
-    void to_direction_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out);
+    size_t compute_samples_per_frame() const;
+    void compile_direction(bool downwards);
+    void compile_plan();
 };
 
 
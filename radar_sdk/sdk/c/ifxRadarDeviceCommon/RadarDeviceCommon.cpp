@@ -27,6 +27,7 @@
 ** ===========================================================================
 */
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <mutex>
@@ -64,6 +65,18 @@ constexpr bool use_uvc = false;
 constexpr bool use_wiggler = false;
 constexpr bool use_libusb = false;
 
+/* All connection types are enumerated concurrently. The results of enumerators
+ * which did not finish before the deadline are ignored (e.g. unanswered
+ * Ethernet discovery), they finish in the background.
+ */
+constexpr uint16_t enumeration_timeout_ms = 2000;
+
+/* Boards found by an enumeration are reused for this time, so that reopening
+ * a device does not need a new discovery. The connections of cached boards
+ * are closed, so other processes can open them in the meantime.
+ */
+constexpr uint16_t board_cache_lifetime_ms = 2000;
+
 /* board_manager may be used by multiple threads concurrently. Each access to
  * board_manager must be protected using the mutex mutex_board_manager. This
  * presents "weird" behavior like that some boards are not found if you
@@ -72,6 +85,32 @@ constexpr bool use_libusb = false;
 std::mutex mutex_board_manager;
 
 
+void setup_board_manager(BoardManager& board_manager)
+{
+    if (use_serial)
+    {
+        board_manager.useSerial();
+    }
+    if (use_ethernet)
+    {
+        board_manager.useUdp();
+    }
+    if (use_uvc)
+    {
+        board_manager.useUvc();
+    }
+    if (use_wiggler)
+    {
+        board_manager.useWiggler();
+    }
+    if (use_libusb)
+    {
+        board_manager.useLibusb();
+    }
+    board_manager.setEnumerationTimeout(enumeration_timeout_ms);
+    board_manager.setCacheLifetime(board_cache_lifetime_ms);
+}
+
 ifx_Radar_Sensor_t get_avian_type(std::unique_ptr<BoardInstance>& board, uint8_t id = 0)
 {
     auto* avian = board->getComponent<IRadarAvian>(id);
@@ -121,6 +160,30 @@ bool get_sensor_type_legacy(std::unique_ptr<BoardInstance>& board, ifx_Radar_Sen
     return false;
 }
 
+bool get_entry(BoardDescriptor& descriptor, ifx_Radar_Sensor_List_Entry_t& entry)
+{
+    try
+    {
+        std::unique_ptr<BoardInstance> board = descriptor.createBoardInstance();
+        if (!rdk::RadarDeviceCommon::get_sensor_type(board, entry.sensor_type))
+        {
+            // not a radar sensor that we support
+            return false;
+        }
+
+        entry.board_type = rdk::RadarDeviceCommon::get_boardtype_from_pid(board->getPid());
+
+        // read uuid
+        const auto uuid = board->getUuidString();
+        std::copy(uuid.begin(), uuid.end(), entry.uuid);
+        return true;
+    }
+    catch (const EException&)
+    {
+        return false;
+    }
+}
+
 std::vector<ifx_Radar_Sensor_List_Entry_t> get_list(BoardManager& board_manager, rdk::RadarDeviceCommon::SelectorFunction&& selector)
 {
     std::vector<ifx_Radar_Sensor_List_Entry_t> list;
@@ -128,29 +191,8 @@ std::vector<ifx_Radar_Sensor_List_Entry_t> get_list(BoardManager& board_manager,
     for (const auto& descriptor : board_manager.getEnumeratedList())
     {
         ifx_Radar_Sensor_List_Entry_t entry = {};
-
-        try
-        {
-            std::unique_ptr<BoardInstance> board = descriptor->createBoardInstance();
-            if (!get_sensor_type(board, entry.sensor_type))
-            {
-                // not a radar sensor that we support
-                continue;
-            }
-
-            entry.board_type = rdk::RadarDeviceCommon::get_boardtype_from_pid(board->getPid());
-
-            // read uuid
-            const auto uuid = board->getUuidString();
-            std::copy(uuid.begin(), uuid.end(), entry.uuid);
-
-            if (selector(entry))
-                list.push_back(entry);
-        }
-        catch (const EException&)
-        {
-            continue;
-        }
+        if (get_entry(*descriptor, entry) && selector(entry))
+            list.push_back(entry);
     }
 
     return list;
@@ -211,39 +253,20 @@ std::unique_ptr<BoardInstance> rdk::RadarDeviceCommon::open(SelectorFunction&& s
     std::unique_lock<std::mutex> lock(mutex_board_manager);
 
     BoardManager board_manager;
-    if (use_serial)
-    {
-        board_manager.useSerial();
-    }
-    if (use_ethernet)
-    {
-        board_manager.useUdp();
-    }
-    if (use_uvc)
-    {
-        board_manager.useUvc();
-    }
-    if (use_wiggler)
-    {
-        board_manager.useWiggler();
-    }
-    if (use_libusb)
-    {
-        board_manager.useLibusb();
-    }
-    board_manager.enumerate();
+    setup_board_manager(board_manager);
 
-    auto list = ::get_list(board_manager, std::forward<SelectorFunction>(selector));
-    if (list.empty())
+    // only accept supported boards matching the selector, so the enumeration stops at the first one
+    EnumerationSelectorHelper board_selector([&selector](BoardDescriptor* descriptor) {
+        ifx_Radar_Sensor_List_Entry_t entry = {};
+        return get_entry(*descriptor, entry) && selector(entry);
+    });
+    board_manager.setEnumerationSelector(&board_selector);
+    if (!board_manager.enumerate(1))
         return nullptr;
 
     try
     {
-        uint8_t uuid_array[16];
-        if (ifx_uuid_from_string(list[0].uuid, uuid_array))
-        {
-            return board_manager.createSpecificBoardInstance(uuid_array);
-        }
+        return board_manager.createBoardInstance(uint8_t(0));
     }
     catch (EException&)
     {
@@ -275,27 +298,21 @@ std::unique_ptr<BoardInstance> rdk::RadarDeviceCommon::open_by_uuid(const char u
     std::unique_lock<std::mutex> lock(mutex_board_manager);
 
     BoardManager board_manager;
-    if (use_serial)
-    {
-        board_manager.useSerial();
-    }
-    if (use_ethernet)
-    {
-        board_manager.useUdp();
-    }
-    if (use_uvc)
-    {
-        board_manager.useUvc();
-    }
-    if (use_wiggler)
-    {
-        board_manager.useWiggler();
-    }
-    if (use_libusb)
-    {
-        board_manager.useLibusb();
-    }
-    board_manager.enumerate();
+    setup_board_manager(board_manager);
+
+    EnumerationSelectorHelper board_selector([&uuid_array](BoardDescriptor* descriptor) {
+        try
+        {
+            const auto& board_uuid = descriptor->getUuid();
+            return std::equal(board_uuid.begin(), board_uuid.end(), uuid_array);
+        }
+        catch (const EException&)
+        {
+            return false;
+        }
+    });
+    board_manager.setEnumerationSelector(&board_selector);
+    board_manager.enumerate(1);
 
     try
     {
@@ -313,26 +330,7 @@ std::vector<ifx_Radar_Sensor_List_Entry_t> rdk::RadarDeviceCommon::get_list(Sele
     std::unique_lock<std::mutex> lock(mutex_board_manager);
 
     BoardManager board_manager;
-    if (use_serial)
-    {
-        board_manager.useSerial();
-    }
-    if (use_ethernet)
-    {
-        board_manager.useUdp();
-    }
-    if (use_uvc)
-    {
-        board_manager.useUvc();
-    }
-    if (use_wiggler)
-    {
-        board_manager.useWiggler();
-    }
-    if (use_libusb)
-    {
-        board_manager.useLibusb();
-    }
+    setup_board_manager(board_manager);
     board_manager.enumerate();
 
     return ::get_list(board_manager, std::forward<SelectorFunction>(selector));
@@ -53,7 +53,7 @@ def c_stride(shape: tuple):
     for k in reversed(range(dimensions)):
         stride[k] = offset
         offset *= shape[k]
-    return (c_uint32 * IFX_MDA_MAX_DIM)(*stride)
+    return (c_size_t * IFX_MDA_MAX_DIM)(*stride)
 
 
 def c_shape(shape: tuple):
@@ -89,7 +89,7 @@ class MdaReal(Structure):
     _fields_ = (('dimensions', c_uint32),
                 ('data', POINTER(c_float)),
                 ('shape', c_uint32 * IFX_MDA_MAX_DIM),
-                ('stride', c_uint32 * IFX_MDA_MAX_DIM),
+                ('stride', c_size_t * IFX_MDA_MAX_DIM),
                 ('flags', c_uint32),
                 )
 
@@ -116,6 +116,37 @@ class MdaReal(Structure):
         arr.np_arr = np_arr  # avoid that memory of np_arr is freed
         return arr
 
+    @classmethod
+    def view_of_numpy(cls, np_arr: np.ndarray):
+        """Create ifx_Mda_R_t object referencing the memory of np_arr
+
+        In contrast to from_numpy the data is never copied, everything the
+        SDK writes to the returned object ends up in np_arr. For this reason
+        np_arr must be a writeable float32 array. It may be a strided view
+        (e.g. one frame of a larger preallocated buffer) as long as all
+        strides are non-negative multiples of the element size.
+        """
+        shape = np_arr.shape
+        dimensions = len(shape)
+        if dimensions > IFX_MDA_MAX_DIM:
+            raise ValueError("too many dimensions")
+        if np_arr.dtype != np.float32:
+            raise ValueError("array must have dtype float32")
+        if not np_arr.flags.writeable:
+            raise ValueError("array must be writeable")
+
+        itemsize = np_arr.itemsize
+        if any(s < 0 or s % itemsize for s in np_arr.strides):
+            raise ValueError("array strides must be non-negative multiples of the element size")
+        stride = [s // itemsize for s in np_arr.strides] + [0] * (IFX_MDA_MAX_DIM - dimensions)
+
+        data = np_arr.ctypes.data_as(POINTER(c_float))
+
+        flags = 0
+        arr = MdaReal(dimensions, data, c_shape(shape), (c_size_t * IFX_MDA_MAX_DIM)(*stride), flags)
+        arr.np_arr = np_arr  # avoid that memory of np_arr is freed
+        return arr
+
     def to_numpy(self) -> np.ndarray:
         """Convert ifx_Mda_R_t type to a numpy array"""
         shape = truncate_list_at_zero(self.shape)
@@ -128,8 +159,9 @@ class MdaComplex(Structure):
     _fields_ = (('dimensions', c_uint32),
                 ('data', POINTER(Complex)),
                 ('shape', c_uint32 * IFX_MDA_MAX_DIM),
-                ('stride', c_uint32 * IFX_MDA_MAX_DIM),
+                ('stride', c_size_t * IFX_MDA_MAX_DIM),
                 ('flags', c_uint32),
+                ('imag_offset', c_ssize_t),
                 )
 
     @classmethod
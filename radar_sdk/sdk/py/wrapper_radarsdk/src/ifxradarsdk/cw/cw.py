@@ -74,6 +74,7 @@ class DeviceCw():
         declare_prototype(dll, "ifx_cw_measure_temperature", [c_void_p], c_float)
         declare_prototype(dll, "ifx_cw_measure_tx_power", [c_void_p, c_uint32], c_float)
         declare_prototype(dll, "ifx_cw_capture_frame", [c_void_p, POINTER(MdaReal)], POINTER(MdaReal))
+        declare_prototype(dll, "ifx_cw_capture_frames", [c_void_p, POINTER(MdaReal), c_uint32], POINTER(MdaReal))
         declare_prototype(dll, "ifx_cw_get_sensor_information", [c_void_p], POINTER(SensorInfo))
         declare_prototype(dll, "ifx_cw_get_firmware_information", [c_void_p], POINTER(FirmwareInfo))
 
@@ -250,6 +251,16 @@ class DeviceCw():
         ifx_mda_destroy_r(frame)
         return frame_numpy
 
+    def capture_frames(self, num_frames: int) -> np.ndarray:
+        """Captures num_frames consecutive frames in CW mode
+
+        The frames are captured back to back and returned as a 3D numpy array
+        with dimensions num_frames x num_antennas x num_samples."""
+        frames = self._cdll.ifx_cw_capture_frames(self.handle, None, num_frames)
+        frames_numpy = frames.contents.to_numpy()
+        ifx_mda_destroy_r(frames)
+        return frames_numpy.reshape(num_frames, -1, frames_numpy.shape[1])
+
     def __enter__(self):
         return self
 
@@ -33,6 +33,7 @@ import typing
 
 import numpy as np
 
+from ..common.base_types import MdaReal
 from ..common.cdll_helper import declare_prototype, load_library
 from ..common.common_types import (
     create_python_list_from_terminated_list,
@@ -43,12 +44,15 @@ from ..common.common_types import (
 )
 from ..common.sdk_base import move_ifx_list_to_python_list
 from .types import (
+    FmcwBufferPolicy,
     FmcwElementType,
     FmcwFrame,
     FmcwMetrics,
+    FmcwRawFrame,
     FmcwSequenceChirp,
     FmcwSequenceElement,
-    FmcwSimpleSequenceConfig
+    FmcwSimpleSequenceConfig,
+    FmcwStatistics
 )
 
 
@@ -87,6 +91,10 @@ class DeviceFmcw():
         declare_prototype(dll, "ifx_fmcw_get_next_frame_timeout", [c_void_p, POINTER(FmcwFrame), c_uint16], None)
         declare_prototype(dll, "ifx_fmcw_allocate_frame", [c_void_p], POINTER(FmcwFrame))
         declare_prototype(dll, "ifx_fmcw_destroy_frame", [POINTER(FmcwFrame)], None)
+        declare_prototype(dll, "ifx_fmcw_get_next_raw_frame", [c_void_p, POINTER(FmcwRawFrame)], None)
+        declare_prototype(dll, "ifx_fmcw_get_next_raw_frame_timeout", [c_void_p, POINTER(FmcwRawFrame), c_uint16], None)
+        declare_prototype(dll, "ifx_fmcw_allocate_raw_frame", [c_void_p], POINTER(FmcwRawFrame))
+        declare_prototype(dll, "ifx_fmcw_destroy_raw_frame", [POINTER(FmcwRawFrame)], None)
         declare_prototype(dll, "ifx_fmcw_get_element_duration", [c_void_p, POINTER(FmcwSequenceElement)], c_float)
         declare_prototype(dll, "ifx_fmcw_get_sequence_duration", [c_void_p, POINTER(FmcwSequenceElement)], c_float)
         declare_prototype(dll, "ifx_fmcw_get_minimum_chirp_repetition_time", [c_void_p, c_uint32, c_float], c_float)
@@ -95,6 +103,9 @@ class DeviceFmcw():
         declare_prototype(dll, "ifx_fmcw_get_simple_sequence_config", [POINTER(FmcwSequenceElement)], POINTER(FmcwSimpleSequenceConfig))
         declare_prototype(dll, "ifx_fmcw_create_sequence_element", [c_int], POINTER(FmcwSequenceElement))
         declare_prototype(dll, "ifx_fmcw_print_sequence", [POINTER(FmcwSequenceElement)], None)
+        declare_prototype(dll, "ifx_fmcw_get_statistics", [c_void_p, POINTER(FmcwStatistics)], None)
+        declare_prototype(dll, "ifx_fmcw_reset_statistics", [c_void_p], None)
+        declare_prototype(dll, "ifx_fmcw_set_buffer_policy", [c_void_p, c_int, c_float], None)
 
         return dll
 
@@ -221,6 +232,12 @@ class DeviceFmcw():
             dev = DeviceFmcw(sensor_type = RadarSensor.BGT60TR13C)
         """
 
+        # frame layout and C frame structure of the last get_next_frame call,
+        # they are reset whenever the acquisition sequence changes
+        self._frame_shapes = None
+        self._num_raw_samples = None
+        self._frame_view = None
+
         if handle:
             self.handle = handle  # instantiate DeviceFmcw from an existing handle (e.g. dummy)
         else:
@@ -287,11 +304,13 @@ class DeviceFmcw():
         filename_buffer = filename.encode("ascii")
         filename_buffer_p = c_char_p(filename_buffer)
         self._cdll.ifx_fmcw_load_register_file(self.handle, filename_buffer_p)
+        self._invalidate_frame_layout()
 
     def set_acquisition_sequence(self, first_element: FmcwSequenceElement) -> None:
         """This function tries to configure the radar device to generate the specified
          acquisition sequence"""
         self._cdll.ifx_fmcw_set_acquisition_sequence(self.handle, byref(first_element))
+        self._invalidate_frame_layout()
 
     def get_acquisition_sequence(self) -> FmcwSequenceElement:
         """This function returns the first element of the currently configured
@@ -350,7 +369,20 @@ class DeviceFmcw():
         """
         self._cdll.ifx_fmcw_stop_acquisition(self.handle)
 
-    def get_next_frame(self, timeout_ms: typing.Optional[int] = None) -> np.ndarray:
+    def allocate_frame(self) -> typing.List[np.ndarray]:
+        """Allocate a frame of time domain data for get_next_frame
+
+        Returns a list of float32 numpy arrays, one for each chirp of the
+        acquisition sequence, with the shapes of the cubes returned by
+        get_next_frame. The arrays can be passed as out parameter to
+        get_next_frame to receive frames without any memory allocation.
+        The frame has to be allocated again after the acquisition sequence
+        was changed.
+        """
+        return [np.empty(shape, dtype=np.float32) for shape in self._get_frame_shapes()]
+
+    def get_next_frame(self, timeout_ms: typing.Optional[int] = None,
+                       out: typing.Optional[typing.List[np.ndarray]] = None) -> typing.List[np.ndarray]:
         """Retrieve next frame of time domain data from device
 
         Retrieve the next complete frame of time domain data from the connected
@@ -367,23 +399,147 @@ class DeviceFmcw():
         Each cube has its data organized in the corresponding dimensions:
         num_virtual_rx_antennas x num_chirps_per_frame x num_samples_per_frame.
 
+        If out is given, the samples are written directly into these arrays
+        and out is returned. The list must contain a writeable float32 array
+        of the right shape for each cube, for instance as returned by
+        allocate_frame or views into a larger preallocated buffer. Reusing
+        the same arrays for every frame avoids all allocations and copies.
+        Otherwise new arrays are allocated and the SDK writes directly into
+        them.
+
+        The GIL is released while waiting for the frame, so other Python
+        threads keep running.
+
         If timeout_ms is given, the exception ErrorTimeout is raised if a
         complete frame is not available within timeout_ms milliseconds.
         """
-        frame = self._cdll.ifx_fmcw_allocate_frame(self.handle)
+        if out is None:
+            out = self.allocate_frame()
+
+        frame = self._get_frame_view(out)
         if timeout_ms:
-            self._cdll.ifx_fmcw_get_next_frame_timeout(self.handle, frame, timeout_ms)
+            self._cdll.ifx_fmcw_get_next_frame_timeout(self.handle, byref(frame), timeout_ms)
         else:
-            self._cdll.ifx_fmcw_get_next_frame(self.handle, frame)
+            self._cdll.ifx_fmcw_get_next_frame(self.handle, byref(frame))
+
+        return out
+
+    def allocate_raw_frame(self) -> np.ndarray:
+        """Allocate a raw frame for get_next_raw_frame
+
+        Returns a uint16 numpy array that can hold all samples of a frame.
+        The frame has to be allocated again after the acquisition sequence
+        was changed.
+        """
+        if self._num_raw_samples is None:
+            frame = self._cdll.ifx_fmcw_allocate_raw_frame(self.handle)
+            self._num_raw_samples = int(frame.contents.num_samples)
+            self._cdll.ifx_fmcw_destroy_raw_frame(frame)
+
+        return np.empty(self._num_raw_samples, dtype=np.uint16)
 
-        # convert each cube to a multi-dimensional np array
-        frame_contents = list()
-        for index in range(0, int(frame.contents.num_cubes)):
-            cube = frame.contents.cubes[index].contents.to_numpy()
-            frame_contents.append(cube)
+    def get_next_raw_frame(self, timeout_ms: typing.Optional[int] = None,
+                           out: typing.Optional[np.ndarray] = None) -> np.ndarray:
+        """Retrieve next frame of raw time domain data from device
 
-        self._cdll.ifx_fmcw_destroy_frame(frame)
-        return frame_contents
+        Retrieve the next complete frame of raw ADC samples from the connected
+        device as uint16 numpy array, without normalization. The samples of
+        all enabled RX antennas are interleaved, the layout is the same as
+        the one of ifx_Fmcw_Raw_Frame_t in the C API.
+
+        If out is given, the samples are written directly into this array
+        and out is returned. It must be a writeable, C contiguous uint16
+        array with the size of the frame, for instance as returned by
+        allocate_raw_frame. Otherwise a new array is allocated.
+
+        The GIL is released while waiting for the frame, so other Python
+        threads keep running.
+
+        If timeout_ms is given, the exception ErrorTimeout is raised if a
+        complete frame is not available within timeout_ms milliseconds.
+        """
+        if out is None:
+            out = self.allocate_raw_frame()
+        elif out.dtype != np.uint16 or not out.flags.c_contiguous or not out.flags.writeable:
+            raise ValueError("out must be a writeable, C contiguous uint16 array")
+
+        # the structure references the memory of out, the SDK fills it in place
+        frame = FmcwRawFrame(out.size, out.ctypes.data_as(POINTER(c_uint16)))
+        if timeout_ms:
+            self._cdll.ifx_fmcw_get_next_raw_frame_timeout(self.handle, byref(frame), timeout_ms)
+        else:
+            self._cdll.ifx_fmcw_get_next_raw_frame(self.handle, byref(frame))
+
+        return out
+
+    def _get_frame_shapes(self) -> typing.List[tuple]:
+        """Return the shapes of the cubes of a frame"""
+        if self._frame_shapes is None:
+            frame = self._cdll.ifx_fmcw_allocate_frame(self.handle)
+            cubes = frame.contents.cubes
+            self._frame_shapes = [tuple(cubes[index].contents.shape[:cubes[index].contents.dimensions])
+                                  for index in range(int(frame.contents.num_cubes))]
+            self._cdll.ifx_fmcw_destroy_frame(frame)
+
+        return self._frame_shapes
+
+    def _get_frame_view(self, arrays: typing.List[np.ndarray]) -> FmcwFrame:
+        """Return a frame structure whose cubes reference the memory of arrays"""
+        frame = self._frame_view
+        if frame is not None and len(frame.mdas) == len(arrays) \
+                and all(cube.np_arr is array for cube, array in zip(frame.mdas, arrays)):
+            return frame
+
+        # callers typically pass arrays of the same layout for every frame,
+        # in this case only the data pointers have to be updated
+        layout = [(array.dtype, array.shape, array.strides, array.flags.writeable) for array in arrays]
+        if frame is not None and frame.layout == layout:
+            for cube, array in zip(frame.mdas, arrays):
+                cube.data = array.ctypes.data_as(POINTER(c_float))
+                cube.np_arr = array  # avoid that memory of array is freed
+            return frame
+
+        mdas = [MdaReal.view_of_numpy(array) for array in arrays]
+        frame = FmcwFrame(len(mdas), (POINTER(MdaReal) * len(mdas))(*[pointer(cube) for cube in mdas]))
+        frame.mdas = mdas
+        frame.layout = layout
+        self._frame_view = frame
+        return frame
+
+    def _invalidate_frame_layout(self):
+        """Forget the frame layout after the acquisition sequence changed"""
+        self._frame_shapes = None
+        self._num_raw_samples = None
+        self._frame_view = None
+
+    def get_statistics(self) -> dict:
+        """Get the counters and latency histograms of the data acquisition
+
+        The dictionary contains the number of received and lost slices and
+        frames, the current and maximum fill level of the slice queue and
+        pool, and a latency histogram for each stage of the acquisition. Each
+        histogram is a dictionary with the keys count, sum_us, max_us and
+        buckets. Bucket 0 counts latencies below 1us, bucket i counts
+        latencies from 2^(i-1)us up to 2^i us.
+        """
+        statistics = FmcwStatistics()
+        self._cdll.ifx_fmcw_get_statistics(self.handle, byref(statistics))
+        return statistics.to_dict()
+
+    def reset_statistics(self) -> None:
+        """Reset all counters and latency histograms of the data acquisition"""
+        self._cdll.ifx_fmcw_reset_statistics(self.handle)
+
+    def set_buffer_policy(self, policy: FmcwBufferPolicy, max_seconds_to_buffer: float = 0) -> None:
+        """Set the buffering of data between device and application
+
+        By default data of 10 seconds is buffered and the oldest data is
+        discarded when the buffer is full. The policy defines the behaviour
+        of a full buffer, max_seconds_to_buffer the maximum buffered time
+        (0 for the default). The settings are applied when the acquisition
+        is started the next time.
+        """
+        self._cdll.ifx_fmcw_set_buffer_policy(self.handle, int(policy), max_seconds_to_buffer)
 
     def __enter__(self):
         return self
@@ -396,6 +552,7 @@ class DeviceFmcw():
         if hasattr(self, "handle") and self.handle:
             self._cdll.ifx_fmcw_destroy(self.handle)
             self.handle = None
+            self._invalidate_frame_layout()
 
     def __del__(self):
         try:
@@ -45,6 +45,13 @@ class FmcwFrame(ifxStructure):
                 )
 
 
+class FmcwRawFrame(ifxStructure):
+    """Wrapper for structure ifx_Fmcw_Raw_Frame_t"""
+    _fields_ = (("num_samples", c_uint32),
+                ("samples", POINTER(c_uint16)),
+                )
+
+
 class FmcwElementType(IntEnum):
     """Lists all building blocks a frame sequence can be built from"""
     IFX_SEQ_LOOP = 0
@@ -124,6 +131,62 @@ class FmcwMetrics(ifxStructure):
                 )
 
 
+class FmcwBufferPolicy(IntEnum):
+    """Wrapper for enum ifx_Fmcw_Buffer_Policy_t"""
+    IFX_FMCW_BUFFER_DROP_OLDEST = 0
+    IFX_FMCW_BUFFER_DROP_NEWEST = 1
+    IFX_FMCW_BUFFER_BLOCK_PRODUCER = 2
+    IFX_FMCW_BUFFER_GROW = 3
+
+
+IFX_FMCW_LATENCY_BUCKETS = 24
+
+
+class FmcwLatencyHistogram(ifxStructure):
+    """Wrapper for structure ifx_Fmcw_Latency_Histogram_t"""
+    _fields_ = (("count", c_uint64),
+                ("sum_us", c_uint64),
+                ("max_us", c_uint64),
+                ("buckets", c_uint64 * IFX_FMCW_LATENCY_BUCKETS),
+                )
+
+    def to_dict(self, decode_byte_str: bool = False) -> dict:
+        d = super().to_dict(decode_byte_str)
+        d["buckets"] = list(self.buckets)
+        return d
+
+
+class FmcwStatistics(ifxStructure):
+    """Wrapper for structure ifx_Fmcw_Statistics_t"""
+    _fields_ = (("slices_received", c_uint64),
+                ("slices_dropped", c_uint64),
+                ("slices_pool_depleted", c_uint64),
+                ("slices_size_exceeded", c_uint64),
+                ("slices_queue_trimmed", c_uint64),
+                ("slices_other_errors", c_uint64),
+                ("frames_received", c_uint64),
+                ("frames_timeout", c_uint64),
+                ("frames_fifo_overflow", c_uint64),
+                ("frames_failed", c_uint64),
+                ("queue_depth", c_uint32),
+                ("queue_high_water_mark", c_uint32),
+                ("pool_size", c_uint32),
+                ("pool_high_water_mark", c_uint32),
+                ("receive_latency", FmcwLatencyHistogram),
+                ("queue_latency", FmcwLatencyHistogram),
+                ("deinterleave_latency", FmcwLatencyHistogram),
+                ("delivery_latency", FmcwLatencyHistogram),
+                ("user_latency", FmcwLatencyHistogram),
+                )
+
+    def to_dict(self, decode_byte_str: bool = False) -> dict:
+        d = super().to_dict(decode_byte_str)
+        for field_name, field_type in self._fields_:
+            if field_type is FmcwLatencyHistogram:
+                d[field_name] = getattr(self, field_name).to_dict()
+        return d
+
+
 def create_dict_from_sequence_recursive(first_element: FmcwSequenceElement) -> dict:
     sequence = list()
     element = first_element
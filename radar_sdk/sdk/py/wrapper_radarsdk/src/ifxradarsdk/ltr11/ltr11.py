@@ -70,6 +70,8 @@ class DeviceLtr11():
         declare_prototype(dll, "ifx_ltr11_stop_acquisition", [c_void_p], None)
         declare_prototype(dll, "ifx_ltr11_get_next_frame", [c_void_p, POINTER(MdaComplex), POINTER(Ltr11Metadata)], POINTER(MdaComplex))
         declare_prototype(dll, "ifx_ltr11_get_next_frame_timeout", [c_void_p, POINTER(MdaComplex), POINTER(Ltr11Metadata), c_uint16], POINTER(MdaComplex))
+        declare_prototype(dll, "ifx_ltr11_get_next_frames", [c_void_p, POINTER(MdaComplex), POINTER(Ltr11Metadata), c_uint32, c_uint16], POINTER(MdaComplex))
+        declare_prototype(dll, "ifx_ltr11_get_next_frames_int16", [c_void_p, POINTER(c_int16), POINTER(Ltr11Metadata), c_uint32, c_uint16], None)
         declare_prototype(dll, "ifx_ltr11_get_sensor_information", [c_void_p], POINTER(SensorInfo))
         declare_prototype(dll, "ifx_ltr11_get_firmware_information", [c_void_p], POINTER(FirmwareInfo))
         declare_prototype(dll, "ifx_ltr11_get_active_mode_power", [c_void_p, POINTER(Ltr11Config)], c_float)
@@ -236,6 +238,40 @@ class DeviceLtr11():
 
         return frame_numpy, metadata
 
+    def get_next_frames(self, num_frames: int, timeout_ms: int = 1000, dtype=np.complex64) -> typing.Tuple[np.ndarray, typing.List[Ltr11Metadata]]:
+        """Retrieve the next num_frames frames of time domain data from LTR11 device.
+
+        This works like get_next_frame, but all frames are read within one
+        call into the SDK, which keeps up with short pulse repetition times
+        where calling get_next_frame for each frame is too slow.
+
+        With dtype=np.complex64 the frames are returned as numpy array with
+        dimensions num_frames x num_samples. With dtype=np.int16 the raw ADC
+        values (0..255) are returned with dimensions num_frames x num_samples x 2,
+        where the last dimension holds I and Q.
+        The list with the metadata of each frame is returned as well.
+
+        The exception ErrorTimeout is raised if any of the frames is not
+        available within timeout_ms milliseconds.
+        """
+        metadata = (Ltr11Metadata * num_frames)()
+        num_samples = self.get_config().num_of_samples
+
+        if np.dtype(dtype) == np.int16:
+            frames = np.empty((num_frames, num_samples, 2), dtype=np.int16)
+            self._cdll.ifx_ltr11_get_next_frames_int16(
+                self.handle, frames.ctypes.data_as(POINTER(c_int16)), metadata, num_frames, timeout_ms)
+        elif np.dtype(dtype) == np.complex64:
+            # the samples are written directly into the numpy array
+            frames_mda = MdaComplex.from_numpy(np.empty((num_frames, num_samples), dtype=np.complex64))
+            self._cdll.ifx_ltr11_get_next_frames(
+                self.handle, byref(frames_mda), metadata, num_frames, timeout_ms)
+            frames = frames_mda.np_arr
+        else:
+            raise ValueError("dtype must be np.complex64 or np.int16")
+
+        return frames, list(metadata)
+
     def get_active_mode_power(self, config: Ltr11Config) -> float:
         """ Return the power in active mode for a given configuration. 
             i.e when the APRT (Adaptive prt LTR11 feature) is disabled,
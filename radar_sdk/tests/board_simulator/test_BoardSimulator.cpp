@@ -0,0 +1,196 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Runs the board simulator in the test process and opens it over Ethernet
+ * with DeviceFmcwAvian, once through UDP and once through TCP. The simulated
+ * device is fed with a known pattern, so the raw frames received by the host
+ * can be compared sample by sample. */
+
+#include <gtest/gtest.h>
+
+#include "AvianSimulator.hpp"
+#include "BridgeSimulator.hpp"
+#include "SampleSource.hpp"
+
+#include "ifxBase/Error.h"
+#include "ifxFmcw/DeviceFmcw.h"
+#include "ifxFmcw/avian/DeviceFmcwAvian.hpp"
+
+// strata
+#include <platform/BoardInstance.hpp>
+#include <platform/ethernet/BoardEthernetTcp.hpp>
+#include <platform/ethernet/BoardEthernetUdp.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace {
+
+constexpr uint32_t num_chirps = 4;
+constexpr uint32_t num_samples = 32;
+constexpr uint32_t rx_mask = 0b101;
+constexpr uint32_t num_rx = 2;
+constexpr uint32_t num_frames = 10;
+constexpr uint16_t timeout_ms = 2000;
+
+// the value of the given word of a chirp, the frame can be told from the first word
+uint16_t pattern(uint32_t frame, uint32_t chirp, uint32_t word)
+{
+    return uint16_t((frame * 61 + chirp * 17 + word) % 4096);
+}
+
+class PatternSource : public SampleSource
+{
+public:
+    void generate_chirp(uint32_t frame, uint32_t chirp, uint32_t num_samples,
+                        uint32_t num_rx, uint16_t* samples) override
+    {
+        for (uint32_t i = 0; i < num_samples * num_rx; i++)
+            samples[i] = pattern(frame, chirp, i);
+    }
+};
+
+struct Connection
+{
+    const char* name;
+    uint8_t address[4];
+    bool tcp;
+};
+
+void PrintTo(const Connection& connection, std::ostream* os)
+{
+    *os << connection.name;
+}
+
+class BoardSimulator : public ::testing::TestWithParam<Connection>
+{
+protected:
+    void SetUp() override
+    {
+        const auto& connection = GetParam();
+        const std::string address = std::to_string(connection.address[0]) + "." + std::to_string(connection.address[1])
+                                    + "." + std::to_string(connection.address[2]) + "." + std::to_string(connection.address[3]);
+        m_simulator = std::make_unique<AvianSimulator>(std::make_unique<PatternSource>());
+        m_bridge = std::make_unique<BridgeSimulator>(*m_simulator, address);
+        m_bridge->start();
+
+        uint8_t ip[4] = {connection.address[0], connection.address[1], connection.address[2], connection.address[3]};
+        auto board = connection.tcp ? BoardEthernetTcp::createBoardInstance(ip)
+                                    : BoardEthernetUdp::createBoardInstance(ip);
+        ASSERT_NE(board, nullptr);
+        m_device = new DeviceFmcwAvian(std::move(board));
+    }
+
+    void TearDown() override
+    {
+        ifx_fmcw_destroy(m_device);
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        m_bridge->stop();
+    }
+
+    // a frame of num_chirps chirps with num_samples samples of the RX antennas in rx_mask
+    void set_sequence()
+    {
+        ifx_Fmcw_Sequence_Element_t* sequence = ifx_fmcw_get_acquisition_sequence(m_device);
+        ASSERT_EQ(sequence->type, IFX_SEQ_LOOP);
+        sequence->loop.repetition_time_s = 0.01f;
+        ifx_Fmcw_Sequence_Element_t* chirps = sequence->loop.sub_sequence;
+        ASSERT_EQ(chirps->type, IFX_SEQ_LOOP);
+        chirps->loop.num_repetitions = num_chirps;
+        ifx_Fmcw_Sequence_Element_t* chirp = chirps->loop.sub_sequence;
+        ASSERT_EQ(chirp->type, IFX_SEQ_CHIRP);
+        chirp->chirp.num_samples = num_samples;
+        chirp->chirp.rx_mask = rx_mask;
+
+        ifx_fmcw_set_acquisition_sequence(m_device, sequence);
+        ifx_fmcw_destroy_sequence(sequence);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    std::unique_ptr<AvianSimulator> m_simulator;
+    std::unique_ptr<BridgeSimulator> m_bridge;
+    ifx_Device_Fmcw_t* m_device = nullptr;
+};
+
+}  // namespace
+
+TEST_P(BoardSimulator, SensorInformation)
+{
+    const auto* info = ifx_fmcw_get_sensor_information(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(ifx_fmcw_get_sensor_type(m_device), IFX_AVIAN_BGT60TR13C);
+    EXPECT_EQ(info->num_rx_antennas, 3);
+
+    const float temperature = ifx_fmcw_get_temperature(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    EXPECT_GT(temperature, -40.f);
+    EXPECT_LT(temperature, 125.f);
+}
+
+TEST_P(BoardSimulator, RawFrames)
+{
+    set_sequence();
+    ifx_Fmcw_Raw_Frame_t* frame = ifx_fmcw_allocate_raw_frame(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ASSERT_EQ(frame->num_samples, num_chirps * num_samples * num_rx);
+
+    ifx_fmcw_start_acquisition(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    uint32_t first_frame = 0;
+    for (uint32_t i = 0; i < num_frames; i++)
+    {
+        ifx_fmcw_get_next_raw_frame_timeout(m_device, frame, timeout_ms);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK) << "frame " << i;
+
+        // the frames are consecutive, wherever the acquisition started
+        if (i == 0)
+            first_frame = frame->samples[0] / 61;
+        const uint32_t index = first_frame + i;
+        for (uint32_t chirp = 0; chirp < num_chirps; chirp++)
+        {
+            for (uint32_t word = 0; word < num_samples * num_rx; word++)
+            {
+                ASSERT_EQ(frame->samples[chirp * num_samples * num_rx + word], pattern(index, chirp, word))
+                    << "frame " << i << " chirp " << chirp << " word " << word;
+            }
+        }
+    }
+
+    ifx_fmcw_stop_acquisition(m_device);
+    ifx_fmcw_destroy_raw_frame(frame);
+}
+
+INSTANTIATE_TEST_SUITE_P(Ethernet, BoardSimulator,
+                         ::testing::Values(Connection {"Udp", {127, 0, 0, 11}, false},
+                                           Connection {"Tcp", {127, 0, 0, 12}, true}),
+                         [](const ::testing::TestParamInfo<Connection>& info) { return info.param.name; });
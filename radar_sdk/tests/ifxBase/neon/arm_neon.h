@@ -0,0 +1,378 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Portable C emulation of the ARMv8 Advanced SIMD intrinsics used by
+ * KernelsNeon.c, so the NEON kernels can be compiled and tested on hosts
+ * without NEON (see tests/ifxBase/CMakeLists.txt). Only the intrinsics the
+ * kernels need are provided. The semantics follow the ARM ACLE, including
+ * fused multiply-add and the pairwise order of the horizontal add, so the
+ * results are bit-identical to the hardware instructions.
+ *
+ * The vector types are distinct structs, so type errors in the kernels are
+ * caught like with the real header.
+ */
+
+#ifndef IFX_TESTS_ARM_NEON_EMULATION_H
+#define IFX_TESTS_ARM_NEON_EMULATION_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef float float32_t;
+
+typedef struct { float v[4]; } float32x4_t;
+typedef struct { double v[2]; } float64x2_t;
+typedef struct { uint8_t v[16]; } uint8x16_t;
+typedef struct { uint16_t v[4]; } uint16x4_t;
+typedef struct { uint16_t v[8]; } uint16x8_t;
+typedef struct { int16_t v[8]; } int16x8_t;
+typedef struct { uint32_t v[4]; } uint32x4_t;
+
+typedef struct { float32x4_t val[2]; } float32x4x2_t;
+typedef struct { uint16x8_t val[2]; } uint16x8x2_t;
+typedef struct { uint16x8_t val[4]; } uint16x8x4_t;
+typedef struct { int16x8_t val[2]; } int16x8x2_t;
+
+/* load, store, duplicate */
+
+static inline float32x4_t vld1q_f32(const float32_t* p)
+{
+    float32x4_t r;
+    memcpy(r.v, p, sizeof(r.v));
+    return r;
+}
+
+static inline void vst1q_f32(float32_t* p, float32x4_t a)
+{
+    memcpy(p, a.v, sizeof(a.v));
+}
+
+static inline uint8x16_t vld1q_u8(const uint8_t* p)
+{
+    uint8x16_t r;
+    memcpy(r.v, p, sizeof(r.v));
+    return r;
+}
+
+static inline uint16x8_t vld1q_u16(const uint16_t* p)
+{
+    uint16x8_t r;
+    memcpy(r.v, p, sizeof(r.v));
+    return r;
+}
+
+static inline void vst1q_u16(uint16_t* p, uint16x8_t a)
+{
+    memcpy(p, a.v, sizeof(a.v));
+}
+
+static inline void vst1q_s16(int16_t* p, int16x8_t a)
+{
+    memcpy(p, a.v, sizeof(a.v));
+}
+
+static inline float32x4x2_t vld2q_f32(const float32_t* p)
+{
+    float32x4x2_t r;
+    for (int i = 0; i < 4; i++)
+    {
+        r.val[0].v[i] = p[2 * i];
+        r.val[1].v[i] = p[2 * i + 1];
+    }
+    return r;
+}
+
+static inline void vst2q_f32(float32_t* p, float32x4x2_t a)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        p[2 * i] = a.val[0].v[i];
+        p[2 * i + 1] = a.val[1].v[i];
+    }
+}
+
+static inline uint16x8x2_t vld2q_u16(const uint16_t* p)
+{
+    uint16x8x2_t r;
+    for (int i = 0; i < 8; i++)
+        for (int k = 0; k < 2; k++)
+            r.val[k].v[i] = p[2 * i + k];
+    return r;
+}
+
+static inline uint16x8x4_t vld4q_u16(const uint16_t* p)
+{
+    uint16x8x4_t r;
+    for (int i = 0; i < 8; i++)
+        for (int k = 0; k < 4; k++)
+            r.val[k].v[i] = p[4 * i + k];
+    return r;
+}
+
+static inline void vst2q_s16(int16_t* p, int16x8x2_t a)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        p[2 * i] = a.val[0].v[i];
+        p[2 * i + 1] = a.val[1].v[i];
+    }
+}
+
+static inline float32x4_t vdupq_n_f32(float32_t s)
+{
+    float32x4_t r;
+    for (int i = 0; i < 4; i++)
+        r.v[i] = s;
+    return r;
+}
+
+static inline uint16x8_t vdupq_n_u16(uint16_t s)
+{
+    uint16x8_t r;
+    for (int i = 0; i < 8; i++)
+        r.v[i] = s;
+    return r;
+}
+
+static inline int16x8_t vdupq_n_s16(int16_t s)
+{
+    int16x8_t r;
+    for (int i = 0; i < 8; i++)
+        r.v[i] = s;
+    return r;
+}
+
+static inline uint32x4_t vdupq_n_u32(uint32_t s)
+{
+    uint32x4_t r;
+    for (int i = 0; i < 4; i++)
+        r.v[i] = s;
+    return r;
+}
+
+/* float arithmetic */
+
+static inline float32x4_t vaddq_f32(float32x4_t a, float32x4_t b)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] += b.v[i];
+    return a;
+}
+
+static inline float32x4_t vsubq_f32(float32x4_t a, float32x4_t b)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] -= b.v[i];
+    return a;
+}
+
+static inline float32x4_t vmulq_f32(float32x4_t a, float32x4_t b)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] *= b.v[i];
+    return a;
+}
+
+static inline float32x4_t vmulq_n_f32(float32x4_t a, float32_t s)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] *= s;
+    return a;
+}
+
+/* a + b * c, rounded once */
+static inline float32x4_t vfmaq_f32(float32x4_t a, float32x4_t b, float32x4_t c)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] = fmaf(b.v[i], c.v[i], a.v[i]);
+    return a;
+}
+
+static inline float32x4_t vfmaq_n_f32(float32x4_t a, float32x4_t b, float32_t s)
+{
+    return vfmaq_f32(a, b, vdupq_n_f32(s));
+}
+
+/* a - b * c, rounded once */
+static inline float32x4_t vfmsq_f32(float32x4_t a, float32x4_t b, float32x4_t c)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] = fmaf(-b.v[i], c.v[i], a.v[i]);
+    return a;
+}
+
+static inline float32x4_t vabsq_f32(float32x4_t a)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] = fabsf(a.v[i]);
+    return a;
+}
+
+static inline float32x4_t vsqrtq_f32(float32x4_t a)
+{
+    for (int i = 0; i < 4; i++)
+        a.v[i] = sqrtf(a.v[i]);
+    return a;
+}
+
+/* FADDP pairwise reduction */
+static inline float32_t vaddvq_f32(float32x4_t a)
+{
+    return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]);
+}
+
+/* permutations */
+
+static inline float32x4_t vrev64q_f32(float32x4_t a)
+{
+    const float32x4_t r = {{a.v[1], a.v[0], a.v[3], a.v[2]}};
+    return r;
+}
+
+static inline float32x4x2_t vtrnq_f32(float32x4_t a, float32x4_t b)
+{
+    const float32x4x2_t r = {{{{a.v[0], b.v[0], a.v[2], b.v[2]}}, {{a.v[1], b.v[1], a.v[3], b.v[3]}}}};
+    return r;
+}
+
+static inline float64x2_t vzip1q_f64(float64x2_t a, float64x2_t b)
+{
+    const float64x2_t r = {{a.v[0], b.v[0]}};
+    return r;
+}
+
+static inline float64x2_t vzip2q_f64(float64x2_t a, float64x2_t b)
+{
+    const float64x2_t r = {{a.v[1], b.v[1]}};
+    return r;
+}
+
+/* out of range indices give 0 */
+static inline uint8x16_t vqtbl1q_u8(uint8x16_t t, uint8x16_t idx)
+{
+    uint8x16_t r;
+    for (int i = 0; i < 16; i++)
+        r.v[i] = idx.v[i] < 16 ? t.v[idx.v[i]] : 0;
+    return r;
+}
+
+static inline uint16x4_t vget_low_u16(uint16x8_t a)
+{
+    uint16x4_t r;
+    memcpy(r.v, &a.v[0], sizeof(r.v));
+    return r;
+}
+
+static inline uint16x4_t vget_high_u16(uint16x8_t a)
+{
+    uint16x4_t r;
+    memcpy(r.v, &a.v[4], sizeof(r.v));
+    return r;
+}
+
+/* integer operations and conversions */
+
+static inline uint16x8_t vandq_u16(uint16x8_t a, uint16x8_t b)
+{
+    for (int i = 0; i < 8; i++)
+        a.v[i] &= b.v[i];
+    return a;
+}
+
+static inline uint16x8_t vorrq_u16(uint16x8_t a, uint16x8_t b)
+{
+    for (int i = 0; i < 8; i++)
+        a.v[i] |= b.v[i];
+    return a;
+}
+
+static inline uint16x8_t vsubq_u16(uint16x8_t a, uint16x8_t b)
+{
+    for (int i = 0; i < 8; i++)
+        a.v[i] = (uint16_t)(a.v[i] - b.v[i]);
+    return a;
+}
+
+static inline uint16x8_t vshrq_n_u16(uint16x8_t a, int n)
+{
+    for (int i = 0; i < 8; i++)
+        a.v[i] = (uint16_t)(a.v[i] >> n);
+    return a;
+}
+
+/* shift left by the signed lane of b, negative values shift right */
+static inline uint16x8_t vshlq_u16(uint16x8_t a, int16x8_t b)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        const int s = (int8_t)b.v[i];
+        if (s >= 16 || s <= -16)
+            a.v[i] = 0;
+        else
+            a.v[i] = (uint16_t)(s >= 0 ? a.v[i] << s : a.v[i] >> -s);
+    }
+    return a;
+}
+
+static inline uint32x4_t vmovl_u16(uint16x4_t a)
+{
+    uint32x4_t r;
+    for (int i = 0; i < 4; i++)
+        r.v[i] = a.v[i];
+    return r;
+}
+
+static inline float32x4_t vcvtq_f32_u32(uint32x4_t a)
+{
+    float32x4_t r;
+    for (int i = 0; i < 4; i++)
+        r.v[i] = (float)a.v[i];
+    return r;
+}
+
+/* reinterpretation, lanes in little endian order */
+
+#define IFX_NEON_REINTERPRET(to_t, from_t, name) \
+    static inline to_t name(from_t a)            \
+    {                                            \
+        to_t r;                                  \
+        memcpy(&r, &a, sizeof(r));               \
+        return r;                                \
+    }
+
+IFX_NEON_REINTERPRET(float64x2_t, float32x4_t, vreinterpretq_f64_f32)
+IFX_NEON_REINTERPRET(float32x4_t, float64x2_t, vreinterpretq_f32_f64)
+IFX_NEON_REINTERPRET(uint16x8_t, uint8x16_t, vreinterpretq_u16_u8)
+IFX_NEON_REINTERPRET(uint16x8_t, uint32x4_t, vreinterpretq_u16_u32)
+IFX_NEON_REINTERPRET(int16x8_t, uint16x8_t, vreinterpretq_s16_u16)
+
+#undef IFX_NEON_REINTERPRET
+
+#endif /* IFX_TESTS_ARM_NEON_EMULATION_H */
@@ -0,0 +1,528 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Compares the kernels of all instruction sets supported by the CPU against
+ * the scalar kernels, and the unpack kernels bit by bit against the
+ * element-wise code they replaced.
+ *
+ * Kernels documented to give bit-identical results (data movement and
+ * integer conversions) are compared bit by bit, the arithmetic kernels
+ * within a tolerance, since FMA and the summation order change the
+ * rounding. On hosts without NEON, the NEON kernels are compiled into this
+ * test with emulated intrinsics (see neon/arm_neon.h) and tested as well.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/internal/Kernels.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr ifx_Kernel_Isa_t all_isas[] = {IFX_KERNEL_ISA_SCALAR, IFX_KERNEL_ISA_SSE2, IFX_KERNEL_ISA_SSSE3, IFX_KERNEL_ISA_AVX2, IFX_KERNEL_ISA_AVX512, IFX_KERNEL_ISA_NEON};
+constexpr ifx_Kernel_Unpack12_t all_formats[] = {IFX_KERNEL_PACKED12, IFX_KERNEL_RAW12};
+
+// sample unpacking as done by DeviceFmcwBase::copy_slice_data (Packed12)
+// and by strata's unpackRaw12 (Raw12) before the kernels existed
+std::vector<uint16_t> reference_unpack(const std::vector<uint8_t>& in, ifx_Kernel_Unpack12_t format)
+{
+    std::vector<uint16_t> out(in.size() / 3 * 2);
+    for (size_t i = 0; i < in.size() / 3; i++)
+    {
+        const uint8_t b0 = in[3 * i + 0];
+        const uint8_t b1 = in[3 * i + 1];
+        const uint8_t b2 = in[3 * i + 2];
+        if (format == IFX_KERNEL_PACKED12)
+        {
+            out[2 * i + 0] = static_cast<uint16_t>((b0 << 4) | (b1 >> 4));
+            out[2 * i + 1] = static_cast<uint16_t>(((b1 & 0x0f) << 8) | b2);
+        }
+        else
+        {
+            out[2 * i + 0] = static_cast<uint16_t>((b0 << 4) | (b2 & 0x0f));
+            out[2 * i + 1] = static_cast<uint16_t>((b1 << 4) | (b2 >> 4));
+        }
+    }
+    return out;
+}
+
+std::vector<uint8_t> random_bytes(size_t count, std::mt19937& rng)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(count);
+    for (auto& b : bytes)
+        b = static_cast<uint8_t>(dist(rng));
+    return bytes;
+}
+
+std::vector<ifx_Float_t> random_floats(size_t count, std::mt19937& rng)
+{
+    std::uniform_real_distribution<ifx_Float_t> dist(-1, 1);
+    std::vector<ifx_Float_t> floats(count);
+    for (auto& f : floats)
+        f = dist(rng);
+    return floats;
+}
+
+// complex view of an array of 2*n floats
+ifx_Complex_t* as_complex(std::vector<ifx_Float_t>& v)
+{
+    return reinterpret_cast<ifx_Complex_t*>(v.data());
+}
+
+const ifx_Complex_t* as_complex(const std::vector<ifx_Float_t>& v)
+{
+    return reinterpret_cast<const ifx_Complex_t*>(v.data());
+}
+
+#ifdef IFX_KERNELS_EMULATE_NEON
+const ifx_Kernels_t* emulated_neon_kernels()
+{
+    static const ifx_Kernels_t kernels = [] {
+        ifx_Kernels_t k = *ifx_kernels_get_isa(IFX_KERNEL_ISA_SCALAR);
+        ifx_kernels_init_neon(&k);
+        return k;
+    }();
+    return &kernels;
+}
+#endif
+
+std::vector<const ifx_Kernels_t*> supported_kernels()
+{
+    std::vector<const ifx_Kernels_t*> tables;
+    for (auto isa : all_isas)
+    {
+        if (const auto* kernels = ifx_kernels_get_isa(isa))
+            tables.push_back(kernels);
+    }
+#ifdef IFX_KERNELS_EMULATE_NEON
+    if (!ifx_kernels_get_isa(IFX_KERNEL_ISA_NEON))
+        tables.push_back(emulated_neon_kernels());
+#endif
+    return tables;
+}
+
+const ifx_Kernels_t* scalar_kernels()
+{
+    return ifx_kernels_get_isa(IFX_KERNEL_ISA_SCALAR);
+}
+
+// compare including the guard element behind the n outputs
+template <typename T>
+void expect_bit_exact(const std::vector<T>& actual, const std::vector<T>& expected, const ifx_Kernels_t* kernels, size_t n)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(std::memcmp(actual.data(), expected.data(), actual.size() * sizeof(T)), 0)
+        << "isa = " << kernels->isa << ", n = " << n;
+}
+
+// compare including the guard element behind the n outputs
+void expect_close(const std::vector<ifx_Float_t>& actual, const std::vector<ifx_Float_t>& expected, double tolerance, const ifx_Kernels_t* kernels, size_t n)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        EXPECT_NEAR(actual[i], expected[i], tolerance) << "isa = " << kernels->isa << ", n = " << n << ", i = " << i;
+    }
+}
+
+void expect_close(ifx_Float_t actual, ifx_Float_t expected, double tolerance, const ifx_Kernels_t* kernels, size_t n)
+{
+    EXPECT_NEAR(actual, expected, tolerance) << "isa = " << kernels->isa << ", n = " << n;
+}
+
+// rounding differences of element-wise operations on values in [-1, 1]
+constexpr double elementwise_tolerance = 1e-5;
+
+// rounding differences of a sum of n products of values in [-1, 1]
+double sum_tolerance(size_t n)
+{
+    return 1e-6 * static_cast<double>(n + 1);
+}
+
+constexpr ifx_Float_t guard_float = -7.0f;
+
+}  // namespace
+
+TEST(Kernels, ScalarAlwaysSupported)
+{
+    ASSERT_NE(ifx_kernels_get_isa(IFX_KERNEL_ISA_SCALAR), nullptr);
+    ASSERT_NE(ifx_kernels_get(), nullptr);
+}
+
+TEST(Kernels, Unpack12)
+{
+    const ifx_Float_t scale = 2.0f / 4095;
+    const ifx_Float_t offset = -1.0f;
+    constexpr uint16_t guard = 0xdead;
+
+    std::mt19937 rng(32);
+    for (size_t n = 0; n <= 200; n += 2)
+    {
+        const auto packed = random_bytes(n / 2 * 3, rng);
+        for (auto format : all_formats)
+        {
+            auto samples = reference_unpack(packed, format);
+
+            std::vector<uint16_t> expected_u16(samples);
+            std::vector<int16_t> expected_s16(n);
+            std::vector<ifx_Float_t> expected_r(n);
+            for (size_t i = 0; i < n; i++)
+            {
+                expected_s16[i] = static_cast<int16_t>(samples[i] - 2048);
+                expected_r[i] = static_cast<ifx_Float_t>(samples[i]) * scale + offset;
+            }
+            expected_u16.push_back(guard);
+            expected_s16.push_back(guard);
+            expected_r.push_back(-2.0f);
+
+            for (const auto* kernels : supported_kernels())
+            {
+                std::vector<uint16_t> out_u16(n + 1, guard);
+                kernels->unpack12_u16(packed.data(), out_u16.data(), n, format);
+                expect_bit_exact(out_u16, expected_u16, kernels, n);
+
+                std::vector<int16_t> out_s16(n + 1, guard);
+                kernels->unpack12_s16(packed.data(), out_s16.data(), n, format);
+                expect_bit_exact(out_s16, expected_s16, kernels, n);
+
+                std::vector<ifx_Float_t> out_r(n + 1, -2.0f);
+                kernels->unpack12_r(packed.data(), out_r.data(), n, format, scale, offset);
+                expect_bit_exact(out_r, expected_r, kernels, n);
+            }
+        }
+    }
+}
+
+TEST(Kernels, Mask12)
+{
+    const ifx_Float_t scale = 2.0f / 4095;
+    const ifx_Float_t offset = -1.0f;
+
+    std::mt19937 rng(33);
+    std::uniform_int_distribution<int> dist(0, 0xffff);
+    for (size_t n = 0; n <= 200; n++)
+    {
+        std::vector<uint16_t> in(n);
+        std::vector<ifx_Float_t> expected(n + 1, -2.0f);
+        for (size_t i = 0; i < n; i++)
+        {
+            in[i] = static_cast<uint16_t>(dist(rng));
+            expected[i] = static_cast<ifx_Float_t>(in[i] & 0x0fff) * scale + offset;
+        }
+
+        for (const auto* kernels : supported_kernels())
+        {
+            std::vector<ifx_Float_t> out(n + 1, -2.0f);
+            kernels->mask12_r(in.data(), out.data(), n, scale, offset);
+            expect_bit_exact(out, expected, kernels, n);
+        }
+    }
+}
+
+// runs the scalar kernel into expected and the tested kernel into out and compares them
+#define COMPARE(call_expected, call_out)                                \
+    do                                                                  \
+    {                                                                   \
+        call_expected;                                                  \
+        call_out;                                                       \
+        expect_close(out, expected, elementwise_tolerance, kernels, n); \
+    } while (0)
+
+TEST(Kernels, RealElementwise)
+{
+    const ifx_Float_t s = 0.75f;
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(34);
+    for (size_t n = 0; n <= 67; n++)
+    {
+        const auto a = random_floats(n, rng);
+        const auto b = random_floats(n, rng);
+
+        for (const auto* kernels : supported_kernels())
+        {
+            std::vector<ifx_Float_t> expected(n + 1, guard_float);
+            std::vector<ifx_Float_t> out(n + 1, guard_float);
+
+            COMPARE(ref->add_r(a.data(), b.data(), expected.data(), n), kernels->add_r(a.data(), b.data(), out.data(), n));
+            COMPARE(ref->sub_r(a.data(), b.data(), expected.data(), n), kernels->sub_r(a.data(), b.data(), out.data(), n));
+            COMPARE(ref->mul_r(a.data(), b.data(), expected.data(), n), kernels->mul_r(a.data(), b.data(), out.data(), n));
+            COMPARE(ref->add_rs(a.data(), s, expected.data(), n), kernels->add_rs(a.data(), s, out.data(), n));
+            COMPARE(ref->scale_r(a.data(), s, expected.data(), n), kernels->scale_r(a.data(), s, out.data(), n));
+            COMPARE(ref->mac_r(a.data(), b.data(), s, expected.data(), n), kernels->mac_r(a.data(), b.data(), s, out.data(), n));
+            COMPARE(ref->abs_r(a.data(), expected.data(), n), kernels->abs_r(a.data(), out.data(), n));
+
+            // in-place operation
+            std::vector<ifx_Float_t> inplace(a);
+            inplace.push_back(guard_float);
+            ref->mac_r(a.data(), b.data(), s, expected.data(), n);
+            kernels->mac_r(inplace.data(), b.data(), s, inplace.data(), n);
+            expect_close(inplace, expected, elementwise_tolerance, kernels, n);
+        }
+    }
+}
+
+TEST(Kernels, RealReductions)
+{
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(35);
+    for (size_t n = 0; n <= 300; n += (n < 40) ? 1 : 37)
+    {
+        const auto a = random_floats(n, rng);
+        const auto b = random_floats(n, rng);
+
+        for (const auto* kernels : supported_kernels())
+        {
+            expect_close(kernels->sum_r(a.data(), n), ref->sum_r(a.data(), n), sum_tolerance(n), kernels, n);
+            expect_close(kernels->dot_r(a.data(), b.data(), n), ref->dot_r(a.data(), b.data(), n), sum_tolerance(n), kernels, n);
+
+            const auto sum = kernels->sum_c(as_complex(a), n / 2);
+            const auto expected_sum = ref->sum_c(as_complex(a), n / 2);
+            expect_close(sum.data[0], expected_sum.data[0], sum_tolerance(n), kernels, n);
+            expect_close(sum.data[1], expected_sum.data[1], sum_tolerance(n), kernels, n);
+        }
+    }
+}
+
+TEST(Kernels, ComplexElementwise)
+{
+    const ifx_Complex_t s = {{0.75f, -0.5f}};
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(36);
+    for (size_t n = 0; n <= 35; n++)
+    {
+        const auto a = random_floats(2 * n, rng);
+        const auto b = random_floats(2 * n, rng);
+        const auto* ca = as_complex(a);
+        const auto* cb = as_complex(b);
+
+        for (const auto* kernels : supported_kernels())
+        {
+            // complex outputs, the guard is the real part of element n
+            std::vector<ifx_Float_t> expected(2 * n + 2, guard_float);
+            std::vector<ifx_Float_t> out(2 * n + 2, guard_float);
+            auto* ce = as_complex(expected);
+            auto* co = as_complex(out);
+
+            COMPARE(ref->mul_c(ca, cb, ce, n), kernels->mul_c(ca, cb, co, n));
+            COMPARE(ref->mul_cr(ca, b.data(), ce, n), kernels->mul_cr(ca, b.data(), co, n));
+            COMPARE(ref->add_cs(ca, s, ce, n), kernels->add_cs(ca, s, co, n));
+            COMPARE(ref->scale_c(ca, s, ce, n), kernels->scale_c(ca, s, co, n));
+            COMPARE(ref->mac_c(ca, cb, s, ce, n), kernels->mac_c(ca, cb, s, co, n));
+
+            // real outputs
+            expected.assign(n + 1, guard_float);
+            out.assign(n + 1, guard_float);
+            COMPARE(ref->abs_c(ca, expected.data(), n), kernels->abs_c(ca, out.data(), n));
+            COMPARE(ref->sqnorm_c(ca, expected.data(), n), kernels->sqnorm_c(ca, out.data(), n));
+        }
+    }
+}
+
+TEST(Kernels, SplitComplex)
+{
+    const ifx_Complex_t s = {{-0.25f, 1.5f}};
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(37);
+    for (size_t n = 0; n <= 35; n++)
+    {
+        const auto a_re = random_floats(n, rng);
+        const auto a_im = random_floats(n, rng);
+        const auto b_re = random_floats(n, rng);
+        const auto b_im = random_floats(n, rng);
+
+        for (const auto* kernels : supported_kernels())
+        {
+            std::vector<ifx_Float_t> expected(n + 1, guard_float);
+            std::vector<ifx_Float_t> out(n + 1, guard_float);
+            COMPARE(ref->abs_s(a_re.data(), a_im.data(), expected.data(), n), kernels->abs_s(a_re.data(), a_im.data(), out.data(), n));
+            COMPARE(ref->sqnorm_s(a_re.data(), a_im.data(), expected.data(), n), kernels->sqnorm_s(a_re.data(), a_im.data(), out.data(), n));
+
+            std::vector<ifx_Float_t> expected_im(n + 1, guard_float);
+            std::vector<ifx_Float_t> out_im(n + 1, guard_float);
+            ref->scale_s(a_re.data(), a_im.data(), s, expected.data(), expected_im.data(), n);
+            kernels->scale_s(a_re.data(), a_im.data(), s, out.data(), out_im.data(), n);
+            expect_close(out, expected, elementwise_tolerance, kernels, n);
+            expect_close(out_im, expected_im, elementwise_tolerance, kernels, n);
+
+            ref->mac_s(a_re.data(), a_im.data(), b_re.data(), b_im.data(), s, expected.data(), expected_im.data(), n);
+            kernels->mac_s(a_re.data(), a_im.data(), b_re.data(), b_im.data(), s, out.data(), out_im.data(), n);
+            expect_close(out, expected, elementwise_tolerance, kernels, n);
+            expect_close(out_im, expected_im, elementwise_tolerance, kernels, n);
+        }
+    }
+}
+
+#undef COMPARE
+
+TEST(Kernels, Interleave)
+{
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(38);
+    for (size_t n = 0; n <= 35; n++)
+    {
+        const auto a = random_floats(2 * n, rng);
+        const auto re = random_floats(n, rng);
+        const auto im = random_floats(n, rng);
+
+        for (const auto* kernels : supported_kernels())
+        {
+            std::vector<ifx_Float_t> expected_re(n + 1, guard_float), expected_im(n + 1, guard_float);
+            std::vector<ifx_Float_t> out_re(n + 1, guard_float), out_im(n + 1, guard_float);
+            ref->deinterleave_c(as_complex(a), expected_re.data(), expected_im.data(), n);
+            kernels->deinterleave_c(as_complex(a), out_re.data(), out_im.data(), n);
+            expect_bit_exact(out_re, expected_re, kernels, n);
+            expect_bit_exact(out_im, expected_im, kernels, n);
+
+            std::vector<ifx_Float_t> expected(2 * n + 2, guard_float);
+            std::vector<ifx_Float_t> out(2 * n + 2, guard_float);
+            ref->interleave_c(re.data(), im.data(), as_complex(expected), n);
+            kernels->interleave_c(re.data(), im.data(), as_complex(out), n);
+            expect_bit_exact(out, expected, kernels, n);
+        }
+    }
+}
+
+TEST(Kernels, Gemm)
+{
+    constexpr size_t mr = IFX_KERNELS_GEMM_MR;
+    constexpr size_t nr = IFX_KERNELS_GEMM_NR;
+    constexpr size_t nr_c = IFX_KERNELS_GEMM_NR_C;
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(39);
+    for (size_t k = 0; k <= 40; k++)
+    {
+        const auto a = random_floats(k * mr, rng);
+        const auto b = random_floats(k * nr, rng);
+        const auto a_c = random_floats(k * 2 * mr, rng);
+        const auto b_c = random_floats(k * 2 * nr_c, rng);
+
+        for (const auto* kernels : supported_kernels())
+        {
+            // the tile is overwritten, so it starts with garbage
+            std::vector<ifx_Float_t> expected(mr * nr, guard_float);
+            std::vector<ifx_Float_t> out(mr * nr, guard_float);
+            ref->gemm_r(k, a.data(), b.data(), expected.data());
+            kernels->gemm_r(k, a.data(), b.data(), out.data());
+            expect_close(out, expected, sum_tolerance(k), kernels, k);
+
+            expected.assign(2 * mr * nr_c, guard_float);
+            out.assign(2 * mr * nr_c, guard_float);
+            ref->gemm_c(k, a_c.data(), b_c.data(), as_complex(expected));
+            kernels->gemm_c(k, a_c.data(), b_c.data(), as_complex(out));
+            expect_close(out, expected, 2 * sum_tolerance(k), kernels, k);
+        }
+    }
+}
+
+TEST(Kernels, Transpose)
+{
+    const auto* ref = scalar_kernels();
+
+    std::mt19937 rng(40);
+    for (size_t rows = 0; rows <= 19; rows++)
+    {
+        for (size_t cols = 0; cols <= 19; cols++)
+        {
+            // padded strides, the padding must not be written
+            const size_t in_stride = rows + 3;
+            const size_t out_stride = cols + 2;
+            const auto in = random_floats(2 * cols * in_stride, rng);
+
+            for (const auto* kernels : supported_kernels())
+            {
+                std::vector<ifx_Float_t> expected(rows * out_stride, guard_float);
+                std::vector<ifx_Float_t> out(rows * out_stride, guard_float);
+                ref->transpose_r(in.data(), in_stride, expected.data(), out_stride, rows, cols);
+                kernels->transpose_r(in.data(), in_stride, out.data(), out_stride, rows, cols);
+                expect_bit_exact(out, expected, kernels, rows * 100 + cols);
+
+                expected.assign(2 * rows * out_stride, guard_float);
+                out.assign(2 * rows * out_stride, guard_float);
+                ref->transpose_c(as_complex(in), in_stride, as_complex(expected), out_stride, rows, cols);
+                kernels->transpose_c(as_complex(in), in_stride, as_complex(out), out_stride, rows, cols);
+                expect_bit_exact(out, expected, kernels, rows * 100 + cols);
+            }
+        }
+    }
+}
+
+TEST(Kernels, GatherIq)
+{
+    const ifx_Float_t scale = 1.0f / 4096;
+    const auto* ref = scalar_kernels();
+
+    struct Format
+    {
+        uint16_t mask;
+        int shift;
+    };
+    const Format formats[] = {{0x0fff, 0}, {0x3ffc, 2}, {0x7fff, 0}};
+
+    std::mt19937 rng(41);
+    std::uniform_int_distribution<int> dist(0, 0xffff);
+    for (size_t stride : {2, 3, 4, 6})
+    {
+        for (size_t n = 0; n <= 40; n++)
+        {
+            std::vector<uint16_t> in(n * stride);
+            for (auto& v : in)
+                v = static_cast<uint16_t>(dist(rng));
+
+            for (const auto& format : formats)
+            {
+                for (const auto* kernels : supported_kernels())
+                {
+                    std::vector<ifx_Float_t> expected(2 * n + 2, guard_float);
+                    std::vector<ifx_Float_t> out(2 * n + 2, guard_float);
+                    ref->gather_iq_c(in.data(), stride, as_complex(expected), n, format.mask, scale);
+                    kernels->gather_iq_c(in.data(), stride, as_complex(out), n, format.mask, scale);
+                    expect_bit_exact(out, expected, kernels, n);
+
+                    std::vector<int16_t> expected_s16(2 * n + 1, 0x5a5a);
+                    std::vector<int16_t> out_s16(2 * n + 1, 0x5a5a);
+                    ref->gather_iq_s16(in.data(), stride, expected_s16.data(), n, format.mask, format.shift);
+                    kernels->gather_iq_s16(in.data(), stride, out_s16.data(), n, format.mask, format.shift);
+                    expect_bit_exact(out_s16, expected_s16, kernels, n);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,403 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Compares the batched Cholesky functions against ifx_la_cholesky_c and
+ * ifx_la_invert_c, which process one matrix at a time.
+ *
+ * The batches are not a multiple of the number of matrices the kernels
+ * process together, so the tail of the batch is covered as well.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Cube.h"
+#include "ifxBase/Complex.h"
+#include "ifxBase/Error.h"
+#include "ifxBase/LA.h"
+#include "ifxBase/Matrix.h"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t batch = 13;
+constexpr ifx_Float_t regularization = 0.5f;
+
+struct Element
+{
+    double real;
+    double imag;
+};
+
+Element get(const ifx_Cube_C_t* cube, uint32_t row, uint32_t col, uint32_t slice)
+{
+    if (IFX_MDA_IS_SPLIT(cube))
+        return {IFX_MDA_REAL_AT(cube, row, col, slice), IFX_MDA_IMAG_AT(cube, row, col, slice)};
+    const ifx_Complex_t value = IFX_CUBE_AT(cube, row, col, slice);
+    return {IFX_COMPLEX_REAL(value), IFX_COMPLEX_IMAG(value)};
+}
+
+void set(ifx_Cube_C_t* cube, uint32_t row, uint32_t col, uint32_t slice, Element value)
+{
+    if (IFX_MDA_IS_SPLIT(cube))
+    {
+        IFX_MDA_REAL_AT(cube, row, col, slice) = static_cast<ifx_Float_t>(value.real);
+        IFX_MDA_IMAG_AT(cube, row, col, slice) = static_cast<ifx_Float_t>(value.imag);
+    }
+    else
+    {
+        IFX_COMPLEX_SET(IFX_CUBE_AT(cube, row, col, slice), static_cast<ifx_Float_t>(value.real), static_cast<ifx_Float_t>(value.imag));
+    }
+}
+
+Element get(const ifx_Matrix_C_t* matrix, uint32_t row, uint32_t col)
+{
+    if (IFX_MDA_IS_SPLIT(matrix))
+        return {IFX_MDA_REAL_AT(matrix, row, col), IFX_MDA_IMAG_AT(matrix, row, col)};
+    const ifx_Complex_t value = IFX_MAT_AT(matrix, row, col);
+    return {IFX_COMPLEX_REAL(value), IFX_COMPLEX_IMAG(value)};
+}
+
+void set(ifx_Matrix_C_t* matrix, uint32_t row, uint32_t col, Element value)
+{
+    if (IFX_MDA_IS_SPLIT(matrix))
+    {
+        IFX_MDA_REAL_AT(matrix, row, col) = static_cast<ifx_Float_t>(value.real);
+        IFX_MDA_IMAG_AT(matrix, row, col) = static_cast<ifx_Float_t>(value.imag);
+    }
+    else
+    {
+        IFX_COMPLEX_SET(IFX_MAT_AT(matrix, row, col), static_cast<ifx_Float_t>(value.real), static_cast<ifx_Float_t>(value.imag));
+    }
+}
+
+// fills each slice with a random hermitian positive definite matrix M M^H + N I
+void fill_hermitian(ifx_Cube_C_t* cube, std::mt19937& rng)
+{
+    const uint32_t N = IFX_CUBE_ROWS(cube);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    for (uint32_t s = 0; s < IFX_CUBE_SLICES(cube); s++)
+    {
+        std::vector<Element> M(N * N);
+        for (auto& m : M)
+            m = {dist(rng), dist(rng)};
+
+        for (uint32_t r = 0; r < N; r++)
+        {
+            for (uint32_t c = 0; c < N; c++)
+            {
+                Element sum = {r == c ? double(N) : 0, 0};
+                for (uint32_t k = 0; k < N; k++)
+                {
+                    const Element a = M[r * N + k];
+                    const Element b = M[c * N + k];  // conjugated
+                    sum.real += a.real * b.real + a.imag * b.imag;
+                    sum.imag += a.imag * b.real - a.real * b.imag;
+                }
+                set(cube, r, c, s, sum);
+            }
+        }
+    }
+}
+
+void copy(const ifx_Cube_C_t* from, ifx_Cube_C_t* to)
+{
+    for (uint32_t s = 0; s < IFX_CUBE_SLICES(from); s++)
+        for (uint32_t r = 0; r < IFX_CUBE_ROWS(from); r++)
+            for (uint32_t c = 0; c < IFX_CUBE_COLS(from); c++)
+                set(to, r, c, s, get(from, r, c, s));
+}
+
+// slice s of A + lambda I as matrix, for the functions without regularization
+ifx_Matrix_C_t* regularized_slice(const ifx_Cube_C_t* A, uint32_t s, ifx_Float_t lambda)
+{
+    const uint32_t N = IFX_CUBE_ROWS(A);
+    ifx_Matrix_C_t* matrix = ifx_mat_create_c(N, N);
+    for (uint32_t r = 0; r < N; r++)
+    {
+        for (uint32_t c = 0; c < N; c++)
+        {
+            Element value = get(A, r, c, s);
+            if (r == c)
+                value.real += lambda;
+            set(matrix, r, c, value);
+        }
+    }
+    return matrix;
+}
+
+void expect_slice_near(const ifx_Cube_C_t* actual, uint32_t s, const ifx_Matrix_C_t* expected, double tolerance)
+{
+    const uint32_t N = IFX_CUBE_ROWS(actual);
+    for (uint32_t r = 0; r < N; r++)
+    {
+        for (uint32_t c = 0; c < N; c++)
+        {
+            const Element a = get(actual, r, c, s);
+            const Element e = get(expected, r, c);
+            EXPECT_NEAR(a.real, e.real, tolerance) << "N=" << N << " slice " << s << " (" << r << "," << c << ")";
+            EXPECT_NEAR(a.imag, e.imag, tolerance) << "N=" << N << " slice " << s << " (" << r << "," << c << ")";
+        }
+    }
+}
+
+ifx_Cube_C_t* create_cube(uint32_t N, uint32_t slices, bool split)
+{
+    return split ? ifx_cube_create_split_c(N, N, slices) : ifx_cube_create_c(N, N, slices);
+}
+
+class LABatch : public ::testing::TestWithParam<bool>
+{
+protected:
+    void SetUp() override
+    {
+        ifx_error_get_and_clear();
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    std::mt19937 m_rng {42};
+};
+
+}  // namespace
+
+TEST_P(LABatch, CholeskyMatchesSingleMatrix)
+{
+    for (uint32_t N = 1; N <= IFX_LA_BATCH_MAX_SIZE; N++)
+    {
+        ifx_Cube_C_t* A = create_cube(N, batch, GetParam());
+        ifx_Cube_C_t* L = create_cube(N, batch, GetParam());
+        fill_hermitian(A, m_rng);
+
+        ifx_la_cholesky_batch_c(A, regularization, L);
+        ASSERT_EQ(ifx_error_get(), IFX_OK);
+
+        ifx_Matrix_C_t* expected = ifx_mat_create_c(N, N);
+        for (uint32_t s = 0; s < batch; s++)
+        {
+            ifx_Matrix_C_t* slice = regularized_slice(A, s, regularization);
+            ifx_la_cholesky_c(slice, expected);
+            ifx_mat_destroy_c(slice);
+
+            // the upper triangle is part of the result and must be zero as well
+            expect_slice_near(L, s, expected, 1e-4 * N);
+        }
+
+        ifx_mat_destroy_c(expected);
+        ifx_cube_destroy_c(L);
+        ifx_cube_destroy_c(A);
+    }
+}
+
+TEST_P(LABatch, InverseMatchesSingleMatrix)
+{
+    for (uint32_t N = 1; N <= IFX_LA_BATCH_MAX_SIZE; N++)
+    {
+        ifx_Cube_C_t* A = create_cube(N, batch, GetParam());
+        ifx_Cube_C_t* Ainv = create_cube(N, batch, GetParam());
+        fill_hermitian(A, m_rng);
+
+        ifx_la_invert_batch_c(A, regularization, Ainv);
+        ASSERT_EQ(ifx_error_get(), IFX_OK);
+
+        ifx_Matrix_C_t* expected = ifx_mat_create_c(N, N);
+        for (uint32_t s = 0; s < batch; s++)
+        {
+            ifx_Matrix_C_t* slice = regularized_slice(A, s, regularization);
+            ifx_la_invert_c(slice, expected);
+            ifx_mat_destroy_c(slice);
+
+            expect_slice_near(Ainv, s, expected, 1e-5 * N);
+
+            // documented to be exactly hermitian
+            for (uint32_t r = 0; r < N; r++)
+            {
+                for (uint32_t c = 0; c < N; c++)
+                {
+                    EXPECT_EQ(get(Ainv, r, c, s).real, get(Ainv, c, r, s).real);
+                    EXPECT_EQ(get(Ainv, r, c, s).imag, -get(Ainv, c, r, s).imag);
+                }
+            }
+        }
+
+        ifx_mat_destroy_c(expected);
+        ifx_cube_destroy_c(Ainv);
+        ifx_cube_destroy_c(A);
+    }
+}
+
+TEST_P(LABatch, SolveLeavesSmallResiduals)
+{
+    std::uniform_real_distribution<double> dist(-1, 1);
+    for (uint32_t N = 1; N <= IFX_LA_BATCH_MAX_SIZE; N++)
+    {
+        ifx_Cube_C_t* A = create_cube(N, batch, GetParam());
+        ifx_Matrix_C_t* B = GetParam() ? ifx_mat_create_split_c(N, batch) : ifx_mat_create_c(N, batch);
+        ifx_Matrix_C_t* X = GetParam() ? ifx_mat_create_split_c(N, batch) : ifx_mat_create_c(N, batch);
+        fill_hermitian(A, m_rng);
+        for (uint32_t r = 0; r < N; r++)
+            for (uint32_t s = 0; s < batch; s++)
+                set(B, r, s, {dist(m_rng), dist(m_rng)});
+
+        ifx_la_cholesky_solve_batch_c(A, regularization, B, X);
+        ASSERT_EQ(ifx_error_get(), IFX_OK);
+
+        // (A_s + lambda I) x_s - b_s
+        for (uint32_t s = 0; s < batch; s++)
+        {
+            for (uint32_t r = 0; r < N; r++)
+            {
+                Element residual = get(B, r, s);
+                residual.real = -residual.real;
+                residual.imag = -residual.imag;
+                for (uint32_t k = 0; k < N; k++)
+                {
+                    Element a = get(A, r, k, s);
+                    if (r == k)
+                        a.real += regularization;
+                    const Element x = get(X, k, s);
+                    residual.real += a.real * x.real - a.imag * x.imag;
+                    residual.imag += a.real * x.imag + a.imag * x.real;
+                }
+                EXPECT_NEAR(residual.real, 0, 1e-5 * N) << "N=" << N << " slice " << s;
+                EXPECT_NEAR(residual.imag, 0, 1e-5 * N) << "N=" << N << " slice " << s;
+            }
+        }
+
+        // solving in place gives the same result
+        ifx_la_cholesky_solve_batch_c(A, regularization, B, B);
+        for (uint32_t r = 0; r < N; r++)
+        {
+            for (uint32_t s = 0; s < batch; s++)
+            {
+                EXPECT_EQ(get(B, r, s).real, get(X, r, s).real);
+                EXPECT_EQ(get(B, r, s).imag, get(X, r, s).imag);
+            }
+        }
+
+        ifx_mat_destroy_c(X);
+        ifx_mat_destroy_c(B);
+        ifx_cube_destroy_c(A);
+    }
+}
+
+TEST_P(LABatch, LayoutsGiveSameResults)
+{
+    // the other layout for the output than for the input
+    constexpr uint32_t N = 5;
+    ifx_Cube_C_t* A = create_cube(N, batch, GetParam());
+    ifx_Cube_C_t* A_other = create_cube(N, batch, !GetParam());
+    ifx_Cube_C_t* L = create_cube(N, batch, GetParam());
+    ifx_Cube_C_t* L_other = create_cube(N, batch, !GetParam());
+    fill_hermitian(A, m_rng);
+    copy(A, A_other);
+
+    ifx_la_cholesky_batch_c(A, regularization, L);
+    ifx_la_cholesky_batch_c(A_other, regularization, L_other);
+    ifx_la_cholesky_batch_c(A, regularization, L_other);
+    for (uint32_t s = 0; s < batch; s++)
+    {
+        for (uint32_t r = 0; r < N; r++)
+        {
+            for (uint32_t c = 0; c < N; c++)
+            {
+                EXPECT_EQ(get(L, r, c, s).real, get(L_other, r, c, s).real);
+                EXPECT_EQ(get(L, r, c, s).imag, get(L_other, r, c, s).imag);
+            }
+        }
+    }
+
+    ifx_cube_destroy_c(L_other);
+    ifx_cube_destroy_c(L);
+    ifx_cube_destroy_c(A_other);
+    ifx_cube_destroy_c(A);
+}
+
+TEST_P(LABatch, IndefiniteMatrixDoesNotStopBatch)
+{
+    constexpr uint32_t N = 4;
+    constexpr uint32_t indefinite = 9;
+    ifx_Cube_C_t* A = create_cube(N, batch, GetParam());
+    ifx_Cube_C_t* L = create_cube(N, batch, GetParam());
+    fill_hermitian(A, m_rng);
+    set(A, 2, 2, indefinite, {-100, 0});
+
+    ifx_la_cholesky_batch_c(A, regularization, L);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE);
+
+    ifx_Matrix_C_t* expected = ifx_mat_create_c(N, N);
+    for (uint32_t s = 0; s < batch; s++)
+    {
+        if (s == indefinite)
+            continue;
+        ifx_Matrix_C_t* slice = regularized_slice(A, s, regularization);
+        ifx_la_cholesky_c(slice, expected);
+        ifx_mat_destroy_c(slice);
+        expect_slice_near(L, s, expected, 1e-4 * N);
+    }
+
+    ifx_mat_destroy_c(expected);
+    ifx_cube_destroy_c(L);
+    ifx_cube_destroy_c(A);
+}
+
+TEST_P(LABatch, InvalidArgumentsAreRejected)
+{
+    ifx_Cube_C_t* large = create_cube(IFX_LA_BATCH_MAX_SIZE + 1, 2, GetParam());
+    ifx_Cube_C_t* large_out = create_cube(IFX_LA_BATCH_MAX_SIZE + 1, 2, GetParam());
+    ifx_la_cholesky_batch_c(large, 0, large_out);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_SUPPORTED);
+    ifx_la_invert_batch_c(large, 0, large_out);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_SUPPORTED);
+
+    ifx_Cube_C_t* A = create_cube(3, batch, GetParam());
+    ifx_Cube_C_t* small = create_cube(3, batch - 1, GetParam());
+    fill_hermitian(A, m_rng);
+    ifx_la_cholesky_batch_c(A, 0, small);
+    EXPECT_NE(ifx_error_get_and_clear(), IFX_OK);
+
+    ifx_Matrix_C_t* B = ifx_mat_create_c(3, batch - 1);
+    ifx_la_cholesky_solve_batch_c(A, 0, B, B);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_DIMENSION_MISMATCH);
+
+    ifx_mat_destroy_c(B);
+    ifx_cube_destroy_c(small);
+    ifx_cube_destroy_c(A);
+    ifx_cube_destroy_c(large_out);
+    ifx_cube_destroy_c(large);
+}
+
+INSTANTIATE_TEST_SUITE_P(Layouts, LABatch, ::testing::Values(false, true),
+                         [](const ::testing::TestParamInfo<bool>& info) { return info.param ? "Split" : "Interleaved"; });
@@ -0,0 +1,289 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Smoke tests of the split complex layout (IFX_MDA_FLAG_SPLIT_COMPLEX).
+ *
+ * The split-native functions must give the same results as for interleaved
+ * arrays, both for contiguous arrays (SIMD kernels) and for views (scalar
+ * loops). Functions without split support must refuse split arrays.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Complex.h"
+#include "ifxBase/Cube.h"
+#include "ifxBase/Error.h"
+#include "ifxBase/Matrix.h"
+#include "ifxBase/Vector.h"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+namespace {
+
+constexpr uint32_t rows = 7;
+constexpr uint32_t columns = 37;  // not a multiple of any SIMD width
+constexpr ifx_Float_t tolerance = 1e-5f;
+
+ifx_Complex_t get(const ifx_Matrix_C_t* matrix, uint32_t row, uint32_t col)
+{
+    if (IFX_MDA_IS_SPLIT(matrix))
+        return IFX_COMPLEX_DEF(IFX_MDA_REAL_AT(matrix, row, col), IFX_MDA_IMAG_AT(matrix, row, col));
+    return IFX_MAT_AT(matrix, row, col);
+}
+
+void set(ifx_Matrix_C_t* matrix, uint32_t row, uint32_t col, ifx_Complex_t value)
+{
+    if (IFX_MDA_IS_SPLIT(matrix))
+    {
+        IFX_MDA_REAL_AT(matrix, row, col) = IFX_COMPLEX_REAL(value);
+        IFX_MDA_IMAG_AT(matrix, row, col) = IFX_COMPLEX_IMAG(value);
+    }
+    else
+    {
+        IFX_MAT_AT(matrix, row, col) = value;
+    }
+}
+
+void fill_random(ifx_Matrix_C_t* matrix, std::mt19937& rng)
+{
+    std::uniform_real_distribution<ifx_Float_t> dist(-1, 1);
+    for (uint32_t r = 0; r < IFX_MAT_ROWS(matrix); r++)
+        for (uint32_t c = 0; c < IFX_MAT_COLS(matrix); c++)
+            set(matrix, r, c, IFX_COMPLEX_DEF(dist(rng), dist(rng)));
+}
+
+void expect_equal(const ifx_Matrix_C_t* expected, const ifx_Matrix_C_t* actual)
+{
+    ASSERT_EQ(IFX_MAT_ROWS(expected), IFX_MAT_ROWS(actual));
+    ASSERT_EQ(IFX_MAT_COLS(expected), IFX_MAT_COLS(actual));
+    for (uint32_t r = 0; r < IFX_MAT_ROWS(expected); r++)
+    {
+        for (uint32_t c = 0; c < IFX_MAT_COLS(expected); c++)
+        {
+            const ifx_Complex_t e = get(expected, r, c);
+            const ifx_Complex_t a = get(actual, r, c);
+            EXPECT_NEAR(IFX_COMPLEX_REAL(a), IFX_COMPLEX_REAL(e), tolerance) << "at " << r << "," << c;
+            EXPECT_NEAR(IFX_COMPLEX_IMAG(a), IFX_COMPLEX_IMAG(e), tolerance) << "at " << r << "," << c;
+        }
+    }
+}
+
+void expect_equal(const ifx_Matrix_R_t* expected, const ifx_Matrix_R_t* actual)
+{
+    for (uint32_t r = 0; r < IFX_MAT_ROWS(expected); r++)
+        for (uint32_t c = 0; c < IFX_MAT_COLS(expected); c++)
+            EXPECT_NEAR(IFX_MAT_AT(actual, r, c), IFX_MAT_AT(expected, r, c), tolerance) << "at " << r << "," << c;
+}
+
+// an interleaved matrix and a split copy of it
+class SplitComplex : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 rng(27);
+        interleaved = ifx_mat_create_c(rows, columns);
+        split = ifx_mat_create_split_c(rows, columns);
+        ASSERT_NE(interleaved, nullptr);
+        ASSERT_NE(split, nullptr);
+        fill_random(interleaved, rng);
+        ifx_mat_copy_c(interleaved, split);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    void TearDown() override
+    {
+        ifx_mat_destroy_c(interleaved);
+        ifx_mat_destroy_c(split);
+    }
+
+    ifx_Matrix_C_t* interleaved = nullptr;
+    ifx_Matrix_C_t* split = nullptr;
+};
+
+}  // namespace
+
+TEST_F(SplitComplex, Layout)
+{
+    EXPECT_TRUE(IFX_MDA_IS_SPLIT(split));
+    EXPECT_FALSE(IFX_MDA_IS_SPLIT(interleaved));
+    EXPECT_EQ(split->imag_offset, ptrdiff_t(rows * columns));
+
+    // real and imaginary parts are two separate blocks
+    EXPECT_EQ(IFX_MDA_REAL_DATA(split)[1], IFX_COMPLEX_REAL(IFX_MAT_AT(interleaved, 0, 1)));
+    EXPECT_EQ(IFX_MDA_IMAG_DATA(split)[1], IFX_COMPLEX_IMAG(IFX_MAT_AT(interleaved, 0, 1)));
+
+    // views and clones keep the layout
+    ifx_Matrix_C_t view;
+    ifx_mat_view_c(&view, split, 1, 2, 3, 4);
+    EXPECT_TRUE(IFX_MDA_IS_SPLIT(&view));
+    EXPECT_EQ(IFX_COMPLEX_IMAG(get(&view, 0, 0)), IFX_COMPLEX_IMAG(IFX_MAT_AT(interleaved, 1, 2)));
+
+    ifx_Matrix_C_t* clone = ifx_mat_clone_c(split);
+    ASSERT_NE(clone, nullptr);
+    EXPECT_TRUE(IFX_MDA_IS_SPLIT(clone));
+    expect_equal(interleaved, clone);
+    ifx_mat_destroy_c(clone);
+
+    ifx_Cube_C_t* cube = ifx_cube_create_split_c(2, 3, 4);
+    ASSERT_NE(cube, nullptr);
+    EXPECT_TRUE(IFX_MDA_IS_SPLIT(cube));
+    EXPECT_EQ(cube->imag_offset, ptrdiff_t(2 * 3 * 4));
+    ifx_cube_destroy_c(cube);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST_F(SplitComplex, CopyRoundTrip)
+{
+    ifx_Matrix_C_t* back = ifx_mat_create_c(rows, columns);
+    ifx_mat_copy_c(split, back);
+    expect_equal(interleaved, back);
+
+    // between views, which are not contiguous
+    ifx_Matrix_C_t from, to;
+    ifx_mat_view_c(&from, split, 1, 3, 4, 20);
+    ifx_mat_clear_c(back);
+    ifx_mat_view_c(&to, back, 2, 5, 4, 20);
+    ifx_mat_copy_c(&from, &to);
+    ifx_Matrix_C_t expected;
+    ifx_mat_view_c(&expected, interleaved, 1, 3, 4, 20);
+    expect_equal(&expected, &to);
+    EXPECT_EQ(IFX_COMPLEX_REAL(IFX_MAT_AT(back, 0, 0)), 0);
+
+    ifx_mat_destroy_c(back);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST_F(SplitComplex, Abs)
+{
+    ifx_Matrix_R_t* expected = ifx_mat_create_r(rows, columns);
+    ifx_Matrix_R_t* actual = ifx_mat_create_r(rows, columns);
+    ifx_mat_abs_c(interleaved, expected);
+    ifx_mat_abs_c(split, actual);
+    expect_equal(expected, actual);
+
+    ifx_Vector_C_t row;
+    ifx_mat_get_rowview_c(split, 3, &row);
+    ifx_Vector_R_t* abs = ifx_vec_create_r(columns);
+    ifx_Vector_R_t* squared = ifx_vec_create_r(columns);
+    ifx_vec_abs_c(&row, abs);
+    ifx_vec_squared_norm_c(&row, squared);
+    for (uint32_t c = 0; c < columns; c++)
+    {
+        EXPECT_NEAR(IFX_VEC_AT(abs, c), IFX_MAT_AT(expected, 3, c), tolerance);
+        EXPECT_NEAR(IFX_VEC_AT(squared, c), IFX_MAT_AT(expected, 3, c) * IFX_MAT_AT(expected, 3, c), tolerance);
+    }
+
+    // a column view of a split matrix is strided
+    ifx_Matrix_C_t column;
+    ifx_Matrix_R_t column_abs;
+    ifx_mat_view_c(&column, split, 0, 5, rows, 1);
+    ifx_mat_view_r(&column_abs, actual, 0, 5, rows, 1);
+    ifx_mat_clear_r(actual);
+    ifx_mat_abs_c(&column, &column_abs);
+    for (uint32_t r = 0; r < rows; r++)
+        EXPECT_NEAR(IFX_MAT_AT(actual, r, 5), IFX_MAT_AT(expected, r, 5), tolerance);
+
+    ifx_vec_destroy_r(abs);
+    ifx_vec_destroy_r(squared);
+    ifx_mat_destroy_r(expected);
+    ifx_mat_destroy_r(actual);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST_F(SplitComplex, ScaleAndMac)
+{
+    const ifx_Complex_t scale = IFX_COMPLEX_DEF(0.5f, -1.25f);
+
+    ifx_Matrix_C_t* expected = ifx_mat_create_c(rows, columns);
+    ifx_Matrix_C_t* actual = ifx_mat_create_split_c(rows, columns);
+    ifx_mat_scale_c(interleaved, scale, expected);
+    ifx_mat_scale_c(split, scale, actual);
+    expect_equal(expected, actual);
+
+    // result = m1 + m2 * scale, also in place
+    ifx_mat_mac_c(interleaved, interleaved, scale, expected);
+    ifx_mat_mac_c(split, split, scale, actual);
+    expect_equal(expected, actual);
+    ifx_mat_mac_c(actual, split, scale, actual);
+    ifx_mat_mac_c(expected, interleaved, scale, expected);
+    expect_equal(expected, actual);
+
+    // vectors, on views of the rows
+    ifx_Vector_C_t in_row, out_row, expected_row;
+    ifx_mat_get_rowview_c(split, 2, &in_row);
+    ifx_mat_get_rowview_c(actual, 4, &out_row);
+    ifx_mat_get_rowview_c(interleaved, 2, &expected_row);
+    ifx_vec_scale_c(&in_row, scale, &out_row);
+    ifx_vec_mac_c(&out_row, &in_row, scale, &out_row);
+    for (uint32_t c = 0; c < columns; c++)
+    {
+        // x * scale + x * scale
+        const ifx_Complex_t x = IFX_VEC_AT(&expected_row, c);
+        const ifx_Float_t re = 2 * (IFX_COMPLEX_REAL(x) * IFX_COMPLEX_REAL(scale) - IFX_COMPLEX_IMAG(x) * IFX_COMPLEX_IMAG(scale));
+        const ifx_Float_t im = 2 * (IFX_COMPLEX_REAL(x) * IFX_COMPLEX_IMAG(scale) + IFX_COMPLEX_IMAG(x) * IFX_COMPLEX_REAL(scale));
+        EXPECT_NEAR(IFX_MDA_REAL_AT(actual, 4, c), re, tolerance);
+        EXPECT_NEAR(IFX_MDA_IMAG_AT(actual, 4, c), im, tolerance);
+    }
+
+    // columns are strided views
+    ifx_Vector_C_t in_col, out_col;
+    ifx_mat_get_colview_c(split, 6, &in_col);
+    ifx_mat_get_colview_c(actual, 9, &out_col);
+    ifx_vec_scale_c(&in_col, scale, &out_col);
+    ifx_vec_mac_c(&out_col, &in_col, scale, &out_col);
+    for (uint32_t r = 0; r < rows; r++)
+    {
+        const ifx_Complex_t x = IFX_MAT_AT(interleaved, r, 6);
+        const ifx_Float_t re = 2 * (IFX_COMPLEX_REAL(x) * IFX_COMPLEX_REAL(scale) - IFX_COMPLEX_IMAG(x) * IFX_COMPLEX_IMAG(scale));
+        const ifx_Float_t im = 2 * (IFX_COMPLEX_REAL(x) * IFX_COMPLEX_IMAG(scale) + IFX_COMPLEX_IMAG(x) * IFX_COMPLEX_REAL(scale));
+        EXPECT_NEAR(IFX_MDA_REAL_AT(actual, r, 9), re, tolerance);
+        EXPECT_NEAR(IFX_MDA_IMAG_AT(actual, r, 9), im, tolerance);
+    }
+
+    ifx_mat_destroy_c(expected);
+    ifx_mat_destroy_c(actual);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST_F(SplitComplex, UnsupportedFunctionsRefuseSplitArrays)
+{
+    ifx_mat_sum_c(split);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_SUPPORTED);
+
+    // mixed layouts are only supported where documented
+    ifx_Matrix_C_t* output = ifx_mat_create_c(rows, columns);
+    ifx_mat_scale_c(split, IFX_COMPLEX_DEF(1, 0), output);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_SUPPORTED);
+    ifx_mat_mac_c(split, interleaved, IFX_COMPLEX_DEF(1, 0), output);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_SUPPORTED);
+    ifx_mat_destroy_c(output);
+}
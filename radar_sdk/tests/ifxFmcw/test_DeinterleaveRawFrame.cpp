@@ -0,0 +1,241 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Compares ifx_fmcw_deinterleave_raw_frame, which replays copy runs compiled
+ * once per acquisition sequence, against the walk over the sequence it did
+ * for every frame before. A dummy device is enough, since only the sequence
+ * is needed. */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Error.h"
+#include "ifxFmcw/DeviceFmcw.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <stack>
+#include <vector>
+
+namespace {
+
+using Dimensions = std::vector<std::array<uint32_t, 3>>;
+
+uint32_t popcount(uint32_t mask)
+{
+    uint32_t count = 0;
+    for (; mask; mask &= mask - 1)
+        count++;
+    return count;
+}
+
+// DeviceFmcwBase::deinterleave_raw_frame before the copy runs
+void reference_deinterleave(const ifx_Fmcw_Sequence_Element_t* sequence, const Dimensions& dimensions, const uint16_t* raw_data_ptr, uint16_t* deinterleaved)
+{
+    std::stack<const ifx_Fmcw_Sequence_Element_t*> loops_stack;
+    std::stack<const ifx_Fmcw_Sequence_Element_t*> chirps_stack;
+    uint32_t num_of_chirps_in_loop = 0;
+    std::vector<uint32_t> remaining_chirp_repetitions;
+    for (const auto& d : dimensions)
+        remaining_chirp_repetitions.emplace_back(d[1]);
+
+    const auto* current_element = sequence;
+    if ((current_element->type == IFX_SEQ_LOOP) && (current_element->next_element == nullptr))
+        current_element = current_element->loop.sub_sequence;
+
+    while (current_element != nullptr)
+    {
+        switch (current_element->type)
+        {
+            case IFX_SEQ_CHIRP:
+                {
+                    const ifx_Fmcw_Sequence_Chirp_t& current_chirp = current_element->chirp;
+                    const uint32_t num_rx = popcount(current_chirp.rx_mask);
+                    const uint32_t num_samples_per_chirp = current_chirp.num_samples;
+                    const auto chirp_index = static_cast<uint32_t>(chirps_stack.size());
+                    chirps_stack.push(current_element);
+                    num_of_chirps_in_loop++;
+
+                    uint32_t offset = (dimensions[chirp_index][1] - remaining_chirp_repetitions[chirp_index]) * (dimensions[chirp_index][0] * dimensions[chirp_index][2]);
+                    for (size_t i = 0; i < chirp_index; i++)
+                        offset += dimensions[i][1] * (dimensions[i][0] * dimensions[i][2]);
+
+                    for (size_t i = 0; i < num_rx; i++)
+                    {
+                        std::copy(raw_data_ptr, raw_data_ptr + num_samples_per_chirp, deinterleaved + offset + i * num_samples_per_chirp);
+                        raw_data_ptr += num_samples_per_chirp;
+                    }
+
+                    remaining_chirp_repetitions[chirp_index] -= 1;
+                    if ((current_element->next_element == nullptr) && (remaining_chirp_repetitions[chirp_index] > 0))
+                    {
+                        current_element = loops_stack.top()->loop.sub_sequence;
+                        for (size_t i = 0; i < num_of_chirps_in_loop; i++)
+                            chirps_stack.pop();
+                        num_of_chirps_in_loop = 0;
+                        continue;
+                    }
+                    break;
+                }
+            case IFX_SEQ_LOOP:
+                num_of_chirps_in_loop = 0;
+                loops_stack.push(current_element);
+                current_element = current_element->loop.sub_sequence;
+                continue;
+            default:
+                break;
+        }
+
+        current_element = current_element->next_element;
+        while ((current_element == nullptr) && (!loops_stack.empty()))
+        {
+            current_element = loops_stack.top()->next_element;
+            loops_stack.pop();
+        }
+    }
+}
+
+class DeinterleaveRawFrame : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_device = ifx_fmcw_create_dummy(IFX_AVIAN_BGT60TR13C);
+        ASSERT_NE(m_device, nullptr);
+    }
+
+    void TearDown() override
+    {
+        ifx_fmcw_destroy(m_device);
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    // the chirp loop of the default sequence (frame loop -> chirp loop -> chirp)
+    static ifx_Fmcw_Sequence_Element_t* chirp_loop(ifx_Fmcw_Sequence_Element_t* sequence)
+    {
+        return sequence->loop.sub_sequence;
+    }
+
+    void check()
+    {
+        ifx_Fmcw_Frame_t* frame = ifx_fmcw_allocate_frame(m_device);
+        ifx_Fmcw_Raw_Frame_t* raw = ifx_fmcw_allocate_raw_frame(m_device);
+        ifx_Fmcw_Raw_Frame_t* actual = ifx_fmcw_allocate_raw_frame(m_device);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+        Dimensions dimensions;
+        for (uint32_t i = 0; i < frame->num_cubes; i++)
+        {
+            const auto* shape = IFX_MDA_SHAPE(frame->cubes[i]);
+            dimensions.push_back({shape[0], shape[1], shape[2]});
+        }
+
+        std::iota(raw->samples, raw->samples + raw->num_samples, uint16_t(0));
+        std::vector<uint16_t> expected(raw->num_samples, 0xffff);
+        ifx_Fmcw_Sequence_Element_t* sequence = ifx_fmcw_get_acquisition_sequence(m_device);
+        reference_deinterleave(sequence, dimensions, raw->samples, expected.data());
+        ifx_fmcw_destroy_sequence(sequence);
+
+        ifx_fmcw_deinterleave_raw_frame(m_device, raw, actual);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        for (uint32_t i = 0; i < raw->num_samples; i++)
+            ASSERT_EQ(actual->samples[i], expected[i]) << "sample " << i;
+
+        ifx_fmcw_destroy_raw_frame(actual);
+        ifx_fmcw_destroy_raw_frame(raw);
+        ifx_fmcw_destroy_frame(frame);
+    }
+
+    ifx_Device_Fmcw_t* m_device = nullptr;
+};
+
+}  // namespace
+
+TEST_F(DeinterleaveRawFrame, DefaultSequence)
+{
+    check();
+}
+
+TEST_F(DeinterleaveRawFrame, Mimo)
+{
+    ifx_Fmcw_Sequence_Element_t* sequence = ifx_fmcw_get_acquisition_sequence(m_device);
+    ifx_Fmcw_Sequence_Element_t* loop = chirp_loop(sequence);
+    ASSERT_EQ(loop->type, IFX_SEQ_LOOP);
+    ifx_Fmcw_Sequence_Element_t* first = loop->loop.sub_sequence;
+    ASSERT_EQ(first->type, IFX_SEQ_CHIRP);
+
+    loop->loop.num_repetitions = 8;
+    first->chirp.rx_mask = 0b111;
+    first->chirp.tx_mask = 0b1;
+    ifx_Fmcw_Sequence_Element_t* second = ifx_fmcw_create_sequence_element(IFX_SEQ_CHIRP);
+    second->chirp = first->chirp;
+    second->chirp.rx_mask = 0b101;
+    second->chirp.num_samples = first->chirp.num_samples / 2;
+    first->next_element = second;
+
+    ifx_fmcw_set_acquisition_sequence(m_device, sequence);
+    ifx_fmcw_destroy_sequence(sequence);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    check();
+}
+
+TEST_F(DeinterleaveRawFrame, SequenceChangesPlan)
+{
+    check();
+
+    ifx_Fmcw_Sequence_Element_t* sequence = ifx_fmcw_get_acquisition_sequence(m_device);
+    ifx_Fmcw_Sequence_Element_t* first = chirp_loop(sequence)->loop.sub_sequence;
+    ifx_Fmcw_Sequence_Element_t* second = ifx_fmcw_create_sequence_element(IFX_SEQ_CHIRP);
+    second->chirp = first->chirp;
+    second->chirp.rx_mask = 0b10;
+    first->next_element = second;
+    ifx_fmcw_set_acquisition_sequence(m_device, sequence);
+    ifx_fmcw_destroy_sequence(sequence);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    check();
+}
+
+TEST_F(DeinterleaveRawFrame, ShortFramesAreRejected)
+{
+    ifx_Fmcw_Raw_Frame_t* raw = ifx_fmcw_allocate_raw_frame(m_device);
+    ifx_Fmcw_Raw_Frame_t* deinterleaved = ifx_fmcw_allocate_raw_frame(m_device);
+    ASSERT_NE(raw, nullptr);
+
+    raw->num_samples--;
+    ifx_fmcw_deinterleave_raw_frame(m_device, raw, deinterleaved);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_DIMENSION_MISMATCH);
+    raw->num_samples++;
+
+    ifx_fmcw_deinterleave_raw_frame(m_device, raw, nullptr);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_ARGUMENT_NULL);
+
+    ifx_fmcw_destroy_raw_frame(deinterleaved);
+    ifx_fmcw_destroy_raw_frame(raw);
+}
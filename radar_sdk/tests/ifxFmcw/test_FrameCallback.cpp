@@ -0,0 +1,336 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Tests of the asynchronous frame delivery (ifx_fmcw_register_frame_callback)
+ * with a playback device, which delivers frames without hardware, and with a
+ * dummy device, which cannot acquire at all. */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Error.h"
+#include "ifxBase/Mda.h"
+#include "ifxFmcw/DeviceFmcw.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t num_recorded_frames = 8;
+constexpr uint32_t num_chirps = 4;
+constexpr uint32_t num_samples = 64;
+constexpr auto wait_timeout = std::chrono::seconds(5);
+
+// Write a recording of a single rx antenna in the format of ifxdaq. All
+// samples of frame i have the value 100 * (i + 1).
+void write_recording(const std::filesystem::path& directory)
+{
+    std::filesystem::create_directories(directory);
+
+    std::ofstream(directory / "meta.json") << R"({"description": "BGT60TR13C FMCW Radar Sensor"})";
+    std::ofstream(directory / "config.json") << R"({"device_config": {"fmcw_single_shape": {
+        "rx_antennas": [1], "tx_antennas": [1], "tx_power_level": 31,
+        "if_gain_dB": 33, "lp_cutoff_Hz": 500000, "hp_cutoff_Hz": 80000, "aaf_cutoff_Hz": 500000,
+        "num_chirps_per_frame": 4, "num_samples_per_chirp": 64,
+        "chirp_repetition_time_s": 0.0005, "frame_repetition_time_s": 0.01,
+        "start_frequency_Hz": 60000000000, "end_frequency_Hz": 61000000000,
+        "sample_rate_Hz": 1000000}}})";
+
+    // .npy version 1.0, the header is padded such that the data is 64 byte aligned
+    std::string header = "{'descr': '<u2', 'fortran_order': False, 'shape': ("
+                         + std::to_string(num_recorded_frames) + ", 1, " + std::to_string(num_chirps) + ", "
+                         + std::to_string(num_samples) + "), }";
+    header.append(63 - (10 + header.size()) % 64, ' ');
+    header.push_back('\n');
+
+    std::ofstream npy(directory / "radar.npy", std::ios::binary);
+    npy.write("\x93NUMPY\x01\x00", 8);
+    const char header_length[2] = {static_cast<char>(header.size() & 0xff), static_cast<char>(header.size() >> 8)};
+    npy.write(header_length, 2);
+    npy << header;
+    for (uint32_t frame = 0; frame < num_recorded_frames; frame++)
+    {
+        const uint16_t sample = static_cast<uint16_t>(100 * (frame + 1));
+        for (uint32_t i = 0; i < num_chirps * num_samples; i++)
+            npy.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+    }
+}
+
+// collects the frames and errors passed to the callback
+struct Receiver
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<ifx_Fmcw_Frame_t*> frames;
+    std::vector<ifx_Error_t> errors;
+
+    static void callback(ifx_Device_Fmcw_t* /*handle*/, ifx_Fmcw_Frame_t* frame, ifx_Error_t error, void* context)
+    {
+        auto* self = static_cast<Receiver*>(context);
+        std::lock_guard<std::mutex> lock(self->mutex);
+        if (frame)
+            self->frames.push_back(frame);
+        else
+            self->errors.push_back(error);
+        self->changed.notify_all();
+    }
+
+    bool wait_for_frames(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return changed.wait_for(lock, wait_timeout, [&] { return frames.size() >= count; });
+    }
+
+    bool wait_for_error()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return changed.wait_for(lock, wait_timeout, [&] { return !errors.empty(); });
+    }
+
+    size_t num_frames()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return frames.size();
+    }
+};
+
+ifx_Float_t first_sample(const ifx_Fmcw_Frame_t* frame)
+{
+    return IFX_MDA_DATA(frame->cubes[0])[0];
+}
+
+class FrameCallbackPlayback : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_directory = std::filesystem::temp_directory_path()
+                      / ("rdk_test_frame_callback_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        write_recording(m_directory);
+
+        m_device = ifx_fmcw_create_playback(m_directory.string().c_str());
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        ASSERT_NE(m_device, nullptr);
+
+        ifx_fmcw_playback_set_mode(m_device, IFX_FMCW_PLAYBACK_AS_FAST_AS_POSSIBLE, true);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    void TearDown() override
+    {
+        ifx_fmcw_destroy(m_device);
+        std::filesystem::remove_all(m_directory);
+    }
+
+    std::filesystem::path m_directory;
+    ifx_Device_Fmcw_t* m_device = nullptr;
+};
+
+}  // namespace
+
+TEST_F(FrameCallbackPlayback, FramesInFlightAreBounded)
+{
+    constexpr uint32_t pool_size = 3;
+    Receiver receiver;
+
+    ifx_fmcw_register_frame_callback(m_device, Receiver::callback, &receiver, pool_size);
+    ifx_fmcw_start_frame_callback(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    ASSERT_TRUE(receiver.wait_for_frames(pool_size));
+
+    // all frames are borrowed, so the acquisition has to wait
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(receiver.num_frames(), pool_size);
+
+    // each frame is a different buffer holding the frames of the recording in order
+    for (uint32_t i = 0; i < pool_size; i++)
+    {
+        for (uint32_t j = 0; j < i; j++)
+        {
+            EXPECT_NE(receiver.frames[i], receiver.frames[j]);
+        }
+        if (i > 0)
+        {
+            EXPECT_GT(first_sample(receiver.frames[i]), first_sample(receiver.frames[i - 1]));
+        }
+    }
+
+    // releasing a frame lets the acquisition continue with this frame
+    ifx_Fmcw_Frame_t* released = receiver.frames[0];
+    ifx_fmcw_release_frame(m_device, released);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ASSERT_TRUE(receiver.wait_for_frames(pool_size + 1));
+    EXPECT_EQ(receiver.frames[pool_size], released);
+
+    ifx_fmcw_stop_frame_callback(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    for (uint32_t i = 1; i <= pool_size; i++)
+        ifx_fmcw_release_frame(m_device, receiver.frames[i]);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST_F(FrameCallbackPlayback, BorrowedFramesOutliveStop)
+{
+    Receiver receiver;
+
+    ifx_fmcw_register_frame_callback(m_device, Receiver::callback, &receiver, 2);
+    ifx_fmcw_start_frame_callback(m_device);
+    ASSERT_TRUE(receiver.wait_for_frames(2));
+    ifx_fmcw_stop_frame_callback(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    const ifx_Float_t sample0 = first_sample(receiver.frames[0]);
+    const ifx_Float_t sample1 = first_sample(receiver.frames[1]);
+
+    // neither the pool nor the callback can be replaced while frames are borrowed
+    Receiver other;
+    ifx_fmcw_register_frame_callback(m_device, Receiver::callback, &other, 2);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_POSSIBLE);
+    ifx_fmcw_register_frame_callback(m_device, nullptr, nullptr, 0);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_POSSIBLE);
+    ifx_fmcw_start_frame_callback(m_device);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_POSSIBLE);
+
+    // the borrowed frames are untouched
+    EXPECT_EQ(first_sample(receiver.frames[0]), sample0);
+    EXPECT_EQ(first_sample(receiver.frames[1]), sample1);
+
+    ifx_fmcw_release_frame(m_device, receiver.frames[0]);
+    ifx_fmcw_release_frame(m_device, receiver.frames[1]);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    // a frame cannot be released twice
+    ifx_fmcw_release_frame(m_device, receiver.frames[0]);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_ARGUMENT_INVALID);
+
+    // once all frames are back, the callback can be replaced
+    ifx_fmcw_register_frame_callback(m_device, Receiver::callback, &other, 1);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ifx_fmcw_start_frame_callback(m_device);
+    ASSERT_TRUE(other.wait_for_frames(1));
+    ifx_fmcw_stop_frame_callback(m_device);
+    ifx_fmcw_release_frame(m_device, other.frames[0]);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST_F(FrameCallbackPlayback, StatisticsFollowFrames)
+{
+    ifx_Fmcw_Statistics_t statistics;
+    ifx_fmcw_reset_statistics(m_device);
+    ifx_fmcw_get_statistics(m_device, &statistics);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    EXPECT_EQ(statistics.frames_received, 0u);
+
+    // frames fetched by the application
+    ifx_Fmcw_Frame_t* frame = ifx_fmcw_allocate_frame(m_device);
+    ASSERT_NE(frame, nullptr);
+    for (int i = 0; i < 3; i++)
+        ifx_fmcw_get_next_frame(m_device, frame);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ifx_fmcw_destroy_frame(frame);
+
+    ifx_fmcw_get_statistics(m_device, &statistics);
+    EXPECT_EQ(statistics.frames_received, 3u);
+    EXPECT_EQ(statistics.frames_timeout, 0u);
+    EXPECT_EQ(statistics.delivery_latency.count, 0u);
+
+    // frames passed to a callback record their delivery, and their release
+    Receiver receiver;
+    ifx_fmcw_register_frame_callback(m_device, Receiver::callback, &receiver, 2);
+    ifx_fmcw_start_frame_callback(m_device);
+    ASSERT_TRUE(receiver.wait_for_frames(2));
+    ifx_fmcw_stop_frame_callback(m_device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    ifx_fmcw_get_statistics(m_device, &statistics);
+    EXPECT_GE(statistics.frames_received, 5u);
+    EXPECT_GE(statistics.delivery_latency.count, 2u);
+    EXPECT_EQ(statistics.user_latency.count, 0u);
+
+    ifx_fmcw_release_frame(m_device, receiver.frames[0]);
+    ifx_fmcw_release_frame(m_device, receiver.frames[1]);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ifx_fmcw_get_statistics(m_device, &statistics);
+    EXPECT_EQ(statistics.user_latency.count, 2u);
+
+    ifx_fmcw_reset_statistics(m_device);
+    ifx_fmcw_get_statistics(m_device, &statistics);
+    EXPECT_EQ(statistics.frames_received, 0u);
+    EXPECT_EQ(statistics.delivery_latency.count, 0u);
+    EXPECT_EQ(statistics.user_latency.count, 0u);
+    EXPECT_EQ(statistics.deinterleave_latency.count, 0u);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+}
+
+TEST(FrameCallbackDummy, AcquisitionErrorIsReported)
+{
+    ifx_Device_Fmcw_t* device = ifx_fmcw_create_dummy(IFX_AVIAN_BGT60TR13C);
+    ASSERT_NE(device, nullptr);
+
+    Receiver receiver;
+    ifx_fmcw_register_frame_callback(device, Receiver::callback, &receiver, 2);
+    ifx_fmcw_start_frame_callback(device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    // a dummy device has no board to acquire from
+    ASSERT_TRUE(receiver.wait_for_error());
+    ifx_fmcw_stop_frame_callback(device);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    EXPECT_TRUE(receiver.frames.empty());
+    ASSERT_EQ(receiver.errors.size(), 1u);
+    EXPECT_NE(receiver.errors[0], IFX_OK);
+
+    ifx_fmcw_destroy(device);
+}
+
+TEST(FrameCallbackDummy, InvalidArguments)
+{
+    ifx_Device_Fmcw_t* device = ifx_fmcw_create_dummy(IFX_AVIAN_BGT60TR13C);
+    ASSERT_NE(device, nullptr);
+
+    Receiver receiver;
+    ifx_fmcw_register_frame_callback(device, Receiver::callback, &receiver, 0);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_ARGUMENT_INVALID);
+
+    // nothing registered
+    ifx_fmcw_start_frame_callback(device);
+    EXPECT_NE(ifx_error_get_and_clear(), IFX_OK);
+
+    ifx_fmcw_destroy(device);
+}
@@ -0,0 +1,193 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Compares FrameScatter, which converts the samples of a frame slice by
+ * slice, against the conversion of the complete raw frame that
+ * DeviceFmcwBase::get_next_frame did before. The samples are passed in
+ * chunks of random size, so rows and chirps are split at every possible
+ * position. */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Mda.h"
+#include "ifxFmcw/FrameScatter.hpp"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr ifx_Float_t max_adc_value = 4095;
+
+using Dimensions = std::vector<std::array<uint32_t, 3>>;
+
+// the conversion loop of get_next_frame before FrameScatter
+void reference_convert(const std::vector<uint16_t>& raw, const Dimensions& dimensions, bool mimo, ifx_Mda_R_t** cubes)
+{
+    const auto* raw_data = raw.data();
+    const auto cube_offset = dimensions.size() - 1;
+    for (size_t i = 0; i < dimensions.size(); i++)
+    {
+        ifx_Mda_R_t* cube = cubes[i];
+        const auto num_rx = dimensions[i][0];
+        const auto num_chirps = dimensions[i][1];
+        const auto num_samples_per_chirp = dimensions[i][2];
+
+        const auto chirp_offset = num_rx * num_samples_per_chirp;
+        const auto* cube_data = raw_data;
+        for (uint32_t chirp = 0; chirp < num_chirps; chirp++)
+        {
+            for (uint32_t sample = 0; sample < num_samples_per_chirp; sample++)
+            {
+                for (uint32_t rx = 0; rx < num_rx; rx++)
+                {
+                    IFX_MDA_AT(cube, rx, chirp, sample) = static_cast<ifx_Float_t>(*cube_data++ * 2) / max_adc_value - 1.0f;
+                }
+            }
+            if (mimo)
+            {
+                cube_data += cube_offset * chirp_offset;
+            }
+        }
+        if (mimo)
+        {
+            raw_data += chirp_offset;
+        }
+        else
+            raw_data = cube_data;
+    }
+}
+
+struct Frame
+{
+    explicit Frame(const Dimensions& dimensions)
+    {
+        for (const auto& d : dimensions)
+            cubes.push_back(IFX_MDA_CREATE_R(d[0], d[1], d[2]));
+    }
+
+    ~Frame()
+    {
+        for (auto* cube : cubes)
+            ifx_mda_destroy_r(cube);
+    }
+
+    std::vector<ifx_Mda_R_t*> cubes;
+};
+
+void check(const Dimensions& dimensions, bool mimo, uint32_t max_chunk, std::mt19937& rng)
+{
+    size_t total = 0;
+    for (const auto& d : dimensions)
+        total += size_t(d[0]) * d[1] * d[2];
+
+    std::uniform_int_distribution<uint16_t> sample_dist(0, 4095);
+    std::vector<uint16_t> raw(total);
+    for (auto& sample : raw)
+        sample = sample_dist(rng);
+
+    Frame expected(dimensions);
+    reference_convert(raw, dimensions, mimo, expected.cubes.data());
+
+    // samples after the end of the frame are ignored
+    raw.resize(total + 100, 0);
+
+    Frame actual(dimensions);
+    FrameScatter scatter(actual.cubes.data(), dimensions, mimo, max_adc_value);
+    std::uniform_int_distribution<uint32_t> chunk_dist(1, max_chunk);
+    for (size_t offset = 0; offset < raw.size();)
+    {
+        const auto chunk = static_cast<uint32_t>(std::min<size_t>(chunk_dist(rng), raw.size() - offset));
+        scatter.write(raw.data() + offset, chunk);
+        offset += chunk;
+    }
+
+    for (size_t i = 0; i < dimensions.size(); i++)
+    {
+        const auto& d = dimensions[i];
+        for (uint32_t rx = 0; rx < d[0]; rx++)
+        {
+            for (uint32_t chirp = 0; chirp < d[1]; chirp++)
+            {
+                for (uint32_t sample = 0; sample < d[2]; sample++)
+                {
+                    // the scale is multiplied instead of divided, which may change the last bit
+                    ASSERT_NEAR(IFX_MDA_AT(actual.cubes[i], rx, chirp, sample), IFX_MDA_AT(expected.cubes[i], rx, chirp, sample), 1e-6)
+                        << "cube " << i << " rx " << rx << " chirp " << chirp << " sample " << sample << " max chunk " << max_chunk;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(FrameScatter, SingleCube)
+{
+    std::mt19937 rng(1);
+    for (uint32_t max_chunk : {1u, 2u, 5u, 64u, 1024u, 100000u})
+    {
+        check({{1, 8, 64}}, false, max_chunk, rng);
+        check({{3, 16, 128}}, false, max_chunk, rng);
+    }
+}
+
+TEST(FrameScatter, SeveralShapes)
+{
+    std::mt19937 rng(2);
+    for (uint32_t max_chunk : {1u, 3u, 7u, 500u, 1024u, 100000u})
+        check({{3, 4, 32}, {2, 8, 16}, {1, 2, 64}}, false, max_chunk, rng);
+}
+
+TEST(FrameScatter, Mimo)
+{
+    std::mt19937 rng(3);
+    for (uint32_t max_chunk : {1u, 2u, 5u, 64u, 1024u, 100000u})
+    {
+        check({{3, 8, 32}, {3, 8, 32}}, true, max_chunk, rng);
+        check({{4, 4, 16}, {4, 4, 16}, {4, 4, 16}}, true, max_chunk, rng);
+    }
+}
+
+TEST(FrameScatter, RandomFrames)
+{
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<uint32_t> rx_dist(1, 4), chirp_dist(1, 16), sample_dist(1, 80), cube_dist(1, 3), chunk_dist(1, 2000);
+    for (int i = 0; i < 50; i++)
+    {
+        const bool mimo = (i % 2) == 1;
+        const std::array<uint32_t, 3> shape = {rx_dist(rng), chirp_dist(rng), sample_dist(rng)};
+        Dimensions dimensions;
+        for (uint32_t cube = cube_dist(rng); cube > 0; cube--)
+            dimensions.push_back(mimo ? shape : std::array<uint32_t, 3> {rx_dist(rng), chirp_dist(rng), sample_dist(rng)});
+        check(dimensions, mimo, chunk_dist(rng), rng);
+    }
+}
@@ -0,0 +1,318 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Tests of the playback device for radar.npy recordings: rejection of
+ * invalid .npy headers, seeking, looping and the playback modes. */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Error.h"
+#include "ifxBase/Mda.h"
+#include "ifxFmcw/DeviceFmcw.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t num_frames = 8;
+constexpr uint32_t num_chirps = 4;
+constexpr uint32_t num_samples = 64;
+constexpr uint32_t frame_size = num_chirps * num_samples;
+constexpr uint16_t timeout_ms = 1000;
+
+// sample i of frame f in the recording
+uint16_t recorded_sample(uint32_t frame, uint32_t i)
+{
+    return static_cast<uint16_t>((frame << 8) | (i & 0xff));
+}
+
+std::string default_header()
+{
+    return "{'descr': '<u2', 'fortran_order': False, 'shape': (" + std::to_string(num_frames) + ", 1, "
+           + std::to_string(num_chirps) + ", " + std::to_string(num_samples) + "), }";
+}
+
+class Playback : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_directory = std::filesystem::temp_directory_path()
+                      / ("rdk_test_playback_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+        std::filesystem::create_directories(m_directory);
+
+        // a single rx antenna, so the raw frames hold the samples as recorded
+        std::ofstream(m_directory / "meta.json") << R"({"description": "BGT60TR13C FMCW Radar Sensor"})";
+        std::ofstream(m_directory / "config.json") << R"({"device_config": {"fmcw_single_shape": {
+            "rx_antennas": [1], "tx_antennas": [1], "tx_power_level": 31,
+            "if_gain_dB": 33, "lp_cutoff_Hz": 500000, "hp_cutoff_Hz": 80000, "aaf_cutoff_Hz": 500000,
+            "num_chirps_per_frame": 4, "num_samples_per_chirp": 64,
+            "chirp_repetition_time_s": 0.0005, "frame_repetition_time_s": 0.02,
+            "start_frequency_Hz": 60000000000, "end_frequency_Hz": 61000000000,
+            "sample_rate_Hz": 1000000}}})";
+    }
+
+    void TearDown() override
+    {
+        if (m_device)
+            ifx_fmcw_destroy(m_device);
+        std::filesystem::remove_all(m_directory);
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    /* Write radar.npy with the given header dictionary, padded such that the
+     * data is 64 byte aligned, followed by num_elements samples. */
+    void write_npy(std::string header, size_t num_elements = num_frames * frame_size, uint8_t major_version = 1, const char* magic = "\x93NUMPY")
+    {
+        const size_t prefix = (major_version == 1) ? 10 : 12;
+        header.append(63 - (prefix + header.size()) % 64, ' ');
+        header.push_back('\n');
+
+        std::ofstream npy(m_directory / "radar.npy", std::ios::binary);
+        npy.write(magic, 6);
+        const char version[2] = {static_cast<char>(major_version), 0};
+        npy.write(version, 2);
+        for (size_t i = 0; i < prefix - 8; i++)
+            npy.put(static_cast<char>((header.size() >> (8 * i)) & 0xff));
+        npy << header;
+        for (size_t i = 0; i < num_elements; i++)
+        {
+            const uint16_t sample = recorded_sample(static_cast<uint32_t>(i / frame_size), static_cast<uint32_t>(i % frame_size));
+            npy.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+        }
+    }
+
+    void open()
+    {
+        m_device = ifx_fmcw_create_playback(m_directory.string().c_str());
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        ASSERT_NE(m_device, nullptr);
+    }
+
+    // expect that creating the device fails with the given error
+    void expect_rejected(ifx_Error_t error)
+    {
+        ifx_Device_Fmcw_t* device = ifx_fmcw_create_playback(m_directory.string().c_str());
+        EXPECT_EQ(device, nullptr);
+        EXPECT_EQ(ifx_error_get_and_clear(), error);
+        if (device)
+            ifx_fmcw_destroy(device);
+    }
+
+    // read the next raw frame and return the index of the recorded frame
+    uint32_t next_frame_index()
+    {
+        ifx_Fmcw_Raw_Frame_t* frame = ifx_fmcw_allocate_raw_frame(m_device);
+        ifx_fmcw_get_next_raw_frame_timeout(m_device, frame, timeout_ms);
+        uint32_t index = UINT32_MAX;
+        if (ifx_error_get() == IFX_OK)
+        {
+            index = frame->samples[0] >> 8;
+            for (uint32_t i = 0; i < frame_size; i++)
+                EXPECT_EQ(frame->samples[i], recorded_sample(index, i));
+        }
+        ifx_fmcw_destroy_raw_frame(frame);
+        return index;
+    }
+
+    std::filesystem::path m_directory;
+    ifx_Device_Fmcw_t* m_device = nullptr;
+};
+
+}  // namespace
+
+TEST_F(Playback, ValidHeaders)
+{
+    write_npy(default_header());
+    open();
+    EXPECT_EQ(ifx_fmcw_playback_get_num_frames(m_device), num_frames);
+    ifx_fmcw_destroy(m_device);
+    m_device = nullptr;
+
+    // version 2.0 has a 32 bit header length, the keys may be in any order
+    write_npy("{'shape': (8, 1, 4, 64), 'fortran_order': False, 'descr': '<u2'}", num_frames * frame_size, 2);
+    open();
+    EXPECT_EQ(ifx_fmcw_playback_get_num_frames(m_device), num_frames);
+}
+
+TEST_F(Playback, InvalidHeadersAreRejected)
+{
+    write_npy(default_header(), num_frames * frame_size, 1, "\x93NUMPZ");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy(default_header(), num_frames * frame_size, 4);
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '<f4', 'fortran_order': False, 'shape': (8, 1, 4, 64), }");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '>u2', 'fortran_order': False, 'shape': (8, 1, 4, 64), }");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '<u2', 'fortran_order': True, 'shape': (8, 1, 4, 64), }");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '<u2', 'fortran_order': False, }");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '<u2', 'fortran_order': False, 'shape': [8, 1, 4, 64], }");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '<u2', 'fortran_order': False, 'shape': (8, 1, x, 64), }");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    write_npy("{'descr': '<u2', 'fortran_order': False, 'shape': (8, 1, 4, 64");
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    // less data than the shape says
+    write_npy(default_header(), num_frames * frame_size - 1);
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    // a header length beyond the end of the file
+    {
+        std::ofstream npy(m_directory / "radar.npy", std::ios::binary);
+        npy.write("\x93NUMPY\x01\x00\xff\x7f{}", 12);
+    }
+    expect_rejected(IFX_ERROR_FILE_INVALID);
+
+    std::ofstream(m_directory / "radar.npy", std::ios::binary | std::ios::trunc);
+    expect_rejected(IFX_ERROR_OPENING_FILE);
+}
+
+TEST_F(Playback, ShapeMustMatchConfig)
+{
+    write_npy("{'descr': '<u2', 'fortran_order': False, 'shape': (8, 1, 4, 32), }", num_frames * frame_size);
+    expect_rejected(IFX_ERROR_DIMENSION_MISMATCH);
+
+    write_npy("{'descr': '<u2', 'fortran_order': False, 'shape': (8, 2, 4, 64), }", num_frames * frame_size * 2);
+    expect_rejected(IFX_ERROR_DIMENSION_MISMATCH);
+
+    write_npy("{'descr': '<u2', 'fortran_order': False, 'shape': (8, 256), }", num_frames * frame_size);
+    expect_rejected(IFX_ERROR_DIMENSION_MISMATCH);
+}
+
+TEST_F(Playback, FramesInOrder)
+{
+    write_npy(default_header());
+    open();
+    ifx_fmcw_playback_set_mode(m_device, IFX_FMCW_PLAYBACK_AS_FAST_AS_POSSIBLE, false);
+
+    for (uint32_t i = 0; i < num_frames; i++)
+    {
+        EXPECT_EQ(ifx_fmcw_playback_get_position(m_device), i);
+        EXPECT_EQ(next_frame_index(), i);
+    }
+
+    // without looping the recording ends
+    ifx_Fmcw_Raw_Frame_t* frame = ifx_fmcw_allocate_raw_frame(m_device);
+    ifx_fmcw_get_next_raw_frame_timeout(m_device, frame, timeout_ms);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_END_OF_FILE);
+    ifx_fmcw_destroy_raw_frame(frame);
+}
+
+TEST_F(Playback, SeekAndLoop)
+{
+    write_npy(default_header());
+    open();
+    ifx_fmcw_playback_set_mode(m_device, IFX_FMCW_PLAYBACK_AS_FAST_AS_POSSIBLE, true);
+
+    ifx_fmcw_playback_seek(m_device, 6);
+    EXPECT_EQ(ifx_fmcw_playback_get_position(m_device), 6u);
+    EXPECT_EQ(next_frame_index(), 6u);
+    EXPECT_EQ(next_frame_index(), 7u);
+    EXPECT_EQ(next_frame_index(), 0u);
+    EXPECT_EQ(next_frame_index(), 1u);
+
+    ifx_fmcw_playback_seek(m_device, 3);
+    EXPECT_EQ(next_frame_index(), 3u);
+
+    // an invalid position does not change the position
+    ifx_fmcw_playback_seek(m_device, num_frames);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_INDEX_OUT_OF_BOUNDS);
+    EXPECT_EQ(ifx_fmcw_playback_get_position(m_device), 4u);
+
+    // the frames are served straight from the recording
+    const uint16_t* data = ifx_fmcw_playback_get_frame_data(m_device, 5);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data[0], recorded_sample(5, 0));
+    EXPECT_EQ(data[frame_size - 1], recorded_sample(5, frame_size - 1));
+    EXPECT_EQ(ifx_fmcw_playback_get_frame_data(m_device, num_frames), nullptr);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_INDEX_OUT_OF_BOUNDS);
+    EXPECT_EQ(ifx_fmcw_playback_get_position(m_device), 4u);
+}
+
+TEST_F(Playback, ConvertedFrame)
+{
+    write_npy(default_header());
+    open();
+    ifx_fmcw_playback_set_mode(m_device, IFX_FMCW_PLAYBACK_AS_FAST_AS_POSSIBLE, false);
+    ifx_fmcw_playback_seek(m_device, 2);
+
+    ifx_Fmcw_Frame_t* frame = ifx_fmcw_allocate_frame(m_device);
+    ifx_fmcw_get_next_frame_timeout(m_device, frame, timeout_ms);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ASSERT_EQ(frame->num_cubes, 1u);
+    for (uint32_t chirp = 0; chirp < num_chirps; chirp++)
+    {
+        for (uint32_t sample = 0; sample < num_samples; sample++)
+        {
+            const ifx_Float_t expected = 2.0f * recorded_sample(2, chirp * num_samples + sample) / 4095.0f - 1.0f;
+            EXPECT_NEAR(IFX_MDA_AT(frame->cubes[0], 0, chirp, sample), expected, 1e-6);
+        }
+    }
+    ifx_fmcw_destroy_frame(frame);
+}
+
+TEST_F(Playback, RealTimeMode)
+{
+    write_npy(default_header());
+    open();
+
+    // frames are returned with the frame repetition time of 20 ms
+    ifx_fmcw_playback_set_mode(m_device, IFX_FMCW_PLAYBACK_REAL_TIME, false);
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < 4; i++)
+        EXPECT_EQ(next_frame_index(), i);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(4 * 20));
+
+    // after a restart, a timeout shorter than the frame period expires
+    ifx_fmcw_stop_acquisition(m_device);
+    ifx_Fmcw_Raw_Frame_t* frame = ifx_fmcw_allocate_raw_frame(m_device);
+    ifx_fmcw_get_next_raw_frame_timeout(m_device, frame, 1);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_TIMEOUT);
+    ifx_fmcw_destroy_raw_frame(frame);
+
+    ifx_fmcw_playback_set_mode(m_device, static_cast<ifx_Fmcw_Playback_Mode_t>(2), false);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_ARGUMENT_INVALID);
+}
@@ -0,0 +1,500 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Reads frames from a DeviceLtr11 on a simulated board and compares the
+ * batched readout (ifx_ltr11_get_next_frames and its int16 variant) with
+ * the values decoded directly from the frames, and with the readout of one
+ * frame at a time. */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Complex.h"
+#include "ifxBase/Error.h"
+#include "ifxBase/Matrix.h"
+#include "ifxBase/Vector.h"
+#include "ifxLtr11/DeviceLtr11.h"
+#include "ifxLtr11/DeviceLtr11Impl.hpp"
+
+// strata
+#include <components/interfaces/IPinsLtr11.hpp>
+#include <components/interfaces/IProtocolLtr11.hpp>
+#include <components/interfaces/IRadarLtr11.hpp>
+#include <platform/BoardInstance.hpp>
+#include <platform/bridge/BridgeData.hpp>
+#include <platform/frames/FramePool.hpp>
+#include <platform/interfaces/IBridge.hpp>
+#include <platform/interfaces/IBridgeControl.hpp>
+#include <platform/interfaces/access/IData.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr uint16_t timeout_ms = 1000;
+constexpr uint32_t words_per_sample = 4;  // I, Q, amplitude, detector output
+
+// register map which keeps what was written
+class FakeRegisters : public IRegisters<uint8_t, uint16_t>
+{
+public:
+    uint16_t read(uint8_t address) override
+    {
+        return m_values[address];
+    }
+
+    void read(uint8_t address, uint16_t& value) override
+    {
+        value = m_values[address];
+    }
+
+    void read(uint8_t address, uint8_t count, uint16_t values[]) override
+    {
+        for (uint8_t i = 0; i < count; i++)
+            values[i] = m_values[static_cast<uint8_t>(address + i)];
+    }
+
+    void write(uint8_t address, uint16_t value) override
+    {
+        m_values[address] = value;
+    }
+
+    void write(uint8_t address, uint8_t count, const uint16_t values[]) override
+    {
+        for (uint8_t i = 0; i < count; i++)
+            m_values[static_cast<uint8_t>(address + i)] = values[i];
+    }
+
+    void readBatch(const uint8_t addresses[], uint8_t count, uint16_t values[]) override
+    {
+        for (uint8_t i = 0; i < count; i++)
+            values[i] = m_values[addresses[i]];
+    }
+
+    void writeBatch(const BatchType vals[], uint8_t count, bool /*optimize*/) override
+    {
+        for (uint8_t i = 0; i < count; i++)
+            m_values[vals[i].address] = vals[i].value;
+    }
+
+    void setBits(uint8_t address, uint16_t bitmask) override
+    {
+        m_values[address] |= bitmask;
+    }
+
+    void clearBits(uint8_t address, uint16_t bitmask) override
+    {
+        m_values[address] &= ~bitmask;
+    }
+
+    void modifyBits(uint8_t address, uint16_t clearBitmask, uint16_t setBitmask) override
+    {
+        m_values[address] = (m_values[address] & ~clearBitmask) | setBitmask;
+    }
+
+private:
+    std::map<uint8_t, uint16_t> m_values;
+};
+
+class FakeRadar :
+    public IRadarLtr11,
+    public IPinsLtr11,
+    public IProtocolLtr11
+{
+public:
+    void initialize() override {}
+    void reset(bool /*softReset*/) override {}
+    uint8_t getDataIndex() override { return 0; }
+
+    IRegisters<uint8_t, uint16_t>* getIRegisters() override { return &m_registers; }
+    IPinsLtr11* getIPinsLtr11() override { return this; }
+    IProtocolLtr11* getIProtocolLtr11() override { return this; }
+
+    void setResetPin(bool /*state*/) override {}
+    void reset() override {}
+    uint8_t getDetectionPins() override { return 0; }
+
+    void executeWrite(const Write& /*command*/) override {}
+    void executeRead(const Read& /*command*/, uint16_t& value) override { value = 0; }
+    void setBits(uint8_t /*address*/, uint16_t /*bitMask*/) override {}
+    void executeWriteBatch(const Write /*commands*/[], uint16_t /*count*/) override {}
+    void executeWriteBurst(const WriteBurst& /*command*/, uint16_t /*count*/, const WriteValue /*values*/[]) override {}
+    void executeReadBurst(const ReadBurst& /*command*/, uint16_t /*count*/, uint16_t /*values*/[]) override {}
+    void setMisoArbitration(uint16_t /*prt*/) override {}
+
+private:
+    FakeRegisters m_registers;
+};
+
+class FakeBoard : public IBoard
+{
+public:
+    IModule* getIModule(uint16_t /*type*/, uint8_t /*id*/) override { return nullptr; }
+
+    IComponent* getIComponent(uint16_t type, uint8_t id) override
+    {
+        return (type == IRadarLtr11::getType() && id == 0) ? &m_radar : nullptr;
+    }
+
+    uint8_t getIModuleCount(uint16_t /*type*/) override { return 0; }
+    uint8_t getIComponentCount(uint16_t type) override { return type == IRadarLtr11::getType(); }
+
+private:
+    FakeRadar m_radar;
+};
+
+// delivers the frames given by the test, like the bridge of a board streaming LTR11 data
+class FakeBridgeData : public BridgeData
+{
+public:
+    ~FakeBridgeData() override
+    {
+        // the queued frames belong to the pool, which is destroyed before the base class
+        stopBridgeData();
+    }
+
+    void setFrameBufferSize(uint32_t size) override
+    {
+        m_pool.setFrameBufferSize(size);
+    }
+
+    void startStreaming() override
+    {
+        startBridgeData();
+    }
+
+    void stopStreaming() override
+    {
+        stopBridgeData();
+    }
+
+    void produce(const std::vector<uint16_t>& words, uint64_t timestamp)
+    {
+        auto* frame = m_pool.dequeueFrame();
+        ASSERT_NE(frame, nullptr);
+        frame->setDataSize(static_cast<uint32_t>(words.size() * sizeof(uint16_t)));
+        std::memcpy(frame->getData(), words.data(), words.size() * sizeof(uint16_t));
+        frame->setTimestamp(timestamp);
+        queueFrame(frame);
+    }
+
+protected:
+    void getFramePoolStatistics(uint32_t& count, uint32_t& highWaterMark) const override
+    {
+        m_pool.getStatistics(count, highWaterMark);
+    }
+
+    void resetFramePoolStatistics() override
+    {
+        m_pool.resetStatistics();
+    }
+
+private:
+    void setFramePoolCount(uint16_t count) override
+    {
+        m_pool.setFrameCount(count);
+    }
+
+    FramePool m_pool;
+};
+
+class FakeBridge :
+    public IBridge,
+    public IBridgeControl,
+    public IData
+{
+public:
+    bool isConnected() override { return true; }
+    void openConnection() override {}
+    void closeConnection() override {}
+    IBridgeControl* getIBridgeControl() override { return this; }
+    IBridgeData* getIBridgeData() override { return &m_bridgeData; }
+
+    IVendorCommands* getIVendorCommands() override { return nullptr; }
+    void checkVersion() override {}
+    void getBoardInfo(BoardInfo_t& /*buffer*/) override {}
+    const VersionInfo_t& getVersionInfo() override { return m_versionInfo; }
+    const std::string& getVersionString() override { return m_string; }
+    const std::string& getExtendedVersionString() override { return m_string; }
+    const Uuid_t& getUuid() override { return m_uuid; }
+    const std::string& getUuidString() override { return m_string; }
+    void activateBootloader() override {}
+    void setDefaultTimeout() override {}
+    uint16_t getMaxTransfer() const override { return 0; }
+    IData* getIData() override { return this; }
+    IGpio* getIGpio() override { return nullptr; }
+    II2c* getII2c() override { return nullptr; }
+    ISpi* getISpi() override { return nullptr; }
+    IFlash* getIFlash() override { return nullptr; }
+    IMemory<uint32_t>* getIMemory() override { return nullptr; }
+
+    void configure(uint8_t /*index*/, const IDataProperties_t* /*dataProperties*/, const uint8_t* /*settings*/, uint16_t /*settingsSize*/) override {}
+    void start(uint8_t /*index*/) override {}
+    void stop(uint8_t /*index*/) override {}
+    uint32_t getStatusFlags(uint8_t /*index*/) override { return 0; }
+
+    FakeBridgeData m_bridgeData;
+
+private:
+    VersionInfo_t m_versionInfo = {2, 5, 4};
+    Uuid_t m_uuid = {};
+    std::string m_string;
+};
+
+struct Frame
+{
+    std::vector<uint16_t> words;
+    uint64_t timestamp;
+};
+
+class DeviceLtr11Test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_bridge = std::make_shared<FakeBridge>();
+        auto board = std::make_unique<BoardInstance>(m_bridge, std::make_unique<FakeBoard>(), "LTR11 simulation");
+        m_device = new DeviceLtr11(std::move(board));
+
+        ifx_Ltr11_Config_t config;
+        ifx_ltr11_get_config_defaults(m_device, &config);
+        config.num_samples = num_samples;
+        ifx_ltr11_set_config(m_device, &config);
+        // the bridge only queues frames while streaming
+        ifx_ltr11_start_acquisition(m_device);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        const uint64_t prt_us[] = {250, 500, 1000, 2000};
+        m_threshold = prt_us[config.prt] * num_samples;
+    }
+
+    void TearDown() override
+    {
+        ifx_ltr11_destroy(m_device);
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    // random frames, every third one after a gap like in low power mode
+    std::vector<Frame> make_frames(size_t count)
+    {
+        std::uniform_int_distribution<uint16_t> word(0, UINT16_MAX);
+        std::vector<Frame> frames(count);
+        for (auto& frame : frames)
+        {
+            frame.words.resize(num_samples * words_per_sample);
+            for (auto& w : frame.words)
+                w = word(m_rng);
+
+            const auto gap = (m_produced++ % 3 == 2) ? 10 * m_threshold : m_threshold;
+            m_timestamp += gap;
+            frame.timestamp = m_timestamp;
+        }
+        return frames;
+    }
+
+    void produce(const std::vector<Frame>& frames)
+    {
+        for (const auto& frame : frames)
+            m_bridge->m_bridgeData.produce(frame.words, frame.timestamp);
+    }
+
+    void expect_metadata(const std::vector<Frame>& frames, const ifx_Ltr11_Metadata_t* metadata)
+    {
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            const uint16_t detector = frames[i].words[(num_samples - 1) * words_per_sample + 3];
+            EXPECT_EQ(metadata[i].motion, (detector & 1) != 0) << "frame " << i;
+            EXPECT_EQ(metadata[i].direction, (detector & 2) != 0) << "frame " << i;
+            const bool active = (i == 0 && m_first_frame) || frames[i].timestamp - previous_timestamp(frames, i) < m_threshold + 10;
+            EXPECT_EQ(metadata[i].active, active) << "frame " << i;
+        }
+        m_first_frame = false;
+        m_previous_timestamp = frames.back().timestamp;
+    }
+
+    uint64_t previous_timestamp(const std::vector<Frame>& frames, size_t i) const
+    {
+        return i ? frames[i - 1].timestamp : m_previous_timestamp;
+    }
+
+    static ifx_Complex_t expected_sample(const Frame& frame, uint32_t k)
+    {
+        const auto* iq = &frame.words[k * words_per_sample];
+        const ifx_Float_t scale = 1.0f / (0xFF << 2);
+        return IFX_COMPLEX_DEF((iq[0] & 0x3FC) * scale, (iq[1] & 0x3FC) * scale);
+    }
+
+    static void expect_samples(const std::vector<Frame>& frames, const ifx_Matrix_C_t* matrix)
+    {
+        ASSERT_EQ(IFX_MAT_ROWS(matrix), frames.size());
+        ASSERT_EQ(IFX_MAT_COLS(matrix), num_samples);
+        for (uint32_t i = 0; i < frames.size(); i++)
+        {
+            for (uint32_t k = 0; k < num_samples; k++)
+            {
+                const auto expected = expected_sample(frames[i], k);
+                ASSERT_EQ(IFX_COMPLEX_REAL(IFX_MAT_AT(matrix, i, k)), IFX_COMPLEX_REAL(expected)) << "frame " << i << " sample " << k;
+                ASSERT_EQ(IFX_COMPLEX_IMAG(IFX_MAT_AT(matrix, i, k)), IFX_COMPLEX_IMAG(expected)) << "frame " << i << " sample " << k;
+            }
+        }
+    }
+
+    static constexpr uint16_t num_samples = 64;
+
+    std::shared_ptr<FakeBridge> m_bridge;
+    ifx_Ltr11_Device_t* m_device = nullptr;
+    uint64_t m_threshold = 0;
+    uint64_t m_timestamp = 0;
+    uint32_t m_produced = 0;
+    uint64_t m_previous_timestamp = 0;
+    bool m_first_frame = true;
+    std::mt19937 m_rng {11};
+};
+
+}  // namespace
+
+TEST_F(DeviceLtr11Test, NextFrames)
+{
+    // allocated by the device
+    const auto first = make_frames(5);
+    produce(first);
+    ifx_Ltr11_Metadata_t metadata[5];
+    ifx_Matrix_C_t* frames = ifx_ltr11_get_next_frames(m_device, nullptr, metadata, 5, timeout_ms);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    ASSERT_NE(frames, nullptr);
+    expect_samples(first, frames);
+    expect_metadata(first, metadata);
+
+    // given by the caller
+    const auto second = make_frames(5);
+    produce(second);
+    EXPECT_EQ(ifx_ltr11_get_next_frames(m_device, frames, metadata, 5, timeout_ms), frames);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    expect_samples(second, frames);
+    expect_metadata(second, metadata);
+
+    ifx_mat_destroy_c(frames);
+}
+
+TEST_F(DeviceLtr11Test, NextFramesIntoView)
+{
+    // a view on every other column of a wider matrix takes the strided path
+    const auto input = make_frames(3);
+    produce(input);
+    ifx_Matrix_C_t* wide = ifx_mat_create_c(3, 2 * num_samples);
+    ifx_mat_clear_c(wide);
+    const ifx_mda_slice_t slices[] = {{0, 0, 1}, {0, 2 * num_samples, 2}};
+    ifx_Matrix_C_t view;
+    ifx_mda_view_c(&view, wide, 2, slices);
+    ASSERT_EQ(IFX_MAT_STRIDE(&view, 1), 2u);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    ifx_Ltr11_Metadata_t metadata[3];
+    EXPECT_EQ(ifx_ltr11_get_next_frames(m_device, &view, metadata, 3, timeout_ms), &view);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    expect_samples(input, &view);
+    for (uint32_t i = 0; i < 3; i++)
+        for (uint32_t k = 1; k < 2 * num_samples; k += 2)
+            EXPECT_EQ(IFX_COMPLEX_REAL(IFX_MAT_AT(wide, i, k)), 0) << "frame " << i << " column " << k;
+
+    ifx_mat_destroy_c(wide);
+}
+
+TEST_F(DeviceLtr11Test, NextFramesInt16)
+{
+    const auto input = make_frames(4);
+    produce(input);
+    std::vector<int16_t> samples(4 * num_samples * 2);
+    ifx_Ltr11_Metadata_t metadata[4];
+    ifx_ltr11_get_next_frames_int16(m_device, samples.data(), metadata, 4, timeout_ms);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        for (uint32_t k = 0; k < num_samples; k++)
+        {
+            const auto* iq = &input[i].words[k * words_per_sample];
+            const size_t index = 2 * (i * num_samples + k);
+            ASSERT_EQ(samples[index], (iq[0] & 0x3FC) >> 2) << "frame " << i << " sample " << k;
+            ASSERT_EQ(samples[index + 1], (iq[1] & 0x3FC) >> 2) << "frame " << i << " sample " << k;
+        }
+    }
+    expect_metadata(input, metadata);
+}
+
+TEST_F(DeviceLtr11Test, NextFramesMatchSingleFrames)
+{
+    const auto input = make_frames(6);
+    produce(input);
+    produce(input);
+
+    ifx_Ltr11_Metadata_t metadata[6];
+    ifx_Matrix_C_t* frames = ifx_ltr11_get_next_frames(m_device, nullptr, metadata, 6, timeout_ms);
+    ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+
+    ifx_Vector_C_t* frame = ifx_vec_create_c(num_samples);
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        ifx_Ltr11_Metadata_t single;
+        ifx_ltr11_get_next_frame_timeout(m_device, frame, &single, timeout_ms);
+        ASSERT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        EXPECT_EQ(single.motion, metadata[i].motion);
+        EXPECT_EQ(single.direction, metadata[i].direction);
+        for (uint32_t k = 0; k < num_samples; k++)
+        {
+            ASSERT_EQ(IFX_COMPLEX_REAL(IFX_VEC_AT(frame, k)), IFX_COMPLEX_REAL(IFX_MAT_AT(frames, i, k)));
+            ASSERT_EQ(IFX_COMPLEX_IMAG(IFX_VEC_AT(frame, k)), IFX_COMPLEX_IMAG(IFX_MAT_AT(frames, i, k)));
+        }
+    }
+
+    ifx_vec_destroy_c(frame);
+    ifx_mat_destroy_c(frames);
+}
+
+TEST_F(DeviceLtr11Test, InvalidArguments)
+{
+    ifx_Ltr11_Metadata_t metadata[2];
+    EXPECT_EQ(ifx_ltr11_get_next_frames(m_device, nullptr, metadata, 0, timeout_ms), nullptr);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_ARGUMENT_INVALID);
+
+    EXPECT_EQ(ifx_ltr11_get_next_frames(m_device, nullptr, nullptr, 2, timeout_ms), nullptr);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_ARGUMENT_NULL);
+
+    ifx_Matrix_C_t* frames = ifx_mat_create_c(3, num_samples);
+    EXPECT_EQ(ifx_ltr11_get_next_frames(m_device, frames, metadata, 2, timeout_ms), nullptr);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_DIMENSION_MISMATCH);
+    ifx_mat_destroy_c(frames);
+
+    // without frames the acquisition times out
+    EXPECT_EQ(ifx_ltr11_get_next_frames(m_device, nullptr, metadata, 2, 10), nullptr);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_TIMEOUT);
+}
@@ -0,0 +1,273 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Compares the DeInterleaver, which compiles its frame definition into
+ * gather runs, against the walk over the frame definition it did for every
+ * frame before. The input is added in chunks of random size, so frames are
+ * split at every position and several frames can arrive at once. */
+
+#include <gtest/gtest.h>
+
+#include "ifxBase/Error.h"
+#include "ifxRadar/internal/DeInterleaver.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Frame_Definition = ifx_DeInterleaver_Frame_Definition_t;
+
+size_t popcount(uint32_t mask)
+{
+    size_t count = 0;
+    for (; mask; mask &= mask - 1)
+        count++;
+    return count;
+}
+
+// DeInterleaver::direction_to_antenna_set_shape_samples before the plans
+void reference_direction(const Frame_Definition& definition, const ifx_Float_t* input, bool downwards, std::vector<ifx_Float_t>& out)
+{
+    struct
+    {
+        size_t active_antennas;
+        size_t size_chirp;
+        size_t shape_offset;
+    } indexing[4];
+    size_t size_shape_set = 0;
+    for (size_t i_shape = 0; i_shape < 4; i_shape++)
+    {
+        const auto& shape = definition.shape[i_shape];
+        const auto& cur_chirp = downwards ? shape.down : shape.up;
+        const auto& alt_chirp = downwards ? shape.up : shape.down;
+
+        const size_t ant_cur_chirp = popcount(cur_chirp.rx_mask);
+        const size_t size_cur_chirp = cur_chirp.samples_per_chirp * ant_cur_chirp;
+
+        const size_t ant_alt_chirp = popcount(alt_chirp.rx_mask);
+        const size_t size_alt_chirp = alt_chirp.samples_per_chirp * ant_alt_chirp;
+
+        size_t size_chirp = size_cur_chirp + size_alt_chirp;
+        size_t size_shape = size_chirp * shape.repeat;
+
+        indexing[i_shape].active_antennas = ant_cur_chirp;
+        indexing[i_shape].size_chirp = size_chirp;
+        indexing[i_shape].shape_offset = size_shape_set;
+
+        if (downwards)
+            indexing[i_shape].shape_offset += size_alt_chirp;
+
+        size_shape_set += size_shape;
+    }
+
+    for (size_t i_ant = 0; i_ant < 32; i_ant++)
+    {
+        for (size_t i_shape = 0; i_shape < 4; i_shape++)
+        {
+            for (size_t i_set = 0; i_set < definition.shape_set_repeat; i_set++)
+            {
+                const auto& shape = definition.shape[i_shape];
+                const auto& chirp = downwards ? shape.down : shape.up;
+
+                const size_t antennas = indexing[i_shape].active_antennas;
+                if (i_ant >= antennas)
+                    break;
+
+                for (size_t i_chirp = 0; i_chirp < shape.repeat; i_chirp++)
+                {
+                    const size_t base =
+                        i_ant
+                        + size_shape_set * i_set
+                        + indexing[i_shape].shape_offset
+                        + indexing[i_shape].size_chirp * i_chirp;
+
+                    for (size_t i_sample = 0; i_sample < chirp.samples_per_chirp; i_sample++)
+                        out.push_back(input[base + i_sample * antennas]);
+                }
+            }
+        }
+    }
+}
+
+std::vector<ifx_Float_t> reference_deinterleave(const Frame_Definition& definition, const ifx_Float_t* input)
+{
+    std::vector<ifx_Float_t> out;
+    reference_direction(definition, input, false, out);
+    reference_direction(definition, input, true, out);
+    return out;
+}
+
+uint32_t random_mask(std::mt19937& rng)
+{
+    std::uniform_int_distribution<uint32_t> antennas(0, 5), bit(0, 31);
+    uint32_t mask = 0;
+    for (uint32_t i = antennas(rng); i > 0; i--)
+        mask |= 1u << bit(rng);
+    return mask;
+}
+
+Frame_Definition random_definition(std::mt19937& rng)
+{
+    std::uniform_int_distribution<size_t> samples(0, 24);
+    std::uniform_int_distribution<uint32_t> repeat(0, 4), set_repeat(1, 3), num_shapes(1, 4);
+    Frame_Definition definition {};
+    const uint32_t shapes = num_shapes(rng);
+    for (uint32_t i = 0; i < shapes; i++)
+    {
+        auto& shape = definition.shape[i];
+        shape.up = {samples(rng), random_mask(rng)};
+        if (rng() % 2)
+            shape.down = {samples(rng), random_mask(rng)};
+        shape.repeat = repeat(rng);
+    }
+    definition.shape_set_repeat = set_repeat(rng);
+    return definition;
+}
+
+class DeInterleaverTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_handle = ifx_di_create();
+        ASSERT_NE(m_handle, nullptr);
+    }
+
+    void TearDown() override
+    {
+        ifx_di_destroy(m_handle);
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    }
+
+    // adds num_frames random frames in random chunks and checks every frame
+    void check(const Frame_Definition& definition, size_t num_frames, size_t max_chunk)
+    {
+        ifx_di_set_frame_definition(m_handle, &definition);
+        const size_t frame_size = ifx_di_get_samples_per_frame(m_handle);
+
+        std::uniform_real_distribution<ifx_Float_t> value(-1, 1);
+        std::vector<ifx_Float_t> input(frame_size * num_frames);
+        for (auto& v : input)
+            v = value(m_rng);
+
+        std::uniform_int_distribution<size_t> chunk(1, max_chunk);
+        std::vector<ifx_Float_t> output(frame_size + 1);
+        size_t frames = 0;
+        for (size_t offset = 0; offset < input.size();)
+        {
+            const size_t length = std::min(chunk(m_rng), input.size() - offset);
+            ifx_di_add_input_samples(m_handle, input.data() + offset, length);
+            offset += length;
+
+            while (ifx_di_is_frame_complete(m_handle))
+            {
+                ASSERT_LT(frames, num_frames);
+                const auto expected = reference_deinterleave(definition, input.data() + frames * frame_size);
+                ASSERT_EQ(expected.size(), frame_size);
+
+                // a buffer that is too short receives the beginning of the frame
+                const size_t output_length = (frames % 3 == 2) ? frame_size / 2 : output.size();
+                const size_t written = std::min(output_length, frame_size);
+                std::fill(output.begin(), output.end(), 42.0f);
+                ifx_di_get_frame(m_handle, output.data(), output_length);
+                for (size_t i = 0; i < written; i++)
+                    ASSERT_EQ(output[i], expected[i]) << "frame " << frames << " sample " << i;
+                EXPECT_EQ(output[written], 42.0f);
+                frames++;
+            }
+        }
+        EXPECT_EQ(frames, num_frames);
+    }
+
+    ifx_DeInterleaver_t* m_handle = nullptr;
+    std::mt19937 m_rng {7};
+};
+
+}  // namespace
+
+TEST_F(DeInterleaverTest, SingleShape)
+{
+    Frame_Definition definition {};
+    definition.shape[0].up = {64, 0b111};
+    definition.shape[0].repeat = 32;
+    definition.shape_set_repeat = 1;
+    for (size_t max_chunk : {1, 7, 100, 6144, 100000})
+        check(definition, 4, max_chunk);
+}
+
+TEST_F(DeInterleaverTest, UpAndDownChirps)
+{
+    Frame_Definition definition {};
+    definition.shape[0].up = {32, 0b101};
+    definition.shape[0].down = {16, 0b1};
+    definition.shape[0].repeat = 4;
+    definition.shape[1].up = {8, 0b1111};
+    definition.shape[1].repeat = 2;
+    definition.shape_set_repeat = 3;
+    for (size_t max_chunk : {1, 5, 333, 100000})
+        check(definition, 5, max_chunk);
+}
+
+TEST_F(DeInterleaverTest, RandomDefinitions)
+{
+    std::uniform_int_distribution<size_t> chunk(1, 3000);
+    for (int i = 0; i < 200; i++)
+    {
+        const auto definition = random_definition(m_rng);
+        ifx_di_set_frame_definition(m_handle, &definition);
+        if (ifx_di_get_samples_per_frame(m_handle) == 0)
+            continue;
+        check(definition, 3, chunk(m_rng));
+        if (HasFatalFailure())
+            return;
+    }
+}
+
+TEST_F(DeInterleaverTest, NewDefinitionDropsInput)
+{
+    Frame_Definition definition {};
+    definition.shape[0].up = {16, 0b11};
+    definition.shape[0].repeat = 2;
+    definition.shape_set_repeat = 1;
+    ifx_di_set_frame_definition(m_handle, &definition);
+
+    const std::vector<ifx_Float_t> partial(40, 1.0f);
+    ifx_di_add_input_samples(m_handle, partial.data(), partial.size());
+    EXPECT_FALSE(ifx_di_is_frame_complete(m_handle));
+
+    definition.shape[0].up = {8, 0b1};
+    ifx_di_set_frame_definition(m_handle, &definition);
+    EXPECT_EQ(ifx_di_get_samples_per_frame(m_handle), 16u);
+    EXPECT_FALSE(ifx_di_is_frame_complete(m_handle));
+
+    check(definition, 10, 5);
+}
@@ -0,0 +1,220 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Smoke tests of the processing functions which accept the split complex
+ * layout (IFX_MDA_FLAG_SPLIT_COMPLEX): FFT, 2D MTI and DBF must give the
+ * same results for split and interleaved inputs and outputs. DBF also
+ * accepts mixed layouts, which are converted at its boundary. */
+
+#include <gtest/gtest.h>
+
+#include "ifxAlgo/2DMTI.h"
+#include "ifxAlgo/FFT.h"
+#include "ifxBase/Complex.h"
+#include "ifxBase/Cube.h"
+#include "ifxBase/Error.h"
+#include "ifxBase/Matrix.h"
+#include "ifxBase/Vector.h"
+#include "ifxRadar/DBF.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr ifx_Float_t tolerance = 1e-4f;
+
+// the four combinations of input and output layout
+struct Layouts
+{
+    bool split_input;
+    bool split_output;
+};
+
+ifx_Complex_t get(const ifx_Mda_C_t* mda, uint32_t index)
+{
+    // index into the underlying contiguous array
+    if (IFX_MDA_IS_SPLIT(mda))
+        return IFX_COMPLEX_DEF(IFX_MDA_REAL_DATA(mda)[index], IFX_MDA_IMAG_DATA(mda)[index]);
+    return IFX_MDA_DATA(mda)[index];
+}
+
+void set(ifx_Mda_C_t* mda, uint32_t index, ifx_Complex_t value)
+{
+    if (IFX_MDA_IS_SPLIT(mda))
+    {
+        IFX_MDA_REAL_DATA(mda)[index] = IFX_COMPLEX_REAL(value);
+        IFX_MDA_IMAG_DATA(mda)[index] = IFX_COMPLEX_IMAG(value);
+    }
+    else
+    {
+        IFX_MDA_DATA(mda)[index] = value;
+    }
+}
+
+size_t size(const ifx_Mda_C_t* mda)
+{
+    size_t n = 1;
+    for (uint32_t d = 0; d < IFX_MDA_DIMENSIONS(mda); d++)
+        n *= IFX_MDA_SHAPE(mda)[d];
+    return n;
+}
+
+void fill_random(ifx_Mda_C_t* mda, std::mt19937& rng)
+{
+    std::uniform_real_distribution<ifx_Float_t> dist(-1, 1);
+    for (uint32_t i = 0; i < size(mda); i++)
+        set(mda, i, IFX_COMPLEX_DEF(dist(rng), dist(rng)));
+}
+
+void copy(const ifx_Mda_C_t* from, ifx_Mda_C_t* to)
+{
+    for (uint32_t i = 0; i < size(from); i++)
+        set(to, i, get(from, i));
+}
+
+void expect_equal(const ifx_Mda_C_t* expected, const ifx_Mda_C_t* actual)
+{
+    ASSERT_EQ(size(expected), size(actual));
+    for (uint32_t i = 0; i < size(expected); i++)
+    {
+        EXPECT_NEAR(IFX_COMPLEX_REAL(get(actual, i)), IFX_COMPLEX_REAL(get(expected, i)), tolerance) << "at " << i;
+        EXPECT_NEAR(IFX_COMPLEX_IMAG(get(actual, i)), IFX_COMPLEX_IMAG(get(expected, i)), tolerance) << "at " << i;
+    }
+}
+
+class SplitLayouts : public ::testing::TestWithParam<Layouts>
+{
+};
+
+}  // namespace
+
+TEST_P(SplitLayouts, Fft)
+{
+    constexpr uint32_t fft_size = 64;
+    std::mt19937 rng(27);
+
+    ifx_FFT_t* fft = ifx_fft_create(IFX_FFT_TYPE_C2C, fft_size);
+    ASSERT_NE(fft, nullptr);
+
+    // the input is shorter than the FFT, so it is zero padded
+    ifx_Vector_C_t* input = ifx_vec_create_c(50);
+    ifx_Vector_C_t* expected = ifx_vec_create_c(fft_size);
+    fill_random(input, rng);
+    ifx_fft_run_c(fft, input, expected);
+
+    ifx_Vector_C_t* layout_input = GetParam().split_input ? ifx_vec_create_split_c(50) : ifx_vec_create_c(50);
+    ifx_Vector_C_t* output = GetParam().split_output ? ifx_vec_create_split_c(fft_size) : ifx_vec_create_c(fft_size);
+    copy(input, layout_input);
+    ifx_fft_run_c(fft, layout_input, output);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    expect_equal(expected, output);
+
+    ifx_vec_destroy_c(input);
+    ifx_vec_destroy_c(expected);
+    ifx_vec_destroy_c(layout_input);
+    ifx_vec_destroy_c(output);
+    ifx_fft_destroy(fft);
+}
+
+TEST_P(SplitLayouts, Mti)
+{
+    constexpr uint32_t rows = 5, columns = 19;
+    std::mt19937 rng(35);
+
+    ifx_2DMTI_C_t* reference = ifx_2dmti_create_c(0.25f, rows, columns);
+    ifx_2DMTI_C_t* mti = ifx_2dmti_create_c(0.25f, rows, columns);
+    ifx_Matrix_C_t* input = ifx_mat_create_c(rows, columns);
+    ifx_Matrix_C_t* expected = ifx_mat_create_c(rows, columns);
+    ifx_Matrix_C_t* layout_input = GetParam().split_input ? ifx_mat_create_split_c(rows, columns) : ifx_mat_create_c(rows, columns);
+    ifx_Matrix_C_t* output = GetParam().split_output ? ifx_mat_create_split_c(rows, columns) : ifx_mat_create_c(rows, columns);
+
+    const bool supported = GetParam().split_input == GetParam().split_output;
+    for (int frame = 0; frame < 3; frame++)
+    {
+        fill_random(input, rng);
+        copy(input, layout_input);
+        ifx_2dmti_run_c(reference, input, expected);
+        ifx_2dmti_run_c(mti, layout_input, output);
+        if (!supported)
+        {
+            // mixed layouts are refused
+            EXPECT_EQ(ifx_error_get_and_clear(), IFX_ERROR_NOT_SUPPORTED);
+            break;
+        }
+        EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+        expect_equal(expected, output);
+    }
+
+    ifx_mat_destroy_c(input);
+    ifx_mat_destroy_c(expected);
+    ifx_mat_destroy_c(layout_input);
+    ifx_mat_destroy_c(output);
+    ifx_2dmti_destroy_c(reference);
+    ifx_2dmti_destroy_c(mti);
+}
+
+TEST_P(SplitLayouts, Dbf)
+{
+    constexpr uint32_t samples = 16, chirps = 9, antennas = 3;
+    const ifx_DBF_Config_t config = {11, antennas, -45, 45, 0.5f};
+    std::mt19937 rng(27);
+
+    ifx_DBF_t* dbf = ifx_dbf_create(&config);
+    ASSERT_NE(dbf, nullptr);
+
+    ifx_Cube_C_t* spectrum = ifx_cube_create_c(samples, chirps, antennas);
+    ifx_Cube_C_t* expected = ifx_cube_create_c(samples, chirps, config.num_beams);
+    fill_random(spectrum, rng);
+    ifx_dbf_run_c(dbf, spectrum, expected);
+
+    ifx_Cube_C_t* layout_spectrum = GetParam().split_input ? ifx_cube_create_split_c(samples, chirps, antennas)
+                                                           : ifx_cube_create_c(samples, chirps, antennas);
+    ifx_Cube_C_t* beams = GetParam().split_output ? ifx_cube_create_split_c(samples, chirps, config.num_beams)
+                                                  : ifx_cube_create_c(samples, chirps, config.num_beams);
+    copy(spectrum, layout_spectrum);
+    ifx_dbf_run_c(dbf, layout_spectrum, beams);
+    EXPECT_EQ(ifx_error_get_and_clear(), IFX_OK);
+    expect_equal(expected, beams);
+
+    ifx_cube_destroy_c(spectrum);
+    ifx_cube_destroy_c(expected);
+    ifx_cube_destroy_c(layout_spectrum);
+    ifx_cube_destroy_c(beams);
+    ifx_dbf_destroy(dbf);
+}
+
+INSTANTIATE_TEST_SUITE_P(Layouts, SplitLayouts,
+                         ::testing::Values(Layouts {false, false}, Layouts {false, true},
+                                           Layouts {true, false}, Layouts {true, true}),
+                         [](const ::testing::TestParamInfo<Layouts>& info) {
+                             return std::string(info.param.split_input ? "Split" : "Interleaved") + "To"
+                                    + (info.param.split_output ? "Split" : "Interleaved");
+                         });
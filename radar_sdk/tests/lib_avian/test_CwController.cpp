@@ -0,0 +1,266 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Tests of the capture session of the Continuous_Wave_Controller. The device
+ * is replaced by a port that answers the status reads, and fills the buffer
+ * of the data reader with a known pattern of packed 12 bit values each time
+ * an acquisition is triggered. */
+
+#include <gtest/gtest.h>
+
+#include "ifxAvian_CwController.hpp"
+#include "ifxAvian_IPort.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace Infineon::Avian;
+
+namespace {
+
+// The MAIN register and its bits are the same in all Avian devices.
+constexpr uint8_t main_address = 0x00;
+constexpr HW::Spi_Command_t frame_start_bit = 0x000001;
+constexpr HW::Spi_Command_t write_bit = 0x01000000;
+
+// STAT0 of a BGT60TR13C, the power mode field PM is 1 in active state
+constexpr uint8_t stat0_address = 0x5D;
+constexpr HW::Spi_Response_t stat0_active = 1 << 5;
+
+uint8_t get_address(HW::Spi_Command_t command)
+{
+    return uint8_t(command >> 25);
+}
+
+// the raw ADC value of the given word of the given acquisition
+uint16_t raw_value(size_t acquisition, size_t word)
+{
+    return uint16_t((acquisition * 97 + word * 13) % 4096);
+}
+
+class CapturePort : public HW::IPort<HW::Packed_Raw_Data_t>
+{
+public:
+    void send_commands(const HW::Spi_Command_t* commands, size_t num_words,
+                       HW::Spi_Response_t* response = nullptr) override
+    {
+        for (size_t i = 0; i < num_words; i++)
+        {
+            const auto command = commands[i];
+            if (response)
+                response[i] = (get_address(command) == stat0_address) ? stat0_active : 0;
+
+            const bool trigger = (get_address(command) == main_address)
+                                 && (command & write_bit) && (command & frame_start_bit);
+            if (trigger && m_buffer && respond)
+                deliver();
+        }
+    }
+
+    void generate_reset_sequence() override
+    {
+        ++num_resets;
+    }
+
+    bool read_irq_level() override
+    {
+        return false;
+    }
+
+    const Properties& get_properties() const override
+    {
+        return m_properties;
+    }
+
+    void start_reader(HW::Spi_Command_t /*burst_command*/, size_t burst_size,
+                      Data_Ready_Callback_t callback) override
+    {
+        ++num_reader_starts;
+        m_burst_size = burst_size;
+        m_callback = callback;
+    }
+
+    void stop_reader() override
+    {
+        m_callback = nullptr;
+        m_buffer = nullptr;
+    }
+
+    void set_buffer(HW::Packed_Raw_Data_t* buffer) override
+    {
+        m_buffer = buffer;
+    }
+
+    size_t num_acquisitions = 0;
+    size_t num_reader_starts = 0;
+    size_t num_resets = 0;
+    bool respond = true;
+
+private:
+    // packs the pattern of the next acquisition into the buffer, like the burst read of a device
+    void deliver()
+    {
+        auto* packed = m_buffer;
+        for (size_t word = 0; word < m_burst_size; word += 2)
+        {
+            const uint16_t first = raw_value(num_acquisitions, word);
+            const uint16_t second = raw_value(num_acquisitions, word + 1);
+            *packed++ = uint8_t(first >> 4);
+            *packed++ = uint8_t(((first & 0x0F) << 4) | (second >> 8));
+            *packed++ = uint8_t(second);
+        }
+        ++num_acquisitions;
+        m_buffer = nullptr;
+        m_callback(0);
+    }
+
+    Properties m_properties = {"Avian", false, 2};
+    HW::Packed_Raw_Data_t* m_buffer = nullptr;
+    size_t m_burst_size = 0;
+    Data_Ready_Callback_t m_callback;
+};
+
+class CwControllerCapture : public ::testing::Test
+{
+protected:
+    CwControllerCapture() :
+        m_driver(m_port, Device_Type::BGT60TR13C),
+        m_controller(m_port, m_driver)
+    {
+        m_controller.enable_rx_antenna(0, true);
+        m_controller.enable_rx_antenna(2, true);
+        m_controller.set_number_of_samples(num_samples);
+        m_controller.enable_continuous_wave(true);
+    }
+
+    // checks the signals of one capture, written to signals with the given row stride
+    void expect_capture(const float* signals, size_t row_stride, size_t acquisition, unsigned samples = num_samples)
+    {
+        for (size_t antenna = 0; antenna < num_antennas; antenna++)
+        {
+            for (size_t sample = 0; sample < samples; sample++)
+            {
+                const float expected = raw_value(acquisition, sample * num_antennas + antenna) * (2.f / 4095.f) - 1.f;
+                ASSERT_FLOAT_EQ(signals[antenna * row_stride + sample], expected)
+                    << "acquisition " << acquisition << " antenna " << antenna << " sample " << sample;
+            }
+        }
+    }
+
+    static constexpr unsigned num_samples = 128;
+    static constexpr size_t num_antennas = 2;
+
+    CapturePort m_port;
+    Driver m_driver;
+    Continuous_Wave_Controller m_controller;
+};
+
+}  // namespace
+
+TEST_F(CwControllerCapture, CaptureToMap)
+{
+    const auto signals = m_controller.capture_rx_signals();
+    ASSERT_EQ(signals.size(), num_antennas);
+    ASSERT_EQ(signals.count(0), 1u);
+    ASSERT_EQ(signals.count(2), 1u);
+
+    std::vector<float> block(signals.at(0));
+    block.insert(block.end(), signals.at(2).begin(), signals.at(2).end());
+    ASSERT_EQ(block.size(), num_antennas * num_samples);
+    expect_capture(block.data(), num_samples, 0);
+}
+
+TEST_F(CwControllerCapture, BackToBackCaptures)
+{
+    // rows are padded, the padding is not written
+    constexpr size_t row_stride = num_samples + 3;
+    constexpr unsigned num_captures = 5;
+    std::vector<float> signals(num_captures * num_antennas * row_stride, 42.f);
+    m_controller.capture_rx_signals(signals.data(), row_stride, num_captures);
+    EXPECT_EQ(m_port.num_acquisitions, num_captures);
+
+    for (unsigned capture = 0; capture < num_captures; capture++)
+    {
+        const float* capture_signals = signals.data() + capture * num_antennas * row_stride;
+        expect_capture(capture_signals, row_stride, capture);
+        for (size_t antenna = 0; antenna < num_antennas; antenna++)
+            for (size_t i = num_samples; i < row_stride; i++)
+                EXPECT_EQ(capture_signals[antenna * row_stride + i], 42.f);
+    }
+}
+
+TEST_F(CwControllerCapture, SessionIsKeptBetweenCaptures)
+{
+    std::vector<float> signals(num_antennas * num_samples);
+    for (size_t acquisition = 0; acquisition < 3; acquisition++)
+    {
+        m_controller.capture_rx_signals(signals.data(), num_samples);
+        expect_capture(signals.data(), num_samples, acquisition);
+    }
+    EXPECT_EQ(m_port.num_reader_starts, 1u);
+
+    // a new configuration ends the session, the next capture starts a new one
+    constexpr unsigned fewer_samples = 32;
+    m_controller.set_number_of_samples(fewer_samples);
+    ASSERT_EQ(m_controller.get_number_of_samples(), fewer_samples);
+    m_controller.capture_rx_signals(signals.data(), fewer_samples, 2);
+    EXPECT_EQ(m_port.num_reader_starts, 2u);
+    expect_capture(signals.data(), fewer_samples, 3, fewer_samples);
+    expect_capture(signals.data() + num_antennas * fewer_samples, fewer_samples, 4, fewer_samples);
+}
+
+TEST_F(CwControllerCapture, InvalidCaptures)
+{
+    std::vector<float> signals(num_antennas * num_samples);
+    EXPECT_THROW(m_controller.capture_rx_signals(signals.data(), num_samples - 1), std::runtime_error);
+
+    m_controller.capture_rx_signals(signals.data(), num_samples, 0);
+    EXPECT_EQ(m_port.num_acquisitions, 0u);
+
+    m_controller.enable_continuous_wave(false);
+    EXPECT_THROW(m_controller.capture_rx_signals(signals.data(), num_samples), std::runtime_error);
+    EXPECT_EQ(m_port.num_acquisitions, 0u);
+}
+
+TEST_F(CwControllerCapture, MissingDataEndsContinuousWave)
+{
+    std::vector<float> signals(num_antennas * num_samples);
+    m_port.respond = false;
+    const auto resets = m_port.num_resets;
+    EXPECT_THROW(m_controller.capture_rx_signals(signals.data(), num_samples), std::runtime_error);
+    EXPECT_FALSE(m_controller.is_continuous_wave_enabled());
+    EXPECT_GT(m_port.num_resets, resets);
+
+    // after enabling continuous wave again, capturing works again
+    m_port.respond = true;
+    m_controller.enable_continuous_wave(true);
+    m_controller.capture_rx_signals(signals.data(), num_samples);
+    expect_capture(signals.data(), num_samples, 0);
+}
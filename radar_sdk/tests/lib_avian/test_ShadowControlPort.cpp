@@ -0,0 +1,244 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Tests of the register shadow of lib_avian (ShadowControlPort). The device is
+ * replaced by a DummyPort, which additionally records the command stream, so
+ * the tests can check which registers are written when switching between
+ * configurations. */
+
+#include <gtest/gtest.h>
+
+#include "ifxAvian_Driver.hpp"
+#include "ifxAvian_RegisterSet.hpp"
+#include "ports/ifxAvian_DummyPort.hpp"
+#include "ports/ifxAvian_ShadowControlPort.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Infineon::Avian;
+
+namespace {
+
+// The MAIN register and its bits are the same in all Avian devices.
+constexpr uint8_t main_address = 0x00;
+constexpr HW::Spi_Command_t frame_start_bit = 0x000001;
+constexpr HW::Spi_Command_t sw_reset_bit = 0x000002;
+constexpr HW::Spi_Command_t write_bit = 0x01000000;
+
+constexpr uint32_t num_preset_switches = 1000;
+
+uint8_t get_address(HW::Spi_Command_t command)
+{
+    return uint8_t(command >> 25);
+}
+
+// A DummyPort that records all commands and resets, and can fail on request.
+class RecordingPort : public DummyPort
+{
+public:
+    void send_commands(const HW::Spi_Command_t* commands, size_t num_words,
+                       HW::Spi_Response_t* response = nullptr) override
+    {
+        if (fail_next)
+        {
+            fail_next = false;
+            throw std::runtime_error("transfer failed");
+        }
+        ++num_calls;
+        stream.insert(stream.end(), commands, commands + num_words);
+        DummyPort::send_commands(commands, num_words, response);
+    }
+
+    void generate_reset_sequence() override
+    {
+        ++num_resets;
+        DummyPort::generate_reset_sequence();
+    }
+
+    void clear()
+    {
+        stream.clear();
+        num_calls = 0;
+    }
+
+    std::vector<HW::Spi_Command_t> stream;
+    size_t num_calls = 0;
+    size_t num_resets = 0;
+    bool fail_next = false;
+};
+
+// The configuration of a BGT60TR13C with the given ADC sample rate.
+HW::RegisterSet make_configuration(DummyPort& port, uint32_t samplerate_Hz)
+{
+    Driver driver(port, Device_Type::BGT60TR13C);
+    EXPECT_EQ(driver.set_adc_samplerate(samplerate_Hz), Driver::Error::OK);
+    return driver.get_device_configuration();
+}
+
+// The addresses of all registers defined in to with a different value in from.
+std::set<uint8_t> get_changed_registers(const HW::RegisterSet& from, const HW::RegisterSet& to)
+{
+    std::set<uint8_t> addresses;
+    for (auto command : to.extract_update(from).get_configuration_sequence(false))
+        addresses.insert(get_address(command));
+    return addresses;
+}
+
+class ShadowControlPortDummy : public ::testing::Test
+{
+protected:
+    ShadowControlPortDummy()
+    {
+        auto recorder = std::make_unique<RecordingPort>();
+        m_recorder = recorder.get();
+        m_shadow = std::make_unique<ShadowControlPort>(std::move(recorder));
+
+        m_preset_a = make_configuration(*m_recorder, 1000000);
+        m_preset_b = make_configuration(*m_recorder, 2000000);
+        m_recorder->clear();
+    }
+
+    RecordingPort* m_recorder;
+    std::unique_ptr<ShadowControlPort> m_shadow;
+    HW::RegisterSet m_preset_a;
+    HW::RegisterSet m_preset_b;
+};
+
+}  // namespace
+
+TEST_F(ShadowControlPortDummy, FirstProgramWritesAllRegisters)
+{
+    const auto full_sequence = m_preset_a.get_configuration_sequence(true);
+
+    EXPECT_EQ(m_shadow->program(m_preset_a, true), full_sequence.size());
+    EXPECT_EQ(m_recorder->stream, full_sequence);
+    EXPECT_EQ(m_recorder->num_calls, 1u);
+}
+
+TEST_F(ShadowControlPortDummy, UnchangedConfigurationOnlyTriggers)
+{
+    m_shadow->program(m_preset_a, true);
+    m_recorder->clear();
+
+    // only the MAIN register is written again to set FRAME_START
+    EXPECT_EQ(m_shadow->program(m_preset_a, true), 1u);
+    ASSERT_EQ(m_recorder->stream.size(), 1u);
+    EXPECT_EQ(get_address(m_recorder->stream[0]), main_address);
+    EXPECT_TRUE(m_recorder->stream[0] & frame_start_bit);
+
+    // without trigger nothing needs to be sent at all
+    m_recorder->clear();
+    EXPECT_EQ(m_shadow->program(m_preset_a, false), 0u);
+    EXPECT_EQ(m_recorder->num_calls, 0u);
+}
+
+TEST_F(ShadowControlPortDummy, OnlyChangedRegistersAreWritten)
+{
+    m_shadow->program(m_preset_a, false);
+    m_recorder->clear();
+
+    const auto changed = get_changed_registers(m_preset_a, m_preset_b);
+    ASSERT_FALSE(changed.empty());
+    ASSERT_LT(changed.size(), m_preset_b.get_configuration_sequence(false).size());
+
+    EXPECT_EQ(m_shadow->program(m_preset_b, false), changed.size());
+    EXPECT_EQ(m_recorder->num_calls, 1u);
+
+    std::set<uint8_t> written;
+    for (auto command : m_recorder->stream)
+    {
+        EXPECT_TRUE(command & write_bit);
+        EXPECT_EQ(command & 0x00FFFFFF, m_preset_b[get_address(command)]);
+        written.insert(get_address(command));
+    }
+    EXPECT_EQ(written, changed);
+
+    // the shadow now mirrors the new configuration
+    EXPECT_TRUE(m_preset_b.extract_update(m_shadow->get_device_registers()).get_configuration_sequence(false).empty());
+}
+
+TEST_F(ShadowControlPortDummy, ResetInvalidatesShadow)
+{
+    const auto full_size = m_preset_a.get_configuration_sequence(false).size();
+
+    m_shadow->program(m_preset_a, false);
+    m_shadow->generate_reset_sequence();
+    EXPECT_EQ(m_recorder->num_resets, 1u);
+    EXPECT_EQ(m_shadow->program(m_preset_a, false), full_size);
+
+    // a soft reset through the MAIN register has the same effect
+    const HW::Spi_Command_t soft_reset = (HW::Spi_Command_t(main_address) << 25) | write_bit | sw_reset_bit;
+    m_shadow->send_commands(&soft_reset, 1);
+    EXPECT_FALSE(m_shadow->get_device_registers().is_defined(main_address));
+    EXPECT_EQ(m_shadow->program(m_preset_a, false), full_size);
+}
+
+TEST_F(ShadowControlPortDummy, FailedTransferInvalidatesShadow)
+{
+    const auto full_size = m_preset_a.get_configuration_sequence(false).size();
+
+    m_shadow->program(m_preset_a, false);
+    m_recorder->fail_next = true;
+    EXPECT_THROW(m_shadow->program(m_preset_b, false), std::runtime_error);
+
+    // it is unknown which registers reached the device, so everything is sent again
+    EXPECT_EQ(m_shadow->program(m_preset_a, false), full_size);
+}
+
+TEST_F(ShadowControlPortDummy, PresetSwitchCost)
+{
+    const auto full_size = m_preset_a.get_configuration_sequence(true).size();
+    const auto switch_size = get_changed_registers(m_preset_a, m_preset_b).size() + 1;
+
+    m_shadow->program(m_preset_a, true);
+    m_recorder->clear();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < num_preset_switches; ++i)
+    {
+        const auto& preset = (i % 2) ? m_preset_a : m_preset_b;
+        ASSERT_EQ(m_shadow->program(preset, true), switch_size);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // every switch is a single transfer of the changed registers and the trigger
+    EXPECT_EQ(m_recorder->num_calls, num_preset_switches);
+    EXPECT_EQ(m_recorder->stream.size(), num_preset_switches * switch_size);
+
+    const auto switch_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / num_preset_switches;
+    RecordProperty("full_configuration_words", std::to_string(full_size));
+    RecordProperty("preset_switch_words", std::to_string(switch_size));
+    RecordProperty("preset_switch_time_ns", std::to_string(switch_time_ns));
+}
@@ -0,0 +1,186 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/* Tests of the timing model cache: StateSequence::create and
+ * StateSequence::createBatch must return the same models as constructing a
+ * StateSequence directly, whether the configurations are cached or not. */
+
+#include <gtest/gtest.h>
+
+#include "ifxAvian_Driver.hpp"
+#include "ifxAvian_RegisterSet.hpp"
+#include "ifxAvian_TimingModel.hpp"
+#include "ports/ifxAvian_DummyPort.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Infineon::Avian;
+using TimingModel::StateSequence;
+
+namespace {
+
+constexpr Device_Type all_device_types[] = {
+    Device_Type::BGT60TR13C,
+    Device_Type::BGT60ATR24C,
+    Device_Type::BGT60UTR13DAIP,
+    Device_Type::BGT60TR12E,
+    Device_Type::BGT60UTR11AIP,
+    Device_Type::BGT120UTR13E,
+    Device_Type::BGT24LTR24,
+    Device_Type::BGT120UTR24,
+    Device_Type::BGT60ATR24EAIP,
+    Device_Type::BGT24LTR13E,
+};
+
+// enough distinct configurations for createBatch to use more than one thread
+constexpr uint32_t num_configurations = 12;
+
+// Configurations of the device that differ in the ADC sample rate, which
+// changes the duration of the chirps.
+std::vector<HW::RegisterSet> make_configurations(Device_Type device_type)
+{
+    DummyPort port;
+    Driver driver(port, device_type);
+
+    std::vector<HW::RegisterSet> configurations;
+    for (uint32_t i = 0; i < num_configurations; ++i)
+    {
+        EXPECT_EQ(driver.set_adc_samplerate(500000 + i * 100000), Driver::Error::OK);
+        configurations.push_back(driver.get_device_configuration());
+    }
+    return configurations;
+}
+
+void expect_same_model(const StateSequence& actual, const StateSequence& expected)
+{
+    EXPECT_EQ(actual.getNumStates(), expected.getNumStates());
+    EXPECT_EQ(actual.getTotalTimeRange(), expected.getTotalTimeRange());
+    EXPECT_EQ(actual.getTotalFrequencyRange(), expected.getTotalFrequencyRange());
+    EXPECT_EQ(actual.getChirpToChirpTime(0), expected.getChirpToChirpTime(0));
+    EXPECT_EQ(actual.getSetToSetTime(), expected.getSetToSetTime());
+    EXPECT_EQ(actual.getFrameDuration(), expected.getFrameDuration());
+    EXPECT_EQ(actual.getFrameActiveDuration(), expected.getFrameActiveDuration());
+    EXPECT_EQ(actual.getFrameAveragePowerConsumption(), expected.getFrameAveragePowerConsumption());
+}
+
+class StateSequenceCache : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        StateSequence::clearCache();
+    }
+
+    void TearDown() override
+    {
+        StateSequence::clearCache();
+    }
+};
+
+}  // namespace
+
+TEST_F(StateSequenceCache, BatchMatchesConstruction)
+{
+    for (auto device_type : all_device_types)
+    {
+        SCOPED_TRACE(int(device_type));
+        StateSequence::clearCache();
+
+        const auto configurations = make_configurations(device_type);
+        const auto batch = StateSequence::createBatch(configurations, device_type);
+        ASSERT_EQ(batch.size(), configurations.size());
+
+        for (size_t i = 0; i < configurations.size(); ++i)
+        {
+            ASSERT_NE(batch[i], nullptr);
+            expect_same_model(*batch[i], StateSequence(configurations[i], device_type));
+
+            // the batch has filled the cache
+            EXPECT_EQ(StateSequence::create(configurations[i], device_type), batch[i]);
+        }
+
+        // the configurations differ in timing, so each one needs its own model
+        EXPECT_NE(batch.front()->getFrameDuration(), batch.back()->getFrameDuration());
+    }
+}
+
+TEST_F(StateSequenceCache, CreateMatchesBatch)
+{
+    for (auto device_type : all_device_types)
+    {
+        SCOPED_TRACE(int(device_type));
+        StateSequence::clearCache();
+
+        const auto configurations = make_configurations(device_type);
+        std::vector<std::shared_ptr<const StateSequence>> models;
+        for (const auto& registers : configurations)
+        {
+            models.push_back(StateSequence::create(registers, device_type));
+            expect_same_model(*models.back(), StateSequence(registers, device_type));
+        }
+
+        // now all configurations are cached
+        EXPECT_EQ(StateSequence::createBatch(configurations, device_type), models);
+    }
+}
+
+TEST_F(StateSequenceCache, PartiallyCachedBatch)
+{
+    const auto device_type = Device_Type::BGT60TR13C;
+    const auto configurations = make_configurations(device_type);
+
+    const auto cached = StateSequence::create(configurations[3], device_type);
+
+    // duplicates are only simulated once and share their model
+    auto candidates = configurations;
+    candidates.insert(candidates.end(), configurations.begin(), configurations.end());
+    const auto batch = StateSequence::createBatch(candidates, device_type);
+    ASSERT_EQ(batch.size(), candidates.size());
+
+    EXPECT_EQ(batch[3], cached);
+    for (size_t i = 0; i < configurations.size(); ++i)
+    {
+        EXPECT_EQ(batch[i], batch[i + configurations.size()]);
+        expect_same_model(*batch[i], StateSequence(configurations[i], device_type));
+    }
+}
+
+TEST_F(StateSequenceCache, ReferenceFrequencyIsPartOfTheKey)
+{
+    const auto device_type = Device_Type::BGT60TR13C;
+    const auto registers = make_configurations(device_type).front();
+
+    const auto model_80 = StateSequence::create(registers, device_type, 80.0e6);
+    const auto model_76 = StateSequence::create(registers, device_type, 76.8e6);
+    EXPECT_NE(model_80, model_76);
+    expect_same_model(*model_76, StateSequence(registers, device_type, 76.8e6));
+    EXPECT_EQ(StateSequence::createBatch({registers}, device_type, 76.8e6).front(), model_76);
+}
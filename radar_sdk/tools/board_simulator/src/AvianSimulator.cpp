@@ -0,0 +1,404 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file AvianSimulator.cpp
+ *
+ * @brief Register level model of a BGT60TR13C radar sensor.
+ */
+
+#include "AvianSimulator.hpp"
+
+#include <ifxAvian_DeviceTraits.hpp>
+#include <ifxAvian_ParameterExtractor.hpp>
+#include <ifxAvian_RegisterSet.hpp>
+#include <ifxAvian_TimingModel.hpp>
+#include <ifxAvian_Types.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <iostream>
+#include <map>
+
+
+using namespace Infineon::Avian;
+
+namespace {
+
+constexpr Device_Type device_type = Device_Type::BGT60TR13C;
+constexpr double reference_clock = 80.0e6;
+
+// registers of the BGT60TRxxC family with a function in the simulation
+constexpr uint8_t reg_main = 0x00;
+constexpr uint8_t reg_chip_id = 0x02;
+constexpr uint8_t reg_stat1 = 0x03;
+constexpr uint8_t reg_sfctl = 0x06;
+constexpr uint8_t reg_sadc_ctrl = 0x07;
+constexpr uint8_t reg_stat0 = 0x5D;
+constexpr uint8_t reg_sadc_result = 0x5E;
+constexpr uint8_t reg_fstat = 0x5F;
+
+constexpr uint32_t chip_id_bgt60tr13c = 0x000303;  // DIGITAL_ID = 3, RF_ID = 3
+
+constexpr uint32_t main_frame_start = 1u << 0;
+constexpr uint32_t main_sw_reset = 1u << 1;
+constexpr uint32_t main_fsm_reset = 1u << 2;
+constexpr uint32_t main_fifo_reset = 1u << 3;
+constexpr uint32_t main_self_clearing = main_frame_start | main_sw_reset | main_fsm_reset | main_fifo_reset;
+
+constexpr uint32_t stat0_ready = 0x00000F;  // SADC_RDY, MADC_RDY, MADC_BGUP, LDO_RDY
+
+constexpr uint32_t sfctl_fifo_cref_msk = 0x001FFF;
+
+constexpr uint32_t sadc_ctrl_chsel_msk = 0x00000F;
+constexpr uint32_t sadc_ctrl_start = 1u << 4;
+
+constexpr uint32_t fstat_fill_status_msk = 0x003FFF;
+constexpr uint32_t fstat_empty = 1u << 20;
+constexpr uint32_t fstat_cref = 1u << 21;
+constexpr uint32_t fstat_full = 1u << 22;
+constexpr uint32_t fstat_fof_err = 1u << 23;
+
+constexpr uint32_t gsr0_fou_err = 1u << 27;
+
+constexpr uint32_t stat1_frame_cnt_pos = 12;
+constexpr uint32_t stat1_frame_cnt_msk = 0xFFF000;
+
+// SADC conversion of the temperature sensor, see ifxAvian_SensorMeter.cpp
+constexpr float sadc_ref_voltage = 1.21f;
+constexpr float temperature_sensor_offset = 0.78984f;
+constexpr float temperature_sensor_slope = 0.00286f;
+constexpr float temperature = 25.f;
+
+// when the registers describe no valid frame, frames are still generated with this repetition time
+constexpr double fallback_frame_period = 0.1;
+
+// two 12 bit samples fit into one 24 bit FIFO word
+uint32_t get_fifo_capacity()
+{
+    return Device_Traits::get(device_type).fifo_size * 2u;
+}
+
+}  // namespace
+
+AvianSimulator::AvianSimulator(std::unique_ptr<SampleSource> source) :
+    m_source {std::move(source)}
+{
+    reset_registers();
+}
+
+uint32_t AvianSimulator::execute(uint32_t command)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto address = static_cast<uint8_t>(command >> 25);
+    const bool write = (command >> 24) & 1;
+    const uint32_t gsr0 = m_fifo_overflow ? gsr0_fou_err : 0;
+
+    return gsr0 | access(address, write, command & 0xFFFFFF);
+}
+
+uint32_t AvianSimulator::read_register(uint8_t address)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return access(address, false, 0);
+}
+
+void AvianSimulator::write_register(uint8_t address, uint32_t value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    access(address, true, value & 0xFFFFFF);
+}
+
+void AvianSimulator::set_bits(uint8_t address, uint32_t mask)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const uint32_t value = access(address, false, 0);
+    access(address, true, (value | mask) & 0xFFFFFF);
+}
+
+void AvianSimulator::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    reset_registers();
+}
+
+bool AvianSimulator::get_irq_level()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (get_fifo_status() & fstat_cref) != 0;
+}
+
+AvianSimulator::Clock::time_point AvianSimulator::update(Clock::time_point now)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    while (m_running && (m_next_frame <= now))
+    {
+        // Frames are written as a whole, so the readout has to drain the FIFO
+        // before the next frame is due, otherwise it counts as overflow.
+        if (m_fifo.size() - m_fifo_head >= get_fifo_capacity())
+        {
+            m_fifo_overflow = true;
+            m_overflow_event = true;
+            stop_frames();
+            break;
+        }
+
+        generate_frame();
+        m_next_frame += m_frame_period;
+
+        if (m_max_frames && (m_frame_count >= m_max_frames))
+            stop_frames();
+    }
+
+    return m_running ? m_next_frame : Clock::time_point::max();
+}
+
+bool AvianSimulator::read_fifo(size_t count, uint16_t* samples)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_fifo.size() - m_fifo_head < count)
+        return false;
+
+    const auto begin = m_fifo.begin() + m_fifo_head;
+    std::copy(begin, begin + count, samples);
+    m_fifo_head += count;
+
+    // the consumed samples are removed once they make up half of the buffer
+    if (m_fifo_head * 2 >= m_fifo.size())
+    {
+        m_fifo.erase(m_fifo.begin(), m_fifo.begin() + m_fifo_head);
+        m_fifo_head = 0;
+    }
+    return true;
+}
+
+bool AvianSimulator::check_overflow()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const bool overflow = m_overflow_event;
+    m_overflow_event = false;
+    return overflow;
+}
+
+uint32_t AvianSimulator::access(uint8_t address, bool write, uint32_t value)
+{
+    // the burst address of the FIFO and unused addresses read as 0
+    if (address >= num_registers)
+        return 0;
+
+    m_registers[reg_stat1] = (m_frame_count << stat1_frame_cnt_pos) & stat1_frame_cnt_msk;
+    m_registers[reg_fstat] = get_fifo_status();
+
+    const uint32_t previous = m_registers[address];
+    if (!write)
+        return previous;
+
+    switch (address)
+    {
+        case reg_chip_id:
+        case reg_stat1:
+        case reg_stat0:
+        case reg_sadc_result:
+        case reg_fstat:
+            // read only
+            break;
+
+        case reg_main:
+            m_registers[address] = value & ~main_self_clearing;
+            if (value & main_sw_reset)
+            {
+                reset_registers();
+                break;
+            }
+            if (value & main_fsm_reset)
+            {
+                stop_frames();
+            }
+            if (value & main_fifo_reset)
+            {
+                m_fifo.clear();
+                m_fifo_head = 0;
+                m_fifo_overflow = false;
+            }
+            if ((value & main_frame_start) && !m_running)
+            {
+                start_frames();
+            }
+            break;
+
+        case reg_sadc_ctrl:
+            m_registers[address] = value & ~sadc_ctrl_start;
+            if (value & sadc_ctrl_start)
+                measure_sadc(value);
+            break;
+
+        default:
+            m_registers[address] = value;
+            break;
+    }
+
+    return previous;
+}
+
+void AvianSimulator::reset_registers()
+{
+    stop_frames();
+    m_fifo.clear();
+    m_fifo_head = 0;
+    m_fifo_overflow = false;
+    m_frame_count = 0;
+
+    m_registers.fill(0);
+    m_registers[reg_chip_id] = chip_id_bgt60tr13c;
+    m_registers[reg_stat0] = stat0_ready;
+}
+
+void AvianSimulator::start_frames()
+{
+    std::map<uint8_t, uint32_t> registers;
+    HW::RegisterSet register_set;
+    for (uint8_t address = 0; address < num_registers; address++)
+    {
+        registers.emplace(address, m_registers[address]);
+        register_set.set(address, m_registers[address]);
+    }
+
+    try
+    {
+        Parameter_Extractor extractor(registers, device_type);
+        const auto definition = extractor.get_frame_definition();
+
+        for (uint8_t shape = 0; shape < 4; shape++)
+        {
+            m_shape_repetitions[shape] = definition.shapes[shape].num_repetitions;
+            m_shapes[shape].clear();
+            if (m_shape_repetitions[shape] == 0)
+                continue;
+
+            // a sawtooth shape has only one of the two chirps, the other one throws
+            for (const bool down : {false, true})
+            {
+                try
+                {
+                    const auto format = extractor.get_frame_format(shape, down);
+                    const auto num_rx = static_cast<uint32_t>(std::bitset<8>(format.rx_mask).count());
+                    m_shapes[shape].push_back({format.num_samples_per_chirp, num_rx});
+                }
+                catch (const Parameter_Extractor::Error&)
+                {
+                }
+            }
+        }
+        m_set_repetitions = definition.shape_set.num_repetitions;
+        m_max_frames = definition.num_frames;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Frame start ignored, the registers hold no valid frame: " << e.what() << std::endl;
+        return;
+    }
+
+    double frame_period = fallback_frame_period;
+    try
+    {
+        const auto sequence = TimingModel::StateSequence::create(register_set, device_type, reference_clock);
+        const double ticks = sequence->getFrameDuration();
+        if (ticks > 0)
+            frame_period = ticks / reference_clock;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Frame timing could not be determined, using " << fallback_frame_period << "s: " << e.what() << std::endl;
+    }
+
+    m_frame_period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(frame_period));
+    m_next_frame = Clock::now() + m_frame_period;
+    m_frame_count = 0;
+    m_running = true;
+}
+
+void AvianSimulator::stop_frames()
+{
+    m_running = false;
+}
+
+void AvianSimulator::generate_frame()
+{
+    uint32_t chirp_index = 0;
+    for (uint16_t set = 0; set < m_set_repetitions; set++)
+    {
+        for (uint8_t shape = 0; shape < 4; shape++)
+        {
+            for (uint16_t repetition = 0; repetition < m_shape_repetitions[shape]; repetition++)
+            {
+                for (const auto& chirp : m_shapes[shape])
+                {
+                    m_chirp.resize(size_t(chirp.num_samples) * chirp.num_rx);
+                    m_source->generate_chirp(m_frame_count, chirp_index++, chirp.num_samples, chirp.num_rx, m_chirp.data());
+                    m_fifo.insert(m_fifo.end(), m_chirp.begin(), m_chirp.end());
+                }
+            }
+        }
+    }
+    m_frame_count++;
+}
+
+void AvianSimulator::measure_sadc(uint32_t sadc_ctrl)
+{
+    // only the temperature sensor on channel 0 delivers a value, the busy flag is never set
+    uint32_t result = 0;
+    if ((sadc_ctrl & sadc_ctrl_chsel_msk) == 0)
+    {
+        const float voltage = temperature_sensor_offset + temperature_sensor_slope * temperature;
+        result = static_cast<uint32_t>(std::lround(voltage * 1023.f / sadc_ref_voltage));
+    }
+    m_registers[reg_sadc_result] = result;
+}
+
+uint32_t AvianSimulator::get_fifo_status() const
+{
+    const auto words = static_cast<uint32_t>((m_fifo.size() - m_fifo_head + 1) / 2);
+    const uint32_t cref = m_registers[reg_sfctl] & sfctl_fifo_cref_msk;
+
+    uint32_t status = std::min(words, fstat_fill_status_msk);
+    if (words == 0)
+        status |= fstat_empty;
+    else if (words >= cref)
+        status |= fstat_cref;
+    if (words >= get_fifo_capacity() / 2)
+        status |= fstat_full;
+    if (m_fifo_overflow)
+        status |= fstat_fof_err;
+    return status;
+}
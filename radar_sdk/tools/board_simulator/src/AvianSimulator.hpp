@@ -0,0 +1,139 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file AvianSimulator.hpp
+ *
+ * @brief Register level model of a BGT60TR13C radar sensor.
+ */
+
+#pragma once
+
+#include "SampleSource.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+/* Simulated BGT60TR13C as seen through its SPI interface.
+ *
+ * The register file accepts everything the host writes, only a few registers
+ * have a function:
+ * - CHIP_ID identifies the device as BGT60TR13C
+ * - MAIN starts the frame generation (FRAME_START) and resets the state
+ *   machine and the FIFO (SW_RESET, FSM_RESET, FIFO_RESET)
+ * - SADC_CTRL / SADC_RESULT measure a constant temperature
+ * - STAT0, STAT1 and FSTAT report the device status
+ *
+ * When a frame is started, the shapes, chirps, samples and RX antennas of a
+ * frame are taken from the programmed registers with the Parameter_Extractor
+ * of lib_avian, the frame repetition time with its timing model. update()
+ * then writes the samples of each frame that is due into the FIFO, from where
+ * they are read in slices like the firmware of a board does.
+ *
+ * All methods may be called from different threads.
+ */
+class AvianSimulator
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint8_t num_registers = 0x60;
+    static constexpr uint8_t fifo_address = 0x60;
+
+    explicit AvianSimulator(std::unique_ptr<SampleSource> source);
+
+    /* Executes one SPI command word (address in bits 31..25, write flag in
+     * bit 24, data in bits 23..0) and returns the response word (GSR0 in
+     * bits 31..24, the register content before the access in bits 23..0).
+     */
+    uint32_t execute(uint32_t command);
+
+    uint32_t read_register(uint8_t address);
+    void write_register(uint8_t address, uint32_t value);
+    void set_bits(uint8_t address, uint32_t mask);
+
+    /* Reset through the reset pin, all registers get their default values */
+    void reset();
+
+    /* The IRQ pin signals that the FIFO holds at least FIFO_CREF words */
+    bool get_irq_level();
+
+    /* Generates all frames that are due at time now and returns the time
+     * when the next frame is due (Clock::time_point::max() when there is no
+     * frame generation running).
+     */
+    Clock::time_point update(Clock::time_point now);
+
+    /* Takes count samples out of the FIFO, returns false if there are less */
+    bool read_fifo(size_t count, uint16_t* samples);
+
+    /* Returns true once after the FIFO overflowed */
+    bool check_overflow();
+
+private:
+    struct Chirp
+    {
+        uint32_t num_samples;
+        uint32_t num_rx;
+    };
+
+    uint32_t access(uint8_t address, bool write, uint32_t value);
+    void reset_registers();
+    void start_frames();
+    void stop_frames();
+    void generate_frame();
+    void measure_sadc(uint32_t sadc_ctrl);
+    uint32_t get_fifo_status() const;
+
+    std::mutex m_mutex;
+    std::unique_ptr<SampleSource> m_source;
+    std::array<uint32_t, num_registers> m_registers;
+
+    // frame generation, derived from the registers when FRAME_START is set
+    bool m_running = false;
+    std::array<std::vector<Chirp>, 4> m_shapes;
+    std::array<uint16_t, 4> m_shape_repetitions = {};
+    uint16_t m_set_repetitions = 0;
+    uint16_t m_max_frames = 0;
+    uint32_t m_frame_count = 0;
+    Clock::duration m_frame_period {};
+    Clock::time_point m_next_frame;
+
+    // the FIFO holds 12 bit samples, they are consumed from m_fifo_head onwards
+    std::vector<uint16_t> m_fifo;
+    size_t m_fifo_head = 0;
+    bool m_fifo_overflow = false;
+    bool m_overflow_event = false;
+    std::vector<uint16_t> m_chirp;
+};
@@ -0,0 +1,904 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file BridgeSimulator.cpp
+ *
+ * @brief Radar baseboard answering the Strata bridge protocol over Ethernet.
+ */
+
+#include "BridgeSimulator.hpp"
+
+#include <common/Serialization.hpp>
+#include <common/Time.hpp>
+#include <components/radar/TypeSerialization.hpp>
+#include <components/radar/TypeSerializationSize.hpp>
+#include <universal/components/radar.h>
+#include <universal/components/radar/iradaravian.h>
+#include <universal/components/subinterfaces.h>
+#include <universal/components/subinterfaces/ipins.h>
+#include <universal/components/subinterfaces/iprotocol.h>
+#include <universal/components/subinterfaces/iregisters.h>
+#include <universal/data_definitions.h>
+#include <universal/error_definitions.h>
+#include <universal/link_definitions.h>
+#include <universal/protocol/protocol_definitions.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+namespace {
+
+constexpr uint16_t firmware_version[4] = {3, 2, 0, 0};
+constexpr const char* board_name = "Radar Baseboard MCU7 (simulated)";
+constexpr const char* extended_version = "Radar Baseboard MCU7 simulator";
+
+constexpr size_t request_header_size = 8;
+constexpr size_t response_header_size = 4;
+constexpr size_t packet_header_size = 6;
+constexpr size_t timestamp_size = sizeof(uint64_t);
+
+constexpr uint8_t data_index = 0;
+constexpr int listen_backlog = 1;
+constexpr auto poll_interval = std::chrono::milliseconds(100);
+
+void check(int result, const char* what)
+{
+    if (result < 0)
+        throw std::system_error(errno, std::generic_category(), what);
+}
+
+int open_socket(int type, const sockaddr_in& address)
+{
+    const int fd = socket(AF_INET, type, 0);
+    check(fd, "socket");
+
+    const int enable = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    if (type == SOCK_DGRAM)
+        setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0)
+    {
+        const int error = errno;
+        close(fd);
+        throw std::system_error(error, std::generic_category(), "bind");
+    }
+    if (type == SOCK_STREAM)
+        check(listen(fd, listen_backlog), "listen");
+
+    return fd;
+}
+
+void close_socket(int& fd)
+{
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+}
+
+bool send_all(int fd, const uint8_t* data, size_t length)
+{
+    while (length)
+    {
+        const auto sent = send(fd, data, length, MSG_NOSIGNAL);
+        if (sent <= 0)
+            return false;
+        data += sent;
+        length -= sent;
+    }
+    return true;
+}
+
+uint8_t* pack(const uint16_t* samples, size_t count, uint8_t format, uint8_t* it)
+{
+    if (format == DataFormat_Raw16)
+    {
+        for (size_t i = 0; i < count; i++)
+            it = hostToSerial(it, samples[i]);
+        return it;
+    }
+
+    // two 12 bit samples in three bytes, big endian like the FIFO of the device
+    size_t i = 0;
+    for (; i + 1 < count; i += 2)
+    {
+        *it++ = static_cast<uint8_t>(samples[i] >> 4);
+        *it++ = static_cast<uint8_t>((samples[i] << 4) | (samples[i + 1] >> 8));
+        *it++ = static_cast<uint8_t>(samples[i + 1]);
+    }
+    if (i < count)
+    {
+        *it++ = static_cast<uint8_t>(samples[i] >> 4);
+        *it++ = static_cast<uint8_t>(samples[i] << 4);
+    }
+    return it;
+}
+
+}  // namespace
+
+
+BridgeSimulator::BridgeSimulator(AvianSimulator& device, const std::string& address,
+                                 const Impairments& impairments, uint32_t seed) :
+    m_device {device},
+    m_address {address},
+    m_impairments {impairments},
+    m_generator {seed}
+{
+    in_addr ip = {};
+    if (inet_pton(AF_INET, address.c_str(), &ip) != 1)
+        throw std::invalid_argument("invalid IPv4 address: " + address);
+
+    // the UUID has to differ between simulators running at the same time, so it contains the address
+    m_uuid = {0x53, 0x49, 0x4D, 0x55, 0x4C, 0x41, 0x54, 0x45, 0x44, 0x00, 0x00, 0x00};
+    std::memcpy(&m_uuid[12], &ip.s_addr, sizeof(ip.s_addr));
+}
+
+BridgeSimulator::~BridgeSimulator()
+{
+    stop();
+}
+
+void BridgeSimulator::start()
+{
+    if (m_running)
+        return;
+
+    sockaddr_in control = {};
+    control.sin_family = AF_INET;
+    inet_pton(AF_INET, m_address.c_str(), &control.sin_addr);
+    control.sin_port = htons(ETHERNET_CONTROL_PORT);
+
+    sockaddr_in data = control;
+    data.sin_port = htons(ETHERNET_DATA_PORT);
+
+    try
+    {
+        m_udp_control = open_socket(SOCK_DGRAM, control);
+        m_tcp_control = open_socket(SOCK_STREAM, control);
+        m_udp_data = open_socket(SOCK_DGRAM, data);
+        m_tcp_data = open_socket(SOCK_STREAM, data);
+    }
+    catch (...)
+    {
+        close_socket(m_udp_control);
+        close_socket(m_tcp_control);
+        close_socket(m_udp_data);
+        close_socket(m_tcp_data);
+        throw;
+    }
+
+    m_running = true;
+    m_control_thread = std::thread(&BridgeSimulator::serve_control, this);
+    m_data_thread = std::thread(&BridgeSimulator::serve_data, this);
+}
+
+void BridgeSimulator::stop()
+{
+    if (!m_running)
+        return;
+
+    m_running = false;
+    m_control_thread.join();
+    m_data_thread.join();
+
+    close_socket(m_tcp_control_client);
+    close_socket(m_tcp_data_client);
+    close_socket(m_udp_control);
+    close_socket(m_tcp_control);
+    close_socket(m_udp_data);
+    close_socket(m_tcp_data);
+    m_has_udp_data_peer = false;
+}
+
+std::vector<uint8_t> BridgeSimulator::process_request(const uint8_t* request, size_t length)
+{
+    std::vector<uint8_t> response(response_header_size);
+    uint8_t status;
+
+    if (length < request_header_size)
+    {
+        response[0] = length ? request[0] : 0;
+        status = STATUS_HEADER_INCOMPLETE;
+    }
+    else
+    {
+        Request req;
+        req.bmReqType = request[0];
+        req.bRequest = request[1];
+        req.wValue = serialToHost<uint16_t>(request + 2);
+        req.wIndex = serialToHost<uint16_t>(request + 4);
+        req.wLength = serialToHost<uint16_t>(request + 6);
+        req.payload = request + request_header_size;
+        req.payload_length = static_cast<uint16_t>(length - request_header_size);
+        response[0] = req.bmReqType;
+
+        if ((req.bmReqType == VENDOR_REQ_WRITE) || (req.bmReqType == VENDOR_REQ_TRANSFER))
+        {
+            status = (req.payload_length < req.wLength) ? STATUS_PAYLOAD_INCOMPLETE : dispatch(req, response);
+        }
+        else if (req.bmReqType == VENDOR_REQ_READ)
+        {
+            status = dispatch(req, response);
+            if ((status == STATUS_SUCCESS) && (response.size() - response_header_size != req.wLength))
+                status = STATUS_REQUEST_WLENGTH_INVALID;
+        }
+        else
+        {
+            status = STATUS_REQUEST_TYPE_INVALID;
+        }
+    }
+
+    if (status != STATUS_SUCCESS)
+        response.resize(response_header_size);
+
+    response[1] = status;
+    hostToSerial(&response[2], static_cast<uint16_t>(response.size() - response_header_size));
+    return response;
+}
+
+uint8_t BridgeSimulator::dispatch(const Request& request, std::vector<uint8_t>& response)
+{
+    switch (request.bRequest)
+    {
+        case REQ_BOARD_INFO:
+            return handle_board_info(request, response);
+        case REQ_DATA:
+            return handle_data(request, response);
+        case CMD_COMPONENT:
+            return handle_component(request, response);
+        case REQ_SPI:
+            // the board configures the SPI of the device itself, the settings of the host are accepted
+            return (request.bmReqType == VENDOR_REQ_WRITE) ? STATUS_SUCCESS : STATUS_REQUEST_TYPE_INVALID;
+        default:
+            return STATUS_REQUEST_NOT_IMPLEMENTED;
+    }
+}
+
+uint8_t BridgeSimulator::handle_board_info(const Request& request, std::vector<uint8_t>& response)
+{
+    switch (request.wValue)
+    {
+        case REQ_BOARD_INFO_BOARD_INFO_WVALUE:
+        {
+            if (request.bmReqType != VENDOR_REQ_TRANSFER)
+                return STATUS_REQUEST_TYPE_INVALID;
+
+            response.resize(response_header_size + 2 * sizeof(uint16_t));
+            auto it = hostToSerial(&response[response_header_size], vid);
+            hostToSerial(it, pid);
+            response.insert(response.end(), board_name, board_name + std::strlen(board_name) + 1);
+            break;
+        }
+        case REQ_BOARD_INFO_VERSION_INFO_WVALUE:
+        {
+            if (request.bmReqType != VENDOR_REQ_READ)
+                return STATUS_REQUEST_TYPE_INVALID;
+
+            const uint16_t version[8] = {firmware_version[0], firmware_version[1], firmware_version[2], firmware_version[3],
+                                         PROTOCOL_VERSION_MAJOR, PROTOCOL_VERSION_MINOR, 0, 0};
+            response.resize(response_header_size + sizeof(version));
+            hostToSerial(&response[response_header_size], version);
+            break;
+        }
+        case REQ_BOARD_INFO_UUID_WVALUE:
+            if (request.bmReqType != VENDOR_REQ_READ)
+                return STATUS_REQUEST_TYPE_INVALID;
+
+            response.insert(response.end(), m_uuid.begin(), m_uuid.end());
+            break;
+        case REQ_BOARD_INFO_EXTENDED_VERSION_WVALUE:
+            if (request.bmReqType != VENDOR_REQ_TRANSFER)
+                return STATUS_REQUEST_TYPE_INVALID;
+
+            response.insert(response.end(), extended_version, extended_version + std::strlen(extended_version) + 1);
+            break;
+        case REQ_BOARD_INFO_ERROR_INFO_WVALUE:
+            if (request.bmReqType != VENDOR_REQ_READ)
+                return STATUS_REQUEST_TYPE_INVALID;
+
+            // there are no errors to report
+            response.resize(response_header_size + request.wLength);
+            break;
+        default:
+            return STATUS_REQUEST_WVALUE_INVALID;
+    }
+    return STATUS_SUCCESS;
+}
+
+uint8_t BridgeSimulator::handle_data(const Request& request, std::vector<uint8_t>& response)
+{
+    if (request.wIndex != data_index)
+        return STATUS_REQUEST_WINDEX_INVALID;
+
+    if (request.bmReqType == VENDOR_REQ_READ)
+    {
+        if (request.wValue != REQ_DATA_STATUS_FLAGS)
+            return STATUS_REQUEST_WVALUE_INVALID;
+
+        response.resize(response_header_size + sizeof(uint32_t));
+        hostToSerial(&response[response_header_size], uint32_t(0));
+        return STATUS_SUCCESS;
+    }
+    if (request.bmReqType != VENDOR_REQ_WRITE)
+        return STATUS_REQUEST_TYPE_INVALID;
+
+    switch (request.wValue)
+    {
+        case REQ_DATA_CONFIGURE:
+        {
+            constexpr auto properties_size = serialized_sizeof(IDataProperties_t());
+            constexpr auto entry_size = 2 * sizeof(uint16_t);
+            if ((request.wLength < properties_size + entry_size) || ((request.wLength - properties_size) % entry_size))
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            IDataProperties_t properties;
+            auto it = serialToHost(request.payload, &properties);
+            if ((properties.format != DataFormat_Packed12) && (properties.format != DataFormat_Raw16))
+                return E_INVALID_PARAMETER;
+
+            // the board reads the whole slice from the FIFO, other readout addresses than the FIFO are not supported
+            const auto address = serialToHost<uint16_t>(it);
+            const auto count = serialToHost<uint16_t>(it + 2);
+            if ((address != AvianSimulator::fifo_address) || (count == 0))
+                return E_INVALID_PARAMETER;
+
+            uint16_t aggregation = 1;
+            const auto end = request.payload + request.wLength;
+            for (it += entry_size; it < end; it += entry_size)
+            {
+                // an entry with a count of zero specifies the aggregation of several slices into one data frame
+                if (serialToHost<uint16_t>(it + 2) != 0)
+                    return E_INVALID_PARAMETER;
+                aggregation = serialToHost<uint16_t>(it) + 1;
+            }
+
+            std::lock_guard<std::mutex> lock(m_data_mutex);
+            m_data_format = properties.format;
+            m_slice_size = count;
+            m_aggregation = aggregation;
+            break;
+        }
+        case REQ_DATA_START:
+        {
+            std::lock_guard<std::mutex> lock(m_data_mutex);
+            if (!m_slice_size)
+                return E_NOT_CONFIGURED;
+            m_data_started = true;
+            break;
+        }
+        case REQ_DATA_STOP:
+            set_data_started(false);
+            break;
+        default:
+            return STATUS_REQUEST_WVALUE_INVALID;
+    }
+    return STATUS_SUCCESS;
+}
+
+uint8_t BridgeSimulator::handle_component(const Request& request, std::vector<uint8_t>& response)
+{
+    if (request.wValue == 0)
+    {
+        // component count for the type given in wIndex
+        if (request.bmReqType != VENDOR_REQ_READ)
+            return STATUS_REQUEST_TYPE_INVALID;
+
+        response.push_back((request.wIndex == COMPONENT_TYPE_RADAR_AVIAN) ? 1 : 0);
+        return STATUS_SUCCESS;
+    }
+    if (request.wValue == (COMPONENT_TYPE_RADAR_AVIAN >> 8))
+    {
+        // implementation of the radar component with the id given in wIndex
+        if (request.bmReqType != VENDOR_REQ_READ)
+            return STATUS_REQUEST_TYPE_INVALID;
+        if (request.wIndex != 0)
+            return STATUS_COMMAND_ID_INVALID;
+
+        response.push_back(COMPONENT_TYPE_RADAR_AVIAN & 0xFF);
+        return STATUS_SUCCESS;
+    }
+
+    if (CMD_GET_TYPE(request.wValue) != COMPONENT_TYPE_RADAR_AVIAN)
+        return STATUS_COMMAND_TYPE_INVALID;
+    if (CMD_GET_ID(request.wIndex) != 0)
+        return STATUS_COMMAND_ID_INVALID;
+
+    const uint8_t function = CMD_GET_FUNCTION(request.wIndex);
+    switch (CMD_GET_SUBIF(request.wIndex))
+    {
+        case COMPONENT_SUBIF_DEFAULT:
+            return handle_radar(request, function, response);
+        case COMPONENT_SUBIF_REGISTERS:
+            return handle_registers(request, function, response);
+        case COMPONENT_SUBIF_PINS:
+            return handle_pins(request, function, response);
+        case COMPONENT_SUBIF_PROTOCOL:
+            return handle_protocol(request, function, response);
+        default:
+            return STATUS_COMMAND_SUBIF_INVALID;
+    }
+}
+
+uint8_t BridgeSimulator::handle_radar(const Request& request, uint8_t function, std::vector<uint8_t>& response)
+{
+    switch (function)
+    {
+        case FN_RADAR_AVIAN_RESET:
+        case FN_RADAR_AVIAN_INITIALIZE:
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            m_device.reset();
+            break;
+        case FN_RADAR_AVIAN_GET_DATA_INDEX:
+            if (request.bmReqType != VENDOR_REQ_READ)
+                return STATUS_REQUEST_TYPE_INVALID;
+            response.push_back(data_index);
+            break;
+        case FN_RADAR_AVIAN_START_DATA:
+        case FN_RADAR_AVIAN_STOP_DATA:
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            set_data_started(function == FN_RADAR_AVIAN_START_DATA);
+            break;
+        default:
+            return STATUS_COMMAND_FUNCTION_INVALID;
+    }
+    return STATUS_SUCCESS;
+}
+
+uint8_t BridgeSimulator::handle_registers(const Request& request, uint8_t function, std::vector<uint8_t>& response)
+{
+    constexpr uint16_t address_size = sizeof(uint8_t);
+    constexpr uint16_t value_size = sizeof(uint32_t);
+    const uint8_t* payload = request.payload;
+
+    switch (function)
+    {
+        case FN_REGISTERS_CLEAR_BITS:
+        case FN_REGISTERS_SET_BITS:
+        {
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            if (request.wLength != address_size + value_size)
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            const auto address = payload[0];
+            const auto mask = serialToHost<uint32_t>(payload + address_size);
+            const auto value = m_device.read_register(address);
+            m_device.write_register(address, (function == FN_REGISTERS_SET_BITS) ? (value | mask) : (value & ~mask));
+            break;
+        }
+        case FN_REGISTERS_MODIFY_BITS:
+        {
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            if (request.wLength != address_size + 2 * value_size)
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            const auto address = payload[0];
+            const auto clear = serialToHost<uint32_t>(payload + address_size);
+            const auto set = serialToHost<uint32_t>(payload + address_size + value_size);
+            m_device.write_register(address, (m_device.read_register(address) & ~clear) | set);
+            break;
+        }
+        case FN_REGISTERS_WRITE_BURST:
+        {
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            if ((request.wLength < address_size) || ((request.wLength - address_size) % value_size))
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            // the values are followed by the start address
+            const uint16_t count = (request.wLength - address_size) / value_size;
+            uint8_t address = payload[count * value_size];
+            for (uint16_t i = 0; i < count; i++)
+                m_device.write_register(address++, serialToHost<uint32_t>(payload + i * value_size));
+            break;
+        }
+        case FN_REGISTERS_READ_BURST:
+        {
+            if (request.bmReqType != VENDOR_REQ_TRANSFER)
+                return STATUS_REQUEST_TYPE_INVALID;
+            if (request.wLength != 2 * address_size)
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            const uint8_t count = payload[0];
+            uint8_t address = payload[1];
+            response.resize(response_header_size + count * value_size);
+            auto it = &response[response_header_size];
+            for (uint8_t i = 0; i < count; i++)
+                it = hostToSerial(it, m_device.read_register(address++));
+            break;
+        }
+        case FN_REGISTERS_BATCH:
+            if (request.bmReqType == VENDOR_REQ_WRITE)
+            {
+                if (request.wLength % (address_size + value_size))
+                    return STATUS_REQUEST_WLENGTH_INVALID;
+
+                for (auto it = payload; it < payload + request.wLength; it += address_size + value_size)
+                    m_device.write_register(it[0], serialToHost<uint32_t>(it + address_size));
+            }
+            else if (request.bmReqType == VENDOR_REQ_TRANSFER)
+            {
+                response.resize(response_header_size + request.wLength * value_size);
+                auto it = &response[response_header_size];
+                for (uint16_t i = 0; i < request.wLength; i++)
+                    it = hostToSerial(it, m_device.read_register(payload[i]));
+            }
+            else
+            {
+                return STATUS_REQUEST_TYPE_INVALID;
+            }
+            break;
+        default:
+            return STATUS_COMMAND_FUNCTION_INVALID;
+    }
+    return STATUS_SUCCESS;
+}
+
+uint8_t BridgeSimulator::handle_pins(const Request& request, uint8_t function, std::vector<uint8_t>& response)
+{
+    switch (function)
+    {
+        case FN_PINS_SET_RESET_PIN:
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            if (request.wLength != sizeof(uint8_t))
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            // the reset pin is active low
+            if (!request.payload[0])
+                m_device.reset();
+            break;
+        case FN_PINS_RESET:
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            m_device.reset();
+            break;
+        case FN_PINS_GET_IRQ:
+            if (request.bmReqType != VENDOR_REQ_READ)
+                return STATUS_REQUEST_TYPE_INVALID;
+            response.push_back(m_device.get_irq_level() ? 1 : 0);
+            break;
+        default:
+            return STATUS_COMMAND_FUNCTION_INVALID;
+    }
+    return STATUS_SUCCESS;
+}
+
+uint8_t BridgeSimulator::handle_protocol(const Request& request, uint8_t function, std::vector<uint8_t>& response)
+{
+    constexpr uint16_t word_size = sizeof(uint32_t);
+
+    switch (function)
+    {
+        case FN_PROTOCOL_EXECUTE:
+        {
+            if ((request.bmReqType != VENDOR_REQ_WRITE) && (request.bmReqType != VENDOR_REQ_TRANSFER))
+                return STATUS_REQUEST_TYPE_INVALID;
+            if (request.wLength % word_size)
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            // the commands are sent in SPI byte order, the results are returned in little endian
+            const uint16_t count = request.wLength / word_size;
+            const bool transfer = (request.bmReqType == VENDOR_REQ_TRANSFER);
+            if (transfer)
+                response.resize(response_header_size + count * word_size);
+
+            for (uint16_t i = 0; i < count; i++)
+            {
+                const uint8_t* it = request.payload + i * word_size;
+                const uint32_t command = (uint32_t(it[0]) << 24) | (uint32_t(it[1]) << 16) | (uint32_t(it[2]) << 8) | it[3];
+                const uint32_t result = m_device.execute(command);
+                if (transfer)
+                    hostToSerial(&response[response_header_size + i * word_size], result);
+            }
+            break;
+        }
+        case FN_PROTOCOL_SET_BITS:
+        {
+            if (request.bmReqType != VENDOR_REQ_WRITE)
+                return STATUS_REQUEST_TYPE_INVALID;
+            if (request.wLength != word_size)
+                return STATUS_REQUEST_WLENGTH_INVALID;
+
+            const auto value = serialToHost<uint32_t>(request.payload);
+            m_device.set_bits(static_cast<uint8_t>(value >> 24), value & 0x00FFFFFF);
+            break;
+        }
+        default:
+            return STATUS_COMMAND_FUNCTION_INVALID;
+    }
+    return STATUS_SUCCESS;
+}
+
+void BridgeSimulator::set_data_started(bool started)
+{
+    std::lock_guard<std::mutex> lock(m_data_mutex);
+    m_data_started = started && m_slice_size;
+}
+
+void BridgeSimulator::serve_control()
+{
+    std::vector<uint8_t> request(ETH_TCP_MAX_PAYLOAD);
+
+    while (m_running)
+    {
+        pollfd fds[] = {
+            {m_udp_control, POLLIN, 0},
+            {m_tcp_control, POLLIN, 0},
+            {m_tcp_control_client, POLLIN, 0},
+        };
+        const nfds_t count = (m_tcp_control_client >= 0) ? 3 : 2;
+        if (poll(fds, count, poll_interval.count()) <= 0)
+            continue;
+
+        if (fds[0].revents & POLLIN)
+        {
+            sockaddr_in peer = {};
+            socklen_t peer_length = sizeof(peer);
+            const auto received = recvfrom(m_udp_control, request.data(), request.size(), 0,
+                                           reinterpret_cast<sockaddr*>(&peer), &peer_length);
+            if (received >= 0)
+            {
+                const auto response = process_request(request.data(), received);
+                sendto(m_udp_control, response.data(), response.size(), 0,
+                       reinterpret_cast<const sockaddr*>(&peer), peer_length);
+            }
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            // like the firmware there is only one host connected at a time, the last one wins
+            const int client = accept(m_tcp_control, nullptr, nullptr);
+            if (client >= 0)
+            {
+                close_socket(m_tcp_control_client);
+                m_tcp_control_client = client;
+                continue;
+            }
+        }
+
+        if ((count > 2) && (fds[2].revents & (POLLIN | POLLHUP | POLLERR)))
+            receive_tcp_request();
+    }
+}
+
+void BridgeSimulator::receive_tcp_request()
+{
+    uint8_t header[request_header_size];
+    if (recv(m_tcp_control_client, header, sizeof(header), MSG_WAITALL) != sizeof(header))
+    {
+        close_socket(m_tcp_control_client);
+        return;
+    }
+
+    // in stream mode only requests sending data to the board are followed by a payload
+    const uint8_t bmReqType = header[0];
+    const uint16_t wLength = serialToHost<uint16_t>(header + 6);
+    const size_t payload_length = ((bmReqType == VENDOR_REQ_WRITE) || (bmReqType == VENDOR_REQ_TRANSFER)) ? wLength : 0;
+
+    std::vector<uint8_t> request(request_header_size + payload_length);
+    std::copy(header, header + request_header_size, request.begin());
+    if (payload_length && (recv(m_tcp_control_client, &request[request_header_size], payload_length, MSG_WAITALL) != ssize_t(payload_length)))
+    {
+        close_socket(m_tcp_control_client);
+        return;
+    }
+
+    const auto response = process_request(request.data(), request.size());
+    if (!send_all(m_tcp_control_client, response.data(), response.size()))
+        close_socket(m_tcp_control_client);
+}
+
+void BridgeSimulator::serve_data()
+{
+    uint8_t dump[ETH_UDP_MAX_PAYLOAD];
+
+    while (m_running)
+    {
+        const auto next_frame = m_device.update(AvianSimulator::Clock::now());
+
+        if (m_device.check_overflow())
+        {
+            uint8_t error[sizeof(uint32_t)];
+            hostToSerial(error, uint32_t(E_OVERFLOW));
+            send_frame(error, sizeof(error), DATA_FRAME_FLAG_ERROR);
+        }
+        read_out_fifo();
+
+        const auto now = AvianSimulator::Clock::now();
+        const auto timeout = (next_frame > now + poll_interval) ? poll_interval
+                                                                 : std::chrono::duration_cast<std::chrono::milliseconds>(next_frame - now);
+
+        pollfd fds[] = {
+            {m_udp_data, POLLIN, 0},
+            {m_tcp_data, POLLIN, 0},
+            {m_tcp_data_client, POLLIN, 0},
+        };
+        const nfds_t count = (m_tcp_data_client >= 0) ? 3 : 2;
+        if (poll(fds, count, std::max<int>(0, timeout.count())) <= 0)
+            continue;
+
+        if (fds[0].revents & POLLIN)
+        {
+            // the host sends an empty datagram to tell where the data shall be sent to
+            sockaddr_in peer = {};
+            socklen_t peer_length = sizeof(peer);
+            if (recvfrom(m_udp_data, dump, sizeof(dump), 0, reinterpret_cast<sockaddr*>(&peer), &peer_length) >= 0)
+            {
+                m_udp_data_peer = peer;
+                m_has_udp_data_peer = true;
+                close_socket(m_tcp_data_client);
+            }
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            const int client = accept(m_tcp_data, nullptr, nullptr);
+            if (client >= 0)
+            {
+                close_socket(m_tcp_data_client);
+                m_tcp_data_client = client;
+                m_has_udp_data_peer = false;
+            }
+        }
+        else if ((count > 2) && (fds[2].revents & (POLLIN | POLLHUP | POLLERR)))
+        {
+            // the host does not send anything on the data channel, so this is the end of the connection
+            if (recv(m_tcp_data_client, dump, sizeof(dump), 0) <= 0)
+                close_socket(m_tcp_data_client);
+        }
+    }
+
+    flush_held_packet();
+}
+
+void BridgeSimulator::read_out_fifo()
+{
+    uint8_t format;
+    size_t count;
+    {
+        std::lock_guard<std::mutex> lock(m_data_mutex);
+        if (!m_data_started)
+            return;
+        format = m_data_format;
+        count = size_t(m_slice_size) * m_aggregation;
+    }
+
+    m_samples.resize(count);
+    m_frame.resize((format == DataFormat_Raw16) ? count * sizeof(uint16_t) : (count * 3 + 1) / 2);
+
+    bool first = true;
+    while (m_device.read_fifo(count, m_samples.data()))
+    {
+        // the delay only applies once per update, frames that are already late are sent right away
+        if (first && (m_impairments.jitter.count() > 0))
+        {
+            std::uniform_int_distribution<int64_t> delay(0, m_impairments.jitter.count());
+            std::this_thread::sleep_for(std::chrono::microseconds(delay(m_generator)));
+        }
+        first = false;
+
+        pack(m_samples.data(), count, format, m_frame.data());
+        send_frame(m_frame.data(), m_frame.size(), 0);
+    }
+}
+
+void BridgeSimulator::send_frame(const uint8_t* data, size_t length, uint8_t flags)
+{
+    const bool udp = (m_tcp_data_client < 0);
+    if (udp && !m_has_udp_data_peer)
+        return;
+
+    // the time stamp is appended to the frame, it ends up in the last packet
+    std::vector<uint8_t> frame(data, data + length);
+    frame.resize(length + timestamp_size);
+    const auto timestamp = static_cast<uint64_t>(getEpochTime());
+    auto it = hostToSerial(&frame[length], static_cast<uint32_t>(timestamp));
+    hostToSerial(it, static_cast<uint32_t>(timestamp >> 32));
+
+    const size_t max_payload = (udp ? ETH_UDP_MAX_PAYLOAD : ETH_TCP_MAX_PAYLOAD) - packet_header_size;
+    for (size_t offset = 0; offset < frame.size(); offset += max_payload)
+    {
+        const size_t payload_length = std::min(max_payload, frame.size() - offset);
+        const bool last = (offset + payload_length == frame.size());
+
+        uint8_t bmPktType = DATA_FRAME_PACKET;
+        if (offset == 0)
+            bmPktType |= DATA_FRAME_FLAG_FIRST;
+        if (last)
+            bmPktType |= DATA_FRAME_FLAG_LAST | DATA_FRAME_FLAG_TIMESTAMP | flags;
+
+        std::vector<uint8_t> packet(packet_header_size + payload_length);
+        packet[0] = bmPktType;
+        packet[1] = 0;  // bChannel
+        hostToSerial(&packet[2], m_packet_counter++);
+        hostToSerial(&packet[4], static_cast<uint16_t>(payload_length));
+        std::copy(&frame[offset], &frame[offset] + payload_length, &packet[packet_header_size]);
+
+        send_packet(std::move(packet));
+    }
+}
+
+void BridgeSimulator::send_packet(std::vector<uint8_t>&& packet)
+{
+    // a lost packet still counts, so the host notices the gap
+    if (m_uniform(m_generator) < m_impairments.packet_loss)
+        return;
+
+    if (!m_held_packet.empty())
+    {
+        transmit(packet);
+        flush_held_packet();
+    }
+    else if (m_uniform(m_generator) < m_impairments.reordering)
+    {
+        m_held_packet = std::move(packet);
+    }
+    else
+    {
+        transmit(packet);
+    }
+}
+
+void BridgeSimulator::flush_held_packet()
+{
+    if (!m_held_packet.empty())
+    {
+        transmit(m_held_packet);
+        m_held_packet.clear();
+    }
+}
+
+void BridgeSimulator::transmit(const std::vector<uint8_t>& packet)
+{
+    if (m_tcp_data_client >= 0)
+    {
+        if (!send_all(m_tcp_data_client, packet.data(), packet.size()))
+            close_socket(m_tcp_data_client);
+    }
+    else if (m_has_udp_data_peer)
+    {
+        sendto(m_udp_data, packet.data(), packet.size(), 0,
+               reinterpret_cast<const sockaddr*>(&m_udp_data_peer), sizeof(m_udp_data_peer));
+    }
+}
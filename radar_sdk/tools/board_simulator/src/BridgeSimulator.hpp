@@ -0,0 +1,158 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file BridgeSimulator.hpp
+ *
+ * @brief Radar baseboard answering the Strata bridge protocol over Ethernet.
+ */
+
+#pragma once
+
+#include "AvianSimulator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+
+
+/* Network impairments applied to the data channel */
+struct Impairments
+{
+    double packet_loss = 0.;                 // probability that a data packet is not sent
+    double reordering = 0.;                  // probability that a data packet is sent after the following one
+    std::chrono::microseconds jitter {0};    // maximum random delay before a data frame is sent
+};
+
+
+/* Simulated Radar Baseboard MCU7 with a BGT60TR13C, reachable over Ethernet.
+ *
+ * Like the firmware of the board it listens on the control port 55055 and
+ * the data port 55056, each with UDP and TCP at the same time, so the host
+ * may connect with BoardEthernetUdp or BoardEthernetTcp. UDP requests to the
+ * control port are also answered when they are broadcast, so the board is
+ * found by the enumeration of BoardManager.
+ *
+ * The control channel handles the board information, data and component
+ * requests that Strata sends to an Avian board. The data channel sends the
+ * samples of the simulated device in slices of the configured readout size
+ * to the host which connected last (the first empty datagram of
+ * BridgeEthernetData tells where to send UDP data to).
+ *
+ * Several simulators may run on one host when each one is bound to a
+ * different address, e.g. 127.0.0.1 and 127.0.0.2.
+ */
+class BridgeSimulator
+{
+public:
+    static constexpr uint16_t vid = 0x058B;
+    static constexpr uint16_t pid = 0x0251;
+
+    BridgeSimulator(AvianSimulator& device, const std::string& address = "0.0.0.0",
+                    const Impairments& impairments = {}, uint32_t seed = 0);
+    ~BridgeSimulator();
+
+    /* Opens the sockets and starts serving, throws std::system_error if a socket cannot be opened */
+    void start();
+    void stop();
+
+    /* Answers one request of the control channel (header and payload) with the response packet */
+    std::vector<uint8_t> process_request(const uint8_t* request, size_t length);
+
+private:
+    struct Request
+    {
+        uint8_t bmReqType;
+        uint8_t bRequest;
+        uint16_t wValue;
+        uint16_t wIndex;
+        uint16_t wLength;
+        const uint8_t* payload;
+        uint16_t payload_length;
+    };
+
+    uint8_t dispatch(const Request& request, std::vector<uint8_t>& response);
+    uint8_t handle_board_info(const Request& request, std::vector<uint8_t>& response);
+    uint8_t handle_data(const Request& request, std::vector<uint8_t>& response);
+    uint8_t handle_component(const Request& request, std::vector<uint8_t>& response);
+    uint8_t handle_radar(const Request& request, uint8_t function, std::vector<uint8_t>& response);
+    uint8_t handle_registers(const Request& request, uint8_t function, std::vector<uint8_t>& response);
+    uint8_t handle_pins(const Request& request, uint8_t function, std::vector<uint8_t>& response);
+    uint8_t handle_protocol(const Request& request, uint8_t function, std::vector<uint8_t>& response);
+
+    void set_data_started(bool started);
+
+    void serve_control();
+    void serve_data();
+    void receive_tcp_request();
+    void read_out_fifo();
+    void send_frame(const uint8_t* data, size_t length, uint8_t flags);
+    void send_packet(std::vector<uint8_t>&& packet);
+    void transmit(const std::vector<uint8_t>& packet);
+    void flush_held_packet();
+
+    AvianSimulator& m_device;
+    std::string m_address;
+    Impairments m_impairments;
+    std::mt19937 m_generator;
+    std::uniform_real_distribution<double> m_uniform {0., 1.};
+    std::array<uint8_t, 16> m_uuid;
+
+    std::atomic<bool> m_running {false};
+    std::thread m_control_thread;
+    std::thread m_data_thread;
+
+    int m_udp_control = -1;
+    int m_tcp_control = -1;
+    int m_tcp_control_client = -1;
+    int m_udp_data = -1;
+    int m_tcp_data = -1;
+    int m_tcp_data_client = -1;
+    sockaddr_in m_udp_data_peer = {};
+    bool m_has_udp_data_peer = false;
+
+    // data configuration, set by the control channel and used by the data channel
+    std::mutex m_data_mutex;
+    uint8_t m_data_format = 0;
+    uint32_t m_slice_size = 0;
+    uint16_t m_aggregation = 1;
+    bool m_data_started = false;
+
+    uint16_t m_packet_counter = 0;
+    std::vector<uint16_t> m_samples;
+    std::vector<uint8_t> m_frame;
+    std::vector<uint8_t> m_held_packet;
+};
@@ -0,0 +1,103 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file SampleSource.cpp
+ *
+ * @brief ADC samples written into the FIFO of the simulated Avian device.
+ */
+
+#include "SampleSource.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace {
+
+constexpr float pi = 3.14159265358979f;
+constexpr float adc_offset = 2048.f;
+constexpr float adc_max = 4095.f;
+
+}  // namespace
+
+SyntheticSource::SyntheticSource(uint32_t seed, float beat_frequency, float doppler, float amplitude, float noise) :
+    m_beat_frequency {beat_frequency},
+    m_doppler {doppler},
+    m_amplitude {amplitude},
+    m_generator {seed},
+    m_noise {0.f, noise}
+{}
+
+void SyntheticSource::generate_chirp(uint32_t /*frame*/, uint32_t /*chirp*/, uint32_t num_samples,
+                                     uint32_t num_rx, uint16_t* samples)
+{
+    // the Doppler phase keeps running from frame to frame, like for a target moving at constant speed
+    m_doppler_phase = std::fmod(m_doppler_phase + m_doppler, 1.f);
+    const float chirp_phase = 2 * pi * m_doppler_phase;
+
+    for (uint32_t s = 0; s < num_samples; s++)
+    {
+        for (uint32_t r = 0; r < num_rx; r++)
+        {
+            const float phase = 2 * pi * m_beat_frequency * s + chirp_phase + r * pi / 4;
+            const float value = adc_offset + m_amplitude * std::cos(phase) + m_noise(m_generator);
+            *samples++ = static_cast<uint16_t>(std::lround(std::min(std::max(value, 0.f), adc_max)));
+        }
+    }
+}
+
+RecordingSource::RecordingSource(const std::string& filename) :
+    m_npy {std::make_unique<NpyFile>(filename)}
+{
+    const auto& shape = m_npy->get_shape();
+    if (shape.size() != 4 || m_npy->get_num_elements() == 0)
+        throw std::runtime_error("radar.npy must hold an array of shape (frames, rx, chirps, samples)");
+
+    m_num_frames = shape[0];
+    m_num_rx = shape[1];
+    m_num_chirps = shape[2];
+    m_num_samples = shape[3];
+}
+
+void RecordingSource::generate_chirp(uint32_t frame, uint32_t chirp, uint32_t num_samples,
+                                     uint32_t num_rx, uint16_t* samples)
+{
+    const uint16_t* recorded_frame = m_npy->get_data() + size_t(frame % m_num_frames) * m_num_rx * m_num_chirps * m_num_samples;
+
+    for (uint32_t s = 0; s < num_samples; s++)
+    {
+        for (uint32_t r = 0; r < num_rx; r++)
+        {
+            const size_t index = (size_t(r % m_num_rx) * m_num_chirps + chirp % m_num_chirps) * m_num_samples + s % m_num_samples;
+            *samples++ = recorded_frame[index];
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file SampleSource.hpp
+ *
+ * @brief ADC samples written into the FIFO of the simulated Avian device.
+ */
+
+#pragma once
+
+#include "ifxFmcw/playback/NpyFile.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+
+
+/* Source of the ADC samples of the simulated device.
+ *
+ * The device asks for the samples of one chirp at a time. They are written
+ * in FIFO order, i.e. for each sample the values of all enabled RX antennas:
+ * samples[s * num_rx + r]. frame counts the frames since the acquisition was
+ * started, chirp the chirps within the frame.
+ */
+class SampleSource
+{
+public:
+    virtual ~SampleSource() = default;
+
+    virtual void generate_chirp(uint32_t frame, uint32_t chirp, uint32_t num_samples,
+                                uint32_t num_rx, uint16_t* samples) = 0;
+};
+
+
+/* Synthetic IF signal of a single moving target plus noise.
+ *
+ * The beat frequency is given in cycles per sample, the Doppler shift as
+ * phase increment from chirp to chirp in cycles. Each RX antenna sees the
+ * signal with an additional phase offset, so the target also has an angle.
+ */
+class SyntheticSource : public SampleSource
+{
+public:
+    explicit SyntheticSource(uint32_t seed = 0, float beat_frequency = 0.1f,
+                             float doppler = 0.02f, float amplitude = 600.f, float noise = 8.f);
+
+    void generate_chirp(uint32_t frame, uint32_t chirp, uint32_t num_samples,
+                        uint32_t num_rx, uint16_t* samples) override;
+
+private:
+    float m_beat_frequency;
+    float m_doppler;
+    float m_amplitude;
+    float m_doppler_phase = 0.f;
+    std::mt19937 m_generator;
+    std::normal_distribution<float> m_noise;
+};
+
+
+/* Replays the frames of a radar.npy recording of shape (frames, rx, chirps, samples).
+ *
+ * All indices wrap around, so the recording is looped and also fills frames
+ * of a configuration that differs from the recorded one.
+ */
+class RecordingSource : public SampleSource
+{
+public:
+    explicit RecordingSource(const std::string& filename);
+
+    void generate_chirp(uint32_t frame, uint32_t chirp, uint32_t num_samples,
+                        uint32_t num_rx, uint16_t* samples) override;
+
+private:
+    std::unique_ptr<NpyFile> m_npy;
+    uint32_t m_num_frames;
+    uint32_t m_num_rx;
+    uint32_t m_num_chirps;
+    uint32_t m_num_samples;
+};
@@ -0,0 +1,144 @@
+/* ===========================================================================
+** Copyright (C) 2024 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file main.cpp
+ *
+ * @brief Command line front end of the board simulator.
+ */
+
+#include "BridgeSimulator.hpp"
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <unistd.h>
+
+
+namespace {
+
+volatile std::sig_atomic_t g_stop = 0;
+
+void on_signal(int)
+{
+    g_stop = 1;
+}
+
+void print_usage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "\n"
+              << "Simulates a Radar Baseboard MCU7 with a BGT60TR13C on the Ethernet ports of the given address.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --address <ip>         address to listen on (default 0.0.0.0)\n"
+              << "  --recording <file>     replay the frames of a radar.npy recording instead of a synthetic target\n"
+              << "  --loss <probability>   probability that a data packet is lost (default 0)\n"
+              << "  --reorder <probability> probability that a data packet is swapped with the next one (default 0)\n"
+              << "  --jitter <ms>          maximum random delay of a data frame (default 0)\n"
+              << "  --seed <value>         seed of the random numbers (default 0)\n"
+              << "  --help                 show this help\n";
+}
+
+}  // namespace
+
+
+int main(int argc, char* argv[])
+{
+    std::string address = "0.0.0.0";
+    std::string recording;
+    Impairments impairments;
+    uint32_t seed = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string option = argv[i];
+        if (option == "--help")
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        if (i + 1 >= argc)
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        const char* value = argv[++i];
+        if (option == "--address")
+            address = value;
+        else if (option == "--recording")
+            recording = value;
+        else if (option == "--loss")
+            impairments.packet_loss = std::atof(value);
+        else if (option == "--reorder")
+            impairments.reordering = std::atof(value);
+        else if (option == "--jitter")
+            impairments.jitter = std::chrono::microseconds(static_cast<int64_t>(std::atof(value) * 1000));
+        else if (option == "--seed")
+            seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 0));
+        else
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    try
+    {
+        std::unique_ptr<SampleSource> source;
+        if (recording.empty())
+            source = std::make_unique<SyntheticSource>(seed);
+        else
+            source = std::make_unique<RecordingSource>(recording);
+
+        AvianSimulator device(std::move(source));
+        BridgeSimulator bridge(device, address, impairments, seed);
+        bridge.start();
+
+        std::signal(SIGINT, on_signal);
+        std::signal(SIGTERM, on_signal);
+        std::cout << "Simulated board listening on " << address << ", press Ctrl+C to stop" << std::endl;
+
+        while (!g_stop)
+            pause();
+
+        bridge.stop();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}